@@ -0,0 +1,66 @@
+#ifndef AUDIO_CAPTURE_H
+#define AUDIO_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mfcc.h"
+
+/**
+ * @brief Captura de audio del micrófono analógico en PA0 (A0, ADC1_IN5).
+ * @note  TIM6 dispara el ADC a MFCC_SAMPLE_RATE y el DMA llena en modo circular
+ *        un buffer de dos mitades de AUDIO_BLOCK_LEN muestras. Cada interrupción
+ *        de media transferencia o transferencia completa deja lista una mitad,
+ *        que el bucle principal procesa mientras el DMA llena la otra.
+ *        El periodo de TIM6 se recalcula en cada cambio de perfil de reloj.
+ */
+
+#define AUDIO_BLOCK_LEN MFCC_FRAME_SHIFT  // Muestras por bloque (un salto de trama)
+#define AUDIO_DC_SHIFT 3                  // Seguimiento de la continua: 1/8 por bloque
+
+/**
+ * @brief Contadores de la captura.
+ */
+typedef struct {
+    uint32_t blocks;     // Bloques entregados al bucle principal
+    uint32_t overruns;   // Mitades que el DMA volvió a llenar antes de procesarlas
+} audio_capture_stats_t;
+
+/**
+ * @brief Configura PA0, ADC1, DMA1 canal 1 y TIM6; calibra el ADC.
+ * @return false si algún periférico no se pudo inicializar.
+ */
+bool audio_capture_init(void);
+
+/**
+ * @brief Arranca y detiene la adquisición continua.
+ */
+bool audio_capture_start(void);
+void audio_capture_stop(void);
+bool audio_capture_running(void);
+
+/**
+ * @brief Devuelve el siguiente bloque listo, ya convertido a q15 sin continua.
+ * @note  La conversión se hace en el mismo buffer del DMA. El bloque es válido
+ *        hasta llamar a audio_capture_release(). NULL si no hay bloque listo.
+ */
+const int16_t *audio_capture_get_block(void);
+void audio_capture_release(void);
+
+/**
+ * @brief Bloques listos sin procesar (0 a 2).
+ */
+uint16_t audio_capture_pending(void);
+
+const audio_capture_stats_t *audio_capture_get_stats(void);
+
+/**
+ * @brief Listener de clock_manager: ajusta TIM6 para mantener la frecuencia de muestreo.
+ */
+void audio_capture_on_clock_change(uint32_t hclk_hz);
+
+/**
+ * @brief Llamar desde DMA1_Channel1_IRQHandler.
+ */
+void audio_capture_irq_handler(void);
+
+#endif // AUDIO_CAPTURE_H
@@ -0,0 +1,100 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+/**
+ * @brief Compara la latencia de alloc/free entre mem_pool y malloc de newlib
+ *        con una carga aleatoria reproducible. Imprime min/promedio/max e histograma.
+ */
+void benchmark_mem_pool(void);
+
+/**
+ * @brief Ejecuta el mismo kernel (CRC32 bit a bit y ring buffer) desde FLASH
+ *        con y sin caché ART, y desde SRAM2. Imprime los ciclos de cada caso.
+ */
+void benchmark_sram2_text(void);
+
+/**
+ * @brief Escribe el área SCRATCH de FLASH con programación rápida por filas y
+ *        con doble palabra. Imprime bytes/s y la utilización de CPU de cada modo.
+ */
+void benchmark_flash_writer(void);
+
+/**
+ * @brief Construye imágenes de credenciales en SCRATCH y compara los ciclos de
+ *        búsqueda del índice en FLASH contra una búsqueda binaria.
+ */
+void benchmark_cred_db(void);
+
+/**
+ * @brief Mide keypad, ring buffer, FIR y FFT con cada combinación de prefetch,
+ *        I-cache y D-cache en cada perfil de reloj; fija la más rápida por perfil.
+ */
+void benchmark_flash_cache(void);
+
+/**
+ * @brief Compara inicialización y RFFT con las tablas de FLASH y con las
+ *        generadas en SRAM2 (arm_rfft_fast_init_dyn_f32).
+ */
+void benchmark_fft_tables(void);
+
+/**
+ * @brief Ciclos de la RFFT de radix mixto (160, 240, 480) contra la de potencia
+ *        de 2 con relleno de ceros.
+ */
+void benchmark_fft_mixed(void);
+
+/**
+ * @brief Ciclos del FIR de 1 a 8 canales entrelazados en una pasada
+ *        (arm_fir_multichannel_f32) contra un arm_fir_f32 por canal.
+ */
+void benchmark_fir_multichannel(void);
+
+/**
+ * @brief Ciclos del FIR por convolución FFT particionada (arm_fir_fft_f32)
+ *        contra arm_fir_f32 de 16 a 512 taps, con el punto de cruce.
+ */
+void benchmark_fir_fft(void);
+
+/**
+ * @brief Ciclos por muestra de salida del conversor de tasa racional L/M
+ *        (arm_fir_resample_f32/q15) para 48 y 44.1 kHz a 16 kHz.
+ */
+void benchmark_fir_resample(void);
+
+/**
+ * @brief Ciclos de la cascada de biquads q15 fusionada por tramos contra las df1
+ *        q15/q31 y df2T f32, con las secciones tal cual y ordenadas y escaladas.
+ */
+void benchmark_biquad(void);
+
+/**
+ * @brief Ciclos de la cascada de biquads df2T f32 de N canales entrelazados contra
+ *        una instancia mono por canal.
+ */
+void benchmark_biquad_multichannel(void);
+
+/**
+ * @brief Ciclos por salto de las estadísticas de una ventana deslizante con
+ *        arm_stats_window_f32/q31 contra las funciones de bloque de CMSIS-DSP.
+ */
+void benchmark_stats_window(void);
+
+/**
+ * @brief Ciclos por capa de nn_runtime con un modelo sintético (conv, depthwise,
+ *        pooling, FC y softmax) y el tamaño de arena que usa.
+ */
+void benchmark_nn(void);
+
+/**
+ * @brief Mide el DS-CNN de palabras clave por capa frente a 50 ms a 80 MHz.
+ */
+void benchmark_kws(void);
+
+/**
+ * @brief Ejecuta todos los benchmarks disponibles e imprime los resultados por UART.
+ */
+void benchmark_run_all(void);
+
+#endif // BENCHMARK_H
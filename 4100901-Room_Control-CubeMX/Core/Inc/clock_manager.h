@@ -0,0 +1,62 @@
+#ifndef CLOCK_MANAGER_H
+#define CLOCK_MANAGER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+#include "clock_policy.h"
+
+#define CLOCK_MANAGER_MAX_LISTENERS 8  // Drivers que pueden recibir notificaciones
+
+/**
+ * @brief Función que un driver registra para recalibrarse tras un cambio de reloj.
+ * @param hclk_hz Nueva frecuencia de HCLK en Hz (PCLK1/PCLK2 usan divisor 1).
+ */
+typedef void (*clock_change_cb_t)(uint32_t hclk_hz);
+
+/**
+ * @brief Registra el perfil inicial. Llamar después de SystemClock_Config().
+ */
+void clock_manager_init(clock_profile_t initial);
+
+/**
+ * @brief Registra un driver a notificar después de cada cambio de perfil.
+ * @return false si la tabla de drivers está llena.
+ */
+bool clock_manager_register(clock_change_cb_t callback);
+
+/**
+ * @brief Cambia de perfil con HAL_PWREx_ControlVoltageScaling y HAL_RCC_ClockConfig.
+ * @note  Al subir se eleva primero el voltaje (Range 1); al bajar se reduce al final.
+ *        HAL_RCC_ClockConfig reconfigura el SysTick, por lo que HAL_GetTick sigue en ms.
+ * @return HAL_OK si el cambio se completó (o el perfil ya estaba activo).
+ */
+HAL_StatusTypeDef clock_manager_set_profile(clock_profile_t profile);
+
+/**
+ * @brief Perfil activo.
+ */
+clock_profile_t clock_manager_get_profile(void);
+
+/**
+ * @brief Nombre legible de un perfil.
+ */
+const char *clock_manager_profile_name(clock_profile_t profile);
+
+/**
+ * @brief Busca un perfil por nombre ("perf", "balanced", "lowpower").
+ * @return true si se encontró.
+ */
+bool clock_manager_profile_from_name(const char *name, clock_profile_t *profile);
+
+/**
+ * @brief Ciclos de CPU (DWT) que tomó el último cambio de from a to; 0 si nunca se midió.
+ */
+uint32_t clock_manager_switch_cycles(clock_profile_t from, clock_profile_t to);
+
+/**
+ * @brief Imprime el perfil actual, las frecuencias y la matriz de latencias de cambio.
+ */
+void clock_manager_report(void);
+
+#endif // CLOCK_MANAGER_H
@@ -0,0 +1,55 @@
+#ifndef CLOCK_POLICY_H
+#define CLOCK_POLICY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Perfiles de reloj disponibles, de mayor a menor consumo.
+ */
+typedef enum {
+    CLOCK_PROFILE_PERFORMANCE = 0,  // 80 MHz PLL(HSI), Range 1
+    CLOCK_PROFILE_BALANCED,         // 24 MHz MSI, Range 2
+    CLOCK_PROFILE_LOW_POWER,        // 4 MHz MSI, Range 2
+    CLOCK_PROFILE_COUNT
+} clock_profile_t;
+
+/**
+ * @brief Trabajo pendiente observado en una iteración del bucle principal.
+ */
+typedef struct {
+    uint16_t pending_keys;     // Teclas en cola sin procesar
+    uint16_t pending_console;  // Bytes de consola sin procesar
+    uint16_t pending_audio;    // Bloques de audio por procesar (al menos 1 con la captura activa)
+    bool ui_active;            // Temporizadores de LED u otra interacción en curso
+    bool compute_requested;    // Cálculo pesado pendiente (benchmarks, DSP)
+    uint32_t now_ms;           // Tiempo actual (HAL_GetTick)
+} clock_policy_input_t;
+
+/**
+ * @brief Estado de la política. No depende del HAL: se puede compilar y probar en el host.
+ */
+typedef struct {
+    uint32_t idle_timeout_ms;     // Tiempo sin actividad antes de bajar a LOW_POWER
+    uint32_t last_activity_ms;    // Último instante con trabajo pendiente
+    uint32_t compute_hold_ms;     // Tiempo que se mantiene PERFORMANCE tras un cálculo
+    uint32_t last_compute_ms;     // Último instante con cálculo pendiente
+    bool compute_seen;            // Hubo algún cálculo desde el inicio
+} clock_policy_t;
+
+/**
+ * @brief Inicializa la política.
+ * @param idle_timeout_ms Inactividad necesaria para pasar de BALANCED a LOW_POWER.
+ * @param compute_hold_ms Histéresis tras un cálculo antes de salir de PERFORMANCE.
+ */
+void clock_policy_init(clock_policy_t *policy, uint32_t idle_timeout_ms,
+                       uint32_t compute_hold_ms, uint32_t now_ms);
+
+/**
+ * @brief Elige el perfil según el trabajo pendiente.
+ * @note  Cálculo pesado -> PERFORMANCE; E/S, audio o interfaz activa -> BALANCED;
+ *        inactividad mayor a idle_timeout_ms -> LOW_POWER.
+ */
+clock_profile_t clock_policy_select(clock_policy_t *policy, const clock_policy_input_t *input);
+
+#endif // CLOCK_POLICY_H
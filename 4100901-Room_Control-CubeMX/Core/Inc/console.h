@@ -0,0 +1,47 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+#define CONSOLE_MAX_COMMANDS 16   // Comandos que se pueden registrar
+#define CONSOLE_LINE_MAX 32       // Longitud máxima de una línea recibida
+
+/**
+ * @brief Manejador de un comando. args apunta al texto después del nombre (puede ser "").
+ */
+typedef void (*console_handler_t)(const char *args);
+
+/**
+ * @brief Inicia la recepción por interrupción de un byte a la vez en la UART indicada.
+ */
+void console_init(UART_HandleTypeDef *huart);
+
+/**
+ * @brief Registra un comando.
+ * @param name Nombre del comando (cadena constante).
+ * @param help Descripción corta mostrada por "help".
+ * @param handler Función a ejecutar.
+ * @return false si la tabla de comandos está llena.
+ */
+bool console_register(const char *name, const char *help, console_handler_t handler);
+
+/**
+ * @brief Procesa los bytes recibidos y ejecuta el comando al llegar '\r' o '\n'.
+ * @note  Debe llamarse en el bucle principal; los comandos nunca corren en la ISR.
+ */
+void console_poll(void);
+
+/**
+ * @brief Bytes recibidos que aún no procesa console_poll().
+ */
+uint16_t console_rx_pending(void);
+
+/**
+ * @brief Recalcula el baud rate de la UART tras un cambio de reloj y rearma la recepción.
+ * @note  Se registra con clock_manager_register().
+ */
+void console_on_clock_change(uint32_t hclk_hz);
+
+#endif // CONSOLE_H
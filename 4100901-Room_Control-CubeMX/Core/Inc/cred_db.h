@@ -0,0 +1,141 @@
+#ifndef CRED_DB_H
+#define CRED_DB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Base de credenciales en FLASH con dos slots A/B.
+ * @note  El slot activo es una imagen inmutable con registros ordenados por clave
+ *        que se consulta directamente por el mapa de memoria. Las actualizaciones
+ *        se escriben en el otro slot y se publican con un marcador de commit que
+ *        se programa al final: un corte de energía deja siempre la imagen vieja o
+ *        la nueva completa. Con un slot por banco, el activo nunca está en el
+ *        banco que se borra o programa: las consultas no esperan a la escritura
+ *        (read-while-write). Al preparar el slot del banco del código, la CPU
+ *        espera cada operación al leer instrucciones de ese banco.
+ *
+ *        Distribución del slot:
+ *          0    encabezado + marcador de commit
+ *          256  registros ordenados, agrupados en hojas de 4 (una línea del ART)
+ *          ...  índice S+tree implícito: nodos de 8 claves (una línea del ART),
+ *               de la raíz a las hojas, sin punteros. La clave i de un nodo es la
+ *               menor clave de su hijo i. Cada nivel cuesta una sola línea de caché.
+ */
+
+#define CRED_DB_MAGIC 0x42445243U         // "CRDB"
+#define CRED_DB_COMMIT_MAGIC 0x544D4D43U  // "CMMT"
+#define CRED_DB_RECORDS_OFFSET 256U       // El encabezado ocupa su propia fila
+#define CRED_DB_LINE_SIZE 32U             // Línea del caché de datos del ART
+#define CRED_DB_NODE_KEYS 8U              // Claves por nodo del índice (una línea)
+#define CRED_DB_LEAF_RECORDS 4U           // Registros por hoja (una línea)
+#define CRED_DB_MAX_LEVELS 8U
+#define CRED_DB_KEY_INVALID 0xFFFFFFFFU   // Reservada: rellena los nodos incompletos
+
+#define CRED_FLAG_ENABLED 0x01U
+
+/**
+ * @brief Credencial tal como queda en FLASH (una doble palabra).
+ */
+typedef struct {
+    uint32_t key;      // PIN empaquetado (cred_db_key_from_pin), orden ascendente
+    uint16_t user_id;
+    uint8_t flags;     // CRED_FLAG_*
+    uint8_t reserved;
+} cred_record_t;
+
+/**
+ * @brief Operaciones de FLASH usadas por la base.
+ * @note  sync espera a que todo lo programado antes esté efectivamente en FLASH
+ *        (escritura asíncrona); puede ser NULL si las operaciones son bloqueantes.
+ *        read copia de FLASH a RAM y devuelve false si hubo un error ECC doble
+ *        (slot a medio programar tras un corte); si es NULL se lee directamente
+ *        del mapa de memoria. Solo se usa al validar los slots.
+ */
+typedef struct {
+    bool (*erase_page)(uintptr_t addr);
+    bool (*program_dword)(uintptr_t addr, uint64_t data);
+    bool (*sync)(void);
+    bool (*read)(uintptr_t addr, void *dst, uint32_t len);
+} cred_db_flash_ops_t;
+
+/**
+ * @brief Instancia de la base.
+ */
+typedef struct {
+    const cred_db_flash_ops_t *ops;
+    uintptr_t slot_base[2];
+    uint32_t slot_size;
+    uint32_t page_size;
+
+    int8_t active;                 // Slot publicado, -1 si no hay imagen válida
+    uint32_t generation;           // Generación del slot activo
+    const cred_record_t *records;  // Registros del slot activo (en FLASH)
+    uint32_t count;
+    const uint32_t *index;         // Nodos del índice del slot activo (en FLASH)
+    uint8_t levels;
+    uint32_t level_start[CRED_DB_MAX_LEVELS];  // Primer nodo de cada nivel
+    uint32_t capacity;             // Registros que caben con su índice
+
+    bool staging;                  // Actualización en curso en el slot inactivo
+    uint32_t stage_count;
+    uint32_t stage_crc;
+    uint32_t stage_last_key;
+} cred_db_t;
+
+/**
+ * @brief Valida ambos slots y publica el de mayor generación.
+ * @note  Un slot es válido solo si el encabezado, el marcador de commit y el CRC
+ *        de los registros coinciden, y ninguna lectura da error ECC. No escribe en FLASH.
+ * @return false si la geometría no es válida.
+ */
+bool cred_db_init(cred_db_t *db, const cred_db_flash_ops_t *ops, uintptr_t slot_a,
+                  uintptr_t slot_b, uint32_t slot_size, uint32_t page_size);
+
+/**
+ * @brief Desciende el índice de la imagen activa y recorre una hoja.
+ * @note  Lee directamente del mapa de memoria: no copia nada a RAM.
+ * @return Puntero al registro en FLASH o NULL si no existe.
+ */
+const cred_record_t *cred_db_find(const cred_db_t *db, uint32_t key);
+
+/**
+ * @brief Borra el slot inactivo y lo deja listo para recibir registros.
+ */
+bool cred_db_begin_update(cred_db_t *db);
+
+/**
+ * @brief Agrega un registro a la imagen en preparación.
+ * @note  Las claves deben llegar en orden estrictamente ascendente y ser distintas
+ *        de CRED_DB_KEY_INVALID.
+ */
+bool cred_db_stage(cred_db_t *db, const cred_record_t *record);
+
+/**
+ * @brief Construye el índice, escribe encabezado y marcador de commit, verifica
+ *        y publica la nueva imagen.
+ * @note  Si algo falla la imagen activa no cambia.
+ */
+bool cred_db_commit(cred_db_t *db);
+
+/**
+ * @brief Descarta la actualización; el slot queda inválido hasta el próximo begin.
+ */
+void cred_db_abort(cred_db_t *db);
+
+/**
+ * @brief Registros que caben en un slot junto con su índice.
+ */
+uint32_t cred_db_capacity(const cred_db_t *db);
+
+/**
+ * @brief Bytes de índice para count registros.
+ */
+uint32_t cred_db_index_size(uint32_t count);
+
+/**
+ * @brief Empaqueta hasta 4 caracteres en una clave (big-endian: conserva el orden).
+ */
+uint32_t cred_db_key_from_pin(const char *pin, uint8_t len);
+
+#endif // CRED_DB_H
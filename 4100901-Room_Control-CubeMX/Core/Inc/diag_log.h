@@ -0,0 +1,36 @@
+#ifndef DIAG_LOG_H
+#define DIAG_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define DIAG_LOG_SIZE 1024  // Bytes de texto retenidos en SRAM2
+
+/**
+ * @brief Inicializa el log de diagnóstico ubicado en SRAM2_NOINIT.
+ * @param retained_valid true si SRAM2 conservó su contenido (ver sram2_init()).
+ *        Si el encabezado no es válido, el log se vacía.
+ */
+void diag_log_init(bool retained_valid);
+
+/**
+ * @brief Agrega una línea al log circular; sobrescribe lo más antiguo si está lleno.
+ */
+void diag_log_write(const char *msg);
+
+/**
+ * @brief Versión con formato de diag_log_write() (máximo 80 caracteres por línea).
+ */
+void diag_log_printf(const char *fmt, ...);
+
+/**
+ * @brief Imprime por UART el contenido del log, de lo más antiguo a lo más reciente.
+ */
+void diag_log_dump(void);
+
+/**
+ * @brief Número de arranques desde que se creó el log (sobrevive a resets en caliente).
+ */
+uint32_t diag_log_boot_count(void);
+
+#endif // DIAG_LOG_H
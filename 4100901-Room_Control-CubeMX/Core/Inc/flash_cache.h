@@ -0,0 +1,60 @@
+#ifndef FLASH_CACHE_H
+#define FLASH_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "clock_policy.h"
+
+/**
+ * @brief Configuración del acelerador ART de la FLASH (prefetch, caché de
+ *        instrucciones y caché de datos) por perfil de reloj.
+ * @note  Reemplaza la configuración fija de HAL_Init (PREFETCH_ENABLE,
+ *        INSTRUCTION_CACHE_ENABLE y DATA_CACHE_ENABLE en stm32l4xx_hal_conf.h).
+ *        No cambiar la configuración con una operación de flash_writer en curso:
+ *        el HAL restaura el caché de datos al terminar cada programación.
+ */
+
+#define FLASH_CACHE_PREFETCH 0x01U
+#define FLASH_CACHE_ICACHE   0x02U
+#define FLASH_CACHE_DCACHE   0x04U
+#define FLASH_CACHE_ALL      (FLASH_CACHE_PREFETCH | FLASH_CACHE_ICACHE | FLASH_CACHE_DCACHE)
+#define FLASH_CACHE_COMBINATIONS 8U  // Todas las combinaciones de los tres bits
+
+/**
+ * @brief Aplica la configuración del perfil activo y se registra en clock_manager
+ *        para reaplicarla en cada cambio de perfil. Llamar después de clock_manager_init().
+ */
+void flash_cache_init(void);
+
+/**
+ * @brief Aplica una combinación de FLASH_CACHE_*; los cachés se reinician al habilitarse.
+ */
+void flash_cache_apply(uint8_t config);
+
+/**
+ * @brief Configuración aplicada actualmente.
+ */
+uint8_t flash_cache_get(void);
+
+/**
+ * @brief Fija la configuración de un perfil; si es el activo se aplica de inmediato.
+ */
+void flash_cache_set_profile_config(clock_profile_t profile, uint8_t config);
+
+/**
+ * @brief Configuración elegida para un perfil.
+ */
+uint8_t flash_cache_profile_config(clock_profile_t profile);
+
+/**
+ * @brief Texto de tres letras, p. ej. "PI-" = prefetch e I-cache, sin D-cache.
+ */
+const char *flash_cache_name(uint8_t config);
+
+/**
+ * @brief Interpreta el formato de flash_cache_name (letras P, I, D; '-' o ausentes = apagado).
+ * @return false si hay caracteres no válidos.
+ */
+bool flash_cache_parse(const char *text, uint8_t *config);
+
+#endif // FLASH_CACHE_H
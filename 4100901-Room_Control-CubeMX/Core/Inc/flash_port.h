@@ -0,0 +1,48 @@
+#ifndef FLASH_PORT_H
+#define FLASH_PORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Acceso mínimo a la FLASH interna sobre el HAL (borrado por página y
+ *        programación por doble palabra). Lo usan los módulos de almacenamiento.
+ * @note  Es bloqueante; si flash_writer tiene una operación en curso el HAL
+ *        responde HAL_BUSY y estas funciones devuelven false.
+ */
+
+/**
+ * @brief Traduce una dirección absoluta a banco (FLASH_BANK_1/2) y número de página.
+ */
+void flash_port_locate(uintptr_t addr, uint32_t *bank, uint32_t *page);
+
+/**
+ * @brief Borra la página de 2 KiB que contiene addr (banco 1 o 2 según la dirección).
+ * @return true si el borrado terminó sin error.
+ */
+bool flash_port_erase_page(uintptr_t addr);
+
+/**
+ * @brief Programa 64 bits en addr (alineada a 8) con FLASH_TYPEPROGRAM_DOUBLEWORD.
+ * @note  La doble palabra debe estar borrada (0xFFFFFFFFFFFFFFFF).
+ * @return true si la programación terminó sin error.
+ */
+bool flash_port_program_dword(uintptr_t addr, uint64_t data);
+
+/**
+ * @brief Copia len bytes de FLASH a dst vigilando los errores ECC dobles.
+ * @note  Una doble palabra a medio programar o borrar (corte de energía) da un
+ *        error ECC doble al leerla, que en el L4 dispara la NMI. Mientras dura
+ *        la copia, la NMI lo absorbe (flash_port_ecc_nmi) en lugar de colgarse.
+ * @return false si alguna doble palabra leída tenía un error ECC doble.
+ */
+bool flash_port_read(uintptr_t addr, void *dst, uint32_t len);
+
+/**
+ * @brief Llamar al comienzo de NMI_Handler.
+ * @return true si la NMI era un error ECC doble durante flash_port_read(): el
+ *         indicador ECCD ya quedó limpio y el handler debe retornar.
+ */
+bool flash_port_ecc_nmi(void);
+
+#endif // FLASH_PORT_H
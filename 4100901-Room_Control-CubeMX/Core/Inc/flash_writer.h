@@ -0,0 +1,108 @@
+#ifndef FLASH_WRITER_H
+#define FLASH_WRITER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Servicio de escritura asíncrona en FLASH.
+ * @note  Las escrituras se agrupan en filas de 32 dobles palabras (256 bytes).
+ *        Una fila completa se programa con FLASH_TYPEPROGRAM_FAST; una parcial,
+ *        doble palabra a doble palabra. Todo corre por HAL_FLASH_Program_IT y
+ *        HAL_FLASHEx_Erase_IT: la CPU solo interviene al terminar cada operación.
+ *        La programación rápida no admite lecturas del banco durante la fila: en
+ *        el banco del código (banco 1) las filas van doble palabra a doble palabra
+ *        y la CPU espera cada operación al leer instrucciones.
+ */
+
+#define FLASH_WRITER_ROW_SIZE 256U        // Fila de programación rápida
+#define FLASH_WRITER_ROW_DWORDS 32U
+#define FLASH_WRITER_QUEUE_LEN 6          // Operaciones (borrado o fila) en cola
+#define FLASH_WRITER_COALESCE_MS 100      // Espera máxima de una fila incompleta
+#define FLASH_WRITER_FAST_MIN_HCLK 8000000U  // Programación rápida requiere HCLK >= 8 MHz
+#define FLASH_WRITER_SYNC_TIMEOUT_MS 2000   // Peor caso: cola llena de borrados de página
+
+/**
+ * @brief Contadores del servicio.
+ */
+typedef struct {
+    uint32_t rows_fast;       // Filas programadas en modo rápido
+    uint32_t dwords;          // Dobles palabras programadas una a una
+    uint32_t pages_erased;
+    uint32_t errors;          // Operaciones terminadas con error
+    uint32_t queue_full;      // Escrituras rechazadas por cola llena
+} flash_writer_stats_t;
+
+/**
+ * @brief Habilita la interrupción de FLASH y deja la cola vacía.
+ */
+void flash_writer_init(void);
+
+/**
+ * @brief Encola el borrado de la página que contiene addr.
+ * @return false si la cola está llena.
+ */
+bool flash_writer_erase_page(uintptr_t addr);
+
+/**
+ * @brief Copia len bytes a la fila correspondiente y los deja pendientes.
+ * @note  addr y len deben ser múltiplos de 8. Si la última operación en cola es
+ *        la misma fila, los datos se agregan a ella. No es reentrante: llamar
+ *        solo desde el bucle principal.
+ * @return false si la cola está llena (no se encola nada) o los argumentos son inválidos.
+ */
+bool flash_writer_program(uintptr_t addr, const void *data, uint32_t len);
+
+/**
+ * @brief Variante de una doble palabra, con la firma de journal_flash_ops_t.
+ */
+bool flash_writer_program_dword(uintptr_t addr, uint64_t data);
+
+/**
+ * @brief Variantes bloqueantes: esperan lugar en la cola llamando a flash_writer_poll().
+ * @note  Útiles para escrituras largas (imágenes completas) desde el bucle principal.
+ */
+bool flash_writer_erase_page_blocking(uintptr_t addr);
+bool flash_writer_program_dword_blocking(uintptr_t addr, uint64_t data);
+
+/**
+ * @brief Operaciones libres en la cola. Un registro nuevo ocupa a lo sumo dos
+ *        (borrado de página y fila), así que el llamador puede reservar antes.
+ */
+uint8_t flash_writer_free_ops(void);
+
+/**
+ * @brief Arranca la siguiente operación si la FLASH está libre. Llamar en el bucle principal.
+ */
+void flash_writer_poll(void);
+
+/**
+ * @brief Programa ya las filas incompletas sin esperar FLASH_WRITER_COALESCE_MS.
+ */
+void flash_writer_flush(void);
+
+/**
+ * @brief Fuerza el flush y espera a que la cola se vacíe (bloqueante).
+ * @return false si vence FLASH_WRITER_SYNC_TIMEOUT_MS o hubo errores durante la espera.
+ */
+bool flash_writer_sync(void);
+
+/**
+ * @brief true si no hay operaciones en curso ni en cola.
+ */
+bool flash_writer_idle(void);
+
+/**
+ * @brief Habilita o deshabilita la programación rápida (por defecto habilitada).
+ */
+void flash_writer_set_fast(bool enable);
+
+/**
+ * @brief Continúa la cola desde la ISR, después de HAL_FLASH_IRQHandler().
+ */
+void flash_writer_irq_handler(void);
+
+void flash_writer_get_stats(flash_writer_stats_t *stats);
+void flash_writer_reset_stats(void);
+
+#endif // FLASH_WRITER_H
@@ -0,0 +1,104 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define JOURNAL_RECORD_SIZE 16     // Dos dobles palabras por registro
+#define JOURNAL_PENDING_MAX 16     // Registros en RAM esperando ser escritos
+
+/**
+ * @brief Tipos de evento registrados.
+ */
+typedef enum {
+    JOURNAL_EVENT_BOOT = 1,
+    JOURNAL_EVENT_ACCESS_GRANTED = 2,
+    JOURNAL_EVENT_ACCESS_DENIED = 3,
+    JOURNAL_EVENT_OCCUPANCY = 4,     // data: 1 ocupada, 0 libre
+} journal_event_t;
+
+/**
+ * @brief Registro tal como queda en FLASH (16 bytes, alineado a 8).
+ */
+typedef struct {
+    uint32_t timestamp_ms;  // HAL_GetTick() al registrar
+    uint32_t sequence;      // Número de registro creciente
+    uint32_t data;          // Dato asociado al evento
+    uint8_t event;          // journal_event_t
+    uint8_t reserved;
+    uint16_t crc;           // CRC16-CCITT de los 14 bytes anteriores
+} journal_record_t;
+
+/**
+ * @brief Operaciones de FLASH usadas por el journal.
+ * @note  Permiten sustituir la FLASH real por una simulada en el host que
+ *        verifique la regla "borrar antes de escribir".
+ *        read copia de FLASH a RAM y devuelve false si hubo un error ECC doble
+ *        (doble palabra a medio programar o borrar tras un corte); si es NULL
+ *        se lee directamente del mapa de memoria.
+ */
+typedef struct {
+    bool (*erase_page)(uintptr_t addr);
+    bool (*program_dword)(uintptr_t addr, uint64_t data);
+    bool (*read)(uintptr_t addr, void *dst, uint32_t len);
+} journal_flash_ops_t;
+
+/**
+ * @brief Instancia del journal.
+ */
+typedef struct {
+    const journal_flash_ops_t *ops;
+    uintptr_t base;          // Dirección de la primera página (lectura por mapa de memoria)
+    uint32_t page_size;
+    uint16_t page_count;
+    bool ready;              // journal_init terminó bien: se puede escribir
+
+    uint16_t page;           // Página activa
+    uint16_t slot;           // Próximo slot libre en la página activa
+    uint32_t page_seq;       // Secuencia de la página activa
+    uint32_t next_sequence;  // Secuencia del próximo registro
+
+    journal_record_t pending[JOURNAL_PENDING_MAX];
+    uint8_t pending_head;
+    uint8_t pending_count;
+    uint32_t dropped;        // Registros perdidos por cola llena
+    uint32_t torn;           // Registros incompletos (CRC o ECC) encontrados al recuperar
+} journal_t;
+
+/**
+ * @brief Recupera el estado a partir del contenido de la FLASH.
+ * @note  Busca la página con mayor secuencia válida y el primer slot borrado.
+ *        Un registro a medio escribir (corte de energía) falla su CRC o da error
+ *        ECC al leerlo, y se salta.
+ * @return false si la geometría no es válida o no se pudo preparar una página.
+ */
+bool journal_init(journal_t *j, const journal_flash_ops_t *ops, uintptr_t base,
+                  uint32_t page_size, uint16_t page_count);
+
+/**
+ * @brief Encola un evento en RAM. No toca la FLASH: seguro en la ruta del keypad.
+ * @note  Solo debe llamarse desde el bucle principal (la cola no tiene bloqueo).
+ * @return false si la cola está llena (el evento se cuenta en dropped).
+ */
+bool journal_append(journal_t *j, journal_event_t event, uint32_t data, uint32_t timestamp_ms);
+
+/**
+ * @brief Escribe en FLASH hasta max_records registros pendientes.
+ * @note  Llamar desde el bucle principal. Cada registro son dos programaciones de 64 bits;
+ *        al llenarse una página se borra la siguiente (la más antigua).
+ * @return Número de registros escritos.
+ */
+uint8_t journal_flush(journal_t *j, uint8_t max_records);
+
+/**
+ * @brief Lee el registro n-ésimo contando desde el más reciente (0 = último).
+ * @return false si no existe o está corrupto.
+ */
+bool journal_read_latest(const journal_t *j, uint32_t n, journal_record_t *record);
+
+/**
+ * @brief CRC16-CCITT (polinomio 0x1021, valor inicial 0xFFFF).
+ */
+uint16_t journal_crc16(const uint8_t *data, uint32_t len);
+
+#endif // JOURNAL_H
@@ -3,6 +3,7 @@
 
 #include "main.h"
 #include <stdint.h>
+#include "mem_sections.h"
 
 #define KEYPAD_ROWS 4
 #define KEYPAD_COLS 4
@@ -28,6 +29,6 @@ void keypad_init(keypad_handle_t* keypad);
  * @param col_pin Pin de la columna a escanear.
  * @return El carácter de la tecla presionada o '\0' si no hay tecla.
  */
-char keypad_scan(keypad_handle_t* keypad, uint16_t col_pin);
+SRAM2_TEXT char keypad_scan(keypad_handle_t* keypad, uint16_t col_pin);
 
 #endif // KEYPAD_DRIVER_H
@@ -0,0 +1,89 @@
+#ifndef KWS_H
+#define KWS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mfcc.h"
+#include "nn_runtime.h"
+
+/**
+ * @brief Detección de palabras clave con un DS-CNN sobre 1 s de MFCC.
+ * @note  Arquitectura DS-CNN de ML-KWS-for-MCU: conv 10x4/2 a 64 canales, cuatro
+ *        bloques depthwise 3x3 + pointwise 1x1, promedio global y FC a 12 clases.
+ *        Los pesos vienen de kws_weights.h (Tools/kws_weights.py). Las tramas se
+ *        agregan de a una; la inferencia corre capa por capa desde el bucle
+ *        principal para no bloquear la captura de audio. No depende del HAL.
+ */
+
+#define KWS_FRAMES 49U                 // 1 s con saltos de 20 ms
+#define KWS_COEFFS MFCC_NUM_COEFFS
+#define KWS_CHANNELS 64U
+#define KWS_CLASSES 12U
+#define KWS_ARENA_SIZE 18304U          // Activaciones 16000 + temporal 2304 (nn_model_plan)
+#define KWS_AVERAGE 3U                 // Inferencias promediadas antes de decidir
+#define KWS_THRESHOLD 90               // Puntaje promedio mínimo (softmax q7, 127 = 1.0)
+#define KWS_BUDGET_CYCLES (50U * 80000U)  // 50 ms por inferencia a 80 MHz
+
+#define KWS_NONE (-1)                  // Inferencia terminada sin palabra clave
+#define KWS_BUSY (-2)                  // Quedan capas por ejecutar
+
+/**
+ * @brief Prepara el modelo y la arena; reordena los pesos de la FC para
+ *        arm_fully_connected_q7_opt.
+ * @return false si el modelo no entra en KWS_ARENA_SIZE.
+ */
+bool kws_init(void);
+
+/**
+ * @brief Agrega los MFCC de una trama al final de la ventana de 1 s.
+ */
+void kws_push_frame(const float32_t *coeffs);
+
+/**
+ * @brief La ventana tiene KWS_FRAMES tramas desde el último reinicio.
+ */
+bool kws_window_full(void);
+
+/**
+ * @brief Inicia una inferencia sobre la ventana actual (descarta la que esté en curso).
+ */
+void kws_start(void);
+
+/**
+ * @brief Ejecuta la siguiente capa de la inferencia en curso.
+ * @return KWS_BUSY mientras quedan capas; al terminar, la clase cuyo puntaje promedio
+ *         supera KWS_THRESHOLD (sin contar silencio ni desconocido) o KWS_NONE.
+ */
+int16_t kws_poll(void);
+
+bool kws_busy(void);
+
+/**
+ * @brief Inferencia completa bloqueante (consola y benchmarks).
+ */
+int16_t kws_run(void);
+
+/**
+ * @brief Puntajes (softmax q7) de la última inferencia terminada.
+ */
+const q7_t *kws_scores(void);
+
+const char *kws_label(uint16_t index);
+
+/**
+ * @brief false con los pesos de prueba de Tools/kws_weights.py (sin entrenar).
+ */
+bool kws_weights_trained(void);
+
+/**
+ * @brief Índice de una etiqueta; -1 si no existe.
+ */
+int16_t kws_find_label(const char *label);
+
+/**
+ * @brief Modelo y runtime, para medir capas (rt->clock, rt->layer_cycles).
+ */
+const nn_model_t *kws_model(void);
+nn_runtime_t *kws_runtime(void);
+
+#endif // KWS_H
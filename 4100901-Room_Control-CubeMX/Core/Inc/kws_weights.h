@@ -0,0 +1,1026 @@
+/* Generado por Tools/kws_weights.py; no editar a mano. */
+#ifndef KWS_WEIGHTS_H
+#define KWS_WEIGHTS_H
+
+// Pesos pseudoaleatorios (semilla 1): solo para medir tiempos y memoria
+#define KWS_WEIGHTS_TRAINED 0
+#define KWS_INPUT_FRAC 1
+
+// CONV1: bits fraccionarios de pesos 7, bias 7, salida 1
+#define CONV1_BIAS_LSHIFT 1
+#define CONV1_OUT_RSHIFT 7
+#define CONV1_OUT_FRAC 1
+#define CONV1_WT { \
+37,41,2,-22,-31,1,-29,-41,6,4,16,-26,0,-2,-43,15,9,68,6,-4,35,6,26,-10, \
+6,29,20,4,-31,13,2,21,6,31,-1,6,19,-31,-11,-14,57,-3,19,18,-8,-44,28,-12, \
+21,-37,-13,36,41,-37,-38,-1,21,5,9,-28,17,32,-12,-41,-22,22,-50,-3,-28,-4,-7,0, \
+43,12,38,-4,-14,11,-81,-1,5,-35,13,-16,-70,-6,-28,-15,-4,36,3,-1,11,-52,35,-31, \
+13,-32,-28,-11,54,20,-17,-8,-33,-1,-16,21,-39,-10,-24,-21,20,4,17,34,33,-39,15,-50, \
+-2,55,-6,-11,5,1,1,-22,31,25,-6,9,19,30,11,20,-8,-31,-14,29,28,4,-16,9, \
+48,39,-20,-1,-42,-33,5,1,28,36,24,38,-16,-32,14,77,10,-33,7,41,-30,23,-17,36, \
+22,9,57,-12,-20,53,-25,63,-1,-30,0,4,6,-5,31,-66,-16,-8,52,-57,-10,-33,-19,18, \
+12,41,-17,8,34,26,-10,32,-26,52,4,-3,8,24,50,-4,-11,17,-25,-49,24,-11,32,-29, \
+-83,8,4,46,15,9,17,-11,2,-39,15,-23,-13,20,26,-29,57,-17,24,27,6,5,51,25, \
+13,-52,-21,33,6,-27,-18,-9,20,11,29,-23,28,-14,-9,50,2,-4,-6,-11,45,39,21,5, \
+30,-2,13,12,3,47,50,38,-55,53,20,-13,-1,33,34,24,4,1,24,-3,-26,-18,-4,10, \
+65,-39,14,-3,9,39,36,-4,-16,-39,-2,36,-8,20,20,11,31,-3,-24,-34,27,-10,-9,24, \
+-23,51,19,-15,-18,31,-34,-18,0,6,0,11,-10,-3,36,18,-13,49,-57,2,19,28,3,-11, \
+17,-6,14,-82,11,-23,27,21,21,-12,12,-10,6,-4,-25,57,21,-59,26,-40,-7,-17,-15,7, \
+-9,-41,0,10,51,-12,-34,-11,19,-25,-21,16,0,6,-18,-24,-9,-4,-10,12,16,16,14,-25, \
+-32,23,0,3,-33,-6,-18,-25,-18,-43,2,33,-20,3,-31,19,53,-35,-7,41,11,3,-58,-4, \
+26,41,18,-17,-20,-52,-31,32,-3,-38,38,-48,36,-9,10,19,8,36,0,-9,-19,-41,-20,28, \
+24,40,78,20,14,-38,-7,63,15,-4,9,-54,-24,-37,-61,22,28,-5,10,-29,13,22,44,45, \
+14,-4,-24,-17,18,16,1,48,19,0,-5,2,-27,-28,10,-17,-8,35,-6,38,0,43,13,-50, \
+35,-6,-56,3,4,-37,-17,16,40,33,35,32,-71,-21,5,-77,22,26,-22,-11,-27,-1,-1,0, \
+-29,11,-10,27,9,-42,-41,2,-14,13,23,1,-48,-34,16,-30,32,-3,15,-25,-3,-85,-6,16, \
+-26,-24,-2,2,-23,19,-47,32,-40,-24,38,-28,-47,2,-26,-32,-20,-21,-28,-29,46,-19,28,-40, \
+16,-36,-13,18,-15,-56,-16,-5,16,-29,-9,2,-47,-3,-24,13,-3,-5,-69,-3,-11,-27,-15,-36, \
+5,19,17,-15,48,24,-27,-4,-47,-3,20,36,-12,-51,-5,39,4,36,24,45,17,-19,13,73, \
+-15,-53,60,12,-18,-17,-44,20,4,-18,-12,-12,31,-5,39,-24,-18,-14,-15,-3,29,35,-31,37, \
+3,45,-5,-24,23,18,-13,1,4,9,-49,-35,2,7,-15,-50,38,-9,-30,46,32,30,24,16, \
+-28,1,10,18,14,-29,-17,-10,-6,-25,-52,-35,9,0,17,-54,-12,25,-56,-31,-48,35,1,-16, \
+4,-3,26,33,26,10,22,23,33,-53,10,2,5,-7,-2,14,6,4,-31,-36,-21,-51,-15,-24, \
+-51,-55,-13,-17,62,25,-22,-14,-29,-23,-10,-1,-18,24,18,56,-37,19,-11,-46,-9,-47,-1,78, \
+37,52,34,-44,12,4,12,-30,-57,60,34,9,-14,5,-36,27,5,-4,-12,-2,4,-12,28,6, \
+-3,-25,35,37,20,-53,-10,28,1,37,-13,23,15,-70,-12,-7,-18,-26,46,-3,23,-38,-59,-14, \
+12,-21,15,23,-13,-2,-21,31,51,14,-14,-20,-8,25,-22,42,-35,0,38,51,-12,23,72,33, \
+-63,8,68,-33,26,-60,45,-24,23,26,-80,-41,9,-44,-1,-27,38,-15,-26,18,35,-4,8,14, \
+-14,-34,15,-10,-39,24,12,4,-22,-6,17,14,-24,-26,10,5,24,-33,26,50,27,4,26,-37, \
+-13,59,-47,-33,24,-19,-16,-32,48,-17,-8,-52,22,0,14,45,4,-34,-29,2,38,-34,-7,-4, \
+19,-26,9,22,-1,-3,18,17,36,-31,35,-7,-33,-16,-35,-6,30,-64,-34,22,-9,23,-38,-2, \
+-75,-24,21,35,47,-2,-25,-11,-55,39,34,-26,52,-39,16,-23,-50,11,-33,34,-26,3,-14,4, \
+-18,23,17,2,-4,56,-20,-13,22,0,-47,-4,-11,-28,6,-33,-7,-33,45,-8,13,8,20,-4, \
+22,4,-70,9,-37,27,6,-11,-72,-61,-34,-11,-39,57,13,-3,-28,-10,-7,-13,-2,23,-50,6, \
+32,-39,-5,-11,-33,27,-9,33,12,-8,8,-11,-47,41,10,33,-52,30,24,-1,-61,3,-19,-6, \
+2,-26,-4,0,42,-3,67,-34,-4,35,-45,18,11,-17,-7,44,-13,8,12,35,-59,-42,-38,-8, \
+18,24,-8,43,-2,20,-22,24,-21,33,25,54,-12,-33,24,9,-15,-38,23,-56,-13,31,-7,13, \
+14,17,30,19,-11,-35,-8,-19,12,35,22,-20,6,0,-13,37,18,10,-35,-75,-21,33,-6,-1, \
+-8,14,0,49,-3,-8,41,21,20,15,-1,9,15,3,-54,39,-14,-16,-10,-21,-25,-2,25,-8, \
+14,-39,22,-33,20,-21,-17,-36,-36,-6,-28,-6,33,-24,-9,-3,-18,-1,7,30,-21,-6,-5,35, \
+-29,5,22,17,-20,-30,-53,-15,-7,-43,24,5,-7,-15,14,-8,14,-14,30,-47,-31,52,30,47, \
+-23,21,29,26,-5,42,12,-37,71,4,36,-20,-27,25,24,-21,7,-38,-59,31,-33,21,30,11, \
+43,10,8,0,12,10,-27,-1,-11,81,35,-23,17,-50,2,52,2,37,-11,13,11,-63,-23,54, \
+-24,34,49,-1,29,10,-17,17,12,-28,-13,-39,-10,-1,-28,-53,19,36,-26,2,-19,-75,61,8, \
+-40,36,21,40,21,15,41,-8,7,-31,-33,6,7,-45,11,29,-36,-10,49,-24,16,22,5,4, \
+16,8,4,-42,7,-23,43,63,32,-62,29,3,-31,-35,30,-19,-2,2,27,-77,35,-23,-12,18, \
+10,-66,17,-4,-30,-18,-46,22,42,-18,-13,-42,-20,-29,1,50,30,28,-28,24,-21,-25,21,-3, \
+71,5,-9,21,-33,19,45,-4,-15,32,-32,11,-15,9,-23,17,16,50,-10,13,-50,-23,8,-39, \
+-3,-26,14,17,-14,19,-16,3,15,16,17,49,-19,-4,-52,25,-32,-17,-15,12,-8,-8,2,-10, \
+-1,-28,-16,-35,24,26,19,10,-17,16,-44,-72,-34,43,7,44,-20,29,46,28,8,31,-13,51, \
+-33,-22,1,-22,50,19,-21,48,39,-11,45,34,-14,-16,9,33,45,43,-14,-51,-48,43,30,34, \
+0,2,14,13,2,-28,-39,4,-5,41,-31,-57,-56,-1,48,-10,-20,11,44,31,25,27,-8,2, \
+12,52,-63,-16,11,-7,-4,-8,-27,14,37,-10,13,32,-19,-3,-37,45,49,-6,57,25,-52,14, \
+7,14,20,-13,33,9,54,-3,-72,55,16,-53,-17,-23,27,-18,33,-14,28,-17,-34,17,-7,15, \
+-47,-30,-10,56,11,-48,-90,53,10,-36,28,24,61,6,-14,23,-39,-13,-29,-16,-37,-41,-32,11, \
+1,-2,14,21,14,59,8,11,-14,31,41,-85,23,-31,10,2,-36,-39,-7,75,-36,-12,-8,-8, \
+32,59,-1,12,-9,45,-2,20,-6,32,-2,-24,55,-56,5,-10,-26,60,10,-12,-25,10,0,-7, \
+-19,44,6,-5,-36,-22,21,-22,19,-3,11,10,-13,-8,-2,19,69,25,-38,64,-3,-20,4,-2, \
+7,-1,-1,36,49,3,45,27,34,8,6,23,-28,2,-32,26,6,17,-10,-22,28,-12,-6,1, \
+13,2,-30,-30,29,-9,-7,-25,27,13,-15,-49,52,-16,-33,-14,-33,0,-16,-34,20,-24,-53,10, \
+-16,-31,-48,-20,-17,-14,-14,36,30,9,16,-13,-42,15,39,-20,-20,-20,-38,16,-31,39,48,2, \
+-1,-24,26,2,-43,-27,13,-14,13,7,41,-3,30,32,38,-10,8,73,-6,-17,3,-34,-24,-12, \
+-8,29,-31,-5,7,-8,21,64,-31,-25,-15,-16,-16,12,50,71,-2,-59,45,0,-12,31,-3,-6, \
+-25,26,24,-24,-16,35,-21,-12,-22,-7,25,2,29,17,-58,0,-1,-48,22,-1,-14,15,28,21, \
+-15,-1,70,-37,2,1,43,18,6,-8,36,2,-3,5,20,1,7,23,-21,-7,2,20,16,-14, \
+-30,-11,-14,26,18,2,-31,-37,4,17,11,-7,16,-56,33,43,5,7,-6,26,-26,-17,11,-41, \
+14,13,0,-14,50,-15,4,23,0,30,0,7,0,19,-19,25,30,-30,-43,-38,-23,20,2,54, \
+45,-44,-11,-9,46,22,27,-23,58,-32,1,-28,-26,7,-26,20,15,2,18,32,31,-33,19,26, \
+-11,-11,35,19,4,41,27,50,-11,28,-57,-18,48,-28,-4,-10,14,33,46,-4,10,25,33,-8, \
+39,-41,8,-39,-13,-23,51,48,22,5,-56,-49,5,21,15,-21,-22,15,65,21,-1,-3,13,9, \
+-41,44,13,16,-13,32,29,-21,29,-20,-53,24,-28,-16,-27,-2,-10,5,13,47,13,15,14,23, \
+26,8,-33,-27,8,-9,-12,-15,-21,31,22,-36,5,-1,-13,30,9,2,-25,27,7,8,-20,43, \
+-89,-40,-48,-37,-29,-14,-10,6,39,16,4,-4,11,23,-21,50,0,24,-70,5,-11,39,29,9, \
+18,-9,-26,33,-34,-15,-33,-27,-12,24,-28,21,-53,-24,-25,19,38,-66,2,46,1,47,33,8, \
+-40,-19,44,-25,-31,-13,36,3,-44,-18,19,33,44,15,13,-28,-16,-39,-4,12,1,-27,16,26, \
+35,-62,-69,-31,15,29,21,1,7,-7,-19,-28,91,-7,16,16,26,-1,27,57,-18,-17,-28,-10, \
+-35,9,19,35,37,-11,5,-23,2,3,14,-2,-30,29,-4,-40,-49,19,-51,19,43,15,23,16, \
+-17,6,-53,18,18,4,31,-5,-49,40,3,-17,-15,-10,6,-36,3,-10,19,-9,18,-25,10,-9, \
+30,11,29,-14,-17,-1,-29,-8,36,-30,-16,2,46,61,-16,-13,7,-19,-56,17,11,8,16,5, \
+-18,18,-1,5,-31,3,-1,-24,-22,-12,0,-18,-31,2,-34,9,-24,-6,32,-63,-38,-15,-4,-25, \
+-27,-17,-29,3,-20,-5,1,19,-18,-12,12,-61,2,-25,25,-9,-25,29,-16,-25,13,-55,-5,20, \
+-35,27,-9,-16,-47,40,38,-10,10,-54,2,10,-22,-18,-6,-23,-48,21,24,16,20,29,-9,-84, \
+0,-16,-33,14,-29,-34,67,-11,4,16,17,-3,14,-3,-13,-8,17,19,12,-43,-6,14,-11,14, \
+3,33,-65,5,30,19,-15,-6,-10,12,21,-16,30,13,-59,-11,-4,-19,2,-2,-3,-8,8,-17, \
+15,-50,2,-14,-11,8,-18,-90,-41,-6,-8,-14,-18,19,0,-29,-24,27,3,10,0,6,-15,-28, \
+-28,-25,50,18,1,-3,-45,21,-49,29,-14,-40,41,-28,-8,-5,-42,12,-38,-6,-32,45,1,41, \
+-15,6,15,2,-8,31,11,2,23,-77,-29,14,-10,-8,-42,-10,39,-14,-28,-8,30,-18,-46,7, \
+-10,4,-48,-31,-9,9,49,38,32,27,29,18,18,-11,-14,37,-33,-16,-6,5,-19,-13,-22,-21, \
+-11,94,-33,69,-35,5,-2,18,-9,-30,-16,-9,-42,-3,3,-42,-37,22,-27,-19,-17,-18,15,6, \
+60,-10,10,-20,27,-43,-24,-6,78,62,56,0,-44,15,30,-19,55,55,-48,-12,-8,-7,-4,1, \
+-7,73,-13,-34,33,28,-32,-25,-25,-61,-37,13,-38,-7,-8,-17,13,5,35,10,-17,47,9,14, \
+8,-9,-26,35,-21,-9,25,28,1,56,-6,66,39,5,-7,32,-48,20,19,45,40,9,14,-27, \
+16,-22,-39,50,50,-3,9,68,-38,43,-9,18,-2,44,34,-4,34,27,40,-30,25,0,7,-44, \
+61,-2,13,-42,-6,5,4,-31,10,-11,26,-32,34,-29,-32,13,17,12,-16,-8,-26,32,-50,-34, \
+-33,15,-42,23,-49,-49,9,12,-10,38,-12,-15,-5,38,-5,54,39,31,26,37,14,-67,5,-4, \
+-33,-53,4,-31,0,-23,10,-28,7,-1,-13,-7,8,-76,-55,3,1,7,10,-28,37,22,10,-7, \
+-20,-17,11,3,24,7,-13,33,-40,-38,11,-14,-41,-42,0,39,40,-3,-7,-24,54,-3,-11,22, \
+33,1,35,-36,13,17,12,19,5,16,-60,-21,24,-32,-25,57,2,8,11,49,-8,-24,8,40, \
+-51,-4,-11,4,19,9,-45,-7,-4,-1,30,-9,-18,-5,1,20,-49,-39,-2,26,-2,7,50,3, \
+8,-1,28,15,-7,20,13,-14,21,59,-31,-30,-3,-6,7,-1,5,32,37,-60,16,1,15,2, \
+10,-6,-18,-5,23,1,-2,36,25,-25,-23,-5,14,30,-48,38 }
+#define CONV1_BIAS { \
+0,1,5,2,1,6,8,-7,-10,-7,2,-2,-1,-3,-5,3,0,2,3,9,14,-4,8,1, \
+3,7,-4,-1,6,4,12,4,1,-1,4,-12,8,2,-4,1,3,-8,6,-14,9,-2,2,-2, \
+-4,6,-6,0,3,-8,4,-6,6,-2,8,0,-6,6,8,6 }
+
+// CONV2_DS: bits fraccionarios de pesos 6, bias 7, salida 1
+#define CONV2_DS_BIAS_LSHIFT 0
+#define CONV2_DS_OUT_RSHIFT 6
+#define CONV2_DS_OUT_FRAC 1
+#define CONV2_DS_WT { \
+-44,-32,28,14,-9,-6,5,-65,-36,-36,31,-11,-63,-5,-11,-22,-44,-27,9,-13,23,40,-10,-48, \
+-30,2,22,-6,-2,7,36,21,-11,-18,-1,-18,-30,31,6,-33,12,-32,-29,-49,-36,-15,7,-3, \
+8,1,-14,35,-34,-31,61,7,6,79,-33,48,-2,-6,-30,-2,22,-1,-15,11,37,1,-13,-12, \
+11,-18,42,-17,32,-6,22,-35,-7,-30,-24,-2,-36,59,50,27,0,-18,-52,24,-36,-2,-19,0, \
+50,-3,-6,27,-16,-59,-23,-8,-24,29,36,-31,1,6,-13,-20,13,-12,54,-1,0,5,6,-13, \
+17,24,6,12,-42,-13,2,-10,32,11,-1,-21,-12,-8,49,-36,28,-12,48,28,-26,10,-43,21, \
+-4,-32,-2,17,73,25,11,-2,-68,-45,-71,-37,29,38,8,-13,21,70,4,42,40,-25,4,-25, \
+10,-13,-28,21,-2,-8,26,13,37,55,-38,14,-53,27,58,-29,36,20,11,-66,-32,-12,2,3, \
+24,4,-6,-30,-23,-6,67,-11,-3,30,24,19,3,49,-18,42,47,8,-16,-19,8,-60,39,-26, \
+-37,15,2,-26,39,-35,-17,-48,52,17,-43,15,-18,-26,-5,-59,6,0,45,-27,-42,-29,-18,25, \
+67,17,13,-34,-43,-37,20,34,-7,-39,23,-3,-23,-47,-55,45,-14,9,14,26,67,-5,36,-26, \
+-43,-1,-59,-46,-24,19,-7,-54,-1,-18,-16,-18,-4,23,15,1,-25,-47,57,45,-51,11,12,3, \
+5,-12,43,10,30,8,6,-14,36,-55,41,-6,8,-16,-55,-28,12,-14,14,-27,-54,-4,-13,-23, \
+43,-55,3,-9,39,4,10,8,7,-7,-5,25,67,-30,7,-33,58,52,7,43,6,-35,54,-47, \
+-32,35,27,18,-11,-21,-36,36,17,66,14,17,-16,-14,15,-24,31,32,-38,19,8,6,-10,35, \
+6,20,12,-19,-35,50,52,-1,33,40,46,29,-3,21,-15,7,-28,-49,-27,-47,13,20,14,-23, \
+-1,-39,13,17,58,-30,-4,-3,71,7,14,-45,-4,66,41,20,-11,-27,8,-18,68,-16,-14,23, \
+8,-27,-39,-24,48,-17,-5,28,49,25,12,-18,-27,5,-2,7,-61,-41,24,44,5,-37,18,-26, \
+-8,-8,23,33,19,-29,32,-14,-45,28,57,-31,-11,-18,-14,36,25,6,5,-22,-15,-21,18,20, \
+-11,22,-25,63,-32,-16,-2,25,8,-26,18,24,-33,-64,18,-31,31,55,39,10,26,-5,-25,-4, \
+-12,7,-35,-32,3,3,2,28,-44,19,-8,-1,32,4,27,48,-1,-54,-15,-14,7,-24,4,7, \
+-58,48,-18,-41,-24,22,94,-60,-20,35,-20,2,-13,-1,9,-29,-30,-43,7,73,35,-3,39,19, \
+-9,-19,4,-24,-1,13,-37,-34,-9,-24,-3,10,10,21,2,9,-3,3,-2,0,-10,9,24,40, \
+47,23,-18,-39,-47,-9,6,30,3,0,-36,21,56,-12,64,22,-25,19,7,11,-36,11,27,-36 }
+#define CONV2_DS_BIAS { \
+3,8,2,-4,-1,5,4,-1,-4,-4,-1,-7,2,12,-1,0,1,4,-2,3,-5,-7,-4,3, \
+-4,-5,1,-13,-3,-15,-4,12,-10,7,-4,-4,-2,12,-4,0,-3,-2,5,2,1,-4,1,-1, \
+0,1,-3,-8,3,-11,6,-4,-6,7,-4,0,-6,3,2,-2 }
+
+// CONV2_PW: bits fraccionarios de pesos 7, bias 7, salida 1
+#define CONV2_PW_BIAS_LSHIFT 1
+#define CONV2_PW_OUT_RSHIFT 7
+#define CONV2_PW_OUT_FRAC 1
+#define CONV2_PW_WT { \
+-5,-35,25,-15,-3,-11,5,-5,-9,-7,4,34,-26,23,2,10,-15,22,17,-42,-39,37,-13,-6, \
+-34,-1,1,-11,28,-5,19,1,4,-7,-13,32,25,26,-15,-10,3,-8,13,36,-13,-9,-34,27, \
+4,7,-15,0,-7,-15,12,29,28,-7,68,-15,0,-30,-6,7,-14,-3,-22,-10,-28,-10,-48,-19, \
+-11,-4,28,-25,-17,18,-21,-9,-39,-70,48,16,45,-3,-33,8,-21,5,8,13,-18,3,8,30, \
+-9,42,14,9,-14,7,14,-23,14,6,-6,-18,-5,15,38,3,-8,15,21,16,-4,-55,4,-2, \
+-26,1,-23,-7,27,-13,-53,23,-3,0,-41,-42,-9,-12,3,-5,7,-10,8,-12,10,14,-35,-1, \
+-9,-1,41,-14,-4,5,-49,31,13,-4,20,59,-18,30,38,-18,10,-29,6,-15,13,-9,28,27, \
+38,-2,-7,-7,-14,-3,-22,-6,18,22,9,-35,34,41,19,-9,15,-2,-35,25,19,12,16,1, \
+-27,34,-7,-7,11,-37,-5,13,-5,-53,4,20,-29,51,4,1,10,23,6,-1,8,-26,45,-37, \
+-3,-17,3,-2,23,-2,-6,47,-22,0,-8,22,0,27,-16,7,13,0,7,-35,11,-6,42,-21, \
+-33,45,44,-4,-43,-16,7,10,22,27,14,-4,31,36,9,-8,18,4,0,3,26,34,23,10, \
+-7,-35,-4,11,-19,10,-18,6,-61,10,16,1,16,-22,2,-9,2,0,4,-17,-10,-40,-5,-56, \
+8,44,-11,-10,2,10,17,-12,-7,9,9,-27,11,39,-39,-9,-7,-23,-30,38,4,10,22,-27, \
+28,-14,24,0,31,13,0,23,-14,15,-30,-3,43,21,-21,30,-7,9,-8,14,-11,32,-6,-13, \
+-9,-30,16,25,31,12,-3,30,33,-14,-27,-11,0,25,25,9,26,-5,-2,-49,-11,-5,27,-2, \
+-7,4,-7,-43,-14,-3,-4,-14,-10,14,-32,-6,-13,-5,2,16,-58,-4,-25,-37,4,3,-16,-5, \
+-18,32,39,26,-26,16,8,2,-3,-6,-13,-15,-18,54,13,-15,-14,13,41,38,-21,-29,-14,7, \
+-12,-12,47,-28,15,-3,-13,43,-28,6,-3,-15,-9,2,58,11,-6,-31,5,18,63,-35,-32,-40, \
+-34,27,-2,-16,3,-2,-3,26,20,-8,28,23,-6,-10,-8,-21,-47,26,31,-54,-7,-21,-9,9, \
+25,11,16,25,6,26,20,-15,17,-9,23,27,-31,14,-21,-11,-10,12,15,-1,-46,12,26,-59, \
+-13,-13,6,-6,23,-9,-20,-44,-42,-5,14,-23,15,-9,20,30,10,-21,24,5,1,9,16,26, \
+-29,28,6,30,-2,18,22,30,-7,33,-11,-27,-18,-29,32,22,-41,-5,6,5,-12,-15,19,-2, \
+-20,6,-15,-6,18,-4,57,-32,-22,35,5,-4,22,-4,-22,35,3,5,4,-1,-19,-22,-37,20, \
+2,-5,-33,-30,-9,7,-4,-2,-20,18,7,29,12,-23,-14,-4,26,1,0,32,20,15,-39,-4, \
+45,15,29,42,18,-44,8,-4,-20,23,-16,29,10,-11,-19,42,-5,8,0,-19,-7,-4,-38,-16, \
+-20,7,3,-27,-14,2,-18,-38,19,0,-7,-11,8,-9,1,25,32,37,-22,-1,-29,-24,-31,-9, \
+-10,-22,-2,12,-11,-19,17,-5,5,-24,13,19,-24,-24,-9,13,17,25,-21,-44,-20,1,10,-31, \
+-1,-8,10,-20,-4,-8,6,0,9,4,18,-22,77,31,-31,14,-11,-18,27,-53,-18,11,-38,20, \
+-10,0,33,2,23,31,-13,-9,31,14,34,54,-20,-2,10,-30,-22,-34,-6,2,38,59,-4,-3, \
+6,9,-1,33,26,-13,-51,0,33,35,-10,-13,2,-14,-21,-14,42,33,7,20,-12,-14,16,11, \
+-29,29,-49,-14,27,33,64,-6,-3,10,2,-24,-7,-8,22,-5,3,-1,-7,25,-11,11,28,-4, \
+25,-11,7,-32,23,27,-1,-36,-7,0,29,-52,6,3,-34,15,-40,13,22,-21,-24,-22,-11,11, \
+15,-9,13,-24,-3,-40,32,-29,-20,38,22,-24,21,62,7,-21,-14,39,-12,-18,57,-38,-19,-38, \
+-16,-11,11,-34,15,-14,32,-13,0,-44,-42,12,47,-38,-7,-5,1,15,14,17,-58,-36,49,28, \
+-39,-12,10,-19,-11,-36,-25,45,2,-2,14,-18,8,-2,15,-23,-4,26,12,-21,-45,13,9,-13, \
+-23,-2,5,14,10,9,-15,8,-2,-10,4,58,-13,-6,2,-4,-4,12,-22,13,23,-13,46,-34, \
+10,3,7,-18,-32,8,-41,20,17,3,16,7,5,0,-15,-4,-1,-14,-1,-27,9,-2,-49,-7, \
+-24,-3,38,-20,5,-23,-9,16,9,-1,21,24,47,-42,-35,-28,-18,21,2,-14,-7,-23,20,6, \
+-2,-41,-14,-33,-13,14,-20,14,-22,42,-4,-12,17,19,-23,-26,-27,13,-15,-12,7,-20,9,9, \
+-15,-21,26,-38,4,39,-12,-27,14,0,-20,11,-4,31,16,-20,15,9,-5,-25,17,5,-20,-4, \
+6,21,36,30,-11,23,-24,-3,12,-6,-13,0,33,13,-19,32,-6,0,5,3,-21,-11,-5,18, \
+-41,19,33,-27,0,-11,-29,30,11,35,32,26,-1,17,11,-2,15,-11,-2,12,21,8,-18,7, \
+48,2,17,-27,8,10,-14,1,-3,16,4,-33,15,53,-32,-24,-12,-22,-23,5,49,22,-4,6, \
+18,14,-6,-26,-24,43,16,7,19,-17,-9,2,-30,-21,6,-9,-38,-18,8,-6,30,39,-18,16, \
+-2,-16,18,23,-39,-36,26,19,21,21,-15,-18,-18,14,19,-40,-36,11,-22,10,-22,-22,-25,7, \
+13,-16,-9,-9,7,-1,3,-13,-1,-2,-3,6,-28,15,28,3,-37,27,-4,3,3,46,-22,2, \
+-7,17,19,22,8,10,10,13,12,-9,54,11,-60,4,6,-25,-1,0,-15,8,-32,31,-40,-37, \
+5,-44,21,17,17,-35,10,-22,19,20,-35,-16,-32,36,27,-26,-2,-68,18,11,-22,8,-11,-22, \
+-4,4,25,8,-7,15,9,1,11,23,3,25,0,-9,-26,-27,60,-41,3,6,-17,-23,25,-17, \
+1,-3,-15,3,4,8,21,-8,11,-37,7,-18,3,-25,31,-14,45,-34,-13,17,43,1,-10,-9, \
+-39,-38,62,-31,-9,15,13,0,-1,32,52,2,-27,-36,-6,27,9,-6,11,6,4,14,13,3, \
+-18,7,-25,9,-8,-29,54,-10,22,-16,1,25,-27,1,31,-12,12,-5,-11,-14,2,0,-10,10, \
+-3,6,17,3,-4,-26,-9,-50,-30,0,7,20,0,-40,9,12,-24,6,-34,-30,0,10,17,10, \
+-8,8,11,-19,0,18,24,-21,4,-11,11,20,-12,3,3,9,12,6,1,19,-67,-50,-23,-12, \
+-8,7,-13,-21,-12,-19,5,20,10,14,14,-4,-42,-30,-16,11,9,8,23,-11,-3,6,-3,-12, \
+-38,0,15,-42,-1,13,15,13,-8,13,17,16,-11,6,4,-9,-17,14,-25,19,-31,-3,-1,-10, \
+27,-6,0,-15,-38,7,-12,26,19,-20,-35,-5,15,-8,37,-6,-11,9,-1,23,-6,-22,9,3, \
+9,-3,41,-29,-25,-21,26,-34,-9,-37,15,-8,-32,20,-9,-21,7,0,5,12,-28,45,39,-2, \
+-46,25,-14,24,-4,-21,-13,-49,-23,32,44,21,-21,4,10,-3,-56,-5,-13,12,-32,9,-5,54, \
+34,-20,-23,-4,2,21,-20,4,-3,0,13,-36,2,-10,-2,16,-53,-23,-27,33,33,8,-16,14, \
+-23,-37,21,-9,-25,-1,27,9,-2,-51,7,28,4,-15,-4,23,-19,-40,-8,30,54,-13,11,-21, \
+-8,-25,-21,-2,38,-2,-5,-2,-20,40,40,25,-9,3,-40,7,25,8,-9,-22,-9,30,-11,-3, \
+35,-28,-50,-11,-4,-4,31,-12,3,4,0,-22,23,25,-40,-14,-20,-15,-33,62,8,-2,38,-2, \
+-1,40,-19,-26,13,-14,12,-27,-44,42,27,14,4,-7,18,-21,-18,-6,1,-13,-22,2,-15,-5, \
+-4,-1,-21,-21,12,16,-40,15,30,-2,5,-21,45,-31,31,-1,14,8,5,31,-14,20,1,-10, \
+16,3,-10,-13,25,-12,-26,-8,30,12,-30,-18,-24,41,-34,18,30,0,13,-6,4,0,-28,31, \
+7,33,5,-16,23,-19,-19,11,20,38,6,-14,12,5,-17,13,35,-15,23,42,56,-14,-33,0, \
+12,-8,19,0,-10,14,-10,-35,2,16,41,-1,-5,41,-7,-23,34,-13,-9,49,-25,31,-23,1, \
+8,26,-19,-4,3,28,-25,13,4,-52,-31,-2,13,9,-22,18,7,27,-1,-36,19,-25,0,-32, \
+25,20,-8,-17,6,-21,29,-37,-36,19,0,15,6,-8,-15,-34,-17,1,22,5,-21,15,5,18, \
+1,12,-24,39,20,-20,-14,-28,-22,-12,-10,-19,-6,15,-29,23,38,9,10,-33,-7,-10,-8,10, \
+-25,0,-52,38,-39,23,-6,14,-17,15,-10,-1,-38,-45,31,27,-8,8,8,-59,-6,-40,23,-35, \
+-25,5,33,19,47,-31,24,-8,1,-22,9,-12,14,6,-3,14,-37,1,-49,-9,2,3,-12,33, \
+2,5,-12,47,-3,14,-8,26,9,-32,16,-18,4,14,29,10,-10,19,-5,5,-10,8,27,40, \
+15,32,-20,5,27,-5,14,-8,-16,-5,3,-8,3,55,-25,-6,-31,54,26,-4,-12,1,-13,7, \
+-20,-8,24,-24,11,-33,1,26,-13,21,39,21,53,-11,4,6,-44,8,-25,-21,6,2,24,-10, \
+-25,7,-21,10,15,11,1,11,-30,14,32,-21,6,-19,-8,-9,-8,18,-56,-34,15,3,-35,8, \
+9,-14,53,1,18,15,0,12,-8,-26,-15,15,38,-25,41,14,8,14,-31,4,-10,-3,38,-5, \
+-46,-40,30,0,-30,13,0,-6,-8,-25,-10,-7,27,8,-13,39,29,-6,15,-8,-12,17,-4,4, \
+-24,12,21,-4,-1,58,0,-8,-1,19,3,-19,31,-16,29,-33,-13,-25,13,-8,-25,-12,-6,28, \
+5,33,22,29,-39,-42,-24,-26,-31,-24,-29,-51,29,-25,9,3,10,-47,17,40,24,1,1,49, \
+17,14,17,-26,17,-22,16,11,-17,-19,29,-1,-28,13,-15,15,-6,22,21,-5,13,-19,-46,22, \
+-7,-19,32,39,-15,36,16,-14,-6,7,0,-12,-4,-5,23,29,-1,6,12,12,15,-2,8,13, \
+-14,14,-21,-14,-33,-17,-4,-4,21,26,-16,-1,25,-18,-27,-4,31,-18,-4,-35,-24,-9,-43,-24, \
+-10,-4,-12,37,1,15,16,34,1,-48,-28,-31,4,32,-35,3,11,-7,31,-7,18,16,-27,-50, \
+11,-30,2,-17,11,-8,-7,-5,6,-7,17,-30,-19,-2,-13,-25,-13,-15,16,21,-4,-13,5,-31, \
+9,0,-49,-13,43,13,-17,-22,-28,7,4,-1,-6,7,13,6,-27,-13,12,32,25,-9,-26,37, \
+22,-14,36,27,-14,-4,9,-5,-15,46,-21,-20,-29,-7,-21,-12,1,-24,6,-27,-16,-10,-5,43, \
+32,-59,45,10,-5,-26,39,-15,-4,-36,-28,-49,-21,-11,1,28,30,15,-1,34,2,-20,19,-11, \
+41,44,-10,21,26,15,24,-4,-23,18,4,-31,1,-12,44,-62,32,4,23,8,-24,34,-19,36, \
+-18,-55,-5,-31,3,15,-30,25,-5,-18,18,29,3,-31,28,13,-26,-12,1,27,-27,9,46,39, \
+-16,32,-12,11,20,14,29,25,17,-1,-19,-2,31,4,-9,-20,-24,11,-24,8,-2,37,7,-29, \
+11,5,-8,8,-5,44,17,11,-26,21,35,-14,-20,-26,-14,10,-10,-20,34,3,-9,-2,-9,6, \
+7,-49,24,-7,-19,13,18,3,4,-26,-34,19,7,13,-13,13,51,-24,-22,-7,39,51,-10,31, \
+-5,-3,-19,-3,-53,4,-2,-39,0,-22,-8,-25,16,-36,-17,9,15,-14,-9,14,40,-15,11,7, \
+-12,28,26,0,-21,19,3,27,-48,-16,-19,11,3,-1,18,-23,-18,-8,13,-45,22,-23,5,24, \
+13,26,-3,-19,20,-16,3,-27,33,-30,-11,-13,40,19,-15,29,-12,-10,2,-13,3,-7,-28,36, \
+-14,-13,24,6,37,-4,13,26,12,-32,-36,0,-5,12,-14,-24,-6,-42,1,-24,3,62,-35,40, \
+-21,29,-23,25,-18,-29,28,8,24,-13,-8,7,2,0,5,10,-19,19,-20,14,-21,-17,-4,26, \
+14,30,33,-2,47,25,9,14,-10,43,6,-4,-2,-2,-1,-3,21,-13,8,21,12,17,-8,-7, \
+12,-29,-13,20,-2,-13,-25,0,7,-6,7,30,11,13,3,45,-18,21,-14,-7,10,2,-38,24, \
+10,-25,1,8,20,35,-12,-21,-17,-4,0,-48,7,-27,-5,16,-19,-6,-35,-13,-24,15,-40,-29, \
+5,-28,25,5,3,10,-30,12,24,-11,-36,-12,-32,11,13,36,-19,-26,-37,-28,41,2,-11,-19, \
+9,-25,-4,29,3,-29,-21,7,-6,5,20,8,-4,-25,-6,1,15,-2,-22,45,-16,51,-2,-17, \
+-4,-13,23,-19,-18,-42,-8,8,-9,-22,-37,19,2,14,-26,-18,-10,2,-37,26,0,-15,-13,-27, \
+20,-8,-23,-16,11,-28,2,22,-13,-12,30,49,3,-15,-8,12,19,0,32,29,-2,-3,-3,12, \
+-27,-15,-11,-3,-8,-13,-29,-28,-6,-30,15,30,21,53,8,-7,-43,-25,0,2,-23,-27,14,-13, \
+-22,-6,-5,11,23,-21,14,21,-7,7,-11,4,21,50,27,-32,-1,-19,-22,27,-21,-38,1,-28, \
+-26,-33,-16,7,-48,-11,-11,-12,-21,-35,-21,-34,36,12,42,-16,-2,-8,-4,-7,6,0,-27,35, \
+7,12,16,38,-4,-5,-24,-20,-32,-33,-11,-24,-20,-20,4,60,1,11,-6,13,23,-15,-16,14, \
+18,-10,-24,10,-2,-13,33,13,-14,26,13,3,14,40,-20,-16,1,8,-10,-9,-29,9,1,-1, \
+30,9,32,16,-39,27,9,-33,9,-19,18,13,-12,28,18,59,35,-2,-18,-24,-6,18,-13,0, \
+24,43,-30,-13,-11,-27,-37,16,10,-2,-26,11,-25,-3,-2,-33,10,-28,23,60,-12,-43,-22,50, \
+8,8,27,9,-30,38,38,30,19,7,-39,16,-11,3,-11,-2,-44,-29,21,12,-10,0,-34,43, \
+15,26,-33,0,13,-23,5,-52,0,-25,10,38,3,8,-1,4,-23,9,-8,-13,14,-13,36,21, \
+-33,-6,7,12,5,23,-1,39,16,24,19,-8,4,-52,6,-37,4,32,15,6,-11,-21,6,0, \
+-12,-28,8,-23,-5,-52,13,17,23,-30,-40,-17,29,-4,-5,26,-4,18,-8,-1,20,7,20,18, \
+-5,35,60,22,-11,18,7,-61,-38,2,21,10,-42,8,-21,13,-26,7,23,13,-11,10,-5,-4, \
+41,51,-24,33,44,-8,3,-10,10,-13,4,0,-11,-21,-2,21,-2,-9,-1,-18,-49,25,42,0, \
+11,-19,-28,-26,3,35,15,30,55,-14,9,-12,-11,-12,-31,19,21,27,-42,9,-36,-25,38,-14, \
+-2,-10,3,8,-14,-7,-9,20,9,17,-9,46,2,11,12,-4,19,-9,-25,-17,22,-16,20,13, \
+-15,23,-60,-16,-18,-2,-20,-2,6,8,-7,-11,3,19,-43,23,-3,32,-32,-32,-33,-40,-7,3, \
+0,0,18,-7,-32,0,16,14,-37,42,24,34,-18,-32,9,-25,28,-7,-5,6,20,18,-4,-9, \
+34,14,3,1,-52,-35,-44,-38,4,36,-22,-8,-30,-17,19,28,4,-6,50,9,-13,-21,34,8, \
+6,-21,-23,-31,27,7,13,29,-2,11,-13,-7,-22,-14,1,-17,20,-20,13,-31,11,12,-13,21, \
+-22,31,-1,-3,32,-17,-39,-19,28,3,1,-48,-15,53,-47,-47,-46,-15,-24,-12,22,-27,-25,-9, \
+-20,4,-29,19,34,24,5,-14,-9,-29,-7,-4,16,-1,48,-48,5,-21,7,2,3,-46,28,-25, \
+-8,46,-31,-17,35,27,-15,21,-3,-23,-13,-46,5,-2,0,-64,22,-25,4,8,-31,-22,-4,-3, \
+16,41,21,9,-3,24,42,-23,-8,3,1,5,-37,23,-13,5,4,9,-7,-20,30,-16,-28,-5, \
+18,1,-3,4,24,-1,-23,25,11,-23,-9,-36,28,24,4,-46,5,20,-32,15,1,-8,16,11, \
+39,-13,-6,7,-8,23,15,25,-15,-3,20,-4,-24,-17,-63,40,-12,-18,-20,-9,-4,21,6,-11, \
+-18,-5,7,-8,-21,2,-33,25,-5,-8,50,-9,12,5,-51,-28,3,8,-12,9,-17,13,-12,-7, \
+-44,29,4,37,-22,22,40,2,-6,-18,2,-18,13,-7,1,-6,1,-11,-3,-7,-16,-21,-31,3, \
+5,34,-6,4,53,-7,26,7,-8,-12,-9,-10,1,4,-45,-47,-18,12,-6,11,-15,31,-14,-15, \
+-43,13,27,43,-4,-26,40,-19,12,29,-36,23,21,17,36,10,6,28,-13,-40,-18,10,42,-27, \
+-39,28,15,-9,2,-3,-7,2,-37,-16,-10,-27,13,3,32,-10,-3,1,-41,-13,4,28,-32,-2, \
+-36,-23,35,-7,-6,-25,-18,31,4,16,-27,-40,10,16,14,7,8,-4,1,-39,-1,21,19,23, \
+1,9,-14,-3,26,10,74,21,-28,-10,-23,3,-9,-6,-11,-43,-37,-1,1,-33,-2,37,-9,40, \
+-8,26,-31,-1,6,5,16,-11,32,-3,-21,21,-24,-82,33,-35,37,0,-16,0,12,-12,-28,17, \
+5,10,-5,-24,-6,-38,21,-2,14,13,13,-3,-2,-25,13,-43,-29,0,-4,9,14,10,3,56, \
+42,12,61,25,-8,-18,-27,-26,6,-11,33,-18,8,-4,36,-15,17,35,-6,-23,-8,-16,12,20, \
+9,-12,2,25,-39,-34,-14,-12,-15,30,47,-24,-16,-8,8,-12,15,-11,3,4,-19,8,-9,-44, \
+-48,23,21,-1,4,8,-2,20,19,-1,31,46,-26,-19,9,-24,5,-31,2,2,0,-4,3,-21, \
+6,-3,47,15,12,37,10,28,9,26,-4,-29,13,-15,-31,-9,29,-16,26,4,20,2,17,-12, \
+-44,27,-3,-10,33,-3,30,-29,14,-1,4,2,0,0,0,-12,5,-19,-8,1,1,1,-5,-4, \
+17,15,27,-6,-17,-10,5,0,-63,-12,-12,-14,-37,43,11,47,-33,16,-7,0,28,30,-23,-23, \
+41,-17,-43,33,-31,1,21,28,0,8,-9,-2,57,-24,0,-13,-22,2,29,-25,-13,43,9,17, \
+17,3,-1,-9,-12,40,43,31,7,38,-16,19,-13,25,-23,8,-11,-2,-14,-10,-22,5,17,12, \
+-2,-2,23,45,-5,2,-4,-34,-5,-4,5,0,-14,-20,15,-23,-34,11,32,17,20,-13,-24,1, \
+-25,20,-33,-15,-7,-8,3,-28,30,44,8,36,-20,30,-7,-8,-27,-18,-53,2,32,8,22,15, \
+25,38,-12,16,12,28,7,31,-11,-3,6,10,33,9,-32,-4,-37,-21,-22,-49,-16,-33,-10,-4, \
+-16,-6,-27,15,10,17,13,-43,0,-14,-30,33,20,-26,40,-28,13,-50,-41,23,17,25,-18,-18, \
+-4,32,-29,-1,1,-27,-38,4,26,-27,20,-30,17,-2,9,11,-3,-10,46,17,-7,-3,-25,0, \
+26,4,-8,36,-43,6,-12,30,33,-43,7,71,54,25,-4,-18,3,-10,1,-12,-8,10,-3,-62, \
+62,48,5,16,-4,-5,-23,40,-15,15,-27,-23,1,-25,-8,-19,1,-4,-12,-1,42,5,1,38, \
+34,-4,-11,-77,-38,-46,-34,34,-65,-10,5,15,-15,36,-6,-40,-2,23,-17,39,11,33,-13,3, \
+-14,14,2,25,-8,-60,20,-5,23,-42,-13,21,-16,-31,-12,-23,-3,-7,-10,2,50,-25,8,13, \
+10,16,-42,34,12,28,32,3,-1,-18,-9,-3,19,-13,-56,-26,15,4,-61,10,4,20,-27,2, \
+-4,-17,12,20,31,-33,6,-15,-21,14,-5,-22,15,0,-6,9,25,6,12,31,-14,31,-15,-1, \
+16,-46,-29,-5,-2,56,2,3,2,-40,-13,-9,6,11,11,20,-1,-1,-38,-21,21,-48,1,-16, \
+33,18,-47,11,25,46,4,-1,-37,22,-26,-15,4,9,-37,-19,-4,-15,-4,0,23,-48,2,-28, \
+8,25,-25,18,-9,-57,-18,18,-8,1,-17,30,0,12,-13,10,-7,21,14,-12,-2,-13,-30,-7, \
+-23,3,-1,-3,-13,-14,23,8,-5,2,-3,16,21,28,-22,17,-11,-36,2,-22,-31,2,-9,5, \
+12,7,55,5,24,14,-13,-6,-28,-5,12,-8,9,-1,1,1,3,-21,-3,-30,11,13,-26,51, \
+23,-16,-19,-21,23,-9,-45,-24,4,6,14,-6,-54,3,7,22,-15,22,32,-30,3,15,-3,-3, \
+15,22,-5,-26,-1,12,19,9,8,23,-15,9,-51,-6,-4,4,0,-15,-32,22,-6,35,16,31, \
+-20,28,30,-3,-17,17,-8,9,15,5,-16,-14,-28,-10,17,-7,-22,-9,15,-16,10,-10,9,19, \
+-10,-24,-24,-24,7,19,21,-31,-44,21,-22,9,13,7,5,4,1,-2,9,-48,2,31,-7,-13, \
+3,-5,2,-32,-4,-12,-59,19,-19,36,4,-7,-8,24,16,25,5,18,-25,-16,-4,18,-53,-18, \
+10,-9,-30,-5,69,-20,-7,22,2,14,32,60,-16,-4,3,13,-3,-9,14,-32,14,13,23,2, \
+44,-7,29,11,15,17,12,-12,-32,6,10,61,-23,-3,-28,7 }
+#define CONV2_PW_BIAS { \
+-2,9,-12,-1,3,-2,-8,-2,-8,-1,1,2,6,-6,-16,-14,-6,12,-7,-7,4,0,2,-7, \
+5,-1,2,7,2,-6,-3,-12,1,2,7,2,4,4,5,-7,2,-6,3,14,3,4,7,-8, \
+-1,1,1,4,-3,-3,6,0,9,-3,9,-8,-7,-6,0,-12 }
+
+// CONV3_DS: bits fraccionarios de pesos 6, bias 7, salida 1
+#define CONV3_DS_BIAS_LSHIFT 0
+#define CONV3_DS_OUT_RSHIFT 6
+#define CONV3_DS_OUT_FRAC 1
+#define CONV3_DS_WT { \
+6,-8,-60,41,9,-29,-7,19,-44,-39,8,2,-30,8,-55,-16,13,-55,-41,-29,40,-23,33,39, \
+-16,-50,-19,-20,-4,4,-76,15,57,6,21,-9,-47,32,-14,-11,17,9,19,-34,42,-20,17,-23, \
+-4,-21,34,23,63,-82,-39,56,32,0,-38,23,49,25,-29,-31,28,-30,-8,18,28,-7,-13,-26, \
+27,78,-17,34,64,-37,17,10,-38,13,9,25,-53,21,-11,34,35,17,18,19,-50,43,-8,-15, \
+-1,23,-7,-28,-37,-34,-11,34,16,-23,17,-1,-56,1,29,6,-11,-30,11,-9,18,-26,15,-28, \
+-8,7,19,42,4,19,-6,-53,6,29,-10,-27,-14,-10,-37,-62,8,-22,1,54,8,-9,20,-3, \
+-47,20,17,-20,30,-11,17,10,21,-5,-34,45,-69,-34,7,-17,-50,15,1,-84,23,4,-5,13, \
+16,-12,-21,5,52,9,18,-29,-41,13,-27,12,12,-4,32,-30,-11,9,29,-43,-18,24,-70,6, \
+-35,-44,13,16,0,-5,48,-1,30,-18,-34,52,18,11,-14,-40,-53,-16,-1,48,43,30,30,-7, \
+22,-32,19,28,4,26,-47,-17,26,27,-38,29,42,-86,5,-7,-2,-8,27,-9,32,9,-5,-33, \
+-38,-1,-41,28,0,12,49,-19,-18,40,40,14,-9,19,-20,10,-1,3,7,30,-10,29,-40,3, \
+1,-6,-65,22,-48,24,6,28,-68,28,-30,-46,-40,-14,21,3,0,-29,46,12,39,17,57,37, \
+2,13,19,20,-4,36,-4,-3,2,-24,34,30,-11,57,30,-18,-40,-9,15,46,19,34,73,-4, \
+52,24,-13,62,18,-9,-39,34,-43,46,-25,29,35,36,24,38,16,0,12,37,48,16,23,25, \
+25,17,-36,34,-13,-10,-25,-1,-44,-22,-32,55,-9,-39,44,26,-39,-54,18,49,30,-12,6,-1, \
+20,-49,51,-25,34,26,68,9,-53,-17,-19,-14,48,-28,19,3,31,60,21,20,-23,-38,-15,38, \
+2,9,3,31,2,17,34,1,-73,4,38,51,-51,12,-14,-38,-35,-28,-49,28,41,-28,-24,25, \
+27,1,22,16,57,16,15,-12,-10,-20,-3,-15,40,-1,38,10,-13,32,-22,-41,-7,22,-6,35, \
+-16,16,15,-23,-14,37,-21,-11,-10,-7,-73,2,50,-10,-27,27,-33,-17,-57,-41,-68,10,-23,51, \
+-21,-2,57,-35,-23,30,-18,-1,34,-27,3,-40,2,7,-13,-15,-26,7,14,-22,9,20,-30,17, \
+-16,-1,-5,-3,-60,13,-16,-5,31,3,9,-22,-36,53,-40,16,-34,2,-43,2,-13,-6,-18,28, \
+-12,-27,-9,7,29,33,19,2,-44,-41,27,-14,-6,-27,-30,-5,31,28,-3,4,12,49,35,19, \
+-9,12,-14,-12,18,70,-33,-6,-30,3,15,2,10,20,-31,67,19,-25,28,33,-4,28,7,27, \
+25,-1,-2,6,-23,27,3,-41,10,90,-35,-14,15,31,-19,-6,16,36,-15,32,-2,-50,19,55 }
+#define CONV3_DS_BIAS { \
+6,-12,1,9,0,10,-13,-6,-5,-4,5,-7,-7,7,-2,-11,4,-2,-3,2,3,-2,-8,-1, \
+-2,-3,0,2,-1,2,3,3,7,-9,-5,4,18,-8,3,-3,3,8,-1,6,7,2,3,-1, \
+1,-13,3,-3,0,0,0,-5,-1,-4,-5,1,6,9,-1,6 }
+
+// CONV3_PW: bits fraccionarios de pesos 7, bias 7, salida 2
+#define CONV3_PW_BIAS_LSHIFT 1
+#define CONV3_PW_OUT_RSHIFT 6
+#define CONV3_PW_OUT_FRAC 2
+#define CONV3_PW_WT { \
+41,-3,-6,6,-23,-7,11,0,4,11,-20,-27,-10,-9,32,2,-5,5,-19,-21,18,26,-56,7, \
+23,-1,54,39,-16,6,-11,-8,23,-10,32,-5,17,44,-22,10,30,15,24,36,-13,6,-8,7, \
+-36,15,26,-54,1,-30,-3,14,37,10,0,26,36,22,3,-12,12,7,-24,1,46,12,21,-16, \
+4,13,8,44,-27,23,-10,-30,-32,23,-8,-44,29,-19,17,6,15,6,7,31,2,6,-13,35, \
+-20,-19,5,-1,-6,-11,18,27,43,13,1,15,17,3,2,13,27,10,-6,2,32,-20,5,29, \
+34,-6,-10,51,-13,14,31,25,-23,-3,-28,-11,20,-24,28,23,-10,57,39,11,11,30,-29,-31, \
+43,-9,33,10,50,-9,-13,4,37,-42,6,11,17,-2,12,12,14,0,45,16,-2,-7,2,2, \
+-27,-45,4,1,3,6,25,7,24,-8,-3,26,27,-41,7,-28,-12,-10,2,-23,39,6,-5,-24, \
+-4,-22,8,11,9,18,7,34,30,21,5,-3,17,-10,-20,-35,21,23,-21,30,8,-11,-21,13, \
+10,19,3,-18,57,-12,-13,17,-7,-11,-16,-8,13,25,-1,17,-10,-11,-16,-30,-19,-28,-5,13, \
+-1,1,30,2,2,-65,-17,-52,49,-3,-28,-60,26,15,9,6,9,19,12,-11,-16,17,-23,-7, \
+22,-35,24,-14,32,-16,1,-25,-20,-10,-30,37,19,15,29,26,6,-25,-14,4,10,-20,0,-23, \
+-6,-1,-9,-1,-36,-35,26,2,-16,39,9,-11,-8,15,19,4,5,-2,34,-2,-30,10,-8,18, \
+28,30,37,-11,-29,-11,13,-15,-9,-11,7,-1,1,-4,-63,-22,22,25,28,-1,-17,5,-5,9, \
+-28,16,-6,3,-45,-41,20,-20,11,1,-50,42,-5,-18,-20,9,-23,9,26,15,-5,18,31,14, \
+27,20,-4,-27,3,-39,2,-14,34,-44,-4,-1,15,-60,-25,-11,21,14,5,21,13,11,58,-26, \
+30,51,5,17,28,-14,0,7,-12,23,-7,2,-21,5,-8,12,5,-12,38,-25,14,-19,-3,34, \
+-6,-10,6,37,-12,2,-25,-10,-11,15,0,-13,-27,30,1,7,-1,20,7,17,-17,-14,10,34, \
+-22,27,-18,1,13,-12,-31,11,2,-15,-30,27,-10,-4,-29,25,1,8,31,7,-23,-28,7,-34, \
+42,-7,-11,36,-1,33,-19,-13,44,10,41,-7,-1,6,3,-16,26,-25,-9,-19,-69,20,0,-22, \
+23,16,32,-12,2,-40,47,-20,-4,1,-5,3,19,-4,16,38,2,-26,-33,5,-22,-32,-3,-13, \
+-29,-18,-26,36,-8,14,8,8,-30,-11,14,17,23,-32,-21,6,-30,-9,-18,-33,22,-6,9,-3, \
+-20,-8,18,19,-18,11,20,8,2,7,-12,-15,-23,-4,6,-2,44,13,4,-44,-6,-30,-24,21, \
+-14,20,-28,30,33,32,3,-8,5,2,47,33,-40,26,-14,-9,-16,-3,25,-1,-3,1,5,-39, \
+10,33,13,-15,-1,44,-34,-55,-2,-8,-40,-10,13,20,16,-1,22,1,22,10,-7,-9,-26,1, \
+11,-8,-41,-18,-2,20,29,-19,8,57,-44,-31,-7,34,-23,17,-41,9,-14,-5,40,-42,7,-13, \
+-14,37,7,4,-1,15,-29,33,-35,-48,-8,2,-13,-8,-12,2,6,-4,5,-14,28,-34,9,32, \
+1,-12,6,-24,15,-26,-15,4,-8,6,-22,28,-12,23,-1,25,16,-15,2,10,31,-38,23,-31, \
+1,-23,-10,50,6,29,-3,21,32,2,-22,47,-7,-28,10,5,-46,28,7,-1,27,-45,48,16, \
+-12,21,25,1,-8,-26,-24,-30,-33,23,-20,-28,40,-2,33,24,-34,30,14,18,14,-17,-25,-23, \
+-28,-17,-2,-26,12,-7,-23,-25,2,8,-25,27,-28,-17,30,-7,22,8,-39,8,-9,-48,-2,14, \
+-38,-31,-44,10,10,10,0,-14,30,-44,-5,-27,-20,-33,8,-21,9,-2,-17,18,-23,-7,37,28, \
+-1,-3,-7,-28,-36,16,-6,4,-14,-19,30,11,-51,0,-33,16,-4,-13,-9,-4,47,-25,20,11, \
+13,-11,-25,-22,18,-16,-7,-13,3,11,-39,21,-13,-14,12,-2,-9,47,3,-2,-3,-6,28,-18, \
+-10,-1,28,-22,-19,5,-2,30,8,52,-24,-38,21,36,11,-15,26,50,-33,7,28,-17,21,1, \
+36,11,-10,24,-27,1,49,21,12,-4,49,17,-28,29,1,17,-2,-21,-45,3,-20,0,9,-22, \
+-4,23,-9,-4,5,21,12,7,-26,2,-15,-19,-24,28,2,27,20,40,-29,6,6,-3,-4,-5, \
+3,12,-13,-8,-6,-11,-29,24,-52,20,19,-17,-28,-7,-17,-78,5,-17,11,-25,16,-48,27,-6, \
+10,13,5,21,-26,-19,-17,31,-10,-57,-12,-2,-10,15,-47,34,-26,7,-18,8,-23,-41,6,-21, \
+15,-7,36,11,32,10,-11,-14,18,-12,-9,-5,-14,-6,9,-21,10,43,4,9,0,45,18,-11, \
+-10,10,-14,3,-5,17,-30,7,5,38,11,-6,26,-13,6,-31,-30,10,1,-11,4,-31,10,3, \
+5,24,-5,-24,3,7,-11,-6,-20,26,-1,-20,19,-2,18,-9,16,42,73,3,-7,3,28,-35, \
+-4,18,21,-18,-4,22,15,61,-5,-43,5,4,-6,15,-4,-29,31,13,20,-6,30,27,-33,-20, \
+13,-45,-14,16,0,-6,-33,15,-8,56,-1,0,-22,-9,-15,41,-36,15,-13,-33,49,48,8,2, \
+-42,-5,10,-14,-21,-20,-49,7,19,0,0,8,-4,-28,-20,26,29,12,-2,-1,-8,10,45,8, \
+-35,17,23,1,3,2,18,-37,-19,-2,9,15,-31,10,17,-35,-13,0,7,-7,-2,8,16,12, \
+62,-9,-3,-2,10,-42,6,12,-46,-14,18,-12,18,32,10,16,-39,-7,0,-32,-3,18,26,-28, \
+-1,2,4,-18,6,-22,-22,14,38,12,24,-2,11,4,-41,8,-30,13,-21,26,23,-15,-16,28, \
+-24,18,12,4,-37,-21,54,10,3,-9,-16,-23,-28,25,-9,-70,6,3,-7,-1,-2,8,24,-27, \
+3,-9,-2,-2,-3,31,22,-59,-48,-7,-15,25,30,4,-31,18,9,-12,13,23,38,23,1,4, \
+-15,-6,19,-15,-14,-24,14,21,-23,-9,-1,-21,-7,13,-9,-5,-14,-27,4,-21,-6,19,1,40, \
+13,8,-10,-19,14,-29,13,11,-24,5,13,-22,-6,-6,26,20,-11,-21,3,-5,-25,-1,13,-4, \
+15,12,-22,-50,-24,-40,20,-4,-46,-27,23,-36,5,7,-22,24,-52,-10,-39,8,2,-10,-36,10, \
+21,-9,0,-19,-15,29,-1,-4,-19,15,-46,17,-22,20,35,22,3,58,-4,9,55,-12,30,38, \
+15,0,-1,-8,4,-9,-9,16,-25,-30,26,-12,9,23,-36,-11,-11,-19,-10,-3,-7,-9,47,-4, \
+32,44,-33,-14,-29,19,1,15,-40,11,11,-21,-1,5,35,21,-41,-21,11,-16,-21,-35,-9,10, \
+-1,12,-21,-37,-17,21,-23,-35,29,25,18,-3,-37,-38,10,40,-10,-1,-26,17,-32,-12,21,41, \
+-16,-8,18,-7,-15,-16,-1,2,-13,28,-22,7,2,-15,-38,16,-19,25,5,5,-17,-41,-16,15, \
+-13,-6,22,12,-13,34,23,-5,-30,-16,31,-7,-22,-5,11,12,13,1,18,-5,24,-23,33,11, \
+-15,-1,16,-2,35,-15,-29,29,-4,15,55,-9,-7,-39,-26,-11,18,-2,13,36,32,-22,23,2, \
+36,22,21,-21,67,8,6,-50,2,27,25,3,24,-1,-8,-58,12,3,-26,4,-22,-24,-6,-2, \
+-14,4,24,-1,1,-2,17,6,2,1,27,31,53,-2,8,25,15,-30,-42,-41,-13,-3,-24,19, \
+-9,29,-27,-42,-1,24,6,13,-37,0,19,34,-7,72,33,-3,-3,-4,-23,16,-8,-11,-23,30, \
+-7,-1,23,-26,8,1,-18,-23,28,1,-28,13,9,11,36,2,-35,-21,7,4,26,34,16,-7, \
+-26,-13,17,45,-12,17,26,-2,-18,-1,-34,-12,6,-21,11,8,-9,-18,37,-18,4,-4,10,16, \
+-4,1,17,-32,-15,-4,-2,13,11,27,-3,8,16,-21,9,64,-7,-45,-13,26,29,-43,-30,49, \
+-7,12,20,14,0,0,9,-7,-14,-5,32,-38,7,-38,4,22,-6,8,6,37,15,10,-14,-5, \
+-8,-18,-20,20,-40,28,-8,4,-24,-5,-7,20,5,-3,8,8,-15,30,1,30,7,-10,-37,-27, \
+13,-5,0,53,40,-19,32,-16,29,11,-6,20,11,-17,-1,-37,41,11,38,-18,24,18,5,4, \
+73,25,-21,-17,37,-25,-1,-7,-33,45,-11,12,-23,47,31,7,20,22,-20,-30,5,-3,8,20, \
+8,-39,8,12,6,-14,-9,-14,-40,22,-21,-7,-18,28,38,42,-18,5,-19,13,10,-2,13,-30, \
+30,-5,-9,-21,-19,4,-26,3,11,-2,35,-19,-19,41,31,41,-13,-34,21,-23,-26,18,47,-6, \
+-24,-19,-2,-31,-2,-37,-22,2,-4,-19,22,5,-19,-17,-17,26,28,27,-10,5,-19,5,27,-15, \
+9,-5,79,-8,0,-28,-17,10,-10,-11,-3,-40,23,7,15,29,24,6,-13,6,4,-7,41,-5, \
+18,-11,4,-22,0,9,-2,30,-12,-5,-24,-2,-7,14,17,13,-13,0,10,-20,29,24,18,-16, \
+52,-41,-15,11,11,11,-13,25,31,-7,-10,22,26,-2,-3,-11,-15,-20,1,34,16,-10,-13,12, \
+-37,-11,18,-30,-3,-7,50,-11,-20,-26,-26,-10,5,5,32,18,-34,23,10,4,5,12,-14,4, \
+16,-1,19,31,-25,29,7,1,12,-2,11,-41,4,45,20,26,68,23,-14,14,6,25,6,3, \
+13,8,-3,-3,25,-21,5,-39,3,3,17,0,14,10,11,19,17,12,17,23,15,10,-33,-27, \
+6,4,8,3,41,10,-17,10,-38,-8,6,32,-31,-5,-39,-3,3,-31,-21,10,12,-18,-1,-34, \
+-26,-24,-13,0,1,2,22,2,-26,-2,-15,-11,0,-1,-9,-66,1,26,3,9,-2,15,-2,-47, \
+8,10,37,38,28,22,-16,2,8,-24,-43,-14,-9,-24,-32,-17,6,21,-1,5,-43,-40,35,-13, \
+18,34,-30,-14,-19,-52,-11,-22,29,-9,19,3,-20,13,-13,6,-43,-10,3,8,-33,7,-15,-7, \
+-5,-22,9,5,-39,33,-22,-19,-41,32,15,-8,15,11,-23,-36,18,-21,1,20,4,41,-9,-15, \
+-49,-2,19,18,-10,-17,-2,6,-22,-6,-8,-4,1,-1,22,-31,2,11,-25,22,-12,13,7,32, \
+33,-26,21,-10,19,-5,20,3,-34,10,-30,-30,10,8,34,0,22,-11,49,1,29,5,30,9, \
+-17,-20,-2,-21,56,6,38,7,-13,-8,1,3,-21,45,8,-9,-26,22,50,-5,-2,44,-11,-15, \
+2,13,-15,18,8,-6,-27,38,19,-14,35,-20,9,58,14,-42,0,-16,32,38,35,-35,-3,-5, \
+12,34,4,65,-35,-3,47,4,61,15,44,-9,-15,-18,-38,-22,-14,14,5,-54,-1,13,83,-27, \
+2,-47,11,-2,23,26,20,60,23,-5,-24,-12,-18,7,-27,-13,-18,18,-10,-8,-10,8,-12,-42, \
+-13,-7,15,-16,54,1,9,-16,-3,-34,4,20,-2,37,25,8,2,30,-5,-27,-39,-16,-32,-6, \
+2,27,-18,8,-1,-2,-29,-12,-19,31,9,14,-23,0,28,8,13,1,-6,-31,26,0,12,-2, \
+-4,-19,-60,3,19,9,5,-8,-34,-33,34,32,39,-51,15,17,-23,11,-22,-22,-69,34,15,-30, \
+21,3,-3,23,-5,13,3,30,9,9,10,13,38,-44,1,-68,-21,34,-25,27,15,-5,-21,13, \
+4,51,11,-6,17,24,16,17,-18,-18,-1,-2,3,-26,-39,-17,-20,-21,-7,2,0,-35,12,-8, \
+-18,7,-1,4,-21,3,-10,1,-29,3,-23,6,-6,-37,-17,32,12,13,-24,39,24,14,-5,-24, \
+-27,40,-58,6,-9,7,-2,-5,9,-15,37,10,-8,-23,-17,10,-16,0,-24,-17,5,-2,-18,-20, \
+-8,-14,3,12,11,27,9,2,2,-1,-2,6,-41,17,21,-15,-11,-25,-22,-15,39,-24,10,-16, \
+2,-31,33,-31,17,11,13,-19,2,13,6,-45,-24,-7,9,-14,21,-23,24,-2,-23,-42,23,-8, \
+0,31,-17,48,11,-34,-10,-5,10,-4,23,34,-14,-24,-3,-14,23,-8,-46,30,23,17,-25,-30, \
+-20,-7,-8,24,-2,-25,-3,38,-24,43,-29,-4,-4,11,21,6,17,-19,4,-11,20,-4,-16,14, \
+-8,0,-62,19,4,-33,29,-44,1,-41,23,-31,-58,13,16,-10,7,-9,4,6,10,2,-4,-10, \
+30,-27,0,4,-30,-29,-19,0,31,-19,-14,3,-2,-32,20,63,-20,15,34,-1,11,5,52,-30, \
+14,3,-10,-10,-12,-5,24,37,-5,-12,15,-7,-9,33,-11,-8,-31,11,-16,-2,-24,-8,23,17, \
+14,11,5,-2,-28,-9,9,-33,-11,49,-6,-1,-1,2,-33,9,-13,-10,62,3,11,32,-33,3, \
+-15,17,37,-10,15,23,40,-16,-34,8,21,19,-3,-3,-1,21,-6,-7,-18,10,-45,7,-1,42, \
+-16,-20,-49,3,28,-13,-36,-21,46,-18,19,-1,-15,-16,10,-1,-41,0,19,4,-41,-70,-5,-32, \
+2,21,28,-9,-8,-19,-7,4,-18,-23,4,30,-3,2,11,-13,-29,-3,15,-22,-7,-9,-20,-8, \
+12,-4,-10,5,-23,6,22,0,-4,19,12,17,14,-32,27,-2,54,-43,14,-41,-38,11,10,14, \
+8,-37,16,13,4,11,31,-14,-5,31,22,8,16,-9,-24,14,18,2,7,-3,0,-15,-4,-5, \
+-4,1,3,-1,25,-4,26,-4,4,-36,13,16,20,6,27,-26,13,13,30,-6,25,-28,24,8, \
+47,-18,2,2,13,21,-4,-11,14,-18,10,-52,11,-41,-5,18,-6,7,5,65,9,0,-3,21, \
+-13,-12,10,26,15,4,-22,-16,-37,17,-16,-4,-2,-10,2,11,-27,15,-28,-8,0,-18,2,22, \
+-34,-32,4,-14,6,11,-10,12,40,-27,-10,-45,42,33,21,59,19,-12,15,29,0,30,15,-7, \
+-36,17,-20,10,-53,-22,-8,-2,-1,-8,14,-2,-4,28,18,23,-21,32,-3,34,29,41,-9,13, \
+16,7,9,11,28,2,-55,18,27,8,-8,13,34,-30,-14,23,-13,8,-7,0,3,21,-5,-16, \
+21,-4,6,5,24,-25,-11,47,-34,3,-10,-43,-35,-48,-36,-10,18,5,-24,-6,41,2,-50,-26, \
+19,-23,-11,38,-28,34,-14,-29,34,-45,-5,27,41,18,4,-38,2,2,11,-25,-9,27,44,-13, \
+24,15,1,-29,-22,-11,7,12,-6,15,-29,-20,0,-8,-4,34,17,11,2,-18,-8,13,-15,-2, \
+12,-21,22,-20,23,-34,-20,-1,36,-14,1,-33,69,-40,15,-42,-4,14,66,-4,37,-22,7,-2, \
+1,-17,45,-12,24,-5,-4,-13,-26,-31,-9,-6,28,40,-24,-36,43,5,-34,15,-45,17,-37,7, \
+10,20,-3,-1,-18,-41,9,-3,-26,-29,-5,-49,19,22,-8,-11,9,18,3,-5,43,-16,16,10, \
+13,15,-25,25,7,17,16,-12,32,22,16,-21,26,0,1,-17,-7,-16,18,-10,-34,1,-44,-4, \
+-20,32,2,-36,4,24,16,28,-39,-2,0,43,-8,0,-38,-37,-28,36,15,-30,8,-14,-7,23, \
+-12,24,13,-9,18,-24,-7,11,-3,27,-80,6,23,-20,-10,43,17,-55,-33,-40,-27,16,-9,-9, \
+-44,-4,-31,-15,14,21,-21,12,18,0,26,-6,20,5,17,12,28,8,-24,-30,3,-40,-2,-4, \
+11,-26,-31,9,-1,10,29,-7,-16,-6,5,25,-20,4,23,8,10,-2,-19,43,-28,24,6,-1, \
+37,-14,12,8,17,-27,-15,-2,22,10,-18,-50,9,-23,32,-3,43,8,11,-35,35,19,-18,6, \
+-17,-9,-3,26,-18,-2,-33,-4,-16,34,-6,-6,6,0,17,18,15,-43,39,29,20,25,-8,14, \
+-8,-21,-7,3,11,-4,35,51,0,24,11,-27,11,-27,-21,-2,-14,4,-38,32,-8,43,-14,-21, \
+-6,-20,-8,-20,11,-4,-1,-3,34,-15,35,-10,13,-30,48,-3,-22,-11,47,-23,-3,18,0,-24, \
+-1,26,12,8,2,32,6,6,-12,0,8,-10,29,-30,22,25,20,-35,6,24,-22,-14,-33,-19, \
+11,-13,-42,10,-21,-45,-6,-40,43,-24,26,11,-18,15,0,-1,-25,-17,-33,-10,-2,8,14,48, \
+-13,11,1,5,-6,14,14,21,-13,42,-22,9,-22,-18,-9,-6,-18,-12,-57,13,3,-6,-20,0, \
+5,-19,8,-37,-15,-5,35,-4,19,21,13,-7,-38,8,-15,22,-12,25,-13,-14,44,45,20,-48, \
+32,-33,-8,18,-1,9,-8,0,22,8,-14,12,18,5,-18,9,-26,-1,13,10,24,12,4,-17, \
+7,-10,-1,32,-11,-37,0,47,-46,3,3,-21,21,-3,-5,-13,-5,0,-10,18,-10,-20,19,56, \
+-7,-24,-22,2,28,-16,18,-35,-30,-2,5,15,15,43,14,5,-4,14,-6,31,8,-10,32,-10, \
+0,28,26,17,34,-10,2,12,-3,-37,9,7,5,2,-9,-2,-19,-17,-27,-18,22,19,-3,27, \
+-12,26,58,16,-15,2,-20,-9,6,-21,-52,-11,11,-28,12,26,-19,0,18,1,-11,-2,-15,7, \
+6,18,17,23,-27,-39,-24,9,-14,-19,-51,-2,-23,32,-9,-21,-24,-14,4,28,26,-10,47,29, \
+29,4,4,-31,-19,-21,-30,43,9,-37,-37,-8,10,7,-9,-18,-13,-24,-9,48,6,-52,-32,-56, \
+32,-10,6,-15,38,1,-27,-25,-29,14,-30,45,-13,15,12,7,-33,32,-16,8,11,-71,-11,13, \
+6,6,14,-12,11,-86,43,-58,5,13,-18,-19,5,-27,-7,-6,-34,27,26,22,57,9,-16,-14, \
+-10,7,-30,-9,36,15,18,-43,-27,38,3,8,0,-8,22,23,8,13,26,28,-21,-7,-27,20, \
+-27,12,33,-4,13,-1,-2,-11,28,-16,22,-4,5,-36,-14,-1,-2,16,-5,-25,11,-8,18,24, \
+-3,25,41,59,-11,40,24,16,-6,-11,-31,-34,15,-10,5,-18,-1,-26,-13,21,36,8,31,9, \
+12,14,18,16,-27,-54,-38,2,33,-10,-22,-11,34,-12,2,31,16,-34,-2,12,18,-35,-31,8, \
+-9,-23,-32,16,15,-10,26,-22,45,42,-13,1,-15,13,0,13,12,20,-20,20,45,-3,-36,21, \
+54,-17,10,-7,-4,4,-9,-6,2,22,-1,-4,16,-10,-4,-30,10,10,6,-25,18,17,31,-38, \
+-23,-29,-8,1,-29,-22,35,-10,-42,-13,-11,11,-42,1,-21,0,2,-2,-29,-68,-8,-31,-18,-48, \
+-7,39,-24,16,-22,62,-38,-7,5,7,-30,32,-2,-10,30,9,-11,-19,0,38,-36,-5,-12,-7, \
+-31,30,-12,-3,4,-11,44,46,35,12,18,22,16,10,16,-33,-28,11,-8,0,-20,0,-12,-13, \
+-20,7,-11,-16,-29,-3,-28,44,-17,6,-22,30,20,29,-54,-28,-12,1,13,-34,-30,-8,-14,-2, \
+-8,26,-20,-38,-21,11,-20,32,-10,47,17,-8,-34,-3,41,16,12,-24,-20,2,-14,0,15,20, \
+-12,-2,-7,-10,-5,-4,28,-22,1,-1,-27,-15,27,9,8,14,-3,-33,-14,-17,10,13,-23,10, \
+27,-36,18,6,3,13,-11,-27,22,21,-18,12,29,-26,34,35,14,-17,14,-11,16,-24,-22,45, \
+23,26,-10,-24,12,12,-12,9,10,-7,-30,-38,-2,0,3,10,-9,29,-25,-37,-46,-12,12,-21, \
+4,-30,-30,-6,-22,16,16,24,14,-14,-21,-32,-15,34,40,-14,-39,27,20,-18,-37,2,9,-14, \
+1,5,10,22,-6,38,36,-7,-14,-28,-13,-7,0,5,-19,0,-4,34,-4,-21,-2,36,2,16, \
+40,-3,-4,38,-7,-14,37,-6,-12,23,13,-49,22,-10,-2,29,13,27,13,30,12,-8,13,7, \
+55,-6,-32,38,6,34,21,0,-6,-3,-27,-1,28,-32,5,32,11,7,-6,-23,17,12,32,3, \
+18,7,-5,-29,0,40,10,-8,-11,9,-8,9,-25,-6,-23,-29,-29,23,4,-18,-20,5,-15,-36, \
+-21,22,40,6,3,33,-9,41,-1,-4,7,0,-8,3,17,22,26,21,-6,-47,30,-12,8,7, \
+16,22,2,-1,-53,1,-9,-47,-7,10,5,1,-30,1,-21,-16,37,-29,3,-20,-12,-17,-1,0, \
+-42,6,38,-26,5,-27,12,-25,20,-1,-5,21,63,-8,27,44,-35,-25,-18,-13,13,37,-21,30, \
+-17,-17,15,-20,-11,27,-4,27,7,24,7,66,-23,8,-15,51,-2,8,4,18,65,-38,-19,7, \
+-23,15,15,0,9,0,-21,-30,-9,-5,-5,31,-4,9,-8,-10,-7,8,29,-12,-41,-38,-34,-43, \
+-35,-26,15,-5,34,-38,8,8,16,20,-17,13,5,-9,0,-1,-8,-39,-1,14,36,-19,-5,1, \
+14,18,-3,-19,30,-13,68,27,-13,44,2,-37,-22,47,18,28,47,-8,6,11,18,-38,-24,34, \
+-37,-43,-20,-39,-35,-16,-36,32,-18,39,-5,5,20,-20,-3,28 }
+#define CONV3_PW_BIAS { \
+5,3,1,9,-2,-9,-5,-1,-13,2,-7,7,4,-3,-6,-3,-1,-2,5,1,3,-5,-11,7, \
+-7,0,5,-8,-2,-10,1,-3,-6,-6,-2,2,-2,6,0,-1,1,-1,8,0,-2,-1,-9,-3, \
+0,10,-1,-2,-7,-2,-2,-8,10,-3,6,1,-7,6,1,-2 }
+
+// CONV4_DS: bits fraccionarios de pesos 6, bias 7, salida 2
+#define CONV4_DS_BIAS_LSHIFT 1
+#define CONV4_DS_OUT_RSHIFT 6
+#define CONV4_DS_OUT_FRAC 2
+#define CONV4_DS_WT { \
+15,-43,30,-11,-17,-10,-4,1,31,32,-31,-17,5,3,11,-9,17,3,-36,-13,23,-50,25,16, \
+-25,-28,-8,-24,-17,25,-11,-38,30,-53,11,-2,0,-25,-16,15,1,65,9,48,-24,24,-20,2, \
+59,33,2,-37,20,2,96,33,-12,-18,26,-45,-12,-75,-6,19,71,13,-25,-12,-47,1,8,6, \
+-41,27,10,28,-33,-9,15,14,12,6,-50,-28,46,14,8,-12,19,-5,-11,46,11,37,-18,-42, \
+18,-15,12,23,-10,11,1,-49,7,17,-7,36,-24,-41,-23,24,-18,-66,55,-72,-9,-42,-29,-56, \
+9,-24,41,5,-14,10,-26,-8,0,-1,20,-35,-37,23,1,-3,13,-5,15,12,-73,44,-1,45, \
+-1,19,24,-35,14,-33,19,29,-23,37,11,4,-15,-24,-6,24,2,11,-12,-11,-24,3,-12,56, \
+-36,-21,-19,-2,-15,46,58,5,-22,17,-12,10,-25,21,-4,-23,38,10,11,32,-21,-5,20,-33, \
+65,-11,41,-37,11,-10,5,6,-57,-3,19,-48,-42,-6,-16,-13,29,-54,22,18,-14,7,12,7, \
+-53,19,5,-36,-63,-5,34,28,25,48,-4,41,-26,-18,-8,-24,64,-38,39,-2,-15,17,16,-49, \
+-27,38,70,8,-22,26,-64,54,46,-18,-12,-30,32,22,29,-15,31,32,29,78,36,15,39,15, \
+0,6,-25,46,-6,10,-48,-25,-6,38,-27,56,35,16,51,-35,-24,31,13,42,-5,-18,-20,6, \
+19,-42,-38,-43,-19,-13,-15,-50,25,31,-7,-61,-1,5,-39,-12,-34,45,-16,-73,12,1,6,13, \
+9,23,17,-20,8,-5,28,-14,-40,9,-8,46,5,5,47,-19,-32,6,-1,20,1,-13,5,11, \
+18,17,45,39,20,-1,-6,-36,-18,16,-46,9,-27,-20,-37,7,34,30,-18,5,6,39,-59,-67, \
+-13,23,16,-27,29,52,9,-32,18,-14,29,4,44,-20,8,14,-38,13,24,-42,5,-25,-51,18, \
+8,19,0,-70,3,-36,3,-12,19,-61,-1,7,-15,49,-28,-27,9,5,19,-40,-78,40,-21,-26, \
+-18,25,39,19,-25,46,-7,-24,-4,-17,-32,-3,-37,-35,22,-39,5,17,12,8,-1,55,8,32, \
+-28,15,-14,61,-29,7,5,-37,-14,-6,49,-34,2,21,-63,62,46,34,7,18,52,22,30,8, \
+34,-26,34,-12,66,-20,10,14,-34,-32,-38,9,5,-9,-22,20,-31,30,10,-5,-2,-9,-4,-14, \
+-8,47,58,10,-82,11,1,-47,37,7,-82,4,-34,2,-40,45,45,-41,-45,32,-23,-8,-95,8, \
+2,9,28,-12,-11,-37,25,28,-17,-2,-44,50,39,0,-69,36,-36,11,-70,29,47,27,21,2, \
+25,-11,-52,-20,-57,-3,46,-19,-1,-17,-10,-2,34,15,-28,-2,14,52,37,50,-52,12,49,1, \
+-35,32,26,16,-8,5,-16,-12,-14,-40,-6,5,15,6,-7,-30,30,-9,-29,9,-34,-18,-16,8 }
+#define CONV4_DS_BIAS { \
+-1,5,3,-1,-5,3,4,-4,10,-2,7,2,-8,6,5,-6,9,-9,2,-5,-3,-5,-5,7, \
+-1,12,-6,1,-1,4,-7,-5,3,-4,7,9,0,10,-11,-2,-6,0,1,1,1,0,-4,5, \
+-8,-9,10,3,-5,16,9,6,-9,8,0,6,-5,-6,-3,4 }
+
+// CONV4_PW: bits fraccionarios de pesos 7, bias 7, salida 2
+#define CONV4_PW_BIAS_LSHIFT 2
+#define CONV4_PW_OUT_RSHIFT 7
+#define CONV4_PW_OUT_FRAC 2
+#define CONV4_PW_WT { \
+-12,-10,-25,-22,16,-30,9,1,1,2,0,40,-17,5,12,6,-12,-6,-3,-19,-25,14,-1,16, \
+-2,-10,1,7,6,34,-1,-17,-10,1,-26,9,-32,13,-12,4,-13,-32,1,-11,25,26,-10,-34, \
+-12,44,-20,10,-34,-34,14,-2,9,3,-10,4,8,-36,33,8,28,-40,-27,-16,-19,-7,-27,2, \
+-34,39,-2,-30,-3,-14,7,8,8,-2,44,35,-16,13,26,0,3,-30,0,15,-45,-6,19,17, \
+9,-2,-14,14,5,3,28,-7,-9,6,-15,35,20,14,-29,46,20,-27,-36,-17,9,19,19,-16, \
+7,14,0,1,12,-24,-69,-7,-13,18,7,49,-7,58,31,17,-8,28,5,49,-10,-11,-10,-6, \
+36,5,-37,-15,28,10,2,-9,25,12,5,39,44,36,-24,27,-9,-41,-38,-16,5,9,15,-10, \
+-1,-2,12,-20,24,8,-72,24,45,-27,3,4,30,23,39,-28,15,-17,9,-2,-3,22,-10,-30, \
+-4,-4,-12,-12,-8,38,37,4,-46,2,13,-5,28,6,7,-8,-42,8,-44,45,-5,7,13,-16, \
+10,-9,26,-23,-12,1,8,-24,16,43,1,-1,-36,-17,23,40,9,-22,22,-15,2,10,-1,-7, \
+-6,8,-29,-6,49,2,13,10,35,9,-32,19,12,18,-36,-4,8,16,-9,20,-19,-28,-21,41, \
+-5,-10,25,-56,-60,10,20,3,23,17,6,-12,18,7,8,-10,-31,3,-21,31,2,-6,33,25, \
+-34,23,-11,-45,4,15,7,2,28,-11,-28,-5,-20,18,1,-10,2,19,-34,-29,-30,16,35,10, \
+17,-12,5,6,16,12,-39,7,-11,-13,-48,6,6,14,6,11,-18,-19,34,-26,-13,0,8,1, \
+26,-6,-20,21,28,5,-30,-6,4,30,10,3,-11,23,-14,7,28,30,7,17,23,-9,32,-10, \
+-19,19,-17,34,15,0,32,8,10,8,-8,16,-12,-5,21,-11,18,42,36,-8,18,15,17,-7, \
+-7,12,-2,23,6,29,6,6,-27,37,18,-19,7,-40,-24,-38,3,27,6,-8,23,5,-42,-22, \
+-10,3,18,35,-30,-11,-11,-25,13,32,-39,0,38,-9,4,-18,6,-18,13,-6,32,-23,-25,8, \
+4,-24,-5,-45,-26,13,23,-29,19,-2,-15,18,-31,23,-26,0,11,-14,-15,-14,12,4,-2,6, \
+-22,-35,25,14,-4,51,-7,3,-13,-5,-7,-1,12,-52,-27,-18,-6,-24,11,-21,38,22,-25,24, \
+32,18,2,9,-13,-5,38,-34,13,10,15,-24,-67,-12,-23,29,2,-29,39,8,-41,-12,18,-43, \
+-3,-18,21,3,-35,0,12,-11,-8,17,-22,-14,3,30,-24,-10,-1,-8,21,-11,-28,-9,21,-1, \
+-12,-34,15,-38,24,4,-10,-10,-16,0,27,-9,-2,-14,-4,0,-22,-13,15,37,-53,25,-7,-11, \
+-1,17,1,-10,-47,3,17,-26,-41,4,31,43,-18,-27,23,-27,-3,5,-17,-14,22,0,-11,29, \
+-5,-5,6,11,-39,12,-8,3,-11,12,-23,29,-27,-31,2,-22,-71,11,-10,12,5,-13,-12,-46, \
+-9,7,-9,8,25,1,36,34,32,-27,-14,13,-16,8,-1,14,6,-52,0,-5,-52,27,37,1, \
+-19,6,-23,-13,17,41,-11,-16,-44,-10,-3,-39,-23,-18,25,-39,7,20,27,3,19,-14,4,-17, \
+35,-28,-11,12,25,11,-6,-15,2,-3,41,5,24,10,5,26,31,60,16,-29,-39,57,40,47, \
+-1,-15,-35,43,6,19,2,-2,27,-6,9,37,-12,7,-21,32,-28,-16,4,7,-18,-20,-31,7, \
+-18,-14,-3,-9,-6,-20,-34,-4,12,-15,-31,-8,6,-19,-34,31,39,-9,-21,2,1,15,9,21, \
+19,26,-15,-36,-42,-34,-10,26,-21,8,-21,14,14,8,-22,-4,-24,-30,21,-14,34,-26,-17,-2, \
+-9,14,10,0,-20,-10,45,12,1,15,1,-19,-10,34,13,-7,11,25,24,13,-8,23,33,-37, \
+-19,-31,-31,-12,-26,8,-3,11,14,-4,0,8,-12,-30,-23,-45,-23,11,-33,16,-2,-11,-30,11, \
+-17,9,-16,25,46,-9,-18,-15,-3,24,1,-13,-22,-17,4,-3,36,0,-22,0,-19,0,4,-10, \
+7,-17,25,-26,30,-5,-18,-4,-17,-10,-9,20,20,-1,20,2,-52,-1,-7,16,-27,53,4,5, \
+-17,1,5,-8,19,26,-11,-6,-12,-30,23,29,14,49,9,8,8,-4,21,18,10,1,15,11, \
+4,-9,30,-50,14,21,-7,9,-3,-12,-48,-4,-24,20,22,-39,-43,28,13,17,-48,7,-2,22, \
+21,-76,46,-20,7,-17,-5,-44,4,-2,5,-13,-13,-7,-20,-21,-16,-25,8,-24,27,-3,2,-34, \
+0,30,-26,29,-18,-13,-14,22,35,40,28,12,-26,-6,-30,-6,6,45,-6,-47,-25,10,26,-41, \
+-16,-3,-22,3,-17,47,-23,-12,16,6,14,-11,36,-24,-23,-4,9,43,10,0,-10,-2,-21,27, \
+18,-11,25,-6,-12,-4,-18,-16,-20,-14,12,-12,16,18,4,-6,6,-11,12,25,-20,-28,15,-45, \
+-17,14,-25,-13,-10,-20,-4,-20,21,28,-9,-44,-19,-14,-14,-30,-1,-3,18,14,31,-2,2,8, \
+9,25,8,7,6,19,32,-8,-19,-1,-39,4,-5,-12,-46,17,-40,40,-15,-10,9,8,-42,-15, \
+17,-19,-25,-12,9,19,40,-15,-9,11,0,-68,-14,-24,-10,1,-17,8,40,-14,-17,-1,16,-22, \
+-8,0,-7,67,24,0,7,0,-2,11,-1,-26,9,-16,-16,-24,16,-40,-8,-1,-24,1,-22,-7, \
+23,-35,50,-13,-6,3,23,0,14,2,17,-30,19,-30,-14,4,-19,-21,-28,-11,-29,3,-11,-3, \
+-2,-28,-42,-21,-11,-21,-20,-11,-31,-5,14,-16,9,-40,-10,4,26,-6,-40,-41,-7,32,-12,-32, \
+-2,23,2,-8,21,-19,21,-15,-25,-15,-7,6,-32,9,-10,-21,14,-11,5,-21,-5,-23,31,-34, \
+9,17,-14,1,-59,28,-3,-16,10,-3,-20,22,-19,27,-18,-34,-22,6,-20,0,-2,18,-26,-29, \
+16,-8,-18,-16,-80,15,7,27,-34,-15,-6,13,4,32,5,-6,0,-38,-14,4,32,4,8,-16, \
+8,-37,7,-57,1,-2,16,19,0,8,-16,40,-33,31,-12,15,-7,3,7,-41,-45,-12,-23,-16, \
+2,-21,-23,-2,-6,-10,-10,-59,64,20,-21,-24,24,5,-22,19,-26,12,-21,-9,-14,-37,-20,24, \
+-5,2,25,87,24,-27,12,-7,-2,-2,-27,14,-9,15,44,22,10,-19,20,21,8,-3,-40,38, \
+-24,-20,1,3,39,0,-22,-32,4,13,-4,-20,20,32,-9,26,9,1,4,-26,27,-38,-21,5, \
+30,12,40,-5,12,14,26,-11,-16,-8,-14,-18,-2,1,-20,-47,-19,3,-8,14,25,-22,-48,-36, \
+-16,-13,9,4,8,-12,-21,-10,-48,-17,14,29,23,17,1,9,-1,-5,-32,-1,16,12,-6,-14, \
+0,0,-2,58,-1,10,36,12,-2,1,21,17,13,-14,-14,0,-46,54,7,18,-14,7,2,33, \
+-11,7,-6,43,-6,20,-42,38,9,-29,30,-6,-15,-11,3,20,4,-13,24,15,-3,17,-47,7, \
+17,35,-3,-33,-4,2,1,-25,46,38,52,-1,0,14,11,16,16,-31,10,10,-23,4,6,-23, \
+39,15,-1,20,-3,37,18,12,13,25,21,3,4,4,-17,-4,35,16,-17,11,32,-4,-34,34, \
+-16,18,-47,-14,-24,8,32,-9,-2,-12,-9,-11,-20,3,-2,-4,24,-29,-41,13,28,-14,19,-30, \
+-8,-7,0,-15,-5,-17,14,-11,10,3,35,3,-31,-47,-39,-5,7,-12,19,14,1,20,3,27, \
+7,-16,-23,-22,-5,-14,16,-19,-1,6,-14,-22,38,4,-25,35,11,10,-2,23,49,3,10,1, \
+27,-2,9,20,-6,-15,-25,2,55,41,-36,-58,-41,-33,7,0,11,24,67,-6,-3,-11,-44,13, \
+41,21,11,-1,-3,-17,-32,-15,15,39,0,16,21,0,-29,-8,3,-35,-7,44,-5,-17,-20,2, \
+-35,-2,40,26,5,0,41,-8,-26,-44,-32,-49,-10,2,15,-9,-20,4,-33,30,-9,-14,-27,1, \
+17,-10,6,6,11,-24,-1,66,18,-1,1,-32,33,-3,5,-20,47,-40,-36,-18,-16,-12,-35,-27, \
+-27,-48,-7,-4,1,-6,-6,-19,8,0,6,-31,-11,22,1,21,2,31,52,-29,-40,-53,53,-12, \
+-41,-2,-1,-3,20,-14,-14,7,4,-27,-15,-9,10,-8,4,-12,-9,14,19,38,-2,11,3,-32, \
+39,-11,30,4,15,20,18,-1,-31,-12,-15,8,13,32,6,-14,32,2,-28,-18,34,48,16,-23, \
+29,-19,1,-11,-7,-1,15,19,17,-16,11,-2,-8,6,-9,15,-5,4,29,-24,10,3,33,21, \
+-27,12,-38,19,-32,11,9,-5,37,36,-3,-16,-2,3,15,20,-27,21,-8,-27,25,-10,-5,31, \
+-36,13,-27,-15,29,30,21,-7,16,-17,-50,-10,-9,12,-11,4,-5,8,-12,32,-18,48,11,23, \
+6,46,0,-5,-5,5,42,15,-66,27,5,-36,-5,-19,0,9,4,56,14,-9,1,1,13,2, \
+47,-2,-8,-7,-22,23,27,11,20,-29,6,-43,0,4,-18,66,15,17,27,21,-35,4,16,-2, \
+11,8,0,13,4,16,-8,4,35,-22,-6,-27,-16,-11,37,26,5,-29,-16,-15,32,-6,-27,19, \
+-26,-30,-73,-7,9,-5,7,35,-11,9,-2,-21,16,-8,26,17,11,-11,32,-14,-35,3,-6,-30, \
+-30,-23,8,-2,9,-32,-28,22,32,16,-2,3,-20,-30,8,40,-16,22,-14,49,-8,-28,-4,3, \
+-30,-32,68,-12,-38,-8,-26,31,-25,21,29,16,-16,1,-1,15,20,-14,-68,9,-13,33,6,4, \
+-8,4,-35,3,20,-6,-9,-41,-22,12,-41,-4,7,-24,-27,36,-4,-43,-3,39,-11,-5,34,-5, \
+15,38,8,5,0,-7,13,-9,-19,7,13,-7,-38,13,8,0,0,10,-42,-11,9,-43,-15,9, \
+2,-51,17,15,-23,-21,-43,13,-3,4,-22,21,-4,21,2,20,11,12,21,-25,20,-28,-41,9, \
+-32,6,4,34,-17,-1,12,-22,-33,-10,33,-25,-20,16,25,2,-69,15,-21,-11,18,12,-16,-11, \
+15,-25,-1,-18,-20,1,-12,-29,-15,1,1,-23,-2,30,6,-8,-21,-5,-6,24,-5,-2,33,-26, \
+1,-4,-13,6,-10,-12,0,-14,13,35,-3,38,0,-4,-11,-4,15,-27,0,6,-21,21,-9,25, \
+5,-27,20,-12,32,-8,22,14,-1,14,24,22,-14,-17,-44,27,16,10,13,60,19,-13,0,14, \
+20,-15,20,-12,-5,-29,-16,-27,-18,25,-4,-68,-15,26,0,-17,-22,-13,-28,-18,-28,-41,4,2, \
+21,-24,4,-37,22,5,-25,24,19,34,-17,-15,9,18,4,13,-10,10,8,23,-6,23,0,22, \
+-23,22,6,-35,40,-58,-10,24,-28,-25,1,17,15,23,-15,11,8,0,-14,-3,-4,-37,14,6, \
+21,11,-28,-17,8,-5,3,20,-10,-19,11,-1,21,49,-18,5,-1,18,-2,-19,4,2,16,16, \
+39,-29,8,-18,26,24,21,-5,15,-11,20,19,-10,-6,-14,-5,0,33,-6,-40,1,-17,16,48, \
+2,-31,16,-14,22,13,-24,16,15,-5,17,-22,-32,1,-8,2,-27,12,13,-16,-10,8,-26,6, \
+31,2,-26,30,-5,1,3,9,11,12,12,-25,-7,9,16,22,-14,-10,40,-15,7,10,41,-28, \
+0,-6,8,15,16,-3,38,-12,-11,-29,43,19,18,-19,27,18,6,-9,25,9,21,-4,4,28, \
+29,-14,-36,17,16,-21,14,8,14,-20,-33,7,11,10,0,-2,-21,-51,-7,-19,-13,30,27,-50, \
+10,-14,-16,60,-44,10,8,10,5,13,-5,30,-8,-29,-8,-29,-9,19,12,-28,-15,-12,1,-35, \
+38,6,-49,9,-5,-35,-18,-14,17,-25,11,27,13,-27,-12,-27,7,31,-18,24,-5,6,35,-14, \
+-36,8,7,-33,9,-3,14,50,-10,18,30,5,6,-49,51,-14,-30,36,25,43,-9,-10,-3,10, \
+-13,15,16,26,-6,-3,-5,-21,-10,-37,-3,-19,-4,25,25,-43,-35,-17,16,-9,7,-25,2,2, \
+0,-13,36,4,3,-21,15,-7,-18,-28,17,-45,23,-22,-30,-19,9,-18,-18,-31,-9,-15,-9,-2, \
+-5,-3,30,33,-10,-1,-9,22,-4,11,42,-6,53,-28,-14,-3,-42,-4,-20,-18,-11,1,-26,0, \
+-30,-2,-11,-17,21,15,-10,-49,25,7,-16,4,-12,11,-18,-40,-40,-11,54,15,26,22,-24,5, \
+3,22,-21,25,18,-23,40,4,-5,-4,-22,-11,-3,16,-24,26,28,-40,48,36,1,26,5,42, \
+16,-25,-1,-6,-34,3,10,-4,44,21,-17,3,11,-21,-1,-5,23,10,24,3,54,-32,-35,1, \
+8,10,11,28,27,-17,-27,-6,-22,18,14,39,4,18,23,-53,-49,8,-17,51,64,-16,-7,-31, \
+-31,8,11,-21,-41,11,4,14,5,20,6,22,12,-35,8,-22,3,-16,3,-9,-32,-1,-3,14, \
+-52,-8,-59,11,5,-23,-2,-18,-13,-12,6,-5,6,-41,-14,-17,-10,14,-4,22,4,0,30,-14, \
+-25,1,-19,15,2,38,1,-8,-14,0,-18,-29,13,-15,1,-25,5,17,0,-13,-16,17,32,0, \
+20,-13,-48,16,22,8,-4,65,-1,3,5,35,-35,-11,-35,-40,-28,-31,10,-7,16,-9,-32,-15, \
+-29,4,14,10,19,21,-22,-10,5,15,-14,-3,-13,32,6,4,-14,-18,-62,32,22,5,9,-1, \
+13,-12,2,3,-18,33,-43,-11,7,-13,32,-20,11,-7,-9,12,-4,-2,-35,-21,32,-27,-4,-1, \
+-2,11,27,-5,25,18,-30,-11,-20,19,50,13,24,-14,14,11,-22,-2,-36,29,-15,0,8,1, \
+-4,38,-14,-14,-2,-48,-2,-10,-13,-3,4,38,5,0,-14,6,-41,-30,23,4,25,-24,44,21, \
+-14,-31,-27,0,13,9,7,11,-27,33,41,-52,-10,-11,22,16,4,-35,-23,-17,2,-3,-17,22, \
+15,32,-7,12,9,41,22,10,5,40,30,17,6,24,34,-27,3,-46,16,-22,-3,-7,28,-41, \
+-19,1,9,-7,43,-58,-20,-11,16,-8,-13,-9,18,-30,3,-34,-18,-1,48,-6,-18,1,59,10, \
+8,-3,-18,3,32,-57,15,-26,1,29,7,26,-2,5,-5,-16,1,28,-11,-22,-8,-23,-41,-19, \
+61,9,-8,34,-1,16,-27,-40,27,-4,-1,10,-5,45,-21,10,21,-15,15,-29,15,23,23,-29, \
+-10,11,-2,-11,-15,27,20,-10,34,-6,14,49,-22,-3,11,-9,-8,5,-27,-5,40,-2,-8,46, \
+6,-6,3,13,6,-35,0,35,11,31,-20,-10,-5,-4,17,19,12,-21,-28,-24,-5,-40,-4,-2, \
+14,18,-29,-8,14,4,2,27,0,24,1,-10,-22,34,16,14,-55,52,32,-4,-8,1,2,-5, \
+6,5,-2,-31,10,-10,-23,27,-19,-1,-26,-15,15,-8,-19,22,-17,12,-13,-4,-7,-21,14,-9, \
+27,-9,-10,-27,2,14,-7,7,31,-9,-42,4,-9,-23,9,14,28,-26,8,20,-25,19,-20,22, \
+-3,24,-29,2,-14,-11,1,2,-18,-24,2,-26,12,-9,35,30,16,4,5,-2,-19,-18,-24,60, \
+1,-15,-7,-23,15,0,-46,-16,21,-22,22,14,-10,-2,-14,-18,-2,-10,-12,-7,-5,33,-40,8, \
+-27,-36,19,32,14,-36,39,0,-1,-3,-4,1,-34,-21,24,4,16,-25,-16,-24,-17,-6,-38,-22, \
+-23,-29,-9,-16,-16,40,-36,-4,-20,-3,-1,-4,34,-6,-1,8,18,17,-4,1,-33,-12,11,-19, \
+-4,3,-33,-20,-19,8,28,46,24,-30,18,-7,-7,-40,42,35,-14,11,-8,-15,13,9,2,-13, \
+2,-6,5,25,-65,-3,-33,18,-13,-15,41,-4,-16,13,-3,8,-19,14,27,21,7,4,13,14, \
+3,5,10,-16,-54,2,4,27,-16,19,9,-13,-37,14,32,-24,27,1,2,14,-12,-50,-21,39, \
+5,-58,-30,-9,14,-14,-7,18,-7,0,-42,15,40,-14,24,-22,40,4,-47,17,-23,49,8,40, \
+-8,4,-4,-11,-8,2,28,-9,28,11,-1,-8,11,5,-41,-20,-15,-29,21,16,-11,-12,18,12, \
+-22,17,-15,9,0,-9,-8,4,9,4,17,27,-1,63,26,7,14,59,9,25,-12,-4,-25,-19, \
+22,13,-12,64,-12,-25,30,-18,-28,-26,21,8,3,-23,-8,-10,33,-32,46,23,-37,19,2,60, \
+17,-6,26,-13,-40,-4,-15,45,-20,-12,11,-32,-4,36,12,21,7,16,-7,-55,10,13,-7,5, \
+3,20,-5,21,48,5,-25,-10,27,-18,-11,-14,-43,6,-28,-35,-65,1,-19,-11,-26,35,23,18, \
+16,3,-36,22,-16,-20,4,-18,-29,-22,31,39,0,-17,8,1,39,12,13,-10,46,-4,-16,-27, \
+-29,5,-43,-28,-9,-22,26,3,-27,16,-3,2,-77,-8,-11,26,4,-12,-57,-5,18,-1,9,-1, \
+27,17,-28,-20,-13,-4,40,-29,5,22,24,19,-37,-30,17,-15,-36,-14,-3,-50,11,-9,-10,-11, \
+15,21,-32,-13,25,-3,9,-26,-20,45,-6,22,-41,25,20,19,33,24,13,-31,-13,-11,-34,11, \
+-4,5,-24,6,-3,23,-17,5,-46,12,0,14,-4,-33,-10,0,-46,-35,-26,17,48,-2,14,2, \
+15,28,-39,-9,-19,18,-11,14,16,-11,-7,-13,5,31,24,21,-52,-41,-31,-21,8,3,61,-12, \
+-9,-3,-63,5,10,17,13,-9,17,16,-19,-19,-54,-10,-9,37,0,-10,-12,-2,-66,-24,3,22, \
+11,5,-17,-27,-44,0,2,0,-13,-7,-7,-5,-6,-20,-31,11,9,25,17,-2,-31,5,22,0, \
+27,20,2,4,-19,-3,-15,-22,4,45,-2,38,8,-9,44,15,2,-11,10,76,2,42,15,15, \
+-11,0,-28,-8,-14,19,-29,-8,23,-18,21,-45,-22,-10,-4,-8,21,10,15,35,-20,-21,6,-9, \
+32,-22,-5,-19,9,15,-20,35,5,-12,57,-19,-2,-37,7,-10,-32,-19,-51,13,12,-10,-8,-2, \
+6,5,-36,-8,-37,-32,-23,-20,-1,-27,-24,22,31,11,17,-31,33,7,2,1,-3,6,25,27, \
+-7,-6,-1,-17,12,-2,8,0,25,39,-18,-1,5,1,-24,3,4,-9,12,-35,-16,30,4,13, \
+7,10,30,-27,8,-36,51,-36,12,-8,15,-45,12,-28,2,-42,26,-49,-9,18,32,5,-13,-9, \
+-24,7,8,-13,28,-18,-1,-7,33,-12,41,-15,-9,5,32,7,17,9,40,-1,1,-7,-15,-9, \
+-16,7,-4,42,-1,2,3,26,59,13,5,-16,18,15,-20,8,18,-11,-7,12,-22,14,-2,-40, \
+14,-40,-9,35,-23,21,7,20,4,8,-11,-20,-26,41,2,5,12,14,9,15,5,-74,-19,18, \
+8,2,-9,-24,-15,-5,37,-1,28,-12,-2,5,-12,9,28,51,-31,3,-29,12,-9,10,-3,29, \
+8,-20,21,16,0,-29,26,35,-44,3,11,23,15,7,-40,-20,-5,-4,3,8,3,29,-38,1, \
+6,-14,10,6,33,-24,64,-3,7,7,-14,-11,4,-12,-34,4,-13,25,38,-13,-21,-18,-45,-10, \
+-45,18,-9,-1,-5,-4,-52,25,-33,-24,-1,1,5,4,-46,15,31,-13,26,-7,10,30,22,-14, \
+54,-6,37,-26,36,-26,-13,-7,35,-1,7,7,-1,13,45,-4,-8,-8,39,22,9,5,7,-1, \
+13,3,-10,5,-28,-39,31,-34,6,-23,0,33,13,0,-18,19,-23,-14,29,-2,8,-5,-4,4, \
+-49,31,52,35,52,66,-2,-34,-18,-6,47,1,6,-18,-12,13,-2,-6,-57,18,38,43,-23,-7, \
+11,-31,3,-26,-8,-9,-24,25,9,16,8,16,29,14,-8,4,-5,-2,4,7,14,7,-15,30, \
+-5,-4,-36,-18,5,21,26,-16,14,-9,-39,30,-7,3,-24,-37,28,-23,-14,1,15,-27,-40,10, \
+-27,6,-15,6,19,-12,9,26,-7,-18,-46,-1,-2,54,-24,-26,52,25,9,-39,26,-18,-3,4, \
+32,-11,33,-39,-32,-54,43,-2,36,-25,-22,-7,-1,17,30,-16,14,-20,18,-9,-24,20,-17,2, \
+14,-25,7,30,40,-9,-19,6,-21,47,-15,14,0,-9,10,5,-33,27,-34,-27,10,5,-6,-46, \
+8,-6,-18,-23,-43,-21,-20,16,-9,-55,-15,-38,-7,-23,17,5,-13,51,-19,2,2,-9,3,-54, \
+-9,12,4,14,34,10,2,1,-7,22,-12,-2,-11,2,-7,-19,-28,8,-28,-21,-6,6,0,2, \
+-18,17,-26,-23,28,-23,5,31,-24,8,-39,-7,-2,8,-7,-21,-7,-12,13,-31,-37,-26,26,69, \
+-4,2,-23,-2,-56,17,-29,-11,4,6,30,2,-33,42,-22,22,-17,19,8,5,38,-3,11,21, \
+40,7,11,-19,-28,1,14,37,6,35,-1,10,25,-15,-6,-1,33,-6,-28,26,-23,29,24,17, \
+-34,-32,12,-15,5,-20,30,-18,-12,-14,-48,3,-19,64,25,-29 }
+#define CONV4_PW_BIAS { \
+13,-3,-3,7,2,6,0,-6,2,-4,-10,-6,0,11,2,0,9,-6,3,8,9,0,6,-8, \
+-9,10,-7,-3,7,-7,9,-4,-4,-6,5,6,-2,16,4,7,9,2,0,-6,-1,-3,-4,-5, \
+9,-1,8,-4,-5,12,-8,4,-3,10,4,-3,0,0,13,-8 }
+
+// CONV5_DS: bits fraccionarios de pesos 6, bias 7, salida 2
+#define CONV5_DS_BIAS_LSHIFT 1
+#define CONV5_DS_OUT_RSHIFT 6
+#define CONV5_DS_OUT_FRAC 2
+#define CONV5_DS_WT { \
+-26,-1,48,-15,0,-42,-31,-60,-47,45,-44,-12,-50,39,-7,4,-4,-31,2,-9,36,42,46,7, \
+6,-41,7,1,45,40,11,-72,-17,-36,20,-36,-35,-27,3,14,-39,20,22,-1,-3,58,-22,-10, \
+-66,-23,52,8,-12,-37,2,-9,20,-15,20,-31,26,33,23,-24,-45,-13,17,-15,22,14,20,9, \
+-27,5,15,53,-33,-37,34,-9,12,32,-11,21,-5,-3,22,23,-45,30,-13,10,31,-15,21,-13, \
+3,47,11,14,12,-25,-11,-2,79,-36,16,-33,-4,9,60,-28,22,18,8,-18,16,-32,14,-20, \
+11,-21,31,-47,3,-42,-26,-39,-29,7,-17,-5,27,-24,-31,15,30,-27,47,34,48,65,-2,19, \
+-10,28,42,-49,17,-13,19,40,46,28,27,73,15,63,42,63,12,-28,38,3,-46,-40,-67,-27, \
+-10,29,-72,42,48,0,-32,-10,-12,-8,1,-14,12,73,-4,11,-15,-9,29,-1,28,-40,13,-34, \
+-23,21,24,1,3,16,11,-6,16,27,-8,-1,-15,21,47,27,3,-8,29,44,23,64,-26,26, \
+34,23,-22,6,-7,44,11,9,1,19,-80,1,35,14,-32,-40,40,-12,-26,-3,7,-27,29,19, \
+-29,17,-28,57,-18,-39,-5,-44,16,-13,8,-52,-7,8,28,10,-27,-29,6,-35,-8,-24,3,57, \
+13,12,-11,-5,26,20,9,-39,-46,47,3,-28,-24,12,3,-38,37,3,21,-63,65,-99,61,5, \
+-16,-16,-14,-30,3,-17,8,-30,-20,15,17,12,-14,-17,-22,-6,-14,-16,-39,-44,27,16,23,19, \
+31,-26,52,-5,15,13,-74,-2,-15,-23,1,8,37,-22,3,24,-3,-5,-27,-37,-5,17,-23,27, \
+24,60,31,3,11,-13,-24,47,-33,-15,21,-5,8,-26,-80,24,-39,11,-33,-2,-37,-15,10,-16, \
+-20,-17,-7,46,60,-21,-3,34,23,30,-16,27,16,-8,-71,-47,53,-13,-39,-74,-48,-15,-1,-18, \
+-30,16,47,-18,18,-2,-10,8,-43,-43,7,-16,-1,-8,26,6,6,67,8,-13,-43,3,30,-4, \
+-15,1,0,28,9,-3,33,23,-6,33,33,17,19,6,-61,-24,-42,3,41,-36,19,-54,14,-19, \
+33,38,-3,45,-1,16,-22,-8,-2,5,72,-17,-66,18,-4,41,-35,-18,-11,-5,-10,-29,27,46, \
+-20,-4,2,-42,-34,2,5,-3,23,31,-7,18,29,-1,-6,23,26,44,-28,-23,-57,38,12,29, \
+-24,48,59,32,22,-66,-16,30,-52,12,-24,-2,10,-22,-6,-24,-13,-2,38,13,-38,-10,-45,5, \
+-40,-82,-48,-1,-6,10,-1,60,25,-15,26,-9,28,22,11,-44,-11,-45,-1,57,1,-17,-69,38, \
+14,-7,-59,17,4,25,-56,25,-4,-9,-43,13,40,12,-31,33,-34,0,74,-52,-6,22,6,-26, \
+4,-49,22,-16,44,3,-63,21,6,-28,13,-48,35,-21,2,-82,6,-32,7,-40,-31,60,-39,-41 }
+#define CONV5_DS_BIAS { \
+5,0,5,13,-7,9,6,-5,6,-6,13,-2,6,12,10,-3,-5,-3,2,7,-7,-3,-1,4, \
+10,1,-17,-3,-1,8,0,2,13,-2,-7,11,-2,3,-6,-13,-8,10,6,-10,0,-10,1,3, \
+-8,9,10,12,8,0,-7,-5,5,-5,2,-18,-1,-6,-9,-3 }
+
+// CONV5_PW: bits fraccionarios de pesos 7, bias 7, salida 2
+#define CONV5_PW_BIAS_LSHIFT 2
+#define CONV5_PW_OUT_RSHIFT 7
+#define CONV5_PW_OUT_FRAC 2
+#define CONV5_PW_WT { \
+16,-6,18,2,10,19,-22,23,-16,10,14,9,39,-9,-4,6,20,26,0,9,-29,-13,-38,4, \
+-15,7,16,28,-6,5,58,37,-14,11,49,38,-13,4,-7,-4,-5,35,-5,5,43,-5,5,5, \
+10,14,-45,4,41,-12,-28,-20,-16,-19,-24,-14,6,27,32,34,-5,11,-8,15,8,41,21,39, \
+-17,-2,-25,17,-20,-9,-44,-1,-10,18,18,9,5,-17,-2,-15,3,-2,-4,13,6,-1,49,-1, \
+8,-18,38,-3,-27,-1,-38,-11,40,-14,-10,-17,39,11,-32,21,13,-37,20,-1,23,15,-31,-2, \
+4,15,-8,-1,-39,12,8,-8,-3,-33,15,-4,-24,17,33,24,2,8,28,25,45,23,3,-2, \
+14,6,9,7,47,19,-17,63,-14,7,21,35,-15,-12,-11,-12,14,-28,48,-9,-46,11,-2,-5, \
+31,1,10,22,1,18,23,-8,7,18,-10,-16,46,-27,20,4,-62,7,-29,5,21,5,-10,3, \
+-6,-15,-6,-32,-25,19,14,-23,22,-8,5,-2,36,-14,30,-4,-11,1,-24,0,33,26,-1,7, \
+2,-3,-12,-10,17,-6,32,11,11,-17,5,5,-38,-4,13,-41,25,41,27,1,16,24,33,2, \
+-23,11,-14,22,0,-1,-14,25,-7,17,-7,32,-41,31,34,28,25,-7,-7,-25,-12,-17,10,18, \
+-20,-9,16,12,16,1,-3,-8,44,-6,-22,-32,-8,-6,5,35,1,42,44,17,-3,28,-2,-7, \
+-24,12,14,-27,-21,15,-20,14,-10,43,-4,-22,24,-8,11,3,-22,-15,-7,47,-21,3,35,23, \
+-11,-17,-9,24,-6,28,-10,18,-23,31,-28,-4,11,18,-11,28,6,18,-4,52,-4,-24,4,-55, \
+5,58,5,18,-2,-7,24,-14,-13,-26,-2,5,-35,-5,20,-44,39,16,3,25,11,-33,1,2, \
+-2,-38,38,12,-3,-37,4,25,7,-50,6,3,6,-10,21,13,6,-34,-52,-57,0,-2,-39,8, \
+0,-1,14,52,4,-23,48,-21,7,-13,32,1,35,1,25,3,-21,-55,-4,-48,-3,39,-7,-50, \
+21,43,-11,18,-9,65,-12,-14,9,-10,39,-13,-16,18,7,5,24,-18,31,-4,-12,-9,14,-24, \
+-25,46,9,6,-23,19,-29,-21,-10,2,37,21,81,-6,-24,-24,10,3,6,5,-2,16,52,21, \
+37,-9,-20,24,38,-30,-14,-23,-34,9,59,10,6,15,22,24,-23,12,-41,-7,14,30,37,-7, \
+-34,-22,6,-25,1,49,37,0,-11,26,-4,-7,8,16,17,8,10,2,-17,21,-23,34,1,-21, \
+9,-25,20,9,-8,12,12,8,-12,-67,-9,11,24,2,-23,-21,23,-23,-25,-5,2,25,-1,0, \
+-12,-55,33,30,14,-2,16,-11,-8,-7,-5,-43,-46,-35,9,15,17,-43,4,3,-3,-3,10,-20, \
+-10,-17,21,17,22,23,-8,24,-4,-36,-16,-26,33,-50,-25,14,-4,14,-4,53,-20,1,12,9, \
+-2,-26,-21,2,14,8,0,21,-29,15,25,-19,8,12,-29,-22,-16,10,-27,-9,-13,-10,10,-11, \
+-5,19,36,3,4,-27,59,-18,-14,18,-22,-9,0,6,-42,-25,-12,-5,-28,-3,-6,11,-2,13, \
+12,-11,17,6,19,15,-13,-15,-15,40,1,16,34,11,26,5,-34,-24,-15,-20,-14,-16,-3,-2, \
+35,-11,-20,0,-30,13,5,14,32,-11,-18,-9,15,22,42,55,20,16,-31,-2,19,-7,2,1, \
+-32,-27,-16,0,34,5,-19,-12,27,-38,-24,14,-33,-17,9,7,0,-22,8,-16,-26,-14,18,-27, \
+-38,-16,-19,-5,24,24,-5,-37,-3,20,3,-37,-1,2,40,35,-14,14,-47,-37,-25,-26,-32,-3, \
+-2,2,-18,40,21,-9,-35,12,-21,48,-10,12,14,-22,13,31,-1,-27,-34,-20,2,-23,0,-5, \
+34,26,0,24,-38,0,-6,-7,35,-5,19,49,8,-37,13,1,1,18,34,32,16,13,-16,-25, \
+-6,-19,26,-4,-19,-10,1,-14,2,-11,2,8,-3,-19,6,-5,-14,-1,-41,-3,28,30,91,47, \
+3,18,-8,-37,-45,14,-24,-5,-20,-51,11,-11,9,-7,34,-14,-13,0,-27,-34,-36,-6,-55,-12, \
+-3,9,26,29,-34,16,-18,-41,-35,-24,2,21,-27,-9,2,21,8,-12,10,15,-21,6,-18,14, \
+48,22,23,-11,-9,46,9,-40,33,-5,7,72,-10,7,24,-27,-16,-52,10,-30,-12,23,-31,-38, \
+-34,40,13,-32,13,50,-17,15,32,-29,-43,-13,31,14,39,6,-32,48,42,-26,12,-12,-5,21, \
+-3,-41,-20,12,-7,11,-22,-30,0,29,-20,-16,-35,25,-25,21,3,7,-59,0,-18,10,-3,-16, \
+-26,5,-1,0,-9,-7,-26,31,-39,-22,1,6,-17,24,-22,-17,-23,13,13,-2,-52,-30,-23,33, \
+43,4,14,15,-11,16,29,-45,22,33,-5,17,-2,-38,-1,40,35,42,-10,17,25,-1,19,-13, \
+21,14,24,-4,-1,-10,-23,-3,25,-30,10,-30,12,25,-13,3,-4,-10,-8,7,-25,16,-14,20, \
+-21,-23,-15,-19,-7,1,-7,-22,28,-27,4,-32,-12,-30,41,-18,2,19,-23,-6,-30,-7,29,7, \
+15,-1,2,-19,-13,-54,18,4,8,-5,2,-8,14,42,-44,2,-3,27,-23,-51,-19,-28,6,15, \
+34,18,2,15,21,16,69,-6,23,12,7,10,-9,-5,-22,3,67,47,-63,0,-23,29,6,-25, \
+-12,-66,-31,-1,-9,-8,56,-18,-42,29,-22,28,12,2,-29,9,-21,-11,-7,1,13,-3,16,-32, \
+-12,6,3,29,23,19,-21,59,20,-7,-3,13,-16,16,-33,40,2,0,21,12,-14,-4,-70,-57, \
+1,1,-35,-24,-33,-29,-9,-8,-15,-20,31,-6,-33,29,-44,-42,42,-31,40,21,6,-6,21,-10, \
+22,38,-12,16,12,9,0,-29,-2,42,1,2,-18,10,23,-8,8,34,-28,-15,-19,37,-10,-10, \
+35,40,23,-18,17,-47,-4,3,-24,0,1,-34,-4,19,-12,-3,21,-3,-1,-34,-13,1,18,0, \
+-59,-31,23,4,19,1,9,-17,14,9,6,-1,24,26,6,-14,-47,2,-43,-20,35,-19,-24,-20, \
+3,-43,4,2,30,-19,-4,10,-27,-15,1,-13,-13,-17,-33,-20,-23,52,14,24,12,16,-16,-29, \
+-13,-20,-19,12,-39,0,-16,5,-8,-10,-8,21,-6,-7,4,37,34,31,14,-30,-4,-28,21,-15, \
+-1,35,-8,-10,-10,-23,24,-62,20,25,19,15,37,29,23,-28,29,-5,1,-10,44,-1,24,30, \
+32,-10,17,18,-27,-9,-27,-10,-14,-19,16,-35,-9,4,-44,9,11,-38,2,12,32,5,-9,6, \
+13,-17,3,-12,27,-21,-5,-28,-16,-7,26,11,5,30,-57,-4,-51,-19,4,-47,-31,-6,-4,30, \
+10,11,-1,-31,-8,-30,-18,-1,71,24,-40,40,45,-3,-32,-1,-54,-14,-28,-8,-9,-9,-13,-29, \
+25,10,8,-15,43,-15,-18,-21,-40,-13,22,-23,-46,0,-34,9,-31,9,-47,-39,21,-8,-22,-29, \
+-2,15,-9,33,-24,-19,-1,-25,24,-1,-11,-20,-9,3,-8,-2,17,-17,21,-2,-21,-8,-3,-33, \
+8,13,-6,20,8,37,-43,24,33,16,12,-7,-42,-14,36,29,-45,13,-37,-25,-13,0,0,6, \
+13,-30,6,-31,-43,-3,29,34,31,35,10,0,-20,-25,8,-17,-7,31,-3,-9,-8,60,8,40, \
+19,17,9,-19,7,36,-2,-13,-20,-15,35,14,-24,-34,-5,-19,-5,-12,-2,-76,3,-1,61,-1, \
+10,10,11,-8,11,-21,23,-15,32,-9,-10,-7,15,-31,15,4,7,-12,-9,-11,0,1,-2,-22, \
+-13,-12,29,33,17,17,-8,34,16,8,3,0,-23,31,17,40,-3,17,12,-4,16,16,-21,24, \
+-57,24,28,-21,38,7,-16,23,3,12,26,-14,55,-43,-22,-30,14,-4,-15,14,-17,8,22,33, \
+-4,-17,-22,-15,-14,20,2,-47,10,18,5,-7,8,-31,49,27,2,8,25,-31,5,-2,11,24, \
+-23,27,11,-21,14,1,-6,31,-35,3,-28,2,15,44,-31,-2,-17,43,22,-2,-32,15,-4,-28, \
+55,-29,-31,-2,1,20,34,15,-10,12,12,-41,12,19,5,23,31,-36,-36,-31,-17,18,-23,-6, \
+-46,0,-22,-26,-28,-2,60,2,-5,7,-15,6,-1,-8,3,-6,12,3,-8,-26,10,36,25,9, \
+-21,6,-14,9,-11,-3,35,8,29,1,7,-4,35,35,34,-1,33,-33,-15,19,-29,-52,25,-16, \
+-8,30,-25,16,-11,56,10,-26,-17,29,34,21,8,75,-20,-13,11,-22,31,23,-12,2,-2,-22, \
+-26,-6,-31,15,22,-20,-4,-27,4,38,-22,25,6,-14,-20,-32,33,-16,-25,17,-32,-24,-16,-5, \
+-44,-31,-20,-16,-53,9,18,-28,-12,-8,0,25,-26,11,-5,-45,-17,32,-12,-19,-30,-6,11,11, \
+30,14,27,-1,28,-15,0,23,-21,-18,9,40,-9,25,12,30,-8,1,12,-6,6,5,-7,-3, \
+-18,22,-5,-30,4,-17,-25,20,-22,-19,-5,21,-5,-11,-4,-5,20,-20,11,-3,-40,4,-25,-3, \
+-18,43,10,-34,-6,6,29,8,-1,-13,-1,-5,-23,34,18,-27,2,-15,36,17,-8,20,-4,28, \
+-1,-9,-2,4,13,30,-2,-39,23,26,-7,-40,25,-6,9,0,24,-6,-35,-19,12,-39,0,10, \
+46,-1,-48,15,-14,-3,-40,-5,-30,-30,-2,13,-35,0,40,-7,11,29,6,16,-29,9,-19,-28, \
+-41,4,32,-10,-22,10,-39,-13,34,29,52,-20,13,0,-17,-4,6,-4,-14,0,-22,19,-7,12, \
+-9,-21,-5,-18,-13,-27,-29,-38,1,-42,30,-3,40,6,3,27,-5,28,-21,-20,-6,16,35,17, \
+4,-49,33,15,-26,3,11,1,10,26,0,-8,-13,-16,-2,30,-17,23,10,20,2,-2,-17,32, \
+7,-13,-4,6,-46,-51,-11,-11,29,18,2,6,25,15,27,39,-13,8,0,-6,-27,-6,-28,-7, \
+-6,18,10,12,25,11,-22,11,18,11,-29,-37,21,18,-8,28,-18,22,1,-24,23,-15,-10,9, \
+-41,-18,-4,7,14,31,-26,6,-28,-3,19,-34,27,-7,-3,18,-9,15,-21,22,-14,6,14,42, \
+16,2,0,38,-52,8,6,-81,30,31,2,18,2,-13,15,-7,-1,-3,-15,12,22,24,-5,-5, \
+24,31,14,-31,-9,-6,1,-29,3,-15,-26,12,-8,28,-1,9,2,-9,15,32,17,-29,-4,11, \
+5,-3,-8,16,23,-12,1,-12,18,8,11,0,2,27,-9,4,3,26,-6,-13,12,-36,-18,-27, \
+28,4,30,19,37,30,51,-4,-34,-3,-19,-7,-26,29,12,11,-3,-6,28,-26,-12,19,-14,-19, \
+-1,-1,-33,-14,-11,-33,15,23,9,3,-25,-29,-16,-24,5,61,5,12,-28,4,1,38,45,-25, \
+-10,-37,-21,2,6,-35,-4,35,33,-1,23,21,16,18,-33,-3,-16,35,25,-17,10,-10,-23,-17, \
+-5,10,25,13,-22,10,14,19,-6,-27,-24,-32,8,10,2,12,2,29,20,4,32,-11,44,27, \
+15,-5,20,0,-15,-25,12,1,-7,-20,34,38,25,-19,10,8,-31,28,10,61,1,1,21,5, \
+16,-32,1,19,-54,9,-38,25,1,11,11,29,11,26,27,6,50,11,-8,29,-5,11,4,28, \
+22,24,-6,-17,-17,15,24,-11,-3,-25,-19,-11,12,16,-5,-2,-1,-24,-29,-6,-8,29,-20,-7, \
+-20,-25,-10,-12,9,-17,22,-10,-9,-8,-35,-2,-15,-14,56,-18,-5,-20,-10,16,13,22,-24,-55, \
+2,90,3,4,-24,-3,-4,-9,-28,-38,-7,2,2,-36,-33,1,41,-14,10,-29,8,0,-46,-31, \
+7,24,-7,-14,19,-1,17,21,13,29,27,-17,-22,33,-11,-1,7,-9,-12,-13,-33,-29,-24,-30, \
+-9,-12,-24,20,23,8,-6,7,12,-10,-15,17,-24,39,-25,-6,-19,26,-49,12,-35,-2,6,13, \
+12,-76,8,-31,4,-12,34,-31,-21,-19,8,10,22,-5,6,16,-4,37,-38,5,24,-6,-9,20, \
+-5,-7,-64,-13,-10,24,-5,-20,15,45,-12,10,-57,-3,37,15,-7,-17,-2,3,-15,-9,-16,12, \
+18,-34,12,-38,3,-6,-17,-54,21,-8,-19,7,-15,8,31,13,-30,-11,-1,1,4,-24,30,-24, \
+6,13,-28,-7,-27,-18,-14,-17,43,-38,-10,-15,11,-21,-1,-12,-29,10,25,-24,-21,11,-15,-11, \
+-32,5,19,5,2,-5,-20,-26,-7,2,-21,-8,5,-54,7,-34,34,53,-20,-3,-28,-4,-38,20, \
+1,-19,31,-39,-19,0,14,-1,6,3,6,36,-2,9,16,12,-35,30,8,28,16,-23,41,-39, \
+18,6,3,11,7,36,28,0,-5,-11,-8,-1,-27,-6,16,-4,-22,-16,5,-2,-11,-4,8,-30, \
+-57,-17,36,13,15,14,2,-28,2,-5,-13,-3,-9,-36,-4,-9,29,46,-14,14,23,4,36,-22, \
+13,28,0,-8,19,-50,-24,-7,42,-15,-24,-38,11,5,10,-15,-40,16,-20,-28,-5,-16,26,-3, \
+17,-25,19,4,-2,30,-15,13,15,-4,-8,-30,47,26,44,-7,-11,-1,-38,9,-11,-29,-9,8, \
+17,-2,-7,-21,-21,6,3,-11,-35,27,13,0,-15,16,-7,-36,-36,-19,16,1,-14,-41,-22,18, \
+-19,12,-71,-19,-23,-1,26,41,-32,-4,-8,17,-15,-4,22,11,8,4,-17,-4,-5,-12,34,15, \
+-7,3,-22,-18,0,36,-5,20,20,42,-16,-31,9,-35,-11,-13,16,-21,16,34,-47,25,-11,-2, \
+5,15,-6,8,-2,-16,11,-12,1,18,-1,13,16,4,-60,-14,-6,28,26,36,-7,6,-8,41, \
+0,-7,24,57,9,-8,12,51,-3,-21,-20,-14,-29,-5,21,-45,-18,-7,11,-14,-2,-26,-10,25, \
+12,18,17,-15,-37,-23,-16,-16,22,2,37,-46,37,-16,-25,0,0,0,1,-24,2,-3,-34,36, \
+-8,21,-15,-21,19,24,-60,-23,-26,-8,-7,-50,11,1,-31,-15,-31,31,-31,-12,29,-4,-5,35, \
+-38,22,-12,31,-5,-35,46,22,-20,9,19,1,29,31,-10,42,-21,-50,6,-11,15,-39,-34,-26, \
+11,-3,-11,-24,-30,18,35,15,10,28,2,16,36,-19,3,3,23,-32,-21,24,38,-13,27,17, \
+16,25,-22,2,-7,1,-14,21,-12,4,-22,-21,16,-3,13,16,27,-11,34,-31,1,11,-4,7, \
+-19,-26,16,27,6,-17,-37,-21,3,12,-36,8,6,33,-23,4,19,8,5,11,2,22,7,16, \
+7,22,-3,-6,20,14,9,18,9,0,-48,-12,52,12,4,8,6,-19,-14,-45,4,6,42,2, \
+12,4,-1,2,-30,13,1,-29,-11,25,34,0,-9,-5,-24,1,34,-15,17,-12,-14,8,-1,0, \
+-17,-21,-28,30,-3,-18,27,-21,-14,13,19,-2,4,-11,-7,-22,-13,-6,20,1,-36,-6,-39,-42, \
+-7,23,18,-39,5,-32,14,-2,18,9,8,-8,-14,-38,-22,16,-4,1,52,-30,-20,1,-29,14, \
+-11,-20,11,-8,-37,1,5,6,12,16,-2,0,16,-14,47,7,40,16,6,31,5,30,55,-12, \
+21,6,22,-2,-22,26,-1,-8,9,-14,-17,-7,6,26,9,12,-32,-3,-4,-18,-25,-9,18,38, \
+-20,21,-4,13,-4,18,-34,21,18,42,29,-10,-16,18,-20,-25,-4,-18,-1,-8,-26,-23,1,49, \
+22,-16,-29,22,30,3,17,11,44,-7,-30,37,0,18,-5,34,7,-22,14,30,8,20,23,12, \
+12,0,-70,-18,20,16,14,9,45,46,-3,17,21,6,27,2,5,13,4,2,32,1,-12,-13, \
+-24,18,-6,26,-16,9,11,20,-29,-29,-5,41,8,-18,-15,-1,-46,9,16,-7,20,27,13,-13, \
+-18,-25,1,35,-11,-9,-20,15,47,45,2,-14,33,4,58,-12,4,21,-18,1,-61,-19,-1,-13, \
+-46,-3,-33,-35,5,-29,-8,-16,-17,44,-4,-34,13,0,11,-12,-3,52,-2,-34,45,-7,23,37, \
+4,-26,4,13,-4,14,16,-18,-8,13,56,22,-4,-16,16,16,1,-4,18,26,35,22,-5,1, \
+-37,4,-32,-14,18,6,22,-6,3,-8,14,12,-7,-10,11,-12,9,-2,8,-2,14,-6,16,-28, \
+-30,-15,-7,-60,14,16,-15,-10,-3,-4,17,-12,-30,-17,31,-3,4,-1,23,24,-8,4,26,-19, \
+-31,-2,7,-25,27,-12,-20,-5,-20,30,3,-6,16,-8,39,25,-54,-8,4,22,-20,-21,-13,-40, \
+-17,-3,-1,-1,-13,-27,1,-37,14,-6,8,13,-9,21,-14,9,23,40,-13,0,-14,-19,-33,58, \
+9,-2,-5,17,0,49,14,19,-5,-20,35,-28,13,-7,-23,-5,-43,-21,18,-9,-33,-47,-8,18, \
+-43,53,3,-25,-39,-46,10,-15,-20,26,-10,-3,21,-6,29,-7,-15,3,-15,-6,5,-4,9,36, \
+-30,-4,-22,-6,6,17,-12,-18,-17,-16,-22,-28,9,-9,34,-33,-22,-4,-19,-35,-25,-9,-15,11, \
+10,-3,8,-22,-9,-4,14,8,3,-11,18,5,-6,27,-3,18,-16,-29,-31,23,-4,-14,6,-5, \
+53,-3,-23,22,5,-14,24,-9,0,10,10,8,6,9,-13,0,-16,-13,-1,-13,-3,-18,-28,6, \
+17,10,11,-1,6,28,-14,-14,-23,-20,19,41,33,-12,2,12,-30,7,11,53,-28,48,12,9, \
+8,-16,1,-15,-3,19,-3,-21,17,25,2,-6,-7,17,3,9,-9,-2,-6,5,-2,-13,15,28, \
+-15,55,21,27,-19,1,-22,14,-45,-10,-20,-25,-31,5,-22,8,-14,13,-25,-18,-15,-1,-17,17, \
+15,8,-24,17,9,15,-9,-19,-34,-27,22,-19,-64,-4,15,-8,-18,6,20,8,-9,9,35,14, \
+1,25,8,-4,0,-14,-9,-39,16,-33,-17,19,-3,-9,12,9,-11,-50,-8,3,-27,-18,-1,14, \
+-20,-5,-10,-9,27,-11,-19,-12,-28,5,38,-20,46,40,15,8,1,-21,24,9,-10,-38,-40,4, \
+1,-4,6,-22,-13,22,40,-5,-26,53,-13,10,-14,0,-12,7,2,-52,-29,-27,-30,16,-19,13, \
+-8,-28,-16,10,22,24,-27,-2,13,4,-24,-14,-48,25,26,32,-5,-13,39,13,-44,17,4,-6, \
+43,-2,-11,-4,-15,-35,-5,-4,-12,2,18,10,28,21,-3,-27,3,5,-28,-5,27,6,-14,-13, \
+49,18,37,28,9,-1,-23,-14,37,-27,-11,27,15,17,-12,-1,-39,15,-14,-6,16,63,35,-23, \
+65,10,23,19,32,-3,-3,-16,27,0,25,4,-10,9,14,17,-31,6,27,6,-20,12,-12,-49, \
+18,-12,-47,-1,14,-12,-49,24,9,-44,39,-8,-29,-2,-25,-15,41,1,-25,-20,-29,-11,31,26, \
+12,-25,-8,-23,-17,6,29,23,26,-18,-7,6,44,-2,-16,22,-9,20,21,3,-5,28,-12,8, \
+-2,25,28,7,-21,24,20,19,-8,13,13,-6,-9,-3,4,-3,-2,2,-9,21,3,37,0,9, \
+-24,16,14,33,-24,7,-26,8,7,-57,31,29,-16,-10,-11,-3,-7,56,-6,0,18,-22,-3,-16, \
+-12,3,39,6,5,-31,38,-3,17,-42,-41,-3,8,25,-1,-47,-15,-8,15,13,-20,-16,3,22, \
+54,8,8,-12,-20,-24,4,-10,44,49,12,-8,-21,4,18,33,5,-36,-17,2,-34,-52,-3,6, \
+6,-40,-15,40,18,-28,19,19,-9,8,3,-19,8,-49,-34,-2,-38,-4,6,-26,18,17,41,31, \
+24,40,-9,-34,0,12,-60,-4,35,6,-3,32,16,16,12,-7,15,-31,35,19,-1,-2,-3,33, \
+23,-10,-26,49,-22,-35,-5,-3,-11,12,-29,-2,7,2,17,5,-16,14,-25,-8,14,-39,-17,1, \
+18,-24,-45,-24,-3,-18,-4,-65,-10,-3,9,-23,39,28,-21,11,-12,24,-31,-15,18,-2,18,-43, \
+-22,23,-2,42,20,25,25,-5,24,-15,18,16,-16,36,-40,-7,10,16,-2,-8,13,18,23,32, \
+-8,33,53,-5,1,-20,-2,2,5,-6,16,20,14,-30,9,-38,35,2,-1,22,4,-35,5,-7, \
+-8,-61,24,31,2,-3,-39,-6,-7,12,-24,17,-3,-5,18,4,-36,29,-12,-17,0,-21,7,-30, \
+-13,9,15,-13,38,-22,4,14,20,-19,-15,41,-21,1,-15,22,1,32,-20,5,-19,-21,-8,-22, \
+15,-16,1,10,-9,7,9,4,2,22,42,20,-1,-36,22,1,-28,27,-33,-51,0,-20,-1,20, \
+-18,38,-21,18,-4,-4,14,-26,24,16,35,-9,-5,16,-1,11,-54,0,-33,40,-27,6,18,-14, \
+2,24,-27,-2,-14,37,-13,2,-23,12,95,-16,-30,-8,-50,50,0,4,39,21,59,-35,28,50, \
+-4,-12,-17,32,-8,25,-19,35,9,5,18,-20,-16,10,-15,7,-23,18,8,-8,-5,-14,-9,-4, \
+-31,11,-44,20,22,20,-2,5,27,7,-32,32,35,-25,-4,6,4,-20,12,3,-22,-15,-9,-24, \
+2,-30,-19,-2,-28,-8,-15,-19,36,-3,4,-29,-26,4,-6,15 }
+#define CONV5_PW_BIAS { \
+9,8,1,-11,-6,2,-11,-6,3,0,9,-16,-16,-3,3,9,3,-11,0,5,-9,4,-8,7, \
+-2,1,-7,-3,-12,12,5,-9,-12,-1,-7,0,6,-2,14,-1,-8,-5,-2,6,0,-8,3,5, \
+-15,-5,3,6,-5,-3,20,-9,-6,7,7,2,0,-2,3,1 }
+
+// FINAL_FC: bits fraccionarios de pesos 7, bias 7, salida 4
+#define FINAL_FC_BIAS_LSHIFT 2
+#define FINAL_FC_OUT_RSHIFT 5
+#define FINAL_FC_OUT_FRAC 4
+#define FINAL_FC_WT { \
+-50,29,-12,7,23,-6,19,24,-9,3,2,4,-12,-46,6,-2,0,3,9,-42,30,-6,27,16, \
+21,-2,-17,-13,-24,-47,-5,25,-31,-15,9,-5,0,1,23,27,-4,18,24,-38,4,-1,7,4, \
+41,26,19,22,1,10,6,8,8,-19,-8,-7,19,-1,-9,16,5,4,2,10,33,-12,3,17, \
+11,25,-31,-15,-18,42,14,32,-7,5,11,-4,-7,-41,-8,37,8,-8,37,-5,-6,-2,1,-5, \
+12,0,-37,-39,11,5,8,-16,27,22,-23,25,24,1,-16,33,18,-25,-30,-18,-1,34,-48,0, \
+-15,39,-2,30,31,-39,-13,10,18,-4,2,12,-8,21,6,-20,-8,3,15,-19,10,-32,25,-13, \
+-9,0,-1,0,-38,33,0,-6,-14,-3,-12,18,-19,-36,30,-14,4,-34,-24,7,18,16,9,20, \
+22,-11,1,52,3,15,22,15,42,-35,-27,23,12,-28,-2,-22,17,3,42,15,-29,24,-14,16, \
+20,29,-21,-28,20,-21,-20,0,-25,-24,-3,14,-49,-21,-13,35,8,-23,2,-12,40,0,12,-13, \
+46,-4,17,-28,-9,-23,-13,27,0,-33,-18,-16,3,25,19,2,-6,19,-1,-45,1,-45,-17,29, \
+-8,35,-12,-19,19,-49,25,2,-23,29,-3,15,22,-8,-17,4,1,-26,42,14,-52,37,-44,35, \
+0,2,-19,1,24,-43,-16,-37,23,18,-19,5,3,-44,9,-5,44,-24,-16,-33,2,-4,-3,7, \
+-4,2,14,-2,8,48,-16,-6,-13,-1,15,15,-2,-47,-20,-11,-9,-14,21,10,4,-26,-19,20, \
+6,17,-6,6,7,7,-5,46,-11,45,26,-29,-27,6,-28,13,-39,12,22,-25,2,-29,10,-1, \
+-11,8,34,-16,-5,27,29,18,43,1,57,-1,-14,-22,-35,-20,-44,-22,7,19,30,-30,-20,32, \
+-15,15,-24,-9,-18,7,-1,-22,18,17,-28,-17,-42,-34,4,36,-31,35,-20,27,-10,33,-24,-8, \
+0,9,-28,-16,5,-8,25,34,4,19,-41,-26,-5,-19,-18,-29,-39,-16,2,8,7,4,20,12, \
+10,-22,-23,-3,9,4,-34,-25,-7,27,15,9,-30,4,4,1,2,-3,21,-20,-37,55,17,-21, \
+3,31,-22,11,10,-36,-8,-32,7,-23,7,23,-12,-20,-2,-14,-3,-7,-4,-1,17,1,-11,39, \
+10,18,38,-26,17,-11,-7,-2,-19,8,41,-40,-26,-15,59,61,34,18,-24,-42,5,-4,-5,-8, \
+13,8,11,-12,1,55,-17,-12,10,14,24,3,14,18,31,-4,-5,29,12,-5,-10,15,14,-11, \
+29,9,53,35,6,-44,0,-29,-11,6,0,0,-28,12,11,14,-38,7,44,18,15,-3,33,-23, \
+-20,-18,14,-1,-34,25,13,23,41,10,33,4,16,-11,-30,-34,-7,-9,16,34,0,-3,-18,38, \
+32,11,-1,22,13,-22,-42,1,13,55,0,-27,-18,-28,9,33,-38,22,-11,-23,-8,-14,-22,-2, \
+-10,-22,-36,0,-23,-14,2,-7,-14,22,11,-18,-32,-56,11,15,-50,8,22,-3,3,-5,-25,-15, \
+7,9,-2,0,-18,-27,-37,-27,-17,25,0,6,-13,27,45,-21,-6,-15,-1,15,-13,22,35,-5, \
+18,-13,-15,-34,-33,36,7,-35,10,23,-31,55,-21,-26,-54,38,20,10,35,22,-16,0,2,0, \
+27,-18,31,-28,-13,-43,17,-14,18,-25,-23,-4,22,-21,-1,-5,-24,-17,-27,-21,-11,58,31,10, \
+-28,-10,-3,16,42,34,4,22,-27,-3,-24,38,-37,2,-28,13,7,-24,-12,-19,-7,-41,22,19, \
+7,-1,-5,37,-1,-1,7,-25,-32,19,23,-5,37,9,9,-11,1,2,30,36,19,-28,33,-18, \
+-24,-25,-7,1,6,8,-21,-14,5,10,19,-9,-26,28,-11,-36,-11,20,46,8,29,-53,-55,24, \
+4,32,8,19,13,-25,20,2,-42,-2,-27,13,-1,1,31,-24,-12,40,15,32,13,-13,-10,-43 }
+#define FINAL_FC_BIAS { \
+5,7,2,-3,5,-3,-3,3,3,-2,-6,-1 }
+
+#endif // KWS_WEIGHTS_H
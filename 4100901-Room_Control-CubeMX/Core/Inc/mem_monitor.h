@@ -0,0 +1,53 @@
+#ifndef MEM_MONITOR_H
+#define MEM_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define MEM_MONITOR_PAINT 0xC5C5C5C5U     // Patrón escrito por el startup (startup_stm32l476xx.s)
+#define MEM_MONITOR_WORDS_PER_POLL 32     // Palabras revisadas en cada llamada a mem_monitor_poll()
+
+/**
+ * @brief Estadísticas de stack y heap.
+ */
+typedef struct {
+    uint32_t stack_reserved;   // _Min_Stack_Size del linker
+    uint32_t stack_peak;       // Máximo de stack usado (high-water mark) en bytes
+    uint32_t heap_current;     // Bytes entregados por _sbrk
+    uint32_t heap_peak;        // Máximo de heap alcanzado
+    uint32_t heap_failures;    // Peticiones a _sbrk rechazadas
+    uint32_t free_gap;         // Bytes pintados entre el heap y el stack más profundo
+    bool stack_overflow;       // El stack superó la reserva o alcanzó el heap
+} mem_monitor_stats_t;
+
+/**
+ * @brief Reinicia el escáner incremental. Llamar una vez al arrancar.
+ */
+void mem_monitor_init(void);
+
+/**
+ * @brief Avanza el escáner del stack MEM_MONITOR_WORDS_PER_POLL palabras.
+ * @note  Costo acotado por llamada; debe invocarse en el bucle principal. El
+ *        high-water mark converge tras varias llamadas sin recorrer toda la RAM.
+ */
+void mem_monitor_poll(void);
+
+/**
+ * @brief Registra una llamada a _sbrk. La invoca sysmem.c.
+ * @param incr Incremento pedido (puede ser negativo).
+ * @param ok   true si _sbrk entregó la memoria.
+ */
+void mem_monitor_on_sbrk(ptrdiff_t incr, bool ok);
+
+/**
+ * @brief Copia las estadísticas actuales.
+ */
+void mem_monitor_get_stats(mem_monitor_stats_t *stats);
+
+/**
+ * @brief Imprime las estadísticas de stack, heap y pool por UART.
+ */
+void mem_monitor_report(void);
+
+#endif // MEM_MONITOR_H
@@ -0,0 +1,75 @@
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief Número de clases de tamaño del pool.
+ * @note  Los tamaños y la cantidad de bloques de cada clase se definen en mem_pool.c.
+ */
+#define MEM_POOL_NUM_CLASSES 4
+
+/**
+ * @brief Si vale 1, malloc/free/calloc/realloc de newlib se redirigen al pool.
+ * @note  Las peticiones mayores al bloque más grande devuelven NULL (ENOMEM).
+ *        Queda en 0: el firmware no llama a malloc y las que hace newlib (buffers
+ *        de stdio, tablas de FILE) superan los 128 B y no tendrían a dónde caer.
+ */
+#ifndef MEM_POOL_OVERRIDE_MALLOC
+#define MEM_POOL_OVERRIDE_MALLOC 0
+#endif
+
+/**
+ * @brief Estadísticas de una clase de tamaño.
+ */
+typedef struct {
+    uint16_t block_size;      // Tamaño de cada bloque en bytes
+    uint16_t block_count;     // Cantidad total de bloques
+    uint16_t in_use;          // Bloques entregados actualmente
+    uint16_t high_water;      // Máximo de bloques en uso simultáneo
+    uint32_t alloc_failures;  // Peticiones que ninguna clase pudo atender
+} mem_pool_stats_t;
+
+/**
+ * @brief Reparte la región del linker (_spool.._epool) entre las clases de tamaño.
+ * @return true si todas las clases caben en la región, false en caso contrario.
+ */
+bool mem_pool_init(void);
+
+/**
+ * @brief Entrega un bloque de la clase más pequeña que pueda contener size bytes.
+ * @note  Tiempo O(1). Segura para llamarse desde ISR y desde el bucle principal.
+ * @param size Cantidad de bytes requeridos.
+ * @return Puntero al bloque (alineado a 8 bytes) o NULL si no hay bloques libres.
+ */
+void *mem_pool_alloc(size_t size);
+
+/**
+ * @brief Devuelve un bloque al pool.
+ * @note  Tiempo O(1). Segura para llamarse desde ISR. Ignora NULL, punteros ajenos al pool y bloques ya liberados.
+ * @param ptr Puntero obtenido con mem_pool_alloc().
+ */
+void mem_pool_free(void *ptr);
+
+/**
+ * @brief Indica el tamaño útil del bloque al que pertenece ptr.
+ * @return Tamaño del bloque en bytes, o 0 si ptr no pertenece al pool.
+ */
+size_t mem_pool_block_size(const void *ptr);
+
+/**
+ * @brief Copia las estadísticas de una clase.
+ * @param class_index Índice de la clase (0 .. MEM_POOL_NUM_CLASSES-1).
+ * @param stats Estructura donde se copian las estadísticas.
+ * @return false si el índice no es válido.
+ */
+bool mem_pool_get_stats(uint8_t class_index, mem_pool_stats_t *stats);
+
+/**
+ * @brief Reinicia los máximos (high water) y contadores de fallos.
+ */
+void mem_pool_reset_stats(void);
+
+#endif // MEM_POOL_H
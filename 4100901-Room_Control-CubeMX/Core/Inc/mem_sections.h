@@ -0,0 +1,48 @@
+#ifndef MEM_SECTIONS_H
+#define MEM_SECTIONS_H
+
+/**
+ * @brief Atributos para ubicar código o datos en regiones específicas del linker.
+ * @note  Las secciones se definen en STM32L476XX_FLASH.ld y se inicializan en
+ *        startup_stm32l476xx.s antes de llamar a main().
+ */
+#if defined(__GNUC__)
+
+/**
+ * @brief Ejecuta la función desde SRAM2 (0x10000000) sin estados de espera de FLASH.
+ * @note  noinline impide que el compilador copie el cuerpo de vuelta a FLASH. Las
+ *        llamadas entre FLASH y SRAM2 superan el alcance de BL (±16 MB); el linker
+ *        inserta automáticamente los veneers de salto largo necesarios. Para evitarlos
+ *        en un camino caliente, las funciones de la HAL que llama se ubican también en
+ *        .sram2_text desde STM32L476XX_FLASH.ld.
+ */
+#define SRAM2_TEXT __attribute__((section(".sram2_text"), noinline))
+
+/**
+ * @brief Variable en SRAM2 puesta en cero por el startup.
+ * @note  SRAM2 está en un bus distinto a SRAM1: el DMA puede acceder a ella
+ *        sin competir con la CPU por .data/.bss.
+ */
+#define SRAM2_BSS __attribute__((section(".sram2_bss")))
+
+/**
+ * @brief Buffer de DMA en SRAM2, alineado a palabra para transferencias de 32 bits.
+ */
+#define DMA_BUFFER __attribute__((section(".sram2_bss"), aligned(4)))
+
+/**
+ * @brief Variable en SRAM2 que el startup no inicializa; conserva su valor
+ *        tras un reset en caliente (ver sram2_init()).
+ */
+#define SRAM2_NOINIT __attribute__((section(".sram2_noinit")))
+
+#else
+
+#define SRAM2_TEXT
+#define SRAM2_BSS
+#define DMA_BUFFER
+#define SRAM2_NOINIT
+
+#endif
+
+#endif // MEM_SECTIONS_H
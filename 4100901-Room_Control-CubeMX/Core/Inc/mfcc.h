@@ -0,0 +1,78 @@
+#ifndef MFCC_H
+#define MFCC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "arm_math.h"
+
+/**
+ * @brief Extracción de MFCC sobre CMSIS-DSP: ventana de Hann, arm_rfft_fast_f32,
+ *        arm_cmplx_mag_f32, banco de filtros mel, logaritmo y DCT-II.
+ * @note  Cada etapa trabaja en el lugar sobre buffers de la instancia; no hay
+ *        memoria dinámica. No depende del HAL: la misma trama se procesa en el
+ *        host (Tools/mfcc_wav_bench.c).
+ */
+
+#define MFCC_SAMPLE_RATE 16000U
+#define MFCC_FRAME_LEN 512U      // 32 ms; potencia de 2 para arm_rfft_fast_f32
+#define MFCC_FRAME_SHIFT 320U    // 20 ms: 49 tramas por segundo de audio
+#define MFCC_NUM_MEL 40U
+#define MFCC_NUM_COEFFS 10U
+#define MFCC_LOW_HZ 20.0f
+#define MFCC_HIGH_HZ 4000.0f
+#define MFCC_NUM_BINS (MFCC_FRAME_LEN / 2U + 1U)
+#define MFCC_MEL_WEIGHTS_MAX (2U * MFCC_NUM_BINS)  // Cada bin cae en a lo sumo dos triángulos
+
+#ifndef MFCC_RFFT_RAM_TABLES
+#define MFCC_RFFT_RAM_TABLES 0   // 1: tablas de la RFFT generadas en RAM al iniciar (arm_rfft_fast_init_dyn_f32)
+#endif
+#define MFCC_RFFT_ARENA_BYTES (10U * MFCC_FRAME_LEN)  // Cota de arm_rfft_fast_init_dyn_size_f32
+
+typedef enum {
+    MFCC_STAGE_WINDOW,
+    MFCC_STAGE_FFT,
+    MFCC_STAGE_MAG,
+    MFCC_STAGE_MEL,
+    MFCC_STAGE_LOG,
+    MFCC_STAGE_DCT,
+    MFCC_STAGE_COUNT
+} mfcc_stage_t;
+
+/**
+ * @brief Instancia con todas las tablas y buffers de trabajo (unos 10 KB).
+ */
+typedef struct {
+    arm_rfft_fast_instance_f32 rfft;
+#if MFCC_RFFT_RAM_TABLES
+    uint32_t rfft_arena[MFCC_RFFT_ARENA_BYTES / sizeof(uint32_t)];  // Twiddles y bit reversal de rfft
+#endif
+    float32_t frame[MFCC_FRAME_LEN];      // Muestras -> ventana (en el lugar)
+    float32_t spectrum[MFCC_FRAME_LEN];   // RFFT -> magnitud (en el lugar)
+    float32_t mel[MFCC_NUM_MEL];          // Energía mel -> log (en el lugar)
+    float32_t window[MFCC_FRAME_LEN];
+    float32_t dct[MFCC_NUM_COEFFS * MFCC_NUM_MEL];  // DCT-II ortonormal, una fila por coeficiente
+    float32_t mel_weights[MFCC_MEL_WEIGHTS_MAX];    // Triángulos sin ceros, concatenados
+    uint16_t mel_first[MFCC_NUM_MEL];     // Primer bin de cada filtro
+    uint16_t mel_len[MFCC_NUM_MEL];
+    uint16_t mel_offset[MFCC_NUM_MEL];    // Inicio del filtro en mel_weights
+    uint32_t (*clock)(void);              // Opcional: mide cada etapa (p. ej. perf_counter_now)
+    uint32_t stage_cycles[MFCC_STAGE_COUNT];
+} mfcc_t;
+
+/**
+ * @brief Calcula ventana, filtros mel y DCT para MFCC_SAMPLE_RATE.
+ */
+bool mfcc_init(mfcc_t *m);
+
+/**
+ * @brief MFCC de una trama de MFCC_FRAME_LEN muestras q15.
+ * @param coeffs Salida de MFCC_NUM_COEFFS valores; coeffs[0] sigue la energía de la trama.
+ */
+void mfcc_compute(mfcc_t *m, const int16_t *samples, float32_t *coeffs);
+
+/**
+ * @brief Nombre corto de una etapa para los reportes.
+ */
+const char *mfcc_stage_name(mfcc_stage_t stage);
+
+#endif // MFCC_H
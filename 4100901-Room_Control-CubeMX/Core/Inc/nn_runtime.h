@@ -0,0 +1,160 @@
+#ifndef NN_RUNTIME_H
+#define NN_RUNTIME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief Runtime mínimo de inferencia sobre CMSIS-NN (q7, formato HWC).
+ * @note  El modelo es una tabla constante de capas que se ejecuta en orden. Toda
+ *        la memoria de trabajo sale de una sola arena preasignada por el llamador:
+ *        una región de activaciones donde la entrada y la salida de cada capa se
+ *        ubican en extremos opuestos (se alternan entre capas), más el buffer
+ *        temporal de la capa más exigente. La región mide el mayor par
+ *        entrada + salida, no el doble del mayor tensor. No usa malloc ni depende
+ *        del HAL, así que el mismo código se compila en el host para benchmarks.
+ */
+
+#define NN_MAX_LAYERS 32U
+#define NN_ARENA_ALIGN 4U
+
+typedef enum {
+    NN_LAYER_CONV,      // Convolución; usa el kernel rápido si ch_in % 4 == 0 y out_ch % 2 == 0
+    NN_LAYER_DWCONV,    // Convolución depthwise (out_ch == ch_in)
+    NN_LAYER_FC,        // Totalmente conectada sobre el tensor aplanado
+    NN_LAYER_FC_OPT,    // Igual a FC con pesos intercalados por nn_fc_opt_reorder()
+    NN_LAYER_RELU,      // En el lugar
+    NN_LAYER_MAXPOOL,   // Solo tensores y ventanas cuadradas
+    NN_LAYER_AVGPOOL,   // Cuadrado con CMSIS-NN; no cuadrado con un kernel propio
+    NN_LAYER_SOFTMAX,
+    NN_LAYER_TYPE_COUNT
+} nn_layer_type_t;
+
+/**
+ * @brief Dimensiones de un tensor HWC.
+ */
+typedef struct {
+    uint16_t h;
+    uint16_t w;
+    uint16_t c;
+} nn_shape_t;
+
+/**
+ * @brief Una capa del modelo. Los campos que no aplican al tipo se dejan en 0.
+ * @note  Pesos en el orden que espera CMSIS-NN: [out_ch][ky][kx][ch_in] para
+ *        CONV, [ky][kx][ch] para DWCONV y [out_ch][entradas] para FC.
+ */
+typedef struct {
+    uint8_t type;          // nn_layer_type_t
+    uint8_t kernel_x;
+    uint8_t kernel_y;
+    uint8_t stride_x;
+    uint8_t stride_y;
+    uint8_t pad_x;
+    uint8_t pad_y;
+    uint8_t bias_shift;    // Desplazamiento a la izquierda del bias
+    uint8_t out_shift;     // Desplazamiento a la derecha del acumulador
+    uint16_t out_ch;       // CONV: canales de salida; FC: neuronas
+    const q7_t *weights;
+    const q7_t *bias;
+} nn_layer_t;
+
+/**
+ * @brief Modelo estático: forma de la entrada y lista de capas.
+ */
+typedef struct {
+    const char *name;
+    nn_shape_t input;
+    const nn_layer_t *layers;
+    uint8_t layer_count;
+} nn_model_t;
+
+/**
+ * @brief Instancia lista para ejecutar un modelo sobre una arena.
+ */
+typedef struct {
+    const nn_model_t *model;
+    q7_t *act;                    // Región de activaciones
+    uint32_t act_size;
+    q15_t *scratch;               // Buffer temporal de los kernels
+    nn_shape_t output;
+    uint32_t arena_used;
+    uint32_t (*clock)(void);      // Opcional: mide cada capa (p. ej. perf_counter_now)
+    uint32_t layer_cycles[NN_MAX_LAYERS];
+    // Inferencia en curso (nn_runtime_begin/nn_runtime_step)
+    q7_t *current;                // Tensor de entrada de la próxima capa
+    nn_shape_t shape;
+    uint8_t next_layer;
+} nn_runtime_t;
+
+/**
+ * @brief Valida el modelo y calcula cuánta arena necesita.
+ * @return false si alguna capa no es compatible con su entrada.
+ */
+bool nn_model_plan(const nn_model_t *model, uint32_t *arena_size, nn_shape_t *output);
+
+/**
+ * @brief Forma de salida de una capa para la entrada in.
+ * @return false si la capa no es compatible con su entrada.
+ */
+bool nn_layer_shape(const nn_layer_t *layer, const nn_shape_t *in, nn_shape_t *out);
+
+/**
+ * @brief Prepara la ejecución de model repartiendo arena.
+ * @return false si el modelo no es válido o la arena no alcanza.
+ */
+bool nn_runtime_init(nn_runtime_t *rt, const nn_model_t *model, void *arena, uint32_t arena_size);
+
+/**
+ * @brief Ejecuta todas las capas sobre input y copia el resultado en output
+ *        (output.h * output.w * output.c bytes).
+ */
+bool nn_runtime_run(nn_runtime_t *rt, const q7_t *input, q7_t *output);
+
+/**
+ * @brief Ejecución por capas para repartir una inferencia entre iteraciones del
+ *        bucle principal: begin copia la entrada y cada step ejecuta una capa.
+ * @note  step devuelve false si CMSIS-NN rechaza una capa o no quedan capas.
+ */
+void nn_runtime_begin(nn_runtime_t *rt, const q7_t *input);
+bool nn_runtime_step(nn_runtime_t *rt);
+
+static inline bool nn_runtime_done(const nn_runtime_t *rt)
+{
+    return rt->next_layer >= rt->model->layer_count;
+}
+
+/**
+ * @brief Resultado de la última capa ejecutada (rt->output al terminar).
+ */
+static inline const q7_t *nn_runtime_result(const nn_runtime_t *rt)
+{
+    return rt->current;
+}
+
+/**
+ * @brief Elementos de un tensor.
+ */
+static inline uint32_t nn_shape_size(const nn_shape_t *shape)
+{
+    return (uint32_t)shape->h * shape->w * shape->c;
+}
+
+/**
+ * @brief Intercala los pesos [rows][cols] de una capa FC en el orden de
+ *        arm_fully_connected_q7_opt (bloques de 4 filas; el resto queda igual).
+ */
+void nn_fc_opt_reorder(const q7_t *weights, q7_t *reordered, uint16_t rows, uint16_t cols);
+
+/**
+ * @brief Nombre corto de un tipo de capa.
+ */
+const char *nn_layer_name(uint8_t type);
+
+/**
+ * @brief Índice del mayor valor (la clase con más puntaje).
+ */
+uint16_t nn_argmax(const q7_t *values, uint16_t count);
+
+#endif // NN_RUNTIME_H
@@ -0,0 +1,52 @@
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mfcc.h"
+
+/**
+ * @brief Detección de ocupación por audio a partir de los MFCC de cada trama.
+ * @note  coeffs[0] sigue la energía de la trama. Se compara con un piso de ruido
+ *        que baja enseguida y sube lento; una trama es activa si lo supera por
+ *        OCCUPANCY_MARGIN_DB. La sala queda ocupada con suficientes tramas activas
+ *        en el último segundo y libre tras OCCUPANCY_HOLD_FRAMES sin actividad.
+ *        No depende del HAL.
+ */
+
+#define OCCUPANCY_WINDOW_FRAMES 50U     // ~1 s de tramas (máximo 64)
+#define OCCUPANCY_MIN_ACTIVE 10U        // Tramas activas en la ventana para marcar ocupado
+#define OCCUPANCY_MARGIN_DB 6.0f        // Sobre el piso de ruido
+#define OCCUPANCY_FLOOR_RISE 0.002f     // Seguimiento del piso hacia arriba por trama
+#define OCCUPANCY_HOLD_FRAMES (30U * 50U)  // ~30 s sin actividad para liberar
+
+/**
+ * @brief Estado del detector; incluye la instancia de MFCC y el historial de la trama.
+ */
+typedef struct {
+    mfcc_t mfcc;
+    int16_t history[MFCC_FRAME_LEN];     // Última trama completa (solapada)
+    uint16_t fill;                       // Muestras válidas en history durante el arranque
+    float32_t coeffs[MFCC_NUM_COEFFS];   // MFCC de la última trama
+    float32_t noise_floor;
+    float32_t margin;                    // OCCUPANCY_MARGIN_DB expresado en unidades de coeffs[0]
+    uint64_t activity;                   // Bit 0: trama más reciente
+    uint32_t frames;
+    uint32_t last_active_frame;
+    bool occupied;
+} occupancy_t;
+
+bool occupancy_init(occupancy_t *occ);
+
+/**
+ * @brief Agrega MFCC_FRAME_SHIFT muestras nuevas y procesa la trama resultante.
+ * @return true si cambió el estado de ocupación.
+ */
+bool occupancy_process(occupancy_t *occ, const int16_t *samples);
+
+/**
+ * @brief Tramas activas dentro de la ventana actual.
+ */
+uint8_t occupancy_active_frames(const occupancy_t *occ);
+
+#endif // OCCUPANCY_H
@@ -0,0 +1,27 @@
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+#include <stdint.h>
+#include "main.h"
+
+/**
+ * @brief Habilita el contador de ciclos DWT->CYCCNT del Cortex-M4.
+ * @note  Debe llamarse una vez antes de usar perf_counter_now().
+ */
+void perf_counter_init(void);
+
+/**
+ * @brief Devuelve el valor actual del contador de ciclos.
+ * @note  Se declara inline para que la medición no agregue una llamada a función.
+ */
+static inline uint32_t perf_counter_now(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Convierte una cantidad de ciclos a microsegundos según SystemCoreClock.
+ */
+uint32_t perf_counter_cycles_to_us(uint32_t cycles);
+
+#endif // PERF_COUNTER_H
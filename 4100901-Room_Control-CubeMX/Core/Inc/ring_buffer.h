@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "mem_sections.h"
 
 /**
  * @brief Estructura del buffer circular (FIFO).
@@ -20,8 +21,11 @@ typedef struct {
 * @brief Inicializa el buffer circular.
  */
 void ring_buffer_init(ring_buffer_t *rb, uint8_t *buffer, uint16_t capacity);
-bool ring_buffer_write(ring_buffer_t *rb, uint8_t data);
-bool ring_buffer_read(ring_buffer_t *rb, uint8_t *data);
+/**
+ * @brief Escritura y lectura se ejecutan desde SRAM2: son el camino rápido ISR -> bucle principal.
+ */
+SRAM2_TEXT bool ring_buffer_write(ring_buffer_t *rb, uint8_t data);
+SRAM2_TEXT bool ring_buffer_read(ring_buffer_t *rb, uint8_t *data);
 uint16_t ring_buffer_count(ring_buffer_t *rb);
 bool ring_buffer_is_empty(ring_buffer_t *rb);
 bool ring_buffer_is_full(ring_buffer_t *rb);
@@ -0,0 +1,36 @@
+#ifndef SRAM2_H
+#define SRAM2_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Estado de SRAM2 y causa del último reset, capturados en sram2_init().
+ */
+typedef struct {
+    uint32_t reset_flags;   // Copia de RCC->CSR antes de limpiar las banderas
+    bool parity_enabled;    // Option byte SRAM2_PE (0 = paridad activa)
+    bool erased_on_reset;   // Option byte SRAM2_RST (0 = se borra en cada reset)
+    bool parity_error;      // SYSCFG_CFGR2.SPF estaba activo al arrancar
+    bool retained_valid;    // La región .sram2_noinit conserva datos del arranque anterior
+} sram2_status_t;
+
+/**
+ * @brief Verifica paridad y causa de reset, y decide si los datos retenidos son válidos.
+ * @note  Si no lo son (encendido, BOR, error de paridad o borrado por option byte),
+ *        escribe toda la región .sram2_noinit en cero para inicializar la paridad.
+ *        Debe llamarse al inicio de main(), antes de usar datos SRAM2_NOINIT.
+ */
+void sram2_init(void);
+
+/**
+ * @brief Devuelve el estado capturado por sram2_init().
+ */
+const sram2_status_t *sram2_get_status(void);
+
+/**
+ * @brief Imprime el uso de cada región (RAM y RAM2) a partir de los símbolos del linker.
+ */
+void sram2_report(void);
+
+#endif // SRAM2_H
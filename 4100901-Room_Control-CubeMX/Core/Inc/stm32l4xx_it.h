@@ -27,7 +27,7 @@ extern "C" {
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "mem_sections.h"
 /* USER CODE END Includes */
 
 /* Exported types ------------------------------------------------------------*/
@@ -59,7 +59,14 @@ void EXTI9_5_IRQHandler(void);
 void USART2_IRQHandler(void);
 void EXTI15_10_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+/* Manejadores críticos en latencia ejecutados desde SRAM2 (sin estados de espera).
+ * Las funciones de la HAL que llaman también van a SRAM2 (STM32L476XX_FLASH.ld).
+ * USART2 queda en FLASH: HAL_UART_IRQHandler y sus callbacks son casi todo su tiempo. */
+SRAM2_TEXT void SysTick_Handler(void);
+SRAM2_TEXT void EXTI9_5_IRQHandler(void);
+SRAM2_TEXT void EXTI15_10_IRQHandler(void);
+void FLASH_IRQHandler(void);
+void DMA1_Channel1_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
@@ -0,0 +1,219 @@
+#include "audio_capture.h"
+#include "main.h"
+#include <string.h>
+
+static ADC_HandleTypeDef hadc1;
+static DMA_HandleTypeDef hdma_adc1;
+static TIM_HandleTypeDef htim6;
+
+// Dos mitades de AUDIO_BLOCK_LEN; get_block las reescribe como int16_t en el lugar
+static uint16_t audio_buffer[2U * AUDIO_BLOCK_LEN];
+static volatile uint8_t audio_ready;   // Bit n: mitad n lista
+static uint8_t audio_next;             // Próxima mitad a entregar
+static bool audio_running;
+static int32_t audio_dc;               // Continua estimada, en cuentas del ADC << 4
+static audio_capture_stats_t audio_stats;
+
+static inline uint32_t audio_lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void audio_unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+static uint32_t audio_timer_period(uint32_t hclk_hz)
+{
+    // TIM6 corre a PCLK1 = HCLK (divisor 1 en todos los perfiles)
+    return (hclk_hz + MFCC_SAMPLE_RATE / 2U) / MFCC_SAMPLE_RATE - 1U;
+}
+
+static bool audio_init_gpio_dma(void)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    __HAL_RCC_ADC_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    __HAL_RCC_TIM6_CLK_ENABLE();
+
+    gpio.Pin = GPIO_PIN_0;
+    gpio.Mode = GPIO_MODE_ANALOG_ADC_CONTROL;
+    gpio.Pull = GPIO_NOPULL;
+    HAL_GPIO_Init(GPIOA, &gpio);
+
+    hdma_adc1.Instance = DMA1_Channel1;
+    hdma_adc1.Init.Request = DMA_REQUEST_0;
+    hdma_adc1.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_adc1.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_adc1.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_adc1.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma_adc1.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma_adc1.Init.Mode = DMA_CIRCULAR;
+    hdma_adc1.Init.Priority = DMA_PRIORITY_HIGH;
+    if (HAL_DMA_Init(&hdma_adc1) != HAL_OK) return false;
+    __HAL_LINKDMA(&hadc1, DMA_Handle, hdma_adc1);
+
+    HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 2, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+    return true;
+}
+
+static bool audio_init_adc(void)
+{
+    ADC_ChannelConfTypeDef channel = {0};
+
+    hadc1.Instance = ADC1;
+    hadc1.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV2;  // Sigue a HCLK: 2 a 40 MHz
+    hadc1.Init.Resolution = ADC_RESOLUTION_12B;
+    hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+    hadc1.Init.ScanConvMode = ADC_SCAN_DISABLE;
+    hadc1.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+    hadc1.Init.LowPowerAutoWait = DISABLE;
+    hadc1.Init.ContinuousConvMode = DISABLE;
+    hadc1.Init.NbrOfConversion = 1;
+    hadc1.Init.DiscontinuousConvMode = DISABLE;
+    hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIG_T6_TRGO;
+    hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+    hadc1.Init.DMAContinuousRequests = ENABLE;
+    hadc1.Init.Overrun = ADC_OVR_DATA_OVERWRITTEN;
+    hadc1.Init.OversamplingMode = DISABLE;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK) return false;
+
+    // 24.5 + 12.5 ciclos: 18.5 us a 4 MHz, dentro de los 62.5 us entre muestras
+    channel.Channel = ADC_CHANNEL_5;
+    channel.Rank = ADC_REGULAR_RANK_1;
+    channel.SamplingTime = ADC_SAMPLETIME_24CYCLES_5;
+    channel.SingleDiff = ADC_SINGLE_ENDED;
+    channel.OffsetNumber = ADC_OFFSET_NONE;
+    channel.Offset = 0;
+    if (HAL_ADC_ConfigChannel(&hadc1, &channel) != HAL_OK) return false;
+
+    return HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED) == HAL_OK;
+}
+
+static bool audio_init_timer(void)
+{
+    TIM_MasterConfigTypeDef master = {0};
+
+    htim6.Instance = TIM6;
+    htim6.Init.Prescaler = 0;
+    htim6.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim6.Init.Period = audio_timer_period(HAL_RCC_GetHCLKFreq());
+    htim6.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    if (HAL_TIM_Base_Init(&htim6) != HAL_OK) return false;
+
+    master.MasterOutputTrigger = TIM_TRGO_UPDATE;
+    master.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+    return HAL_TIMEx_MasterConfigSynchronization(&htim6, &master) == HAL_OK;
+}
+
+bool audio_capture_init(void)
+{
+    audio_ready = 0;
+    audio_next = 0;
+    audio_running = false;
+    audio_dc = 2048 << 4;  // Mitad de escala: polarización típica del micrófono
+    memset(&audio_stats, 0, sizeof(audio_stats));
+
+    return audio_init_gpio_dma() && audio_init_adc() && audio_init_timer();
+}
+
+bool audio_capture_start(void)
+{
+    if (audio_running) return true;
+    audio_ready = 0;
+    audio_next = 0;
+    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t *)audio_buffer, 2U * AUDIO_BLOCK_LEN) != HAL_OK) return false;
+    if (HAL_TIM_Base_Start(&htim6) != HAL_OK) {
+        HAL_ADC_Stop_DMA(&hadc1);
+        return false;
+    }
+    audio_running = true;
+    return true;
+}
+
+void audio_capture_stop(void)
+{
+    if (!audio_running) return;
+    HAL_TIM_Base_Stop(&htim6);
+    HAL_ADC_Stop_DMA(&hadc1);
+    audio_ready = 0;
+    audio_running = false;
+}
+
+bool audio_capture_running(void)
+{
+    return audio_running;
+}
+
+const int16_t *audio_capture_get_block(void)
+{
+    if ((audio_ready & (1U << audio_next)) == 0) return NULL;
+
+    uint16_t *raw = &audio_buffer[audio_next * AUDIO_BLOCK_LEN];
+    int16_t *pcm = (int16_t *)raw;
+    int32_t sum = 0;
+    int32_t dc = audio_dc;
+
+    // 12 bits sin signo -> q15 con signo restando la continua del bloque anterior
+    for (uint32_t i = 0; i < AUDIO_BLOCK_LEN; i++) {
+        int32_t s = (int32_t)raw[i] << 4;
+        sum += s;
+        s -= dc;
+        pcm[i] = (int16_t)((s > 32767) ? 32767 : (s < -32768) ? -32768 : s);
+    }
+    audio_dc = dc + ((int32_t)(sum / (int32_t)AUDIO_BLOCK_LEN) - dc) / (1 << AUDIO_DC_SHIFT);
+    return pcm;
+}
+
+void audio_capture_release(void)
+{
+    uint32_t primask = audio_lock();
+    audio_ready &= (uint8_t)~(1U << audio_next);
+    audio_unlock(primask);
+    audio_next ^= 1U;
+    audio_stats.blocks++;
+}
+
+uint16_t audio_capture_pending(void)
+{
+    uint8_t ready = audio_ready;
+    return (uint16_t)((ready & 1U) + ((ready >> 1) & 1U));
+}
+
+const audio_capture_stats_t *audio_capture_get_stats(void)
+{
+    return &audio_stats;
+}
+
+void audio_capture_on_clock_change(uint32_t hclk_hz)
+{
+    // Con precarga el nuevo periodo entra en el próximo evento de actualización
+    __HAL_TIM_SET_AUTORELOAD(&htim6, audio_timer_period(hclk_hz));
+}
+
+void audio_capture_irq_handler(void)
+{
+    HAL_DMA_IRQHandler(&hdma_adc1);
+}
+
+static void audio_mark_ready(uint8_t half)
+{
+    if (audio_ready & (1U << half)) audio_stats.overruns++;
+    audio_ready |= (uint8_t)(1U << half);
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc == &hadc1) audio_mark_ready(0);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc == &hadc1) audio_mark_ready(1);
+}
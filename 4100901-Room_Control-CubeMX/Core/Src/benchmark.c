@@ -0,0 +1,1475 @@
+#include "benchmark.h"
+#include "perf_counter.h"
+#include "mem_pool.h"
+#include "mem_sections.h"
+#include "flash_writer.h"
+#include "cred_db.h"
+#include "flash_cache.h"
+#include "clock_manager.h"
+#include "ring_buffer.h"
+#include "arm_math.h"
+#include "nn_runtime.h"
+#include "mfcc.h"
+#include "kws.h"
+#include "main.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- CONFIGURACION DE LOS BENCHMARKS ---
+#define BENCH_ALLOC_SLOTS 32      // Punteros vivos simultáneamente en la carga aleatoria
+#define BENCH_ALLOC_OPS 2000      // Operaciones alloc/free por corrida
+#define BENCH_ALLOC_MAX_SIZE 128  // Tamaño máximo pedido (bloque más grande del pool)
+#define BENCH_HIST_BUCKETS 8      // Histograma: <32, <64, ... <2048, >=2048 ciclos
+#define BENCH_KERNEL_LEN 256      // Bytes procesados por el kernel FLASH vs SRAM2
+#define BENCH_KERNEL_RUNS 8       // Repeticiones; se reporta la mejor
+#define BENCH_FLASH_BYTES 4096    // Bytes escritos por modo (dos páginas del área SCRATCH)
+#define BENCH_FLASH_TIMEOUT_MS 2000
+#define BENCH_IDLE_CYCLES 100000  // Ventana para medir la tasa del bucle ocioso sin FLASH
+#define BENCH_CRED_SLOT_SIZE (64U * 1024U)  // Dos slots como CRED_A/CRED_B dentro de SCRATCH
+#define BENCH_CRED_PROBES 512     // Búsquedas medidas por tamaño (mitad aciertos)
+#define BENCH_FIR_TAPS 32
+#define BENCH_FIR_BLOCK 64
+#define BENCH_FFT_LEN 256
+#define BENCH_RING_LEN 64
+#define BENCH_CACHE_WORKLOADS 4
+
+/**
+ * @brief Acumulador de latencias en ciclos.
+ */
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t total;
+    uint32_t count;
+    uint32_t hist[BENCH_HIST_BUCKETS];
+} bench_stats_t;
+
+typedef void *(*bench_alloc_fn)(size_t size);
+typedef void (*bench_free_fn)(void *ptr);
+
+static uint32_t bench_rand_state;
+
+/**
+ * @brief Generador congruencial lineal; la semilla fija hace la carga reproducible.
+ */
+static uint32_t bench_rand(void)
+{
+    bench_rand_state = bench_rand_state * 1664525U + 1013904223U;
+    return bench_rand_state >> 8;
+}
+
+// Los benchmarks corren de a uno y ninguno guarda datos para el siguiente: sus buffers
+// se superponen en esta zona, dimensionada por el mayor (FIR por FFT y ventana deslizante)
+#define BENCH_SCRATCH_BYTES (14U * 1024U)
+static uint32_t bench_scratch[BENCH_SCRATCH_BYTES / sizeof(uint32_t)] __attribute__((aligned(8)));
+
+static void bench_stats_reset(bench_stats_t *s)
+{
+    memset(s, 0, sizeof(*s));
+    s->min = UINT32_MAX;
+}
+
+static void bench_stats_add(bench_stats_t *s, uint32_t cycles)
+{
+    if (cycles < s->min) s->min = cycles;
+    if (cycles > s->max) s->max = cycles;
+    s->total += cycles;
+    s->count++;
+
+    uint8_t bucket = 0;
+    uint32_t limit = 32;
+    while (bucket < BENCH_HIST_BUCKETS - 1 && cycles >= limit) {
+        bucket++;
+        limit <<= 1;
+    }
+    s->hist[bucket]++;
+}
+
+static void bench_stats_print(const char *name, const bench_stats_t *s)
+{
+    if (s->count == 0) return;
+    printf("%-14s n=%lu min=%lu avg=%lu max=%lu ciclos\r\n", name,
+           (unsigned long)s->count, (unsigned long)s->min,
+           (unsigned long)(s->total / s->count), (unsigned long)s->max);
+    printf("  hist(<32,<64,<128,<256,<512,<1k,<2k,>=2k):");
+    for (uint8_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        printf(" %lu", (unsigned long)s->hist[i]);
+    }
+    printf("\r\n");
+}
+
+/**
+ * @brief Carga aleatoria: en cada paso se elige un slot; si está vacío se pide
+ *        un bloque de tamaño aleatorio, si está ocupado se libera.
+ */
+static void bench_alloc_workload(bench_alloc_fn alloc_fn, bench_free_fn free_fn,
+                                 bench_stats_t *alloc_stats, bench_stats_t *free_stats)
+{
+    void *slots[BENCH_ALLOC_SLOTS] = {0};
+
+    bench_rand_state = 0x1234U;
+    bench_stats_reset(alloc_stats);
+    bench_stats_reset(free_stats);
+
+    for (uint32_t op = 0; op < BENCH_ALLOC_OPS; op++) {
+        uint32_t idx = bench_rand() % BENCH_ALLOC_SLOTS;
+        if (slots[idx] == NULL) {
+            size_t size = 1 + bench_rand() % BENCH_ALLOC_MAX_SIZE;
+            uint32_t t0 = perf_counter_now();
+            slots[idx] = alloc_fn(size);
+            bench_stats_add(alloc_stats, perf_counter_now() - t0);
+        } else {
+            uint32_t t0 = perf_counter_now();
+            free_fn(slots[idx]);
+            bench_stats_add(free_stats, perf_counter_now() - t0);
+            slots[idx] = NULL;
+        }
+    }
+
+    for (uint32_t i = 0; i < BENCH_ALLOC_SLOTS; i++) {
+        free_fn(slots[i]);
+    }
+}
+
+/**
+ * @brief Ejecuta la misma carga sobre mem_pool y sobre malloc/free de newlib.
+ */
+void benchmark_mem_pool(void)
+{
+    bench_stats_t alloc_stats;
+    bench_stats_t free_stats;
+
+    printf("\r\n--- Benchmark mem_pool vs newlib ---\r\n");
+
+    bench_alloc_workload(mem_pool_alloc, mem_pool_free, &alloc_stats, &free_stats);
+    bench_stats_print("pool alloc", &alloc_stats);
+    bench_stats_print("pool free", &free_stats);
+
+#if MEM_POOL_OVERRIDE_MALLOC
+    printf("malloc redirigido al pool: se omite la comparación con newlib\r\n");
+#else
+    bench_alloc_workload(malloc, free, &alloc_stats, &free_stats);
+    bench_stats_print("newlib malloc", &alloc_stats);
+    bench_stats_print("newlib free", &free_stats);
+#endif
+
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        mem_pool_stats_t st;
+        mem_pool_get_stats(i, &st);
+        printf("clase %3u B: uso=%u max=%u/%u fallos=%lu\r\n", st.block_size, st.in_use,
+               st.high_water, st.block_count, (unsigned long)st.alloc_failures);
+    }
+}
+
+/**
+ * @brief Cuerpo común del kernel: CRC32 bit a bit seguido de un recorrido por
+ *        un buffer circular local. Es intensivo en saltos, lo que expone los
+ *        estados de espera de FLASH cuando falla el caché de instrucciones.
+ */
+#define BENCH_KERNEL_BODY(data, len)                                  \
+    uint32_t crc = 0xFFFFFFFFU;                                       \
+    for (uint32_t i = 0; i < (len); i++) {                            \
+        crc ^= (data)[i];                                             \
+        for (uint8_t b = 0; b < 8; b++) {                             \
+            crc = (crc & 1U) ? (crc >> 1) ^ 0xEDB88320U : (crc >> 1); \
+        }                                                             \
+    }                                                                 \
+    uint8_t ring[16];                                                 \
+    uint8_t head = 0;                                                 \
+    for (uint32_t i = 0; i < (len); i++) {                            \
+        ring[head] = (uint8_t)crc ^ (data)[i];                        \
+        head = (head + 1) & 0x0F;                                     \
+        crc += ring[(head + 8) & 0x0F];                               \
+    }                                                                 \
+    return crc;
+
+static uint32_t __attribute__((noinline)) bench_kernel_flash(const uint8_t *data, uint32_t len)
+{
+    BENCH_KERNEL_BODY(data, len)
+}
+
+static SRAM2_TEXT uint32_t bench_kernel_sram2(const uint8_t *data, uint32_t len)
+{
+    BENCH_KERNEL_BODY(data, len)
+}
+
+/**
+ * @brief Devuelve el menor número de ciclos entre varias corridas del kernel.
+ */
+static uint32_t bench_kernel_best(uint32_t (*kernel)(const uint8_t *, uint32_t),
+                                  const uint8_t *data, uint32_t *result)
+{
+    uint32_t best = UINT32_MAX;
+    for (uint8_t run = 0; run < BENCH_KERNEL_RUNS; run++) {
+        uint32_t t0 = perf_counter_now();
+        *result = kernel(data, BENCH_KERNEL_LEN);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+/**
+ * @brief Compara el kernel ejecutado desde FLASH (con/sin caché) y desde SRAM2.
+ */
+void benchmark_sram2_text(void)
+{
+    static uint8_t data[BENCH_KERNEL_LEN];
+    uint32_t res_flash, res_sram2;
+
+    bench_rand_state = 0x5A5AU;
+    for (uint32_t i = 0; i < BENCH_KERNEL_LEN; i++) {
+        data[i] = (uint8_t)bench_rand();
+    }
+
+    printf("\r\n--- Benchmark FLASH vs SRAM2 (latencia FLASH=%lu) ---\r\n",
+           (unsigned long)__HAL_FLASH_GET_LATENCY());
+
+    uint32_t flash_cached = bench_kernel_best(bench_kernel_flash, data, &res_flash);
+
+    __HAL_FLASH_INSTRUCTION_CACHE_DISABLE();
+    __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+    uint32_t flash_uncached = bench_kernel_best(bench_kernel_flash, data, &res_flash);
+    uint32_t sram2 = bench_kernel_best(bench_kernel_sram2, data, &res_sram2);
+#if (PREFETCH_ENABLE != 0)
+    __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+#endif
+#if (INSTRUCTION_CACHE_ENABLE != 0)
+    __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+    __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+#endif
+
+    printf("FLASH + ART   : %lu ciclos\r\n", (unsigned long)flash_cached);
+    printf("FLASH sin ART : %lu ciclos\r\n", (unsigned long)flash_uncached);
+    printf("SRAM2         : %lu ciclos\r\n", (unsigned long)sram2);
+    if (res_flash != res_sram2) {
+        printf("ERROR: resultados distintos (%08lx / %08lx)\r\n",
+               (unsigned long)res_flash, (unsigned long)res_sram2);
+    }
+}
+
+extern uint8_t _sscratch, _escratch; /* Symbols defined in the linker script */
+
+_Static_assert(BENCH_FLASH_BYTES <= sizeof(bench_scratch), "datos de flash_writer");
+
+/**
+ * @brief Escribe BENCH_FLASH_BYTES en filas completas y cuenta las vueltas del
+ *        bucle ocioso mientras la FLASH trabaja.
+ * @return Ciclos hasta terminar, o 0 si falló o venció el tiempo.
+ */
+static uint32_t bench_flash_write(const uint8_t *src, uint32_t *idle_loops)
+{
+    uintptr_t base = (uintptr_t)&_sscratch;
+
+    for (uintptr_t page = base; page < base + BENCH_FLASH_BYTES; page += FLASH_PAGE_SIZE) {
+        while (!flash_writer_erase_page(page)) flash_writer_poll();
+    }
+    if (!flash_writer_sync()) return 0;
+
+    uint32_t start_ms = HAL_GetTick();
+    uint32_t idle = 0;
+    uint32_t offset = 0;
+    uint32_t t0 = perf_counter_now();
+    while (offset < BENCH_FLASH_BYTES || !flash_writer_idle()) {
+        if (offset < BENCH_FLASH_BYTES
+            && flash_writer_program(base + offset, src + offset, FLASH_WRITER_ROW_SIZE)) {
+            offset += FLASH_WRITER_ROW_SIZE;
+            continue;
+        }
+        if (HAL_GetTick() - start_ms > BENCH_FLASH_TIMEOUT_MS) return 0;
+        flash_writer_poll();
+        idle++;
+    }
+    uint32_t cycles = perf_counter_now() - t0;
+
+    *idle_loops = idle;
+    return (memcmp((const void *)base, src, BENCH_FLASH_BYTES) == 0) ? cycles : 0;
+}
+
+/**
+ * @brief Compara la programación rápida por filas con la de doble palabra.
+ * @note  La utilización de CPU se estima comparando la tasa del bucle ocioso
+ *        durante la escritura con la tasa medida con la FLASH libre.
+ */
+void benchmark_flash_writer(void)
+{
+    uint8_t *src = (uint8_t *)bench_scratch;
+
+    printf("\r\n--- Benchmark flash_writer (%lu bytes, HCLK=%lu Hz) ---\r\n",
+           (unsigned long)BENCH_FLASH_BYTES, (unsigned long)HAL_RCC_GetHCLKFreq());
+    if ((uint32_t)(&_escratch - &_sscratch) < BENCH_FLASH_BYTES || !flash_writer_sync()) {
+        printf("writer ocupado o area SCRATCH insuficiente\r\n");
+        return;
+    }
+
+    bench_rand_state = 0xF1A5U;
+    for (uint32_t i = 0; i < BENCH_FLASH_BYTES; i++) {
+        src[i] = (uint8_t)bench_rand();
+    }
+
+    // Tasa de referencia del bucle ocioso
+    uint32_t base_loops = 0;
+    uint32_t t0 = perf_counter_now();
+    while (perf_counter_now() - t0 < BENCH_IDLE_CYCLES) {
+        flash_writer_poll();
+        base_loops++;
+    }
+
+    static const struct {
+        const char *name;
+        bool fast;
+    } modes[] = { { "doble palabra", false }, { "fila rapida", true } };
+
+    for (uint8_t m = 0; m < 2; m++) {
+        uint32_t idle = 0;
+        flash_writer_set_fast(modes[m].fast);
+        uint32_t cycles = bench_flash_write(src, &idle);
+        if (cycles == 0) {
+            printf("%-14s: ERROR (tiempo agotado o verificacion fallida)\r\n", modes[m].name);
+            continue;
+        }
+        uint32_t bytes_per_s = (uint32_t)((uint64_t)BENCH_FLASH_BYTES * SystemCoreClock / cycles);
+        uint64_t idle_share = ((uint64_t)idle * BENCH_IDLE_CYCLES * 100U) / ((uint64_t)base_loops * cycles);
+        uint32_t cpu_pct = (idle_share >= 100U) ? 0 : (uint32_t)(100U - idle_share);
+        printf("%-14s: %lu ciclos, %lu B/s, CPU %lu%%\r\n", modes[m].name,
+               (unsigned long)cycles, (unsigned long)bytes_per_s, (unsigned long)cpu_pct);
+    }
+    flash_writer_set_fast(true);
+}
+
+/**
+ * @brief Búsqueda binaria sobre los registros ordenados, sin índice (referencia).
+ */
+static const cred_record_t *__attribute__((noinline)) bench_cred_bsearch(const cred_db_t *db, uint32_t key)
+{
+    uint32_t lo = 0, hi = db->count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2U;
+        uint32_t k = db->records[mid].key;
+        if (k == key) return &db->records[mid];
+        if (k < key) lo = mid + 1U; else hi = mid;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Arma imágenes de 10, 1000 y el máximo de credenciales en SCRATCH y mide
+ *        los ciclos de cred_db_find contra la búsqueda binaria sobre la misma FLASH.
+ * @note  50k credenciales no caben en un slot de 64K; ese caso se mide en el host
+ *        con Tools/cred_db_build --bench.
+ */
+void benchmark_cred_db(void)
+{
+    static const cred_db_flash_ops_t ops = {
+        .erase_page = flash_writer_erase_page_blocking,
+        .program_dword = flash_writer_program_dword_blocking,
+        .sync = flash_writer_sync,
+    };
+    uintptr_t base = (uintptr_t)&_sscratch;
+    cred_db_t db;
+
+    printf("\r\n--- Benchmark cred_db: indice vs busqueda binaria ---\r\n");
+    if ((uint32_t)(&_escratch - &_sscratch) < 2U * BENCH_CRED_SLOT_SIZE) {
+        printf("area SCRATCH insuficiente\r\n");
+        return;
+    }
+    cred_db_init(&db, &ops, base, base + BENCH_CRED_SLOT_SIZE, BENCH_CRED_SLOT_SIZE, FLASH_PAGE_SIZE);
+    uint32_t sizes[] = { 10, 1000, cred_db_capacity(&db) };
+
+    for (uint8_t s = 0; s < 3; s++) {
+        uint32_t n = sizes[s];
+        bool ok = cred_db_begin_update(&db);
+        for (uint32_t i = 0; ok && i < n; i++) {
+            cred_record_t rec = { .key = 0x01000000U + i * 37U, .user_id = (uint16_t)i,
+                                  .flags = CRED_FLAG_ENABLED, .reserved = 0xFF };
+            ok = cred_db_stage(&db, &rec);
+        }
+        if (!ok || !cred_db_commit(&db)) {
+            printf("n=%lu: no se pudo escribir la imagen\r\n", (unsigned long)n);
+            continue;
+        }
+
+        bench_stats_t idx_stats, bin_stats;
+        bench_stats_reset(&idx_stats);
+        bench_stats_reset(&bin_stats);
+        bench_rand_state = 0xC4EDU;
+        uint32_t mismatches = 0;
+        for (uint32_t p = 0; p < BENCH_CRED_PROBES; p++) {
+            uint32_t key = 0x01000000U + (bench_rand() % n) * 37U + (p & 1U);  // Impares: fallo
+            uint32_t t0 = perf_counter_now();
+            const cred_record_t *a = cred_db_find(&db, key);
+            bench_stats_add(&idx_stats, perf_counter_now() - t0);
+            t0 = perf_counter_now();
+            const cred_record_t *b = bench_cred_bsearch(&db, key);
+            bench_stats_add(&bin_stats, perf_counter_now() - t0);
+            if (a != b) mismatches++;
+        }
+        printf("n=%lu niveles=%u indice=%lu B\r\n", (unsigned long)n, db.levels,
+               (unsigned long)cred_db_index_size(n));
+        bench_stats_print("indice", &idx_stats);
+        bench_stats_print("binaria", &bin_stats);
+        if (mismatches != 0) printf("ERROR: %lu resultados distintos\r\n", (unsigned long)mismatches);
+    }
+}
+
+// --- Cargas representativas para la matriz de caché ---
+
+static arm_fir_instance_f32 bench_fir;
+static float32_t bench_fir_coeffs[BENCH_FIR_TAPS];
+static float32_t bench_fir_state[BENCH_FIR_TAPS + BENCH_FIR_BLOCK - 1];
+static float32_t bench_fir_in[BENCH_FIR_BLOCK];
+static float32_t bench_fir_out[BENCH_FIR_BLOCK];
+static arm_rfft_fast_instance_f32 bench_rfft;
+static float32_t bench_fft_in[BENCH_FFT_LEN];
+static float32_t bench_fft_out[BENCH_FFT_LEN];
+
+/**
+ * @brief Recorrido del keypad sin los retardos de keypad_scan: cada fila se
+ *        sube y baja y se leen las cuatro columnas, todo por el HAL de GPIO.
+ */
+static uint32_t bench_work_keypad(void)
+{
+    static GPIO_TypeDef *const row_ports[] = { KEYPAD_R1_GPIO_Port, KEYPAD_R2_GPIO_Port,
+                                               KEYPAD_R3_GPIO_Port, KEYPAD_R4_GPIO_Port };
+    static const uint16_t row_pins[] = { KEYPAD_R1_Pin, KEYPAD_R2_Pin, KEYPAD_R3_Pin, KEYPAD_R4_Pin };
+    static GPIO_TypeDef *const col_ports[] = { KEYPAD_C1_GPIO_Port, KEYPAD_C2_GPIO_Port,
+                                               KEYPAD_C3_GPIO_Port, KEYPAD_C4_GPIO_Port };
+    static const uint16_t col_pins[] = { KEYPAD_C1_Pin, KEYPAD_C2_Pin, KEYPAD_C3_Pin, KEYPAD_C4_Pin };
+    uint32_t levels = 0;
+
+    for (uint8_t r = 0; r < 4; r++) {
+        HAL_GPIO_WritePin(row_ports[r], row_pins[r], GPIO_PIN_SET);
+        for (uint8_t c = 0; c < 4; c++) {
+            levels = (levels << 1) | HAL_GPIO_ReadPin(col_ports[c], col_pins[c]);
+        }
+        HAL_GPIO_WritePin(row_ports[r], row_pins[r], GPIO_PIN_RESET);  // Reposo: filas en bajo
+    }
+    return levels;
+}
+
+static uint32_t bench_work_ring(void)
+{
+    static uint8_t storage[BENCH_RING_LEN];
+    ring_buffer_t rb;
+    uint8_t byte;
+    uint32_t sum = 0;
+
+    ring_buffer_init(&rb, storage, BENCH_RING_LEN);
+    for (uint32_t i = 0; i < BENCH_RING_LEN - 1; i++) ring_buffer_write(&rb, (uint8_t)i);
+    while (ring_buffer_read(&rb, &byte)) sum += byte;
+    return sum;
+}
+
+static uint32_t bench_work_fir(void)
+{
+    arm_fir_f32(&bench_fir, bench_fir_in, bench_fir_out, BENCH_FIR_BLOCK);
+    return (uint32_t)bench_fir_out[BENCH_FIR_BLOCK - 1];
+}
+
+static uint32_t bench_work_fft(void)
+{
+    float32_t in[BENCH_FFT_LEN];
+    memcpy(in, bench_fft_in, sizeof(in));  // arm_rfft_fast_f32 modifica la entrada
+    arm_rfft_fast_f32(&bench_rfft, in, bench_fft_out, 0);
+    return (uint32_t)bench_fft_out[2];
+}
+
+static const struct {
+    const char *name;
+    uint32_t (*run)(void);
+} bench_workloads[BENCH_CACHE_WORKLOADS] = {
+    { "keypad", bench_work_keypad },
+    { "ring", bench_work_ring },
+    { "fir32x64", bench_work_fir },
+    { "rfft256", bench_work_fft },
+};
+
+/**
+ * @brief Primera corrida (cachés recién reiniciados) y mejor de BENCH_KERNEL_RUNS.
+ */
+static void bench_workload_cycles(uint32_t (*run)(void), uint32_t *cold, uint32_t *best)
+{
+    volatile uint32_t sink;
+    *best = UINT32_MAX;
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        sink = run();
+        uint32_t cycles = perf_counter_now() - t0;
+        if (i == 0) *cold = cycles;
+        if (cycles < *best) *best = cycles;
+    }
+    (void)sink;
+}
+
+/**
+ * @brief Ejecuta las cargas con las 8 combinaciones de prefetch/I-cache/D-cache en
+ *        cada perfil de reloj y adopta, por perfil, la de menor suma de ciclos.
+ * @note  Termina de vuelta en el perfil de rendimiento.
+ */
+void benchmark_flash_cache(void)
+{
+    bench_rand_state = 0xCAC4U;
+    for (uint32_t i = 0; i < BENCH_FIR_TAPS; i++) bench_fir_coeffs[i] = 1.0f / BENCH_FIR_TAPS;
+    for (uint32_t i = 0; i < BENCH_FIR_BLOCK; i++) bench_fir_in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f;
+    for (uint32_t i = 0; i < BENCH_FFT_LEN; i++) bench_fft_in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f;
+    arm_fir_init_f32(&bench_fir, BENCH_FIR_TAPS, bench_fir_coeffs, bench_fir_state, BENCH_FIR_BLOCK);
+    arm_rfft_fast_init_f32(&bench_rfft, BENCH_FFT_LEN);
+
+    printf("\r\n--- Benchmark ART: prefetch (P), I-cache (I), D-cache (D) ---\r\n");
+    if (!flash_writer_sync()) {
+        printf("flash_writer ocupado\r\n");
+        return;
+    }
+
+    for (uint8_t p = 0; p < CLOCK_PROFILE_COUNT; p++) {
+        if (clock_manager_set_profile((clock_profile_t)p) != HAL_OK) continue;
+        printf("perfil %s (latencia %lu), ciclos frio/mejor:\r\n", clock_manager_profile_name((clock_profile_t)p),
+               (unsigned long)__HAL_FLASH_GET_LATENCY());
+
+        uint8_t best_config = flash_cache_get();
+        uint32_t best_total = UINT32_MAX;
+        for (uint8_t config = 0; config < FLASH_CACHE_COMBINATIONS; config++) {
+            flash_cache_apply(config);
+            uint32_t total = 0;
+            printf("  %s", flash_cache_name(config));
+            for (uint8_t w = 0; w < BENCH_CACHE_WORKLOADS; w++) {
+                uint32_t cold, best;
+                bench_workload_cycles(bench_workloads[w].run, &cold, &best);
+                total += best;
+                printf(" %s=%lu/%lu", bench_workloads[w].name, (unsigned long)cold, (unsigned long)best);
+            }
+            printf("\r\n");
+            if (total < best_total) {
+                best_total = total;
+                best_config = config;
+            }
+        }
+        flash_cache_set_profile_config((clock_profile_t)p, best_config);
+        printf("  elegido: %s\r\n", flash_cache_name(best_config));
+    }
+    clock_manager_set_profile(CLOCK_PROFILE_PERFORMANCE);
+}
+
+// --- Tablas de FFT en FLASH contra generadas en SRAM2 ---
+
+// Cota de arm_rfft_fast_init_dyn_size_f32: 10 bytes por punto de la RFFT más larga
+static SRAM2_BSS uint32_t bench_fft_arena[(10U * MFCC_FRAME_LEN) / sizeof(uint32_t)];
+
+typedef struct {
+    float32_t work[MFCC_FRAME_LEN];
+    float32_t in[MFCC_FRAME_LEN];
+    float32_t out_rom[MFCC_FRAME_LEN];
+    float32_t out_ram[MFCC_FRAME_LEN];
+} bench_fft_buffers_t;
+
+_Static_assert(sizeof(bench_fft_buffers_t) <= sizeof(bench_scratch), "buffers de las tablas de FFT");
+static bench_fft_buffers_t *const bench_fft = (bench_fft_buffers_t *)bench_scratch;
+
+/**
+ * @brief Mejor de BENCH_KERNEL_RUNS de una RFFT de in copiada en work; deja el espectro en out.
+ */
+static uint32_t bench_rfft_cycles(arm_rfft_fast_instance_f32 *s, const float32_t *in, float32_t *work,
+                                  float32_t *out)
+{
+    uint32_t best = UINT32_MAX;
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        memcpy(work, in, s->fftLenRFFT * sizeof(float32_t));  // arm_rfft_fast_f32 modifica la entrada
+        uint32_t t0 = perf_counter_now();
+        arm_rfft_fast_f32(s, work, out, 0);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+/**
+ * @brief Inicialización y RFFT con las tablas de FLASH y con las generadas en
+ *        SRAM2 (arm_rfft_fast_init_dyn_f32) para BENCH_FFT_LEN y MFCC_FRAME_LEN.
+ * @note  La diferencia entre espectros se imprime en partes por 10^9 del pico;
+ *        Tools/fft_tables_check.c compara las tablas de todos los tamaños.
+ */
+void benchmark_fft_tables(void)
+{
+    static const uint16_t lens[] = { BENCH_FFT_LEN, MFCC_FRAME_LEN };
+    float32_t *in = bench_fft->in, *out_rom = bench_fft->out_rom, *out_ram = bench_fft->out_ram;
+
+    printf("\r\n--- Benchmark tablas de FFT: FLASH contra SRAM2 ---\r\n");
+    bench_rand_state = 0xFF7AU;
+    for (uint32_t i = 0; i < MFCC_FRAME_LEN; i++) in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+
+    for (uint8_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        arm_rfft_fast_instance_f32 rom, ram;
+        uint16_t len = lens[l];
+
+        uint32_t t0 = perf_counter_now();
+        arm_status rom_status = arm_rfft_fast_init_f32(&rom, len);
+        uint32_t rom_init = perf_counter_now() - t0;
+        t0 = perf_counter_now();
+        arm_status ram_status = arm_rfft_fast_init_dyn_f32(&ram, len, bench_fft_arena, sizeof(bench_fft_arena));
+        uint32_t ram_init = perf_counter_now() - t0;
+        if (ram_status != ARM_MATH_SUCCESS) {
+            printf("rfft%u: arena chica\r\n", len);
+            continue;
+        }
+
+        uint32_t ram_fft = bench_rfft_cycles(&ram, in, bench_fft->work, out_ram);
+        printf("rfft%u SRAM2: init %lu ciclos (%lu us), %lu B de RAM, rfft %lu ciclos\r\n", len,
+               (unsigned long)ram_init, (unsigned long)perf_counter_cycles_to_us(ram_init),
+               (unsigned long)arm_rfft_fast_init_dyn_size_f32(len), (unsigned long)ram_fft);
+        if (rom_status != ARM_MATH_SUCCESS) {
+            printf("rfft%u FLASH: tablas no compiladas (CMSIS_DSP_FFT_TABLES)\r\n", len);
+            continue;
+        }
+
+        uint32_t rom_fft = bench_rfft_cycles(&rom, in, bench_fft->work, out_rom);
+        float32_t peak = 0.0f, diff = 0.0f;
+        for (uint32_t i = 0; i < len; i++) {
+            if (fabsf(out_rom[i]) > peak) peak = fabsf(out_rom[i]);
+            if (fabsf(out_ram[i] - out_rom[i]) > diff) diff = fabsf(out_ram[i] - out_rom[i]);
+        }
+        printf("rfft%u FLASH: init %lu ciclos, rfft %lu ciclos; diferencia %lu ppb del pico\r\n", len,
+               (unsigned long)rom_init, (unsigned long)rom_fft, (unsigned long)(diff / peak * 1e9f));
+    }
+}
+
+// --- FFT de radix mixto contra potencia de 2 con relleno de ceros ---
+
+#define BENCH_MIXED_MAX_LEN 480U
+
+typedef struct {
+    float32_t twiddle[2U * BENCH_MIXED_MAX_LEN];  // arm_rfft_mixed_init_f32: 2*fftLen
+    float32_t work[MFCC_FRAME_LEN];
+    float32_t in[MFCC_FRAME_LEN];
+    float32_t padded_in[MFCC_FRAME_LEN];
+    float32_t out[MFCC_FRAME_LEN];
+} bench_mixed_buffers_t;
+
+_Static_assert(sizeof(bench_mixed_buffers_t) <= sizeof(bench_scratch), "buffers de la FFT de radix mixto");
+static bench_mixed_buffers_t *const bench_mixed = (bench_mixed_buffers_t *)bench_scratch;
+
+/**
+ * @brief Ciclos de arm_rfft_mixed_f32 para las ventanas de los sensores (160, 240
+ *        y 480 muestras) contra arm_rfft_fast_f32 de la potencia de 2 siguiente con
+ *        relleno de ceros. La exactitud se verifica en Tools/fft_mixed_bench.c.
+ */
+void benchmark_fft_mixed(void)
+{
+    static const uint16_t lens[][2] = { { 160, 256 }, { 240, 256 }, { 480, 512 } };
+    float32_t *in = bench_mixed->in, *padded_in = bench_mixed->padded_in, *out = bench_mixed->out;
+
+    printf("\r\n--- Benchmark FFT radix mixto (2, 3, 4, 5) contra potencia de 2 ---\r\n");
+    bench_rand_state = 0x3A5EU;
+    for (uint32_t i = 0; i < MFCC_FRAME_LEN; i++) in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+
+    for (uint8_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        arm_rfft_mixed_instance_f32 mixed;
+        arm_rfft_fast_instance_f32 pow2;
+        uint16_t len = lens[l][0], padded = lens[l][1];
+
+        if (arm_rfft_mixed_init_f32(&mixed, len, bench_mixed->twiddle) != ARM_MATH_SUCCESS) {
+            printf("rfft%u: longitud no soportada\r\n", len);
+            continue;
+        }
+        uint32_t best_mixed = UINT32_MAX;
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            memcpy(bench_mixed->work, in, len * sizeof(float32_t));
+            uint32_t t0 = perf_counter_now();
+            arm_rfft_mixed_f32(&mixed, bench_mixed->work, out, 0);
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_mixed) best_mixed = cycles;
+        }
+        printf("rfft%u mixto: %lu ciclos", len, (unsigned long)best_mixed);
+
+        if (arm_rfft_fast_init_f32(&pow2, padded) != ARM_MATH_SUCCESS) {
+            printf(", rfft%u sin tablas en FLASH\r\n", padded);
+            continue;
+        }
+        // Misma ventana con relleno de ceros hasta la potencia de 2
+        memset(padded_in, 0, sizeof(bench_mixed->padded_in));
+        memcpy(padded_in, in, len * sizeof(float32_t));
+        uint32_t best_pow2 = bench_rfft_cycles(&pow2, padded_in, bench_mixed->work, out);
+        printf(", rfft%u con relleno: %lu ciclos (x%lu.%02lu)\r\n", padded, (unsigned long)best_pow2,
+               (unsigned long)(best_pow2 / best_mixed), (unsigned long)(best_pow2 * 100U / best_mixed % 100U));
+    }
+}
+
+// --- FIR de N canales entrelazados: una pasada contra un arm_fir_f32 por canal ---
+
+#define BENCH_FIR_MAX_CHANNELS 8U
+#define BENCH_FIR_STATE_LEN (BENCH_FIR_TAPS + BENCH_FIR_BLOCK - 1U)
+
+typedef struct {
+    float32_t in[BENCH_FIR_BLOCK * BENCH_FIR_MAX_CHANNELS];
+    float32_t out[BENCH_FIR_BLOCK * BENCH_FIR_MAX_CHANNELS];
+    float32_t ref[BENCH_FIR_BLOCK * BENCH_FIR_MAX_CHANNELS];
+    float32_t state[BENCH_FIR_STATE_LEN * BENCH_FIR_MAX_CHANNELS];  // Compartido por ambas variantes
+} bench_mc_buffers_t;
+
+_Static_assert(sizeof(bench_mc_buffers_t) <= sizeof(bench_scratch), "buffers del FIR multicanal");
+static bench_mc_buffers_t *const bench_mc = (bench_mc_buffers_t *)bench_scratch;
+
+/**
+ * @brief Camino sin la API multicanal: separa cada canal, lo filtra con su propia
+ *        instancia de arm_fir_f32 y vuelve a entrelazar la salida.
+ */
+static void bench_fir_per_channel(arm_fir_instance_f32 *fir, uint32_t channels)
+{
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        for (uint32_t n = 0; n < BENCH_FIR_BLOCK; n++) bench_fir_in[n] = bench_mc->in[n * channels + ch];
+        arm_fir_f32(&fir[ch], bench_fir_in, bench_fir_out, BENCH_FIR_BLOCK);
+        for (uint32_t n = 0; n < BENCH_FIR_BLOCK; n++) bench_mc->ref[n * channels + ch] = bench_fir_out[n];
+    }
+}
+
+/**
+ * @brief Ciclos de arm_fir_multichannel_f32 para 1 a 8 canales entrelazados con
+ *        los mismos BENCH_FIR_TAPS coeficientes, contra un arm_fir_f32 por canal
+ *        con su separación y entrelazado. Imprime la diferencia máxima entre ambos.
+ */
+void benchmark_fir_multichannel(void)
+{
+    arm_fir_instance_f32 fir[BENCH_FIR_MAX_CHANNELS];
+    arm_fir_multichannel_instance_f32 mc;
+
+    printf("\r\n--- Benchmark FIR multicanal (%u taps, %u tramas) ---\r\n", BENCH_FIR_TAPS, BENCH_FIR_BLOCK);
+    bench_rand_state = 0x4C11U;
+    for (uint32_t i = 0; i < BENCH_FIR_TAPS; i++) {
+        bench_fir_coeffs[i] = ((float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f) / BENCH_FIR_TAPS;
+    }
+    for (uint32_t i = 0; i < BENCH_FIR_BLOCK * BENCH_FIR_MAX_CHANNELS; i++) {
+        bench_mc->in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+    }
+
+    for (uint32_t channels = 1; channels <= BENCH_FIR_MAX_CHANNELS; channels++) {
+        uint32_t best_ref = UINT32_MAX, best_mc = UINT32_MAX;
+
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            arm_fir_init_f32(&fir[ch], BENCH_FIR_TAPS, bench_fir_coeffs, &bench_mc->state[ch * BENCH_FIR_STATE_LEN],
+                             BENCH_FIR_BLOCK);
+        }
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            uint32_t t0 = perf_counter_now();
+            bench_fir_per_channel(fir, channels);
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_ref) best_ref = cycles;
+        }
+
+        arm_fir_multichannel_init_f32(&mc, (uint16_t)channels, BENCH_FIR_TAPS, bench_fir_coeffs, bench_mc->state,
+                                      BENCH_FIR_BLOCK);
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            uint32_t t0 = perf_counter_now();
+            arm_fir_multichannel_f32(&mc, bench_mc->in, bench_mc->out, BENCH_FIR_BLOCK);
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_mc) best_mc = cycles;
+        }
+
+        // Misma entrada en cada corrida: con el estado lleno ambas salidas coinciden
+        float32_t diff = 0.0f;
+        for (uint32_t i = 0; i < BENCH_FIR_BLOCK * channels; i++) {
+            if (fabsf(bench_mc->out[i] - bench_mc->ref[i]) > diff) diff = fabsf(bench_mc->out[i] - bench_mc->ref[i]);
+        }
+        printf("%lu canales: por canal %lu ciclos, multicanal %lu ciclos (x%lu.%02lu), %lu ciclos/muestra, "
+               "diferencia %lu ppb\r\n",
+               (unsigned long)channels, (unsigned long)best_ref, (unsigned long)best_mc,
+               (unsigned long)(best_ref / best_mc), (unsigned long)(best_ref * 100U / best_mc % 100U),
+               (unsigned long)(best_mc / (BENCH_FIR_BLOCK * channels)), (unsigned long)(diff * 1e9f));
+    }
+}
+
+// --- FIR largo: convolución FFT particionada (overlap-save) contra FIR directo ---
+
+#define BENCH_FIR_FFT_BLOCK 128U      // Partición: rfft256, con tablas en FLASH por defecto
+#define BENCH_FIR_FFT_MAX_TAPS 512U   // Tools/fir_fft_bench.c llega a 4096 en el host
+
+typedef struct {
+    float32_t coeffs[BENCH_FIR_FFT_MAX_TAPS];
+    float32_t in[BENCH_FIR_FFT_BLOCK];
+    float32_t out[BENCH_FIR_FFT_BLOCK];
+    float32_t ref[BENCH_FIR_FFT_BLOCK];
+    // Compartido por ambas variantes: el de la FFT es el mayor
+    float32_t state[ARM_FIR_FFT_STATE_LEN_F32(BENCH_FIR_FFT_MAX_TAPS, BENCH_FIR_FFT_BLOCK)];
+} bench_ffir_buffers_t;
+
+_Static_assert(sizeof(bench_ffir_buffers_t) <= sizeof(bench_scratch), "buffers del FIR por FFT");
+static bench_ffir_buffers_t *const bench_ffir = (bench_ffir_buffers_t *)bench_scratch;
+
+/**
+ * @brief Ciclos de arm_fir_fft_f32 contra arm_fir_f32 para 16 a 512 taps con
+ *        bloques de BENCH_FIR_FFT_BLOCK muestras, e imprime desde cuántos taps
+ *        conviene la FFT. La diferencia se imprime en ppb del pico de la salida.
+ */
+void benchmark_fir_fft(void)
+{
+    arm_fir_instance_f32 fir;
+    arm_fir_fft_instance_f32 fir_fft;
+    uint32_t crossover = 0;
+
+    printf("\r\n--- Benchmark FIR por FFT particionada (bloque %u) contra FIR directo ---\r\n",
+           BENCH_FIR_FFT_BLOCK);
+    bench_rand_state = 0x0F17U;
+    for (uint32_t i = 0; i < BENCH_FIR_FFT_MAX_TAPS; i++) {
+        bench_ffir->coeffs[i] = ((float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f) / 16.0f;
+    }
+    for (uint32_t i = 0; i < BENCH_FIR_FFT_BLOCK; i++) {
+        bench_ffir->in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+    }
+
+    for (uint32_t taps = 16; taps <= BENCH_FIR_FFT_MAX_TAPS; taps *= 2) {
+        uint32_t best_direct = UINT32_MAX, best_fft = UINT32_MAX;
+
+        arm_fir_init_f32(&fir, (uint16_t)taps, bench_ffir->coeffs, bench_ffir->state, BENCH_FIR_FFT_BLOCK);
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            uint32_t t0 = perf_counter_now();
+            arm_fir_f32(&fir, bench_ffir->in, bench_ffir->ref, BENCH_FIR_FFT_BLOCK);
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_direct) best_direct = cycles;
+        }
+
+        if (arm_fir_fft_init_f32(&fir_fft, (uint16_t)taps, bench_ffir->coeffs, bench_ffir->state,
+                                 BENCH_FIR_FFT_BLOCK) != ARM_MATH_SUCCESS) {
+            printf("rfft%u sin tablas en FLASH (CMSIS_DSP_FFT_TABLES)\r\n", 2U * BENCH_FIR_FFT_BLOCK);
+            return;
+        }
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            uint32_t t0 = perf_counter_now();
+            arm_fir_fft_f32(&fir_fft, bench_ffir->in, bench_ffir->out, BENCH_FIR_FFT_BLOCK);
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_fft) best_fft = cycles;
+        }
+
+        // Misma entrada en cada corrida: con el estado lleno ambas salidas coinciden
+        float32_t peak = 0.0f, diff = 0.0f;
+        for (uint32_t i = 0; i < BENCH_FIR_FFT_BLOCK; i++) {
+            float32_t d = fabsf(bench_ffir->out[i] - bench_ffir->ref[i]);
+            if (fabsf(bench_ffir->ref[i]) > peak) peak = fabsf(bench_ffir->ref[i]);
+            if (d > diff) diff = d;
+        }
+        printf("%lu taps: directo %lu ciclos, FFT %lu ciclos (x%lu.%02lu), diferencia %lu ppb del pico\r\n",
+               (unsigned long)taps, (unsigned long)best_direct, (unsigned long)best_fft,
+               (unsigned long)(best_direct / best_fft), (unsigned long)(best_direct * 100U / best_fft % 100U),
+               (unsigned long)(diff / peak * 1e9f));
+        if (crossover == 0 && best_fft < best_direct) crossover = taps;
+    }
+
+    if (crossover != 0) {
+        printf("Cruce: la FFT gana desde %lu taps\r\n", (unsigned long)crossover);
+    } else {
+        printf("Cruce: el FIR directo gana hasta %u taps\r\n", BENCH_FIR_FFT_MAX_TAPS);
+    }
+}
+
+// --- Conversor de tasa racional L/M (polifase) ---
+
+#define BENCH_RS_BLOCK 96U           // Muestras de entrada por llamada (2 ms a 48 kHz)
+#define BENCH_RS_DECIM_TAPS 48U      // 48k->16k: mismo filtro que arm_fir_decimate
+#define BENCH_RS_PHASE_LEN 16U       // 44.1k->16k: 160 fases de 16 taps
+#define BENCH_RS_STATE_LEN (BENCH_RS_DECIM_TAPS + BENCH_RS_BLOCK - 1U)
+
+typedef struct {
+    float32_t coeffs[160U * BENCH_RS_PHASE_LEN];  // Los de 44.1k->16k, los mayores; los q15 reusan el espacio
+    float32_t in[BENCH_RS_BLOCK], out[BENCH_RS_BLOCK];
+    q15_t in_q15[BENCH_RS_BLOCK], out_q15[BENCH_RS_BLOCK];
+    float32_t state[BENCH_RS_STATE_LEN];
+    q15_t state_q15[BENCH_RS_STATE_LEN];
+    q15_t decim_q15[BENCH_RS_DECIM_TAPS];
+} bench_rs_buffers_t;
+
+_Static_assert(sizeof(bench_rs_buffers_t) <= sizeof(bench_scratch), "buffers del conversor de tasa");
+static bench_rs_buffers_t *const bench_rs = (bench_rs_buffers_t *)bench_scratch;
+
+/**
+ * @brief Mejor de BENCH_KERNEL_RUNS de un bloque del conversor f32 o q15; deja en
+ *        *outputs las muestras producidas por la mejor corrida.
+ */
+static uint32_t bench_rs_cycles(arm_fir_resample_instance_f32 *f32, arm_fir_resample_instance_q15 *q15,
+                                uint32_t *outputs)
+{
+    uint32_t best = UINT32_MAX;
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        uint32_t n = (f32 != NULL) ? arm_fir_resample_f32(f32, bench_rs->in, bench_rs->out, BENCH_RS_BLOCK)
+                                   : arm_fir_resample_q15(q15, bench_rs->in_q15, bench_rs->out_q15, BENCH_RS_BLOCK);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best) {
+            best = cycles;
+            *outputs = n;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Ciclos por muestra de salida de arm_fir_resample_f32/q15 para 48 kHz a
+ *        16 kHz, contra arm_fir_decimate con el mismo filtro, y para 44.1 kHz a
+ *        16 kHz (L=160, M=441). La exactitud se verifica en Tools/resample_bench.c.
+ */
+void benchmark_fir_resample(void)
+{
+    arm_fir_resample_instance_f32 rs;
+    arm_fir_resample_instance_q15 rs_q15;
+    arm_fir_decimate_instance_f32 dec;
+    arm_fir_decimate_instance_q15 dec_q15;
+    float32_t *coeffs = bench_rs->coeffs;
+    q15_t *coeffs_q15 = (q15_t *)bench_rs->coeffs;
+    uint32_t n, n_q15, best, best_q15;
+
+    printf("\r\n--- Benchmark conversor de tasa L/M (bloque %u) ---\r\n", BENCH_RS_BLOCK);
+    bench_rand_state = 0x44B1U;
+    for (uint32_t i = 0; i < BENCH_RS_BLOCK; i++) {
+        bench_rs->in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+    }
+    arm_float_to_q15(bench_rs->in, bench_rs->in_q15, BENCH_RS_BLOCK);
+
+    // 48k->16k (L=1, M=3): conversor contra el decimador de CMSIS
+    for (uint32_t i = 0; i < BENCH_RS_DECIM_TAPS; i++) {
+        coeffs[i] = ((float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f) / BENCH_RS_DECIM_TAPS;
+    }
+    arm_float_to_q15(coeffs, bench_rs->decim_q15, BENCH_RS_DECIM_TAPS);
+
+    arm_fir_decimate_init_f32(&dec, BENCH_RS_DECIM_TAPS, 3, coeffs, bench_rs->state, BENCH_RS_BLOCK);
+    uint32_t best_dec = UINT32_MAX;
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        arm_fir_decimate_f32(&dec, bench_rs->in, bench_rs->out, BENCH_RS_BLOCK);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best_dec) best_dec = cycles;
+    }
+    arm_fir_decimate_init_q15(&dec_q15, BENCH_RS_DECIM_TAPS, 3, bench_rs->decim_q15, bench_rs->state_q15, BENCH_RS_BLOCK);
+    uint32_t best_dec_q15 = UINT32_MAX;
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        arm_fir_decimate_q15(&dec_q15, bench_rs->in_q15, bench_rs->out_q15, BENCH_RS_BLOCK);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best_dec_q15) best_dec_q15 = cycles;
+    }
+
+    arm_fir_resample_init_f32(&rs, 1, 3, BENCH_RS_DECIM_TAPS, coeffs, bench_rs->state, BENCH_RS_BLOCK);
+    best = bench_rs_cycles(&rs, NULL, &n);
+    arm_fir_resample_init_q15(&rs_q15, 1, 3, BENCH_RS_DECIM_TAPS, bench_rs->decim_q15, bench_rs->state_q15,
+                              BENCH_RS_BLOCK);
+    best_q15 = bench_rs_cycles(NULL, &rs_q15, &n_q15);
+    printf("48k->16k: f32 %lu ciclos/salida (decimador %lu), q15 %lu ciclos/salida (decimador %lu)\r\n",
+           (unsigned long)(best / n), (unsigned long)(best_dec / (BENCH_RS_BLOCK / 3U)),
+           (unsigned long)(best_q15 / n_q15), (unsigned long)(best_dec_q15 / (BENCH_RS_BLOCK / 3U)));
+
+    // 44.1k->16k (L=160, M=441): sin equivalente directo en CMSIS
+    for (uint32_t i = 0; i < 160U * BENCH_RS_PHASE_LEN; i++) {
+        coeffs[i] = ((float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f) / BENCH_RS_PHASE_LEN;
+    }
+    arm_fir_resample_init_f32(&rs, 160, 441, 160U * BENCH_RS_PHASE_LEN, coeffs, bench_rs->state, BENCH_RS_BLOCK);
+    best = bench_rs_cycles(&rs, NULL, &n);
+    for (uint32_t i = 0; i < 160U * BENCH_RS_PHASE_LEN; i++) {
+        coeffs_q15[i] = (q15_t)(((int32_t)(bench_rand() & 0xFFFF) - 0x8000) / (int32_t)BENCH_RS_PHASE_LEN);
+    }
+    arm_fir_resample_init_q15(&rs_q15, 160, 441, 160U * BENCH_RS_PHASE_LEN, coeffs_q15, bench_rs->state_q15,
+                              BENCH_RS_BLOCK);
+    best_q15 = bench_rs_cycles(NULL, &rs_q15, &n_q15);
+    printf("44.1k->16k: f32 %lu ciclos/salida, q15 %lu ciclos/salida (%u taps por salida; interpolar y "
+           "descartar filtraría 441 muestras por salida)\r\n",
+           (unsigned long)(best / n), (unsigned long)(best_q15 / n_q15), BENCH_RS_PHASE_LEN);
+}
+
+// --- Cascada de biquads q15 fusionada por tramos ---
+
+#define BENCH_BQ_STAGES 4U
+#define BENCH_BQ_BLOCK 64U
+
+// Butterworth pasa bajos de 8 polos en 0.03 fs, la sección de mayor Q primero (Tools/biquad_bench.c)
+static const float32_t bench_bq_sos[5U * BENCH_BQ_STAGES] = {
+    0.008544036f, 0.017088073f, 0.008544036f, 1.895289757f, -0.929465902f,
+    0.008021327f, 0.016042653f, 0.008021327f, 1.779339107f, -0.811424414f,
+    0.007662537f, 0.015325074f, 0.007662537f, 1.699750238f, -0.730400386f,
+    0.007481431f, 0.014962862f, 0.007481431f, 1.659576201f, -0.689501925f,
+};
+
+typedef struct {
+    float32_t sos_scaled[5U * BENCH_BQ_STAGES];
+    q15_t coeffs_q15[6U * BENCH_BQ_STAGES];
+    q31_t coeffs_q31[5U * BENCH_BQ_STAGES];
+    q15_t state_q15[2][4U * BENCH_BQ_STAGES];  // [0] df1, [1] fusionada
+    q31_t state_q31[4U * BENCH_BQ_STAGES];
+    float32_t state_f32[2U * BENCH_BQ_STAGES];
+    q15_t in_q15[BENCH_BQ_BLOCK], out_q15[2][BENCH_BQ_BLOCK];
+    q31_t in_q31[BENCH_BQ_BLOCK], out_q31[BENCH_BQ_BLOCK];
+    float32_t in_f32[BENCH_BQ_BLOCK], out_f32[BENCH_BQ_BLOCK];
+} bench_bq_buffers_t;
+
+_Static_assert(sizeof(bench_bq_buffers_t) <= sizeof(bench_scratch), "buffers de la cascada de biquads");
+static bench_bq_buffers_t *const bench_bq = (bench_bq_buffers_t *)bench_scratch;
+
+/**
+ * @brief Mejor de BENCH_KERNEL_RUNS de un bloque de la cascada q15 con df1 (fused = 0)
+ *        o fusionada (fused = 1).
+ */
+static uint32_t bench_bq_cycles_q15(const arm_biquad_casd_df1_inst_q15 *bq, uint8_t fused)
+{
+    uint32_t best = UINT32_MAX;
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        if (fused) {
+            arm_biquad_cascade_df1_fused_q15(bq, bench_bq->in_q15, bench_bq->out_q15[1], BENCH_BQ_BLOCK);
+        } else {
+            arm_biquad_cascade_df1_q15(bq, bench_bq->in_q15, bench_bq->out_q15[0], BENCH_BQ_BLOCK);
+        }
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+/**
+ * @brief Ciclos por muestra de arm_biquad_cascade_df1_fused_q15 contra df1 q15 (normal
+ *        y rápida), df1 q31 y df2T f32 con BENCH_BQ_STAGES secciones, con las secciones
+ *        tal cual y tras arm_biquad_sos_order_scale_f32. La saturación de cada caso se
+ *        mide en Tools/biquad_bench.c.
+ */
+void benchmark_biquad(void)
+{
+    arm_biquad_casd_df1_inst_q15 bq[2];
+    arm_biquad_casd_df1_inst_q31 bq_q31;
+    arm_biquad_cascade_df2T_instance_f32 bq_f32;
+    uint32_t best_df1, best_fast = UINT32_MAX, best_fused, best_q31 = UINT32_MAX, best_f32 = UINT32_MAX;
+    uint32_t diff;
+    float32_t gain;
+    int8_t shift;
+
+    printf("\r\n--- Benchmark cascada de biquads (%u secciones, bloque %u) ---\r\n", BENCH_BQ_STAGES,
+           BENCH_BQ_BLOCK);
+    bench_rand_state = 0xB1C0U;
+    for (uint32_t i = 0; i < BENCH_BQ_BLOCK; i++) {
+        bench_bq->in_f32[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+    }
+    arm_float_to_q15(bench_bq->in_f32, bench_bq->in_q15, BENCH_BQ_BLOCK);
+    arm_float_to_q31(bench_bq->in_f32, bench_bq->in_q31, BENCH_BQ_BLOCK);
+
+    memcpy(bench_bq->sos_scaled, bench_bq_sos, sizeof(bench_bq_sos));
+    for (uint8_t ordered = 0; ordered < 2; ordered++) {
+        if (ordered && arm_biquad_sos_order_scale_f32(bench_bq->sos_scaled, BENCH_BQ_STAGES, 256, &gain) !=
+                           ARM_MATH_SUCCESS) {
+            printf("Orden y escala de secciones fallo\r\n");
+            return;
+        }
+        if (arm_biquad_sos_to_q15(bench_bq->sos_scaled, BENCH_BQ_STAGES, bench_bq->coeffs_q15, &shift) !=
+            ARM_MATH_SUCCESS) {
+            printf("Conversion a q15 fallo\r\n");
+            return;
+        }
+
+        // Ambas con el mismo historial: tras BENCH_KERNEL_RUNS bloques iguales las salidas deben coincidir
+        for (uint8_t v = 0; v < 2; v++) {
+            arm_biquad_cascade_df1_init_q15(&bq[v], BENCH_BQ_STAGES, bench_bq->coeffs_q15, bench_bq->state_q15[v],
+                                            shift);
+        }
+        best_df1 = bench_bq_cycles_q15(&bq[0], 0);
+        best_fused = bench_bq_cycles_q15(&bq[1], 1);
+        diff = 0;
+        for (uint32_t i = 0; i < BENCH_BQ_BLOCK; i++) {
+            if (bench_bq->out_q15[0][i] != bench_bq->out_q15[1][i]) diff++;
+        }
+
+        if (!ordered) {
+            printf("Secciones tal cual (postShift %d): df1 q15 %lu ciclos, fusionada %lu ciclos (x%lu.%02lu), "
+                   "%lu muestras distintas\r\n",
+                   (int)shift, (unsigned long)best_df1, (unsigned long)best_fused,
+                   (unsigned long)(best_df1 / best_fused), (unsigned long)(best_df1 * 100U / best_fused % 100U),
+                   (unsigned long)diff);
+        } else {
+            printf("Ordenadas y escaladas (postShift %d, ganancia x%lu.%03lu): df1 q15 %lu ciclos, fusionada %lu "
+                   "ciclos, %lu muestras distintas\r\n",
+                   (int)shift, (unsigned long)gain, (unsigned long)(gain * 1000.0f) % 1000U,
+                   (unsigned long)best_df1, (unsigned long)best_fused, (unsigned long)diff);
+        }
+    }
+
+    // Resto de las cascadas con las secciones ordenadas y escaladas
+    arm_biquad_cascade_df1_init_q15(&bq[0], BENCH_BQ_STAGES, bench_bq->coeffs_q15, bench_bq->state_q15[0], shift);
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        arm_biquad_cascade_df1_fast_q15(&bq[0], bench_bq->in_q15, bench_bq->out_q15[0], BENCH_BQ_BLOCK);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best_fast) best_fast = cycles;
+    }
+    // q31 con el mismo postShift: los coeficientes q15 en la mitad alta
+    for (uint32_t k = 0; k < BENCH_BQ_STAGES; k++) {
+        for (uint32_t i = 0; i < 5U; i++) {
+            bench_bq->coeffs_q31[5U * k + i] = (q31_t)bench_bq->coeffs_q15[6U * k + ((i == 0U) ? 0U : i + 1U)] << 16;
+        }
+    }
+    arm_biquad_cascade_df1_init_q31(&bq_q31, BENCH_BQ_STAGES, bench_bq->coeffs_q31, bench_bq->state_q31, shift);
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        arm_biquad_cascade_df1_q31(&bq_q31, bench_bq->in_q31, bench_bq->out_q31, BENCH_BQ_BLOCK);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best_q31) best_q31 = cycles;
+    }
+    arm_biquad_cascade_df2T_init_f32(&bq_f32, BENCH_BQ_STAGES, bench_bq->sos_scaled, bench_bq->state_f32);
+    for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+        uint32_t t0 = perf_counter_now();
+        arm_biquad_cascade_df2T_f32(&bq_f32, bench_bq->in_f32, bench_bq->out_f32, BENCH_BQ_BLOCK);
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best_f32) best_f32 = cycles;
+    }
+    printf("Ciclos/muestra: df1 q15 %lu, df1 rapida q15 %lu, fusionada q15 %lu, df1 q31 %lu, df2T f32 %lu\r\n",
+           (unsigned long)(best_df1 / BENCH_BQ_BLOCK), (unsigned long)(best_fast / BENCH_BQ_BLOCK),
+           (unsigned long)(best_fused / BENCH_BQ_BLOCK), (unsigned long)(best_q31 / BENCH_BQ_BLOCK),
+           (unsigned long)(best_f32 / BENCH_BQ_BLOCK));
+}
+
+// --- Cascada de biquads df2T f32 de N canales entrelazados ---
+
+#define BENCH_BQMC_MAX_CHANNELS 8U
+
+static const uint16_t bench_bqmc_channels[] = {1, 2, 4, 8};
+
+typedef struct {
+    float32_t state_mono[BENCH_BQMC_MAX_CHANNELS][2U * BENCH_BQ_STAGES];
+    float32_t state[2U * BENCH_BQ_STAGES * BENCH_BQMC_MAX_CHANNELS];
+    float32_t in[BENCH_BQ_BLOCK * BENCH_BQMC_MAX_CHANNELS];
+    float32_t out[2][BENCH_BQ_BLOCK * BENCH_BQMC_MAX_CHANNELS];  // [0] mono, [1] multicanal
+    float32_t mono_in[BENCH_BQ_BLOCK], mono_out[BENCH_BQ_BLOCK];  // Un canal separado
+} bench_bqmc_buffers_t;
+
+_Static_assert(sizeof(bench_bqmc_buffers_t) <= sizeof(bench_scratch), "buffers de la cascada multicanal");
+static bench_bqmc_buffers_t *const bench_bqmc = (bench_bqmc_buffers_t *)bench_scratch;
+
+/**
+ * @brief Ciclos por trama de arm_biquad_cascade_multichannel_df2T_f32 contra un
+ *        arm_biquad_cascade_df2T_f32 por canal (separando y volviendo a entrelazar
+ *        los canales) con las secciones de benchmark_biquad. Ambas salidas deben
+ *        coincidir bit a bit.
+ */
+void benchmark_biquad_multichannel(void)
+{
+    arm_biquad_cascade_df2T_instance_f32 mono[BENCH_BQMC_MAX_CHANNELS];
+    arm_biquad_cascade_multichannel_df2T_instance_f32 mc;
+
+    printf("\r\n--- Benchmark cascada de biquads multicanal (%u secciones, bloque %u) ---\r\n", BENCH_BQ_STAGES,
+           BENCH_BQ_BLOCK);
+    bench_rand_state = 0xB1C1U;
+    for (uint32_t i = 0; i < BENCH_BQ_BLOCK * BENCH_BQMC_MAX_CHANNELS; i++) {
+        bench_bqmc->in[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+    }
+
+    for (uint32_t c = 0; c < sizeof(bench_bqmc_channels) / sizeof(bench_bqmc_channels[0]); c++) {
+        uint16_t channels = bench_bqmc_channels[c];
+        uint32_t best_mono = UINT32_MAX, best_mc = UINT32_MAX, diff = 0;
+
+        // Ambas con el mismo historial: tras BENCH_KERNEL_RUNS bloques iguales las salidas deben coincidir
+        for (uint16_t ch = 0; ch < channels; ch++) {
+            arm_biquad_cascade_df2T_init_f32(&mono[ch], BENCH_BQ_STAGES, bench_bq_sos, bench_bqmc->state_mono[ch]);
+        }
+        if (arm_biquad_cascade_multichannel_df2T_init_f32(&mc, BENCH_BQ_STAGES, channels, bench_bq_sos,
+                                                          bench_bqmc->state) != ARM_MATH_SUCCESS) {
+            printf("Init multicanal fallo\r\n");
+            return;
+        }
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            uint32_t t0 = perf_counter_now();
+            for (uint16_t ch = 0; ch < channels; ch++) {
+                for (uint32_t n = 0; n < BENCH_BQ_BLOCK; n++) bench_bqmc->mono_in[n] = bench_bqmc->in[n * channels + ch];
+                arm_biquad_cascade_df2T_f32(&mono[ch], bench_bqmc->mono_in, bench_bqmc->mono_out, BENCH_BQ_BLOCK);
+                for (uint32_t n = 0; n < BENCH_BQ_BLOCK; n++) {
+                    bench_bqmc->out[0][n * channels + ch] = bench_bqmc->mono_out[n];
+                }
+            }
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_mono) best_mono = cycles;
+        }
+        for (uint8_t i = 0; i < BENCH_KERNEL_RUNS; i++) {
+            uint32_t t0 = perf_counter_now();
+            arm_biquad_cascade_multichannel_df2T_f32(&mc, bench_bqmc->in, bench_bqmc->out[1], BENCH_BQ_BLOCK);
+            uint32_t cycles = perf_counter_now() - t0;
+            if (cycles < best_mc) best_mc = cycles;
+        }
+        for (uint32_t i = 0; i < BENCH_BQ_BLOCK * channels; i++) {
+            if (memcmp(&bench_bqmc->out[0][i], &bench_bqmc->out[1][i], sizeof(float32_t)) != 0) diff++;
+        }
+
+        printf("%u canales: %lu instancias mono %lu ciclos/trama, multicanal %lu ciclos/trama (x%lu.%02lu), "
+               "%lu muestras distintas\r\n",
+               channels, (unsigned long)channels, (unsigned long)(best_mono / BENCH_BQ_BLOCK),
+               (unsigned long)(best_mc / BENCH_BQ_BLOCK), (unsigned long)(best_mono / best_mc),
+               (unsigned long)(best_mono * 100U / best_mc % 100U), (unsigned long)diff);
+    }
+}
+
+// --- Estadísticas de ventana deslizante ---
+
+#define BENCH_SW_WINDOW 512U
+#define BENCH_SW_HOP 16U
+#define BENCH_SW_HOPS 32U
+
+typedef struct {
+    float32_t signal[BENCH_SW_WINDOW + BENCH_SW_HOP * BENCH_SW_HOPS];
+    q31_t signal_q31[BENCH_SW_WINDOW + BENCH_SW_HOP * BENCH_SW_HOPS];
+    union {
+        float32_t f32[BENCH_SW_WINDOW];
+        q31_t q31[BENCH_SW_WINDOW];
+    } buffer;  // Se usa una sola instancia a la vez
+    uint32_t queue[2U * BENCH_SW_WINDOW];
+} bench_sw_buffers_t;
+
+_Static_assert(sizeof(bench_sw_buffers_t) <= sizeof(bench_scratch), "buffers de la ventana deslizante");
+static bench_sw_buffers_t *const bench_sw = (bench_sw_buffers_t *)bench_scratch;
+
+/**
+ * @brief Mejor de BENCH_KERNEL_RUNS pasadas de BENCH_SW_HOPS saltos: media, varianza,
+ *        desviación, RMS, máximo y mínimo con las funciones de bloque sobre la ventana
+ *        (mode = 0), con arm_stats_window_f32 (1) o con arm_stats_window_q31 (2).
+ */
+static uint32_t bench_sw_cycles(uint8_t mode)
+{
+    arm_stats_window_instance_f32 sw;
+    arm_stats_window_instance_q31 sw_q31;
+    float32_t r[6];
+    q31_t r_q31[6];
+    uint32_t idx[2], best = UINT32_MAX;
+
+    for (uint8_t run = 0; run < BENCH_KERNEL_RUNS; run++) {
+        // Ventana llena antes del primer salto medido
+        if (mode == 1U) {
+            arm_stats_window_init_f32(&sw, BENCH_SW_WINDOW, bench_sw->buffer.f32, bench_sw->queue);
+            arm_stats_window_f32(&sw, bench_sw->signal, BENCH_SW_WINDOW);
+        } else if (mode == 2U) {
+            arm_stats_window_init_q31(&sw_q31, BENCH_SW_WINDOW, bench_sw->buffer.q31, bench_sw->queue);
+            arm_stats_window_q31(&sw_q31, bench_sw->signal_q31, BENCH_SW_WINDOW);
+        }
+
+        uint32_t t0 = perf_counter_now();
+        for (uint32_t h = 1; h <= BENCH_SW_HOPS; h++) {
+            const float32_t *win = &bench_sw->signal[h * BENCH_SW_HOP];
+            if (mode == 0U) {
+                arm_mean_f32(win, BENCH_SW_WINDOW, &r[0]);
+                arm_var_f32(win, BENCH_SW_WINDOW, &r[1]);
+                arm_std_f32(win, BENCH_SW_WINDOW, &r[2]);
+                arm_rms_f32(win, BENCH_SW_WINDOW, &r[3]);
+                arm_max_f32(win, BENCH_SW_WINDOW, &r[4], &idx[0]);
+                arm_min_f32(win, BENCH_SW_WINDOW, &r[5], &idx[1]);
+            } else if (mode == 1U) {
+                arm_stats_window_f32(&sw, win + BENCH_SW_WINDOW - BENCH_SW_HOP, BENCH_SW_HOP);
+                arm_stats_window_mean_f32(&sw, &r[0]);
+                arm_stats_window_var_f32(&sw, &r[1]);
+                arm_stats_window_std_f32(&sw, &r[2]);
+                arm_stats_window_rms_f32(&sw, &r[3]);
+                arm_stats_window_max_f32(&sw, &r[4], &idx[0]);
+                arm_stats_window_min_f32(&sw, &r[5], &idx[1]);
+            } else {
+                arm_stats_window_q31(&sw_q31, &bench_sw->signal_q31[(h - 1U) * BENCH_SW_HOP + BENCH_SW_WINDOW],
+                                     BENCH_SW_HOP);
+                arm_stats_window_mean_q31(&sw_q31, &r_q31[0]);
+                arm_stats_window_var_q31(&sw_q31, &r_q31[1]);
+                arm_stats_window_std_q31(&sw_q31, &r_q31[2]);
+                arm_stats_window_rms_q31(&sw_q31, &r_q31[3]);
+                arm_stats_window_max_q31(&sw_q31, &r_q31[4], &idx[0]);
+                arm_stats_window_min_q31(&sw_q31, &r_q31[5], &idx[1]);
+            }
+        }
+        uint32_t cycles = perf_counter_now() - t0;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+/**
+ * @brief Ciclos por salto de media, varianza, desviación, RMS, máximo y mínimo de una
+ *        ventana de BENCH_SW_WINDOW muestras que avanza BENCH_SW_HOP: las funciones de
+ *        bloque releen la ventana entera en cada salto, arm_stats_window_f32/q31 solo
+ *        procesan las muestras nuevas. La exactitud se mide en Tools/stats_window_bench.c.
+ */
+void benchmark_stats_window(void)
+{
+    arm_stats_window_instance_f32 sw;
+    float32_t got[2], ref[2];
+    uint32_t idx[2], ref_idx[2];
+    uint32_t best_block, best_f32, best_q31, diff = 0;
+
+    printf("\r\n--- Benchmark estadisticas de ventana deslizante (ventana %u, salto %u) ---\r\n", BENCH_SW_WINDOW,
+           BENCH_SW_HOP);
+    bench_rand_state = 0x57A7U;
+    for (uint32_t i = 0; i < BENCH_SW_WINDOW + BENCH_SW_HOP * BENCH_SW_HOPS; i++) {
+        bench_sw->signal[i] = (float32_t)(bench_rand() & 0xFF) / 256.0f - 0.5f;
+    }
+    arm_float_to_q31(bench_sw->signal, bench_sw->signal_q31, BENCH_SW_WINDOW + BENCH_SW_HOP * BENCH_SW_HOPS);
+
+    best_block = bench_sw_cycles(0);
+    best_f32 = bench_sw_cycles(1);
+    best_q31 = bench_sw_cycles(2);
+
+    // Máximo y mínimo deben coincidir (valor y posición) con los de bloque en cada salto
+    arm_stats_window_init_f32(&sw, BENCH_SW_WINDOW, bench_sw->buffer.f32, bench_sw->queue);
+    arm_stats_window_f32(&sw, bench_sw->signal, BENCH_SW_WINDOW);
+    for (uint32_t h = 1; h <= BENCH_SW_HOPS; h++) {
+        const float32_t *win = &bench_sw->signal[h * BENCH_SW_HOP];
+        arm_stats_window_f32(&sw, win + BENCH_SW_WINDOW - BENCH_SW_HOP, BENCH_SW_HOP);
+        arm_stats_window_max_f32(&sw, &got[0], &idx[0]);
+        arm_stats_window_min_f32(&sw, &got[1], &idx[1]);
+        arm_max_f32(win, BENCH_SW_WINDOW, &ref[0], &ref_idx[0]);
+        arm_min_f32(win, BENCH_SW_WINDOW, &ref[1], &ref_idx[1]);
+        if (got[0] != ref[0] || got[1] != ref[1] || idx[0] != ref_idx[0] || idx[1] != ref_idx[1]) diff++;
+    }
+    printf("Ciclos/salto: bloque f32 %lu, deslizante f32 %lu (x%lu.%02lu), deslizante q31 %lu; "
+           "%lu saltos con max/min distintos\r\n",
+           (unsigned long)(best_block / BENCH_SW_HOPS), (unsigned long)(best_f32 / BENCH_SW_HOPS),
+           (unsigned long)(best_block / best_f32), (unsigned long)(best_block * 100U / best_f32 % 100U),
+           (unsigned long)(best_q31 / BENCH_SW_HOPS), (unsigned long)diff);
+}
+
+// --- Modelo sintético para nn_runtime (mismo que Tools/nn_host_bench.c) ---
+
+#define BENCH_NN_ARENA_SIZE 4608U
+#define BENCH_NN_RUNS 4
+
+typedef struct {
+    uint32_t arena[BENCH_NN_ARENA_SIZE / sizeof(uint32_t)];
+    q7_t input[16 * 16 * 4];
+} bench_nn_buffers_t;
+
+_Static_assert(sizeof(bench_nn_buffers_t) <= sizeof(bench_scratch), "buffers del modelo sintetico");
+static bench_nn_buffers_t *const bench_nn = (bench_nn_buffers_t *)bench_scratch;
+
+static q7_t bench_nn_conv_w[8 * 3 * 3 * 4], bench_nn_conv_b[8];
+static q7_t bench_nn_dw_w[3 * 3 * 8], bench_nn_dw_b[8];
+static q7_t bench_nn_pw_w[16 * 8], bench_nn_pw_b[16];
+static q7_t bench_nn_fc_w[4 * 16], bench_nn_fc_b[4];
+
+static const nn_layer_t bench_nn_layers[] = {
+    { .type = NN_LAYER_CONV, .kernel_x = 3, .kernel_y = 3, .stride_x = 1, .stride_y = 1, .pad_x = 1, .pad_y = 1,
+      .out_shift = 7, .out_ch = 8, .weights = bench_nn_conv_w, .bias = bench_nn_conv_b },
+    { .type = NN_LAYER_RELU },
+    { .type = NN_LAYER_MAXPOOL, .kernel_x = 2, .kernel_y = 2, .stride_x = 2, .stride_y = 2 },
+    { .type = NN_LAYER_DWCONV, .kernel_x = 3, .kernel_y = 3, .stride_x = 1, .stride_y = 1, .pad_x = 1, .pad_y = 1,
+      .out_shift = 6, .out_ch = 8, .weights = bench_nn_dw_w, .bias = bench_nn_dw_b },
+    { .type = NN_LAYER_RELU },
+    { .type = NN_LAYER_CONV, .kernel_x = 1, .kernel_y = 1, .stride_x = 1, .stride_y = 1,
+      .out_shift = 6, .out_ch = 16, .weights = bench_nn_pw_w, .bias = bench_nn_pw_b },
+    { .type = NN_LAYER_RELU },
+    { .type = NN_LAYER_AVGPOOL, .kernel_x = 8, .kernel_y = 8, .stride_x = 8, .stride_y = 8 },
+    { .type = NN_LAYER_FC, .out_shift = 6, .out_ch = 4, .weights = bench_nn_fc_w, .bias = bench_nn_fc_b },
+    { .type = NN_LAYER_SOFTMAX },
+};
+
+static const nn_model_t bench_nn_model = {
+    .name = "sintetico",
+    .input = { .h = 16, .w = 16, .c = 4 },
+    .layers = bench_nn_layers,
+    .layer_count = sizeof(bench_nn_layers) / sizeof(bench_nn_layers[0]),
+};
+
+static void bench_nn_fill(q7_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) data[i] = (q7_t)((bench_rand() & 0x3F) - 32);  // Sin saturar
+}
+
+/**
+ * @brief Ciclos por capa de una inferencia del modelo sintético (mejor de BENCH_NN_RUNS).
+ */
+void benchmark_nn(void)
+{
+    uint32_t *arena = bench_nn->arena;
+    q7_t *input = bench_nn->input;
+    uint32_t best[NN_MAX_LAYERS];
+    q7_t output[4];
+    nn_runtime_t rt;
+
+    printf("\r\n--- Benchmark nn_runtime (CMSIS-NN q7) ---\r\n");
+    bench_rand_state = 0x4E4EU;
+    bench_nn_fill(bench_nn_conv_w, sizeof(bench_nn_conv_w));
+    bench_nn_fill(bench_nn_conv_b, sizeof(bench_nn_conv_b));
+    bench_nn_fill(bench_nn_dw_w, sizeof(bench_nn_dw_w));
+    bench_nn_fill(bench_nn_dw_b, sizeof(bench_nn_dw_b));
+    bench_nn_fill(bench_nn_pw_w, sizeof(bench_nn_pw_w));
+    bench_nn_fill(bench_nn_pw_b, sizeof(bench_nn_pw_b));
+    bench_nn_fill(bench_nn_fc_w, sizeof(bench_nn_fc_w));
+    bench_nn_fill(bench_nn_fc_b, sizeof(bench_nn_fc_b));
+    bench_nn_fill(input, sizeof(bench_nn->input));
+
+    if (!nn_runtime_init(&rt, &bench_nn_model, arena, sizeof(bench_nn->arena))) {
+        printf("modelo invalido o arena chica\r\n");
+        return;
+    }
+    rt.clock = perf_counter_now;
+    for (uint8_t i = 0; i < bench_nn_model.layer_count; i++) best[i] = UINT32_MAX;
+    for (uint8_t run = 0; run < BENCH_NN_RUNS; run++) {
+        if (!nn_runtime_run(&rt, input, output)) {
+            printf("CMSIS-NN rechazo una capa\r\n");
+            return;
+        }
+        for (uint8_t i = 0; i < bench_nn_model.layer_count; i++) {
+            if (rt.layer_cycles[i] < best[i]) best[i] = rt.layer_cycles[i];
+        }
+    }
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < bench_nn_model.layer_count; i++) {
+        printf("  %2u %-8s %8lu ciclos\r\n", i, nn_layer_name(bench_nn_layers[i].type), (unsigned long)best[i]);
+        total += best[i];
+    }
+    printf("modelo %s: %lu ciclos (%lu us), arena %lu bytes, clase %u\r\n", bench_nn_model.name,
+           (unsigned long)total, (unsigned long)perf_counter_cycles_to_us(total),
+           (unsigned long)rt.arena_used, nn_argmax(output, 4));
+}
+
+/**
+ * @brief Ciclos por capa del DS-CNN de palabras clave sobre la ventana de MFCC
+ *        actual (mejor de BENCH_NN_RUNS) y comparación con KWS_BUDGET_CYCLES.
+ */
+void benchmark_kws(void)
+{
+    nn_runtime_t *rt = kws_runtime();
+    const nn_model_t *model = kws_model();
+    uint32_t best[NN_MAX_LAYERS];
+
+    printf("\r\n--- Benchmark KWS (DS-CNN, CMSIS-NN q7) ---\r\n");
+    if (rt->model == NULL && !kws_init()) {
+        printf("modelo invalido o arena chica\r\n");
+        return;
+    }
+    uint32_t (*clock)(void) = rt->clock;
+    rt->clock = perf_counter_now;
+    for (uint8_t i = 0; i < model->layer_count; i++) best[i] = UINT32_MAX;
+    for (uint8_t run = 0; run < BENCH_NN_RUNS; run++) {
+        kws_run();
+        for (uint8_t i = 0; i < model->layer_count; i++) {
+            if (rt->layer_cycles[i] < best[i]) best[i] = rt->layer_cycles[i];
+        }
+    }
+    rt->clock = clock;
+
+    uint32_t total = 0, slowest = 0;
+    for (uint8_t i = 0; i < model->layer_count; i++) {
+        printf("  %2u %-8s %8lu ciclos\r\n", i, nn_layer_name(model->layers[i].type), (unsigned long)best[i]);
+        total += best[i];
+        if (best[i] > slowest) slowest = best[i];
+    }
+    // A 80 MHz cada ciclo dura 12.5 ns: us = ciclos / 80
+    printf("modelo %s: %lu ciclos (%lu us a 80 MHz, presupuesto %lu us: %s), capa mas lenta %lu us\r\n",
+           model->name, (unsigned long)total, (unsigned long)(total / 80U),
+           (unsigned long)(KWS_BUDGET_CYCLES / 80U), total <= KWS_BUDGET_CYCLES ? "ok" : "excedido",
+           (unsigned long)(slowest / 80U));
+    printf("arena %lu bytes, clase %s\r\n", (unsigned long)rt->arena_used,
+           kws_label(nn_argmax(kws_scores(), KWS_CLASSES)));
+}
+
+/**
+ * @brief Ejecuta todos los benchmarks.
+ */
+void benchmark_run_all(void)
+{
+    perf_counter_init();
+    benchmark_mem_pool();
+    benchmark_sram2_text();
+    benchmark_flash_writer();
+    benchmark_cred_db();
+    benchmark_flash_cache();
+    benchmark_fft_tables();
+    benchmark_fft_mixed();
+    benchmark_fir_multichannel();
+    benchmark_fir_fft();
+    benchmark_fir_resample();
+    benchmark_biquad();
+    benchmark_biquad_multichannel();
+    benchmark_stats_window();
+    benchmark_nn();
+    benchmark_kws();
+}
@@ -0,0 +1,168 @@
+#include "clock_manager.h"
+#include "perf_counter.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Parámetros de cada perfil.
+ * @note  La latencia de FLASH sigue la tabla del manual de referencia (RM0351):
+ *        Range 1 a 80 MHz = 4 WS; Range 2 a 24 MHz = 3 WS; Range 2 a 4 MHz = 0 WS.
+ */
+typedef struct {
+    const char *name;
+    uint32_t sysclk_hz;
+    uint32_t voltage_scale;
+    uint32_t flash_latency;
+    uint32_t sysclk_source;
+    uint32_t msi_range;      // Solo para perfiles MSI
+} clock_profile_desc_t;
+
+static const clock_profile_desc_t profiles[CLOCK_PROFILE_COUNT] = {
+    [CLOCK_PROFILE_PERFORMANCE] = { "perf", 80000000U, PWR_REGULATOR_VOLTAGE_SCALE1,
+                                    FLASH_LATENCY_4, RCC_SYSCLKSOURCE_PLLCLK, 0 },
+    [CLOCK_PROFILE_BALANCED]    = { "balanced", 24000000U, PWR_REGULATOR_VOLTAGE_SCALE2,
+                                    FLASH_LATENCY_3, RCC_SYSCLKSOURCE_MSI, RCC_MSIRANGE_9 },
+    [CLOCK_PROFILE_LOW_POWER]   = { "lowpower", 4000000U, PWR_REGULATOR_VOLTAGE_SCALE2,
+                                    FLASH_LATENCY_0, RCC_SYSCLKSOURCE_MSI, RCC_MSIRANGE_6 },
+};
+
+static clock_profile_t current_profile;
+static clock_change_cb_t listeners[CLOCK_MANAGER_MAX_LISTENERS];
+static uint8_t listener_count;
+static uint32_t switch_cycles[CLOCK_PROFILE_COUNT][CLOCK_PROFILE_COUNT];
+
+void clock_manager_init(clock_profile_t initial)
+{
+    current_profile = initial;
+    memset(switch_cycles, 0, sizeof(switch_cycles));
+}
+
+bool clock_manager_register(clock_change_cb_t callback)
+{
+    if (listener_count >= CLOCK_MANAGER_MAX_LISTENERS) return false;
+    listeners[listener_count++] = callback;
+    return true;
+}
+
+/**
+ * @brief Enciende y selecciona la fuente del perfil (PLL desde HSI, igual que
+ *        SystemClock_Config, o MSI en el rango indicado).
+ */
+static HAL_StatusTypeDef clock_apply_source(const clock_profile_desc_t *p)
+{
+    RCC_OscInitTypeDef osc = {0};
+    RCC_ClkInitTypeDef clk = {0};
+
+    if (p->sysclk_source == RCC_SYSCLKSOURCE_PLLCLK) {
+        osc.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+        osc.HSIState = RCC_HSI_ON;
+        osc.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+        osc.PLL.PLLState = RCC_PLL_ON;
+        osc.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+        osc.PLL.PLLM = 1;
+        osc.PLL.PLLN = 10;
+        osc.PLL.PLLP = RCC_PLLP_DIV7;
+        osc.PLL.PLLQ = RCC_PLLQ_DIV2;
+        osc.PLL.PLLR = RCC_PLLR_DIV2;
+    } else {
+        osc.OscillatorType = RCC_OSCILLATORTYPE_MSI;
+        osc.MSIState = RCC_MSI_ON;
+        osc.MSICalibrationValue = RCC_MSICALIBRATION_DEFAULT;
+        osc.MSIClockRange = p->msi_range;
+        osc.PLL.PLLState = RCC_PLL_NONE;
+    }
+    if (HAL_RCC_OscConfig(&osc) != HAL_OK) return HAL_ERROR;
+
+    clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK
+                  | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clk.SYSCLKSource = p->sysclk_source;
+    clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+    clk.APB1CLKDivider = RCC_HCLK_DIV1;
+    clk.APB2CLKDivider = RCC_HCLK_DIV1;
+    if (HAL_RCC_ClockConfig(&clk, p->flash_latency) != HAL_OK) return HAL_ERROR;
+
+    // En los perfiles MSI se apagan PLL y HSI para ahorrar energía
+    if (p->sysclk_source == RCC_SYSCLKSOURCE_MSI) {
+        RCC_OscInitTypeDef off = {0};
+        off.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+        off.HSIState = RCC_HSI_OFF;
+        off.PLL.PLLState = RCC_PLL_OFF;
+        if (HAL_RCC_OscConfig(&off) != HAL_OK) return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef clock_manager_set_profile(clock_profile_t profile)
+{
+    if (profile >= CLOCK_PROFILE_COUNT) return HAL_ERROR;
+    if (profile == current_profile) return HAL_OK;
+
+    const clock_profile_desc_t *p = &profiles[profile];
+    uint32_t t0 = perf_counter_now();
+
+    // Subir el voltaje antes de subir la frecuencia
+    if (p->voltage_scale == PWR_REGULATOR_VOLTAGE_SCALE1
+        && HAL_PWREx_GetVoltageRange() != PWR_REGULATOR_VOLTAGE_SCALE1) {
+        if (HAL_PWREx_ControlVoltageScaling(PWR_REGULATOR_VOLTAGE_SCALE1) != HAL_OK) return HAL_ERROR;
+    }
+
+    if (clock_apply_source(p) != HAL_OK) return HAL_ERROR;
+
+    // Bajar el voltaje solo cuando la frecuencia ya es compatible con Range 2 (<= 26 MHz)
+    if (p->voltage_scale == PWR_REGULATOR_VOLTAGE_SCALE2
+        && HAL_PWREx_GetVoltageRange() != PWR_REGULATOR_VOLTAGE_SCALE2) {
+        if (HAL_PWREx_ControlVoltageScaling(PWR_REGULATOR_VOLTAGE_SCALE2) != HAL_OK) return HAL_ERROR;
+    }
+
+    switch_cycles[current_profile][profile] = perf_counter_now() - t0;
+    current_profile = profile;
+
+    uint32_t hclk = HAL_RCC_GetHCLKFreq();
+    for (uint8_t i = 0; i < listener_count; i++) {
+        listeners[i](hclk);
+    }
+    return HAL_OK;
+}
+
+clock_profile_t clock_manager_get_profile(void)
+{
+    return current_profile;
+}
+
+const char *clock_manager_profile_name(clock_profile_t profile)
+{
+    return (profile < CLOCK_PROFILE_COUNT) ? profiles[profile].name : "?";
+}
+
+bool clock_manager_profile_from_name(const char *name, clock_profile_t *profile)
+{
+    for (uint8_t i = 0; i < CLOCK_PROFILE_COUNT; i++) {
+        if (strcmp(name, profiles[i].name) == 0) {
+            *profile = (clock_profile_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t clock_manager_switch_cycles(clock_profile_t from, clock_profile_t to)
+{
+    if (from >= CLOCK_PROFILE_COUNT || to >= CLOCK_PROFILE_COUNT) return 0;
+    return switch_cycles[from][to];
+}
+
+void clock_manager_report(void)
+{
+    printf("perfil=%s SYSCLK=%lu Hz HCLK=%lu Hz Range=%lu\r\n",
+           profiles[current_profile].name, (unsigned long)HAL_RCC_GetSysClockFreq(),
+           (unsigned long)HAL_RCC_GetHCLKFreq(),
+           (unsigned long)(HAL_PWREx_GetVoltageRange() == PWR_REGULATOR_VOLTAGE_SCALE1 ? 1 : 2));
+    printf("ciclos de cambio (fila=desde, columna=hacia):\r\n");
+    for (uint8_t from = 0; from < CLOCK_PROFILE_COUNT; from++) {
+        printf("  %-9s", profiles[from].name);
+        for (uint8_t to = 0; to < CLOCK_PROFILE_COUNT; to++) {
+            printf(" %8lu", (unsigned long)switch_cycles[from][to]);
+        }
+        printf("\r\n");
+    }
+}
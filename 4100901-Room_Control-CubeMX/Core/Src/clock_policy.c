@@ -0,0 +1,36 @@
+#include "clock_policy.h"
+
+void clock_policy_init(clock_policy_t *policy, uint32_t idle_timeout_ms,
+                       uint32_t compute_hold_ms, uint32_t now_ms)
+{
+    policy->idle_timeout_ms = idle_timeout_ms;
+    policy->compute_hold_ms = compute_hold_ms;
+    policy->last_activity_ms = now_ms;
+    policy->last_compute_ms = now_ms;
+    policy->compute_seen = false;
+}
+
+/**
+ * @brief Las restas de tiempo usan aritmética sin signo, por lo que soportan el
+ *        desborde de HAL_GetTick() cada ~49 días.
+ */
+clock_profile_t clock_policy_select(clock_policy_t *policy, const clock_policy_input_t *input)
+{
+    if (input->compute_requested) {
+        policy->compute_seen = true;
+        policy->last_compute_ms = input->now_ms;
+        policy->last_activity_ms = input->now_ms;
+    }
+    if (policy->compute_seen && input->now_ms - policy->last_compute_ms < policy->compute_hold_ms) {
+        return CLOCK_PROFILE_PERFORMANCE;
+    }
+
+    if (input->pending_keys > 0 || input->pending_console > 0 || input->pending_audio > 0 ||
+        input->ui_active) {
+        policy->last_activity_ms = input->now_ms;
+    }
+    if (input->now_ms - policy->last_activity_ms < policy->idle_timeout_ms) {
+        return CLOCK_PROFILE_BALANCED;
+    }
+    return CLOCK_PROFILE_LOW_POWER;
+}
@@ -0,0 +1,132 @@
+#include "console.h"
+#include "ring_buffer.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CONSOLE_RX_BUFFER_LEN 64
+
+/**
+ * @brief Entrada de la tabla de comandos.
+ */
+typedef struct {
+    const char *name;
+    const char *help;
+    console_handler_t handler;
+} console_command_t;
+
+static UART_HandleTypeDef *console_uart;
+static uint8_t console_rx_byte;
+static uint8_t console_rx_buffer[CONSOLE_RX_BUFFER_LEN];
+static ring_buffer_t console_rx_rb;
+
+static char console_line[CONSOLE_LINE_MAX + 1];
+static uint8_t console_line_len;
+
+static console_command_t console_commands[CONSOLE_MAX_COMMANDS];
+static uint8_t console_command_count;
+
+/**
+ * @brief Lista los comandos registrados.
+ */
+static void console_cmd_help(const char *args)
+{
+    (void)args;
+    for (uint8_t i = 0; i < console_command_count; i++) {
+        printf("  %-8s %s\r\n", console_commands[i].name, console_commands[i].help);
+    }
+}
+
+void console_init(UART_HandleTypeDef *huart)
+{
+    console_uart = huart;
+    ring_buffer_init(&console_rx_rb, console_rx_buffer, CONSOLE_RX_BUFFER_LEN);
+    console_line_len = 0;
+    console_register("help", "lista los comandos", console_cmd_help);
+    HAL_UART_Receive_IT(console_uart, &console_rx_byte, 1);
+}
+
+bool console_register(const char *name, const char *help, console_handler_t handler)
+{
+    if (console_command_count >= CONSOLE_MAX_COMMANDS) return false;
+    console_commands[console_command_count].name = name;
+    console_commands[console_command_count].help = help;
+    console_commands[console_command_count].handler = handler;
+    console_command_count++;
+    return true;
+}
+
+/**
+ * @brief Separa el nombre del comando de sus argumentos y lo ejecuta.
+ */
+static void console_execute(char *line)
+{
+    while (*line == ' ') line++;
+    if (*line == '\0') return;
+
+    char *args = strchr(line, ' ');
+    if (args != NULL) {
+        *args++ = '\0';
+        while (*args == ' ') args++;
+    } else {
+        args = line + strlen(line);
+    }
+
+    for (uint8_t i = 0; i < console_command_count; i++) {
+        if (strcmp(line, console_commands[i].name) == 0) {
+            console_commands[i].handler(args);
+            return;
+        }
+    }
+    printf("Comando desconocido: %s (use help)\r\n", line);
+}
+
+void console_poll(void)
+{
+    uint8_t byte;
+    while (ring_buffer_read(&console_rx_rb, &byte)) {
+        if (byte == '\r' || byte == '\n') {
+            console_line[console_line_len] = '\0';
+            console_line_len = 0;
+            console_execute(console_line);
+        } else if (console_line_len < CONSOLE_LINE_MAX) {
+            console_line[console_line_len++] = (char)byte;
+        }
+    }
+}
+
+uint16_t console_rx_pending(void)
+{
+    return ring_buffer_count(&console_rx_rb);
+}
+
+/**
+ * @brief HAL_UART_Init recalcula BRR a partir de la nueva frecuencia de PCLK1.
+ */
+void console_on_clock_change(uint32_t hclk_hz)
+{
+    (void)hclk_hz;
+    HAL_UART_AbortReceive(console_uart);
+    if (HAL_UART_Init(console_uart) != HAL_OK) {
+        Error_Handler();
+    }
+    HAL_UART_Receive_IT(console_uart, &console_rx_byte, 1);
+}
+
+/**
+ * @brief Callback de recepción UART: guarda el byte y rearma la recepción.
+ */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart != console_uart) return;
+    ring_buffer_write(&console_rx_rb, console_rx_byte);
+    HAL_UART_Receive_IT(console_uart, &console_rx_byte, 1);
+}
+
+/**
+ * @brief Callback de error UART (p. ej. overrun): rearma la recepción para no perder la consola.
+ */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart != console_uart) return;
+    HAL_UART_Receive_IT(console_uart, &console_rx_byte, 1);
+}
@@ -0,0 +1,374 @@
+#include "cred_db.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Encabezado del slot (offset 0). El marcador de commit va justo después
+ *        y es lo último que se programa.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t count;
+    uint32_t records_crc;  // CRC32 de count registros
+    uint32_t index_offset; // Desde el inicio del slot
+    uint32_t index_crc;    // CRC32 de los nodos del índice
+    uint32_t levels;
+    uint32_t reserved;
+} cred_db_header_t;
+
+typedef struct {
+    uint32_t magic;        // CRED_DB_COMMIT_MAGIC
+    uint32_t header_crc;   // CRC32 del encabezado: liga el marcador a esta imagen
+} cred_db_commit_t;
+
+#define CRED_DB_COMMIT_OFFSET sizeof(cred_db_header_t)
+
+_Static_assert(sizeof(cred_record_t) == 8, "cred_record_t debe ser una doble palabra");
+_Static_assert(sizeof(cred_db_header_t) == 32, "encabezado de cuatro dobles palabras");
+_Static_assert(CRED_DB_NODE_KEYS * sizeof(uint32_t) == CRED_DB_LINE_SIZE, "un nodo por línea");
+_Static_assert(CRED_DB_LEAF_RECORDS * sizeof(cred_record_t) == CRED_DB_LINE_SIZE, "una hoja por línea");
+_Static_assert((CRED_DB_RECORDS_OFFSET % CRED_DB_LINE_SIZE) == 0, "hojas alineadas a la línea");
+_Static_assert(CRED_DB_COMMIT_OFFSET + sizeof(cred_db_commit_t) <= CRED_DB_RECORDS_OFFSET,
+               "el encabezado no cabe antes de los registros");
+
+/**
+ * @brief CRC32 (polinomio reflejado 0xEDB88320) incremental; iniciar con 0xFFFFFFFF.
+ */
+static uint32_t cred_db_crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 1U) ? (crc >> 1) ^ 0xEDB88320U : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+static uint64_t cred_db_dword(const void *src)
+{
+    uint64_t dw;
+    memcpy(&dw, src, sizeof(dw));
+    return dw;
+}
+
+/**
+ * @brief Calcula la forma del índice para count registros.
+ * @param level_start Primer nodo de cada nivel, de la raíz hacia abajo (puede ser NULL).
+ * @return Número de niveles (0 si count es 0); *nodes recibe el total de nodos.
+ */
+static uint8_t cred_db_geometry(uint32_t count, uint32_t *level_start, uint32_t *nodes)
+{
+    uint32_t width[CRED_DB_MAX_LEVELS];
+    uint32_t blocks = (count + CRED_DB_LEAF_RECORDS - 1U) / CRED_DB_LEAF_RECORDS;
+    uint8_t levels = 0;
+
+    *nodes = 0;
+    if (count == 0) return 0;
+    do {
+        blocks = (blocks + CRED_DB_NODE_KEYS - 1U) / CRED_DB_NODE_KEYS;
+        width[levels++] = blocks;  // De abajo hacia arriba
+    } while (blocks > 1U && levels < CRED_DB_MAX_LEVELS);
+
+    for (uint8_t l = 0; l < levels; l++) {
+        if (level_start != NULL) level_start[l] = *nodes;
+        *nodes += width[levels - 1U - l];
+    }
+    return levels;
+}
+
+static uint32_t cred_db_index_offset(uint32_t count)
+{
+    uint32_t bytes = count * (uint32_t)sizeof(cred_record_t);
+    return CRED_DB_RECORDS_OFFSET + (bytes + CRED_DB_LINE_SIZE - 1U) / CRED_DB_LINE_SIZE * CRED_DB_LINE_SIZE;
+}
+
+uint32_t cred_db_index_size(uint32_t count)
+{
+    uint32_t nodes;
+    cred_db_geometry(count, NULL, &nodes);
+    return nodes * CRED_DB_LINE_SIZE;
+}
+
+static const cred_db_header_t *cred_db_header(const cred_db_t *db, uint8_t slot)
+{
+    return (const cred_db_header_t *)db->slot_base[slot];
+}
+
+static const cred_record_t *cred_db_slot_records(const cred_db_t *db, uint8_t slot)
+{
+    return (const cred_record_t *)(db->slot_base[slot] + CRED_DB_RECORDS_OFFSET);
+}
+
+/**
+ * @brief Copia de FLASH a RAM con ops->read o, si no hay, del mapa de memoria.
+ * @return false si la lectura dio error ECC.
+ */
+static bool cred_db_read(const cred_db_t *db, uintptr_t addr, void *dst, uint32_t len)
+{
+    if (db->ops != NULL && db->ops->read != NULL) return db->ops->read(addr, dst, len);
+    memcpy(dst, (const void *)addr, len);
+    return true;
+}
+
+/**
+ * @brief CRC32 de len bytes de FLASH, leídos de a una línea con cred_db_read.
+ * @return false si alguna lectura dio error ECC.
+ */
+static bool cred_db_crc32_flash(const cred_db_t *db, uintptr_t addr, uint32_t len, uint32_t *crc)
+{
+    uint8_t line[CRED_DB_LINE_SIZE];
+
+    *crc = 0xFFFFFFFFU;
+    while (len > 0) {
+        uint32_t n = (len < sizeof(line)) ? len : (uint32_t)sizeof(line);
+        if (!cred_db_read(db, addr, line, n)) return false;
+        *crc = cred_db_crc32(*crc, line, n);
+        addr += n;
+        len -= n;
+    }
+    return true;
+}
+
+/**
+ * @brief Comprueba encabezado, marcador, geometría y CRC de registros e índice de un slot.
+ * @note  Tras un corte el slot puede tener dobles palabras a medio programar: todo se
+ *        lee con cred_db_read para que un error ECC invalide el slot en vez de colgar.
+ */
+static bool cred_db_slot_valid(const cred_db_t *db, uint8_t slot)
+{
+    cred_db_header_t hdr;
+    cred_db_commit_t commit;
+    uintptr_t base = db->slot_base[slot];
+
+    if (!cred_db_read(db, base, &hdr, sizeof(hdr)) ||
+        !cred_db_read(db, base + CRED_DB_COMMIT_OFFSET, &commit, sizeof(commit))) {
+        return false;
+    }
+    if (hdr.magic != CRED_DB_MAGIC || commit.magic != CRED_DB_COMMIT_MAGIC) return false;
+    if (commit.header_crc != cred_db_crc32(0xFFFFFFFFU, (const uint8_t *)&hdr, sizeof(hdr))) return false;
+    if (hdr.count > db->capacity || hdr.index_offset != cred_db_index_offset(hdr.count)) return false;
+
+    uint32_t nodes;
+    if (hdr.levels != cred_db_geometry(hdr.count, NULL, &nodes)) return false;
+
+    uint32_t crc;
+    if (!cred_db_crc32_flash(db, base + CRED_DB_RECORDS_OFFSET, hdr.count * (uint32_t)sizeof(cred_record_t), &crc) ||
+        crc != hdr.records_crc) {
+        return false;
+    }
+    return cred_db_crc32_flash(db, base + hdr.index_offset, nodes * CRED_DB_LINE_SIZE, &crc)
+        && crc == hdr.index_crc;
+}
+
+static void cred_db_publish(cred_db_t *db, uint8_t slot)
+{
+    const cred_db_header_t *hdr = cred_db_header(db, slot);
+    db->active = (int8_t)slot;
+    db->generation = hdr->generation;
+    db->count = hdr->count;
+    db->records = cred_db_slot_records(db, slot);
+    db->index = (const uint32_t *)(db->slot_base[slot] + hdr->index_offset);
+
+    uint32_t nodes;
+    db->levels = cred_db_geometry(hdr->count, db->level_start, &nodes);
+}
+
+static uint8_t cred_db_staging_slot(const cred_db_t *db)
+{
+    return (db->active == 0) ? 1U : 0U;
+}
+
+bool cred_db_init(cred_db_t *db, const cred_db_flash_ops_t *ops, uintptr_t slot_a,
+                  uintptr_t slot_b, uint32_t slot_size, uint32_t page_size)
+{
+    memset(db, 0, sizeof(*db));
+    db->active = -1;
+    if (page_size == 0 || (slot_size % page_size) != 0 || slot_size <= CRED_DB_RECORDS_OFFSET) {
+        return false;
+    }
+    db->ops = ops;
+    db->slot_base[0] = slot_a;
+    db->slot_base[1] = slot_b;
+    db->slot_size = slot_size;
+    db->page_size = page_size;
+
+    // Mayor cantidad de registros que entra junto con su índice
+    uint32_t n = (slot_size - CRED_DB_RECORDS_OFFSET) / (uint32_t)sizeof(cred_record_t);
+    while (n > 0 && cred_db_index_offset(n) + cred_db_index_size(n) > slot_size) n--;
+    db->capacity = n;
+
+    bool valid[2] = { cred_db_slot_valid(db, 0), cred_db_slot_valid(db, 1) };
+    if (valid[0] && valid[1]) {
+        int32_t diff = (int32_t)(cred_db_header(db, 1)->generation - cred_db_header(db, 0)->generation);
+        cred_db_publish(db, diff > 0 ? 1U : 0U);
+    } else if (valid[0] || valid[1]) {
+        cred_db_publish(db, valid[0] ? 0U : 1U);
+    }
+    return true;
+}
+
+/**
+ * @brief En cada nivel cuenta las claves <= key (sin saltos) para elegir el hijo.
+ * @note  Los nodos incompletos están rellenos con CRED_DB_KEY_INVALID, que nunca cuenta.
+ */
+const cred_record_t *cred_db_find(const cred_db_t *db, uint32_t key)
+{
+    if (db->levels == 0 || key == CRED_DB_KEY_INVALID) return NULL;
+
+    uint32_t child = 0;
+    for (uint8_t l = 0; l < db->levels; l++) {
+        const uint32_t *node = db->index + (db->level_start[l] + child) * CRED_DB_NODE_KEYS;
+        uint32_t le = 0;
+        for (uint32_t i = 0; i < CRED_DB_NODE_KEYS; i++) {
+            le += (node[i] <= key) ? 1U : 0U;
+        }
+        if (le == 0) return NULL;  // Menor que la primera clave
+        child = child * CRED_DB_NODE_KEYS + le - 1U;
+    }
+
+    uint32_t first = child * CRED_DB_LEAF_RECORDS;
+    uint32_t last = first + CRED_DB_LEAF_RECORDS;
+    if (last > db->count) last = db->count;
+    for (uint32_t i = first; i < last; i++) {
+        if (db->records[i].key == key) return &db->records[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Borra el slot empezando por la página del encabezado: si se corta la
+ *        energía a mitad, el slot ya no puede pasar por válido.
+ */
+bool cred_db_begin_update(cred_db_t *db)
+{
+    if (db->ops == NULL) return false;
+    uint8_t slot = cred_db_staging_slot(db);
+
+    db->staging = false;
+    for (uint32_t off = 0; off < db->slot_size; off += db->page_size) {
+        if (!db->ops->erase_page(db->slot_base[slot] + off)) return false;
+    }
+    db->staging = true;
+    db->stage_count = 0;
+    db->stage_crc = 0xFFFFFFFFU;
+    db->stage_last_key = 0;
+    return true;
+}
+
+bool cred_db_stage(cred_db_t *db, const cred_record_t *record)
+{
+    if (!db->staging || db->stage_count >= db->capacity) return false;
+    if (record->key == CRED_DB_KEY_INVALID) return false;
+    if (db->stage_count > 0 && record->key <= db->stage_last_key) return false;
+
+    uint8_t slot = cred_db_staging_slot(db);
+    uintptr_t addr = db->slot_base[slot] + CRED_DB_RECORDS_OFFSET + db->stage_count * sizeof(cred_record_t);
+    if (!db->ops->program_dword(addr, cred_db_dword(record))) {
+        cred_db_abort(db);
+        return false;
+    }
+    db->stage_crc = cred_db_crc32(db->stage_crc, (const uint8_t *)record, sizeof(*record));
+    db->stage_last_key = record->key;
+    db->stage_count++;
+    return true;
+}
+
+/**
+ * @brief Programa los nodos del índice a partir de los registros ya escritos.
+ * @note  La clave c del nodo j del nivel l es la primera clave de la hoja donde
+ *        empieza su hijo: (j * 8 + c) * 8^(niveles - 1 - l).
+ */
+static bool cred_db_write_index(cred_db_t *db, uintptr_t addr, const cred_record_t *records,
+                                uint32_t count, uint32_t *crc)
+{
+    uint32_t level_start[CRED_DB_MAX_LEVELS];
+    uint32_t nodes;
+    uint8_t levels = cred_db_geometry(count, level_start, &nodes);
+
+    *crc = 0xFFFFFFFFU;
+    for (uint8_t l = 0; l < levels; l++) {
+        uint32_t span = 1;  // Hojas bajo cada hijo de este nivel
+        for (uint8_t d = l + 1U; d < levels; d++) span *= CRED_DB_NODE_KEYS;
+
+        uint32_t width = ((l + 1U < levels) ? level_start[l + 1U] : nodes) - level_start[l];
+        for (uint32_t j = 0; j < width; j++) {
+            uint32_t node[CRED_DB_NODE_KEYS];
+            for (uint32_t c = 0; c < CRED_DB_NODE_KEYS; c++) {
+                uint32_t first = (j * CRED_DB_NODE_KEYS + c) * span * CRED_DB_LEAF_RECORDS;
+                node[c] = (first < count) ? records[first].key : CRED_DB_KEY_INVALID;
+            }
+            for (uint32_t w = 0; w < CRED_DB_NODE_KEYS; w += 2U) {
+                if (!db->ops->program_dword(addr, cred_db_dword(&node[w]))) return false;
+                addr += 8U;
+            }
+            *crc = cred_db_crc32(*crc, (const uint8_t *)node, sizeof(node));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Orden de escritura: registros → sync → índice → encabezado → sync → marcador → sync.
+ * @note  El marcador incluye el CRC del encabezado, así que un marcador viejo o a
+ *        medio programar nunca valida una imagen incompleta.
+ */
+bool cred_db_commit(cred_db_t *db)
+{
+    if (!db->staging) return false;
+    uint8_t slot = cred_db_staging_slot(db);
+    uintptr_t base = db->slot_base[slot];
+    uint32_t nodes;
+
+    cred_db_header_t hdr = {
+        .magic = CRED_DB_MAGIC,
+        .generation = (db->active < 0) ? 1U : db->generation + 1U,
+        .count = db->stage_count,
+        .records_crc = db->stage_crc,
+        .index_offset = cred_db_index_offset(db->stage_count),
+        .levels = cred_db_geometry(db->stage_count, NULL, &nodes),
+        .reserved = 0xFFFFFFFFU,
+    };
+
+    // El índice se arma leyendo los registros ya programados en el slot
+    bool ok = (db->ops->sync == NULL || db->ops->sync())
+           && cred_db_write_index(db, base + hdr.index_offset, cred_db_slot_records(db, slot),
+                                  hdr.count, &hdr.index_crc);
+
+    cred_db_commit_t commit = {
+        .magic = CRED_DB_COMMIT_MAGIC,
+        .header_crc = cred_db_crc32(0xFFFFFFFFU, (const uint8_t *)&hdr, sizeof(hdr)),
+    };
+    for (uint32_t off = 0; ok && off < sizeof(hdr); off += 8U) {
+        ok = db->ops->program_dword(base + off, cred_db_dword((const uint8_t *)&hdr + off));
+    }
+    ok = ok && (db->ops->sync == NULL || db->ops->sync())
+            && db->ops->program_dword(base + CRED_DB_COMMIT_OFFSET, cred_db_dword(&commit))
+            && (db->ops->sync == NULL || db->ops->sync());
+
+    db->staging = false;
+    if (!ok || !cred_db_slot_valid(db, slot)) return false;
+
+    cred_db_publish(db, slot);
+    return true;
+}
+
+void cred_db_abort(cred_db_t *db)
+{
+    db->staging = false;
+}
+
+uint32_t cred_db_capacity(const cred_db_t *db)
+{
+    return db->capacity;
+}
+
+uint32_t cred_db_key_from_pin(const char *pin, uint8_t len)
+{
+    uint32_t key = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        key = (key << 8) | (uint8_t)((i < len) ? pin[i] : 0);
+    }
+    return key;
+}
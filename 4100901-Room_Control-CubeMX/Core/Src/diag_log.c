@@ -0,0 +1,92 @@
+#include "diag_log.h"
+#include "mem_sections.h"
+#include "main.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DIAG_LOG_MAGIC 0x4C4F4744U  // "DGOL"
+#define DIAG_LOG_LINE_MAX 80
+
+/**
+ * @brief Encabezado y datos del log; todo vive en SRAM2 y sobrevive a resets en caliente.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t boot_count;
+    uint16_t head;    // Próxima posición de escritura
+    uint16_t count;   // Bytes válidos (<= DIAG_LOG_SIZE)
+    char data[DIAG_LOG_SIZE];
+} diag_log_t;
+
+static SRAM2_NOINIT diag_log_t diag_log;
+
+/**
+ * @brief Valida el encabezado retenido; si está corrupto, reinicia el log.
+ */
+void diag_log_init(bool retained_valid)
+{
+    bool header_ok = retained_valid && diag_log.magic == DIAG_LOG_MAGIC
+                     && diag_log.head < DIAG_LOG_SIZE && diag_log.count <= DIAG_LOG_SIZE;
+
+    if (!header_ok) {
+        memset(&diag_log, 0, sizeof(diag_log));
+        diag_log.magic = DIAG_LOG_MAGIC;
+    }
+    diag_log.boot_count++;
+}
+
+/**
+ * @brief Copia el mensaje al buffer circular seguido de un salto de línea.
+ * @note  Protegido con PRIMASK para poder registrar desde ISR.
+ */
+void diag_log_write(const char *msg)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    for (const char *c = msg; ; c++) {
+        char ch = (*c != '\0') ? *c : '\n';
+        diag_log.data[diag_log.head] = ch;
+        diag_log.head = (diag_log.head + 1) % DIAG_LOG_SIZE;
+        if (diag_log.count < DIAG_LOG_SIZE) diag_log.count++;
+        if (*c == '\0') break;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+void diag_log_printf(const char *fmt, ...)
+{
+    char line[DIAG_LOG_LINE_MAX + 1];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    diag_log_write(line);
+}
+
+/**
+ * @brief Recorre el buffer desde el byte más antiguo.
+ */
+void diag_log_dump(void)
+{
+    uint16_t start = (diag_log.head + DIAG_LOG_SIZE - diag_log.count) % DIAG_LOG_SIZE;
+
+    printf("--- diag_log (arranque #%lu, %u B) ---\r\n",
+           (unsigned long)diag_log.boot_count, diag_log.count);
+    for (uint16_t i = 0; i < diag_log.count; i++) {
+        char ch = diag_log.data[(start + i) % DIAG_LOG_SIZE];
+        if (ch == '\n') {
+            printf("\r\n");
+        } else {
+            putchar(ch);
+        }
+    }
+}
+
+uint32_t diag_log_boot_count(void)
+{
+    return diag_log.boot_count;
+}
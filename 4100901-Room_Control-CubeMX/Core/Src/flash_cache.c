@@ -0,0 +1,86 @@
+#include "flash_cache.h"
+#include "clock_manager.h"
+#include "main.h"
+
+/**
+ * @brief Configuración inicial por perfil.
+ * @note  Con 0 estados de espera (4 MHz) el prefetch no gana ciclos y solo suma
+ *        consumo; en los demás perfiles se parte de todo habilitado hasta medir.
+ */
+static uint8_t profile_config[CLOCK_PROFILE_COUNT] = {
+    [CLOCK_PROFILE_PERFORMANCE] = FLASH_CACHE_ALL,
+    [CLOCK_PROFILE_BALANCED]    = FLASH_CACHE_ALL,
+    [CLOCK_PROFILE_LOW_POWER]   = FLASH_CACHE_ICACHE | FLASH_CACHE_DCACHE,
+};
+
+static uint8_t current_config;
+
+static void flash_cache_on_clock_change(uint32_t hclk_hz)
+{
+    (void)hclk_hz;
+    flash_cache_apply(profile_config[clock_manager_get_profile()]);
+}
+
+void flash_cache_init(void)
+{
+    flash_cache_apply(profile_config[clock_manager_get_profile()]);
+    clock_manager_register(flash_cache_on_clock_change);
+}
+
+/**
+ * @brief Los cachés solo pueden reiniciarse deshabilitados (RM0351, 3.3.3).
+ */
+void flash_cache_apply(uint8_t config)
+{
+    __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+    __HAL_FLASH_INSTRUCTION_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+    __HAL_FLASH_DATA_CACHE_RESET();
+
+    if (config & FLASH_CACHE_ICACHE) __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+    if (config & FLASH_CACHE_DCACHE) __HAL_FLASH_DATA_CACHE_ENABLE();
+    if (config & FLASH_CACHE_PREFETCH) __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+    current_config = config & FLASH_CACHE_ALL;
+}
+
+uint8_t flash_cache_get(void)
+{
+    return current_config;
+}
+
+void flash_cache_set_profile_config(clock_profile_t profile, uint8_t config)
+{
+    if (profile >= CLOCK_PROFILE_COUNT) return;
+    profile_config[profile] = config & FLASH_CACHE_ALL;
+    if (profile == clock_manager_get_profile()) flash_cache_apply(profile_config[profile]);
+}
+
+uint8_t flash_cache_profile_config(clock_profile_t profile)
+{
+    return (profile < CLOCK_PROFILE_COUNT) ? profile_config[profile] : 0;
+}
+
+const char *flash_cache_name(uint8_t config)
+{
+    static const char *const names[FLASH_CACHE_COMBINATIONS] = {
+        "---", "P--", "-I-", "PI-", "--D", "P-D", "-ID", "PID",
+    };
+    return names[config & FLASH_CACHE_ALL];
+}
+
+bool flash_cache_parse(const char *text, uint8_t *config)
+{
+    uint8_t c = 0;
+    for (; *text != '\0'; text++) {
+        switch (*text) {
+        case 'P': case 'p': c |= FLASH_CACHE_PREFETCH; break;
+        case 'I': case 'i': c |= FLASH_CACHE_ICACHE; break;
+        case 'D': case 'd': c |= FLASH_CACHE_DCACHE; break;
+        case '-': break;
+        default: return false;
+        }
+    }
+    *config = c;
+    return true;
+}
@@ -0,0 +1,68 @@
+#include "flash_port.h"
+#include "main.h"
+
+static volatile bool flash_port_ecc_guard;  // flash_port_read() en curso
+static volatile bool flash_port_ecc_error;  // La NMI vio ECCD durante la copia
+
+void flash_port_locate(uintptr_t addr, uint32_t *bank, uint32_t *page)
+{
+    uint32_t offset = (uint32_t)(addr - FLASH_BASE);
+    if (offset < FLASH_BANK_SIZE) {
+        *bank = FLASH_BANK_1;
+    } else {
+        *bank = FLASH_BANK_2;
+        offset -= FLASH_BANK_SIZE;
+    }
+    *page = offset / FLASH_PAGE_SIZE;
+}
+
+bool flash_port_erase_page(uintptr_t addr)
+{
+    FLASH_EraseInitTypeDef erase = {0};
+    uint32_t page_error = 0;
+
+    erase.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase.NbPages = 1;
+    flash_port_locate(addr, &erase.Banks, &erase.Page);
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &page_error);
+    HAL_FLASH_Lock();
+
+    return status == HAL_OK;
+}
+
+bool flash_port_program_dword(uintptr_t addr, uint64_t data)
+{
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, addr, data);
+    HAL_FLASH_Lock();
+
+    return status == HAL_OK;
+}
+
+bool flash_port_read(uintptr_t addr, void *dst, uint32_t len)
+{
+    uint8_t *out = (uint8_t *)dst;
+
+    flash_port_ecc_error = false;
+    flash_port_ecc_guard = true;
+    for (uint32_t i = 0; i < len; i++) {
+        out[i] = *(volatile const uint8_t *)(addr + i);
+    }
+    __DSB();  // La NMI de la última lectura entra antes de bajar la guarda
+    flash_port_ecc_guard = false;
+
+    return !flash_port_ecc_error;
+}
+
+bool flash_port_ecc_nmi(void)
+{
+    if (!flash_port_ecc_guard || !__HAL_FLASH_GET_FLAG(FLASH_FLAG_ECCD)) return false;
+
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ECCD);
+    flash_port_ecc_error = true;
+    return true;
+}
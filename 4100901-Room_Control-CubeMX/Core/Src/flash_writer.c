@@ -0,0 +1,316 @@
+#include "flash_writer.h"
+#include "flash_port.h"
+#include "mem_sections.h"
+#include "main.h"
+#include <string.h>
+
+#define FW_ROW_ALL 0xFFFFFFFFU  // Las 32 dobles palabras de la fila
+
+typedef enum {
+    FW_OP_ERASE,
+    FW_OP_ROW,
+} fw_op_type_t;
+
+/**
+ * @brief Operación en cola: borrado de página o fila en preparación.
+ * @note  data va primero para quedar alineado a 8; es la fuente de FLASH_Program_Fast.
+ */
+typedef struct {
+    uint64_t data[FLASH_WRITER_ROW_DWORDS];
+    uintptr_t addr;       // Página a borrar o inicio de la fila
+    uint32_t pending;     // Dobles palabras cargadas y aún no programadas
+    uint32_t created_ms;  // Para el límite de espera de filas incompletas
+    uint8_t type;         // fw_op_type_t
+} fw_op_t;
+
+static SRAM2_BSS fw_op_t fw_queue[FLASH_WRITER_QUEUE_LEN];
+static volatile uint8_t fw_head;
+static volatile uint8_t fw_count;
+
+static volatile bool fw_busy;    // Operación lanzada al HAL
+static volatile bool fw_done;    // El HAL avisó el fin (con o sin error)
+static volatile bool fw_failed;
+static uint32_t fw_active;       // Máscara de la fila en curso (0 para borrado)
+static volatile bool fw_flush_req;
+static bool fw_fast_enabled = true;
+static flash_writer_stats_t fw_stats;
+
+static inline uint32_t fw_lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void fw_unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+static fw_op_t *fw_tail(void)
+{
+    return &fw_queue[(fw_head + fw_count - 1U) % FLASH_WRITER_QUEUE_LEN];
+}
+
+static fw_op_t *fw_push(fw_op_type_t type, uintptr_t addr)
+{
+    fw_op_t *op = &fw_queue[(fw_head + fw_count) % FLASH_WRITER_QUEUE_LEN];
+    op->type = (uint8_t)type;
+    op->addr = addr;
+    op->pending = 0;
+    op->created_ms = HAL_GetTick();
+    fw_count++;
+    return op;
+}
+
+static void fw_pop(void)
+{
+    fw_head = (uint8_t)((fw_head + 1U) % FLASH_WRITER_QUEUE_LEN);
+    fw_count--;
+}
+
+/**
+ * @brief Última fila en cola si corresponde a row y todavía no se está programando.
+ */
+static fw_op_t *fw_mergeable(uintptr_t row)
+{
+    if (fw_count == 0) return NULL;
+    fw_op_t *op = fw_tail();
+    if (op->type != FW_OP_ROW || op->addr != row) return NULL;
+    if (fw_busy && fw_count == 1) return NULL;  // La cola es la operación en curso
+    return op;
+}
+
+/**
+ * @brief La fila admite programación rápida: completa y fuera del banco del código.
+ */
+static bool fw_row_fast(const fw_op_t *op)
+{
+    return op->pending == FW_ROW_ALL && op->addr >= FLASH_BASE + FLASH_BANK_SIZE && fw_fast_enabled
+        && HAL_RCC_GetHCLKFreq() >= FLASH_WRITER_FAST_MIN_HCLK;
+}
+
+/**
+ * @brief Lanza la operación de la cabeza. Llamar con interrupciones deshabilitadas o desde la ISR.
+ * @note  Una fila incompleta que además es la última en cola espera hasta
+ *        FLASH_WRITER_COALESCE_MS por más datos, salvo que se pida flush.
+ */
+static void fw_start_next(void)
+{
+    if (fw_busy) return;
+
+    if (fw_count == 0) {
+        fw_flush_req = false;
+        HAL_FLASH_Lock();
+        return;
+    }
+
+    fw_op_t *op = &fw_queue[fw_head];
+    if (op->type == FW_OP_ROW && op->pending != FW_ROW_ALL && fw_count == 1 && !fw_flush_req
+        && (HAL_GetTick() - op->created_ms) < FLASH_WRITER_COALESCE_MS) {
+        return;
+    }
+
+    HAL_StatusTypeDef status;
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    fw_done = false;
+    fw_failed = false;
+
+    if (op->type == FW_OP_ERASE) {
+        FLASH_EraseInitTypeDef erase = {0};
+        erase.TypeErase = FLASH_TYPEERASE_PAGES;
+        erase.NbPages = 1;
+        flash_port_locate(op->addr, &erase.Banks, &erase.Page);
+        fw_active = 0;
+        status = HAL_FLASHEx_Erase_IT(&erase);
+    } else if (fw_row_fast(op)) {
+        // Fila completa: una sola operación; la fila destino debe estar borrada
+        fw_active = FW_ROW_ALL;
+        status = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_FAST_AND_LAST, op->addr, (uint32_t)op->data);
+    } else {
+        uint32_t idx = __CLZ(__RBIT(op->pending));  // Doble palabra pendiente más baja
+        fw_active = 1U << idx;
+        status = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_DOUBLEWORD, op->addr + idx * 8U, op->data[idx]);
+    }
+
+    // HAL_BUSY: la FLASH la está usando flash_port; se reintenta en el próximo poll
+    if (status == HAL_OK) fw_busy = true;
+}
+
+void flash_writer_init(void)
+{
+    uint32_t primask = fw_lock();
+    fw_head = 0;
+    fw_count = 0;
+    fw_busy = false;
+    fw_flush_req = false;
+    memset(&fw_stats, 0, sizeof(fw_stats));
+    fw_unlock(primask);
+
+    HAL_NVIC_SetPriority(FLASH_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(FLASH_IRQn);
+}
+
+bool flash_writer_erase_page(uintptr_t addr)
+{
+    uint32_t primask = fw_lock();
+    if (fw_count >= FLASH_WRITER_QUEUE_LEN) {
+        fw_stats.queue_full++;
+        fw_unlock(primask);
+        return false;
+    }
+    fw_push(FW_OP_ERASE, addr & ~(uintptr_t)(FLASH_PAGE_SIZE - 1U));
+    fw_start_next();
+    fw_unlock(primask);
+    return true;
+}
+
+bool flash_writer_program(uintptr_t addr, const void *data, uint32_t len)
+{
+    if ((addr % 8U) != 0 || (len % 8U) != 0 || len == 0) return false;
+
+    const uintptr_t row_mask = ~(uintptr_t)(FLASH_WRITER_ROW_SIZE - 1U);
+    const uint8_t *src = (const uint8_t *)data;
+    uintptr_t first_row = addr & row_mask;
+    uint32_t rows = (uint32_t)(((addr + len - 1U) & row_mask) - first_row) / FLASH_WRITER_ROW_SIZE + 1U;
+
+    uint32_t primask = fw_lock();
+
+    // Todo o nada: reservar antes de copiar
+    uint32_t needed = rows - (fw_mergeable(first_row) != NULL ? 1U : 0U);
+    if (fw_count + needed > FLASH_WRITER_QUEUE_LEN) {
+        fw_stats.queue_full++;
+        fw_unlock(primask);
+        return false;
+    }
+
+    while (len > 0) {
+        uintptr_t row = addr & row_mask;
+        fw_op_t *op = fw_mergeable(row);
+        if (op == NULL) op = fw_push(FW_OP_ROW, row);
+
+        uint32_t idx = (uint32_t)(addr - row) / 8U;
+        memcpy(&op->data[idx], src, 8);
+        op->pending |= 1U << idx;
+
+        addr += 8U;
+        src += 8;
+        len -= 8U;
+    }
+    fw_start_next();
+    fw_unlock(primask);
+    return true;
+}
+
+bool flash_writer_program_dword(uintptr_t addr, uint64_t data)
+{
+    return flash_writer_program(addr, &data, sizeof(data));
+}
+
+bool flash_writer_erase_page_blocking(uintptr_t addr)
+{
+    while (!flash_writer_erase_page(addr)) flash_writer_poll();
+    return true;
+}
+
+bool flash_writer_program_dword_blocking(uintptr_t addr, uint64_t data)
+{
+    while (!flash_writer_program_dword(addr, data)) flash_writer_poll();
+    return true;
+}
+
+uint8_t flash_writer_free_ops(void)
+{
+    return (uint8_t)(FLASH_WRITER_QUEUE_LEN - fw_count);
+}
+
+void flash_writer_poll(void)
+{
+    uint32_t primask = fw_lock();
+    fw_start_next();
+    fw_unlock(primask);
+}
+
+void flash_writer_flush(void)
+{
+    fw_flush_req = true;
+    flash_writer_poll();
+}
+
+bool flash_writer_sync(void)
+{
+    uint32_t errors = fw_stats.errors;
+    uint32_t start = HAL_GetTick();
+    flash_writer_flush();
+    while (!flash_writer_idle()) {
+        if (HAL_GetTick() - start > FLASH_WRITER_SYNC_TIMEOUT_MS) return false;
+        flash_writer_poll();
+    }
+    return fw_stats.errors == errors;
+}
+
+bool flash_writer_idle(void)
+{
+    return fw_count == 0 && !fw_busy;
+}
+
+void flash_writer_set_fast(bool enable)
+{
+    fw_fast_enabled = enable;
+}
+
+/**
+ * @brief Cierra la operación terminada y lanza la siguiente.
+ * @note  Corre después de HAL_FLASH_IRQHandler(), cuando el HAL ya liberó su bloqueo:
+ *        desde los callbacks no se puede lanzar otra operación.
+ */
+void flash_writer_irq_handler(void)
+{
+    if (!fw_busy || !fw_done) return;
+
+    fw_op_t *op = &fw_queue[fw_head];
+    if (fw_failed) {
+        fw_stats.errors++;
+    } else if (op->type == FW_OP_ERASE) {
+        fw_stats.pages_erased++;
+    } else if (fw_active == FW_ROW_ALL) {
+        fw_stats.rows_fast++;
+    } else {
+        fw_stats.dwords++;
+    }
+
+    // Tras un error la doble palabra ya no está borrada: no se reintenta
+    op->pending &= ~fw_active;
+    if (op->type == FW_OP_ERASE || op->pending == 0) fw_pop();
+
+    fw_busy = false;
+    fw_start_next();
+}
+
+void flash_writer_get_stats(flash_writer_stats_t *stats)
+{
+    uint32_t primask = fw_lock();
+    *stats = fw_stats;
+    fw_unlock(primask);
+}
+
+void flash_writer_reset_stats(void)
+{
+    uint32_t primask = fw_lock();
+    memset(&fw_stats, 0, sizeof(fw_stats));
+    fw_unlock(primask);
+}
+
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+    (void)ReturnValue;
+    fw_done = true;
+}
+
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+    (void)ReturnValue;
+    fw_failed = true;
+    fw_done = true;
+}
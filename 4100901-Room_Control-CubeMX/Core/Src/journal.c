@@ -0,0 +1,239 @@
+#include "journal.h"
+#include <stddef.h>
+#include <string.h>
+
+#define JOURNAL_PAGE_MAGIC 0x4A524E4CU  // "JRNL"
+#define JOURNAL_ERASED_WORD 0xFFFFFFFFU
+
+/**
+ * @brief Encabezado de página: ocupa el slot 0 (16 bytes) de cada página.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t page_seq;
+    uint32_t reserved[2];  // Se dejan borrados
+} journal_page_header_t;
+
+_Static_assert(sizeof(journal_record_t) == JOURNAL_RECORD_SIZE, "journal_record_t debe medir 16 bytes");
+_Static_assert(sizeof(journal_page_header_t) == JOURNAL_RECORD_SIZE, "el encabezado ocupa un slot");
+
+uint16_t journal_crc16(const uint8_t *data, uint32_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uintptr_t journal_page_addr(const journal_t *j, uint16_t page)
+{
+    return j->base + (uintptr_t)page * j->page_size;
+}
+
+static uintptr_t journal_slot_addr(const journal_t *j, uint16_t page, uint16_t slot)
+{
+    return journal_page_addr(j, page) + (uintptr_t)slot * JOURNAL_RECORD_SIZE;
+}
+
+/**
+ * @brief Copia un slot de FLASH a RAM.
+ * @return false si la lectura dio error ECC (slot a medio programar o borrar).
+ */
+static bool journal_read_slot(const journal_t *j, uint16_t page, uint16_t slot, void *dst)
+{
+    uintptr_t addr = journal_slot_addr(j, page, slot);
+    if (j->ops->read != NULL) return j->ops->read(addr, dst, JOURNAL_RECORD_SIZE);
+    memcpy(dst, (const void *)addr, JOURNAL_RECORD_SIZE);
+    return true;
+}
+
+static uint16_t journal_slots_per_page(const journal_t *j)
+{
+    return (uint16_t)(j->page_size / JOURNAL_RECORD_SIZE);
+}
+
+static bool journal_slot_erased(const void *slot)
+{
+    uint32_t w[JOURNAL_RECORD_SIZE / sizeof(uint32_t)];
+    memcpy(w, slot, sizeof(w));
+    return w[0] == JOURNAL_ERASED_WORD && w[1] == JOURNAL_ERASED_WORD
+        && w[2] == JOURNAL_ERASED_WORD && w[3] == JOURNAL_ERASED_WORD;
+}
+
+static bool journal_record_valid(const journal_record_t *r)
+{
+    return r->crc == journal_crc16((const uint8_t *)r, offsetof(journal_record_t, crc));
+}
+
+/**
+ * @brief Programa un slot de 16 bytes como dos dobles palabras.
+ * @note  El CRC va en la segunda doble palabra: si se corta la energía entre
+ *        ambas, el registro queda inválido y se descarta al recuperar.
+ */
+static bool journal_program_slot(journal_t *j, uintptr_t addr, const void *slot)
+{
+    uint64_t dw[2];
+    memcpy(dw, slot, sizeof(dw));
+    return j->ops->program_dword(addr, dw[0]) && j->ops->program_dword(addr + 8, dw[1]);
+}
+
+/**
+ * @brief Borra una página y escribe su encabezado con la secuencia indicada.
+ * @note  Si se corta la energía tras el borrado, la página queda sin encabezado
+ *        y al recuperar se sigue usando la anterior.
+ */
+static bool journal_open_page(journal_t *j, uint16_t page, uint32_t page_seq)
+{
+    uintptr_t addr = journal_page_addr(j, page);
+    if (!j->ops->erase_page(addr)) return false;
+    if (!j->ops->program_dword(addr, ((uint64_t)page_seq << 32) | JOURNAL_PAGE_MAGIC)) return false;
+
+    j->page = page;
+    j->page_seq = page_seq;
+    j->slot = 1;
+    return true;
+}
+
+bool journal_init(journal_t *j, const journal_flash_ops_t *ops, uintptr_t base,
+                  uint32_t page_size, uint16_t page_count)
+{
+    memset(j, 0, sizeof(*j));
+    if (page_count < 2 || page_size < 2 * JOURNAL_RECORD_SIZE || (page_size % JOURNAL_RECORD_SIZE) != 0) {
+        return false;
+    }
+    j->ops = ops;
+    j->base = base;
+    j->page_size = page_size;
+    j->page_count = page_count;
+
+    // 1. Página activa = encabezado válido con la secuencia más alta
+    bool found = false;
+    for (uint16_t p = 0; p < page_count; p++) {
+        journal_page_header_t hdr;
+        if (!journal_read_slot(j, p, 0, &hdr) || hdr.magic != JOURNAL_PAGE_MAGIC) continue;
+        if (!found || (int32_t)(hdr.page_seq - j->page_seq) > 0) {
+            j->page = p;
+            j->page_seq = hdr.page_seq;
+            found = true;
+        }
+    }
+    if (!found) {
+        // Si falla, ready queda en false y journal_flush no escribe sobre el slot 0
+        j->ready = journal_open_page(j, 0, 1);
+        return j->ready;
+    }
+
+    // 2. Primer slot borrado de la página activa; los registros rotos se saltan
+    uint16_t slots = journal_slots_per_page(j);
+    j->slot = slots;
+    for (uint16_t s = 1; s < slots; s++) {
+        journal_record_t r;
+        if (!journal_read_slot(j, j->page, s, &r)) {
+            j->torn++;
+            continue;
+        }
+        if (journal_slot_erased(&r)) {
+            j->slot = s;
+            break;
+        }
+        if (journal_record_valid(&r)) {
+            j->next_sequence = r.sequence + 1;
+        } else {
+            j->torn++;
+        }
+    }
+    j->ready = true;
+
+    // 3. Página activa sin registros válidos: continuar la secuencia de la anterior
+    if (j->next_sequence == 0) {
+        journal_record_t last;
+        if (journal_read_latest(j, 0, &last)) j->next_sequence = last.sequence + 1;
+    }
+    return true;
+}
+
+bool journal_append(journal_t *j, journal_event_t event, uint32_t data, uint32_t timestamp_ms)
+{
+    if (j->pending_count >= JOURNAL_PENDING_MAX) {
+        j->dropped++;
+        return false;
+    }
+
+    uint8_t idx = (uint8_t)((j->pending_head + j->pending_count) % JOURNAL_PENDING_MAX);
+    journal_record_t *r = &j->pending[idx];
+    r->timestamp_ms = timestamp_ms;
+    r->sequence = 0;  // Se asigna al escribir, en orden
+    r->data = data;
+    r->event = (uint8_t)event;
+    r->reserved = 0xFF;
+    r->crc = 0;
+    j->pending_count++;
+    return true;
+}
+
+uint8_t journal_flush(journal_t *j, uint8_t max_records)
+{
+    uint8_t written = 0;
+    if (!j->ready) return 0;  // journal_init falló
+
+    while (written < max_records && j->pending_count > 0) {
+        if (j->slot >= journal_slots_per_page(j)) {
+            uint16_t next = (uint16_t)((j->page + 1) % j->page_count);
+            if (!journal_open_page(j, next, j->page_seq + 1)) break;
+        }
+
+        journal_record_t *r = &j->pending[j->pending_head];
+        r->sequence = j->next_sequence;
+        r->crc = journal_crc16((const uint8_t *)r, offsetof(journal_record_t, crc));
+
+        uintptr_t addr = journal_slot_addr(j, j->page, j->slot);
+        bool ok = journal_program_slot(j, addr, r);
+        j->slot++;   // Aun si falla, el slot ya no está borrado
+        if (!ok) break;
+
+        j->next_sequence++;
+        j->pending_head = (uint8_t)((j->pending_head + 1) % JOURNAL_PENDING_MAX);
+        j->pending_count--;
+        written++;
+    }
+    return written;
+}
+
+/**
+ * @brief Recorre hacia atrás desde el último slot escrito, cruzando páginas.
+ * @note  Los slots con error ECC se saltan igual que los que fallan su CRC.
+ */
+bool journal_read_latest(const journal_t *j, uint32_t n, journal_record_t *record)
+{
+    if (!j->ready) return false;
+
+    uint16_t slots = journal_slots_per_page(j);
+    uint16_t page = j->page;
+    uint32_t page_seq = j->page_seq;
+    int32_t slot = (int32_t)j->slot - 1;
+
+    for (uint16_t visited = 0; visited < j->page_count; visited++) {
+        journal_page_header_t hdr;
+        if (!journal_read_slot(j, page, 0, &hdr)) return false;
+        if (hdr.magic != JOURNAL_PAGE_MAGIC || hdr.page_seq != page_seq) return false;
+
+        for (; slot >= 1; slot--) {
+            journal_record_t r;
+            if (!journal_read_slot(j, page, (uint16_t)slot, &r)) continue;
+            if (journal_slot_erased(&r) || !journal_record_valid(&r)) continue;
+            if (n == 0) {
+                *record = r;
+                return true;
+            }
+            n--;
+        }
+        page = (uint16_t)((page + j->page_count - 1) % j->page_count);
+        page_seq--;
+        slot = slots - 1;
+    }
+    return false;
+}
@@ -0,0 +1,189 @@
+#include "kws.h"
+#include "kws_weights.h"
+#include <string.h>
+
+static const q7_t conv1_wt[] = CONV1_WT;
+static const q7_t conv1_bias[] = CONV1_BIAS;
+static const q7_t conv2_ds_wt[] = CONV2_DS_WT;
+static const q7_t conv2_ds_bias[] = CONV2_DS_BIAS;
+static const q7_t conv2_pw_wt[] = CONV2_PW_WT;
+static const q7_t conv2_pw_bias[] = CONV2_PW_BIAS;
+static const q7_t conv3_ds_wt[] = CONV3_DS_WT;
+static const q7_t conv3_ds_bias[] = CONV3_DS_BIAS;
+static const q7_t conv3_pw_wt[] = CONV3_PW_WT;
+static const q7_t conv3_pw_bias[] = CONV3_PW_BIAS;
+static const q7_t conv4_ds_wt[] = CONV4_DS_WT;
+static const q7_t conv4_ds_bias[] = CONV4_DS_BIAS;
+static const q7_t conv4_pw_wt[] = CONV4_PW_WT;
+static const q7_t conv4_pw_bias[] = CONV4_PW_BIAS;
+static const q7_t conv5_ds_wt[] = CONV5_DS_WT;
+static const q7_t conv5_ds_bias[] = CONV5_DS_BIAS;
+static const q7_t conv5_pw_wt[] = CONV5_PW_WT;
+static const q7_t conv5_pw_bias[] = CONV5_PW_BIAS;
+static const q7_t final_fc_wt[] = FINAL_FC_WT;
+static const q7_t final_fc_bias[] = FINAL_FC_BIAS;
+
+// Copia intercalada para arm_fully_connected_q7_opt (kws_init)
+static q7_t final_fc_wt_opt[KWS_CLASSES * KWS_CHANNELS];
+
+// Depthwise 3x3 + ReLU + pointwise 1x1 + ReLU
+#define KWS_DS_BLOCK(n)                                                                                  \
+    { .type = NN_LAYER_DWCONV, .kernel_x = 3, .kernel_y = 3, .stride_x = 1, .stride_y = 1, .pad_x = 1,  \
+      .pad_y = 1, .bias_shift = CONV##n##_DS_BIAS_LSHIFT, .out_shift = CONV##n##_DS_OUT_RSHIFT,          \
+      .out_ch = KWS_CHANNELS, .weights = conv##n##_ds_wt, .bias = conv##n##_ds_bias },                   \
+    { .type = NN_LAYER_RELU },                                                                           \
+    { .type = NN_LAYER_CONV, .kernel_x = 1, .kernel_y = 1, .stride_x = 1, .stride_y = 1,                 \
+      .bias_shift = CONV##n##_PW_BIAS_LSHIFT, .out_shift = CONV##n##_PW_OUT_RSHIFT,                      \
+      .out_ch = KWS_CHANNELS, .weights = conv##n##_pw_wt, .bias = conv##n##_pw_bias },                   \
+    { .type = NN_LAYER_RELU }
+
+static const nn_layer_t kws_layers[] = {
+    // 50x10x1 -> 25x5x64; pad_y 4 más la fila en cero reproduce el SAME de TensorFlow
+    { .type = NN_LAYER_CONV, .kernel_x = 4, .kernel_y = 10, .stride_x = 2, .stride_y = 2, .pad_x = 1, .pad_y = 4,
+      .bias_shift = CONV1_BIAS_LSHIFT, .out_shift = CONV1_OUT_RSHIFT, .out_ch = KWS_CHANNELS,
+      .weights = conv1_wt, .bias = conv1_bias },
+    { .type = NN_LAYER_RELU },
+    KWS_DS_BLOCK(2),
+    KWS_DS_BLOCK(3),
+    KWS_DS_BLOCK(4),
+    KWS_DS_BLOCK(5),
+    { .type = NN_LAYER_AVGPOOL, .kernel_x = 5, .kernel_y = 25, .stride_x = 5, .stride_y = 25 },
+    { .type = NN_LAYER_FC_OPT, .bias_shift = FINAL_FC_BIAS_LSHIFT, .out_shift = FINAL_FC_OUT_RSHIFT,
+      .out_ch = KWS_CLASSES, .weights = final_fc_wt_opt, .bias = final_fc_bias },
+    { .type = NN_LAYER_SOFTMAX },
+};
+
+static const nn_model_t kws_ds_cnn = {
+    .name = "ds-cnn",
+    .input = { .h = KWS_FRAMES + 1U, .w = KWS_COEFFS, .c = 1 },
+    .layers = kws_layers,
+    .layer_count = sizeof(kws_layers) / sizeof(kws_layers[0]),
+};
+
+static const char *const kws_labels[KWS_CLASSES] = {
+    "silencio", "desconocido", "yes", "no", "up", "down", "left", "right", "on", "off", "stop", "go"
+};
+
+static nn_runtime_t kws_rt;
+static uint32_t kws_arena[KWS_ARENA_SIZE / sizeof(uint32_t)];
+static q7_t kws_features[(KWS_FRAMES + 1U) * KWS_COEFFS];  // Última fila siempre en cero
+static uint8_t kws_frames;
+static q7_t kws_last[KWS_CLASSES];
+static q7_t kws_history[KWS_AVERAGE][KWS_CLASSES];
+static uint8_t kws_history_pos;
+static uint8_t kws_history_count;
+
+bool kws_init(void)
+{
+    nn_fc_opt_reorder(final_fc_wt, final_fc_wt_opt, KWS_CLASSES, KWS_CHANNELS);
+    memset(kws_features, 0, sizeof(kws_features));
+    memset(kws_last, 0, sizeof(kws_last));
+    kws_frames = 0;
+    kws_history_pos = 0;
+    kws_history_count = 0;
+    return nn_runtime_init(&kws_rt, &kws_ds_cnn, kws_arena, sizeof(kws_arena));
+}
+
+void kws_push_frame(const float32_t *coeffs)
+{
+    q7_t *row = &kws_features[(KWS_FRAMES - 1U) * KWS_COEFFS];
+
+    memmove(kws_features, &kws_features[KWS_COEFFS], (KWS_FRAMES - 1U) * KWS_COEFFS);
+    for (uint32_t i = 0; i < KWS_COEFFS; i++) {
+        int32_t v = (int32_t)lroundf(coeffs[i] * (float32_t)(1U << KWS_INPUT_FRAC));
+        row[i] = (q7_t)((v > 127) ? 127 : (v < -128) ? -128 : v);
+    }
+    if (kws_frames < KWS_FRAMES) kws_frames++;
+}
+
+bool kws_window_full(void)
+{
+    return kws_frames >= KWS_FRAMES;
+}
+
+void kws_start(void)
+{
+    nn_runtime_begin(&kws_rt, kws_features);
+}
+
+bool kws_busy(void)
+{
+    return !nn_runtime_done(&kws_rt);
+}
+
+/**
+ * @brief Promedia las últimas KWS_AVERAGE salidas y decide; reinicia el historial
+ *        tras una detección para no repetirla con la misma ventana.
+ */
+static int16_t kws_decide(void)
+{
+    memcpy(kws_history[kws_history_pos], kws_last, KWS_CLASSES);
+    kws_history_pos = (uint8_t)((kws_history_pos + 1U) % KWS_AVERAGE);
+    if (kws_history_count < KWS_AVERAGE) kws_history_count++;
+
+    int16_t best = KWS_NONE;
+    int32_t best_score = 0;
+    for (uint16_t c = 2; c < KWS_CLASSES; c++) {
+        int32_t sum = 0;
+        for (uint8_t h = 0; h < kws_history_count; h++) sum += kws_history[h][c];
+        int32_t average = sum / KWS_AVERAGE;
+        if (average >= KWS_THRESHOLD && average > best_score) {
+            best = (int16_t)c;
+            best_score = average;
+        }
+    }
+    if (best != KWS_NONE) kws_history_count = 0;
+    return best;
+}
+
+int16_t kws_poll(void)
+{
+    if (nn_runtime_done(&kws_rt)) return KWS_NONE;
+    if (!nn_runtime_step(&kws_rt)) return KWS_NONE;
+    if (!nn_runtime_done(&kws_rt)) return KWS_BUSY;
+
+    memcpy(kws_last, nn_runtime_result(&kws_rt), KWS_CLASSES);
+    return kws_decide();
+}
+
+int16_t kws_run(void)
+{
+    int16_t result;
+    kws_start();
+    while ((result = kws_poll()) == KWS_BUSY) {
+    }
+    return result;
+}
+
+const q7_t *kws_scores(void)
+{
+    return kws_last;
+}
+
+const char *kws_label(uint16_t index)
+{
+    return (index < KWS_CLASSES) ? kws_labels[index] : "?";
+}
+
+int16_t kws_find_label(const char *label)
+{
+    for (uint16_t i = 0; i < KWS_CLASSES; i++) {
+        if (strcmp(kws_labels[i], label) == 0) return (int16_t)i;
+    }
+    return -1;
+}
+
+bool kws_weights_trained(void)
+{
+    return KWS_WEIGHTS_TRAINED != 0;
+}
+
+const nn_model_t *kws_model(void)
+{
+    return &kws_ds_cnn;
+}
+
+nn_runtime_t *kws_runtime(void)
+{
+    return &kws_rt;
+}
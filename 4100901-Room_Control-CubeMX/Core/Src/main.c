@@ -24,8 +24,25 @@
 #include "led_driver.h"
 #include "ring_buffer.h"
 #include "keypad_driver.h"
+#include "mem_pool.h"
+#include "sram2.h"
+#include "diag_log.h"
+#include "benchmark.h"
+#include "mem_monitor.h"
+#include "console.h"
+#include "clock_manager.h"
+#include "perf_counter.h"
+#include "journal.h"
+#include "flash_writer.h"
+#include "flash_port.h"
+#include "cred_db.h"
+#include "flash_cache.h"
+#include "audio_capture.h"
+#include "occupancy.h"
+#include "kws.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -41,6 +58,16 @@
 #define DEBOUNCE_TIME_MS 200      // Tiempo de anti-rebote para las teclas 
 #define FEEDBACK_LED_TIME_MS 100  // Tiempo que el LED se enciende al oprimir cualquier tecla
 #define SUCCESS_LED_TIME_MS 4000  // Tiempo que el LED se enciende cuando se ingresa la contraseña correcta
+#define RUN_BENCHMARKS_AT_BOOT 0  // 1: ejecutar benchmark_run_all() al arrancar
+#define CLOCK_AUTO_SCALING 1      // 1: elegir el perfil de reloj según el trabajo pendiente
+#define CLOCK_IDLE_TIMEOUT_MS 5000  // Inactividad antes de bajar a 4 MHz
+#define CLOCK_COMPUTE_HOLD_MS 1000  // Tiempo en 80 MHz tras un cálculo pesado
+#define JOURNAL_FLUSH_PER_LOOP 1    // Registros escritos en FLASH por iteración del bucle
+#define AUDIO_OCCUPANCY 1           // 1: capturar audio en PA0 y detectar ocupación
+#define VOICE_UNLOCK 0              // 1: abrir con la palabra clave (requiere pesos entrenados)
+#define VOICE_UNLOCK_WORD "go"      // Etiqueta de kws.c que abre la puerta
+#define VOICE_UNLOCK_USER 0xFFFFU   // user_id registrado en el journal para la voz
+#define KWS_INFERENCE_FRAMES 10     // Tramas entre inferencias (200 ms)
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -68,9 +95,10 @@ keypad_handle_t keypad = {
     .col_pins  = {KEYPAD_C1_Pin, KEYPAD_C2_Pin, KEYPAD_C3_Pin, KEYPAD_C4_Pin}
 };
 // --- Buffer circular para teclas ---
+// Vive en SRAM2 para no competir por el bus de SRAM1 con .data/.bss y el DMA
 #define KEYPAD_BUFFER_LEN 16
-uint8_t keypad_buffer[KEYPAD_BUFFER_LEN];
-ring_buffer_t keypad_rb;
+SRAM2_BSS uint8_t keypad_buffer[KEYPAD_BUFFER_LEN];
+SRAM2_BSS ring_buffer_t keypad_rb;
 
 // --- VARIABLES DE CONTROL DE ACCESO ---
 char entered_password[PASSWORD_LEN + 1] = {0};
@@ -80,6 +108,36 @@ uint8_t password_index = 0;
 uint32_t last_key_press_time = 0;
 uint32_t led_timer_start = 0;
 uint32_t led_on_duration = 0;
+
+// --- ESCALADO DINAMICO DE FRECUENCIA ---
+clock_policy_t clock_policy;
+bool clock_auto = CLOCK_AUTO_SCALING;
+
+// --- JOURNAL DE EVENTOS DE ACCESO EN FLASH ---
+extern uint8_t _sjournal, _ejournal; /* Symbols defined in the linker script */
+static const journal_flash_ops_t journal_flash_ops = {
+    .erase_page = flash_writer_erase_page,
+    .program_dword = flash_writer_program_dword,
+    .read = flash_port_read,
+};
+journal_t access_journal;
+
+// --- BASE DE CREDENCIALES A/B EN FLASH ---
+extern uint8_t _scred_a, _scred_b, _cred_slot_size; /* Symbols defined in the linker script */
+static const cred_db_flash_ops_t cred_flash_ops = {
+    .erase_page = flash_writer_erase_page_blocking,
+    .program_dword = flash_writer_program_dword_blocking,
+    .sync = flash_writer_sync,
+    .read = flash_port_read,
+};
+cred_db_t credential_db;
+
+// --- OCUPACION DE LA SALA POR AUDIO ---
+occupancy_t room_occupancy;
+
+// --- DESBLOQUEO POR PALABRA CLAVE ---
+bool voice_unlock = VOICE_UNLOCK;
+int16_t voice_unlock_class = KWS_NONE;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -89,6 +147,11 @@ static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
 void manage_led_timer(void);
 void process_key(uint8_t key);
+void manage_clock_profile(void);
+void process_audio(void);
+void process_voice(void);
+static void grant_access(uint16_t user_id);
+static void register_console_commands(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -97,8 +160,9 @@ void process_key(uint8_t key);
   * @brief  Callback de la interrupción externa GPIO.
   * @note   Esta función se llama cuando se detecta un flanco en un pin configurado para interrupción.
   *         Se mantiene muy rápida: solo lee el teclado y guarda la tecla en un buffer.
+  *         Se ejecuta desde SRAM2 para evitar los estados de espera de FLASH.
   */
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+SRAM2_TEXT void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
     char key = keypad_scan(&keypad, GPIO_Pin);
     if (key != '\0') {
@@ -130,15 +194,16 @@ void process_key(uint8_t key)
     // 3. Si la contraseña se ha completado, verificarla
     // Si ya se ingresaron 4 dígitos, verificar contraseña
     if (password_index == PASSWORD_LEN) {
-        if (strncmp(entered_password, PASSWORD, PASSWORD_LEN) == 0) {
+        // La credencial se lee directamente de la imagen activa en FLASH
+        const cred_record_t *cred = cred_db_find(&credential_db,
+                                                 cred_db_key_from_pin(entered_password, PASSWORD_LEN));
+        if (cred != NULL && (cred->flags & CRED_FLAG_ENABLED)) {
             printf("Contraseña correcta. ACCESO AUTORIZADO.\r\n");
-            // Encender los LEDs para indicar éxito
-            led_on(&led1);
-            led_on(&led_ext);
-            led_timer_start = HAL_GetTick();
-            led_on_duration = SUCCESS_LED_TIME_MS;
+            grant_access(cred->user_id);
         } else {
             printf("Contraseña incorrecta. ACCESO DENEGADO.\r\n");
+            diag_log_printf("t=%lu acceso denegado", (unsigned long)HAL_GetTick());
+            journal_append(&access_journal, JOURNAL_EVENT_ACCESS_DENIED, 0, HAL_GetTick());
            // Apagar el LED para indicar fallo
             led_off(&led1);
             led_off(&led_ext);
@@ -151,6 +216,20 @@ void process_key(uint8_t key)
     }
 }
 
+/**
+ * @brief Registra un acceso autorizado y enciende los LEDs de éxito.
+ */
+static void grant_access(uint16_t user_id)
+{
+    diag_log_printf("t=%lu acceso autorizado u=%u", (unsigned long)HAL_GetTick(), user_id);
+    journal_append(&access_journal, JOURNAL_EVENT_ACCESS_GRANTED, user_id, HAL_GetTick());
+    // Encender los LEDs para indicar éxito
+    led_on(&led1);
+    led_on(&led_ext);
+    led_timer_start = HAL_GetTick();
+    led_on_duration = SUCCESS_LED_TIME_MS;
+}
+
 /**
  * @brief Gestiona el apagado automático de los LEDs sin bloquear el programa.
  * @note  Esta función debe ser llamada repetidamente en el bucle principal.
@@ -167,6 +246,278 @@ void manage_led_timer(void)
     }
 }
 
+/**
+ * @brief Comandos de consola para diagnóstico de memoria y rendimiento.
+ */
+static void cmd_stat(const char *args) { (void)args; mem_monitor_report(); }
+static void cmd_mem(const char *args) { (void)args; sram2_report(); }
+static void cmd_log(const char *args) { (void)args; diag_log_dump(); }
+static void cmd_bench(const char *args)
+{
+    (void)args;
+    clock_manager_set_profile(CLOCK_PROFILE_PERFORMANCE); // Medir siempre a 80 MHz
+    benchmark_run_all();
+}
+
+/**
+ * @brief journal [n]: muestra los n eventos más recientes guardados en FLASH.
+ */
+static void cmd_journal(const char *args)
+{
+    static const char *const event_names[] = { "?", "arranque", "autorizado", "denegado", "ocupacion" };
+    uint32_t count = (*args != '\0') ? (uint32_t)strtoul(args, NULL, 10) : 10;
+    journal_record_t rec;
+
+    printf("journal: pagina=%u slot=%u pendientes=%u perdidos=%lu rotos=%lu\r\n",
+           access_journal.page, access_journal.slot, access_journal.pending_count,
+           (unsigned long)access_journal.dropped, (unsigned long)access_journal.torn);
+    flash_writer_stats_t fw;
+    flash_writer_get_stats(&fw);
+    printf("flash: filas rapidas=%lu dwords=%lu borrados=%lu errores=%lu cola llena=%lu\r\n",
+           (unsigned long)fw.rows_fast, (unsigned long)fw.dwords, (unsigned long)fw.pages_erased,
+           (unsigned long)fw.errors, (unsigned long)fw.queue_full);
+    for (uint32_t i = 0; i < count && journal_read_latest(&access_journal, i, &rec); i++) {
+        const char *name = (rec.event <= JOURNAL_EVENT_OCCUPANCY) ? event_names[rec.event] : "?";
+        printf("  #%lu t=%lu %s %lu\r\n", (unsigned long)rec.sequence,
+               (unsigned long)rec.timestamp_ms, name, (unsigned long)rec.data);
+    }
+}
+
+/**
+ * @brief clk [perf|balanced|lowpower|auto]: muestra o fija el perfil de reloj.
+ */
+static void cmd_clk(const char *args)
+{
+    clock_profile_t profile;
+    if (strcmp(args, "auto") == 0) {
+        clock_auto = true;
+    } else if (clock_manager_profile_from_name(args, &profile)) {
+        clock_auto = false;
+        if (clock_manager_set_profile(profile) != HAL_OK) {
+            printf("Error al cambiar de perfil\r\n");
+        }
+    } else if (*args != '\0') {
+        printf("Uso: clk [perf|balanced|lowpower|auto]\r\n");
+        return;
+    }
+    printf("modo %s\r\n", clock_auto ? "auto" : "manual");
+    clock_manager_report();
+}
+
+/**
+ * @brief cache [perf|balanced|lowpower <PID>]: muestra o fija la configuración del ART por perfil.
+ */
+static void cmd_cache(const char *args)
+{
+    char name[12] = {0}, flags[4] = {0};
+    clock_profile_t profile;
+    uint8_t config;
+
+    if (*args != '\0') {
+        if (sscanf(args, "%11s %3s", name, flags) != 2 || !clock_manager_profile_from_name(name, &profile)
+            || !flash_cache_parse(flags, &config)) {
+            printf("Uso: cache [perf|balanced|lowpower <PID>]\r\n");
+            return;
+        }
+        // El HAL restaura el caché de datos al terminar cada programación (ver flash_cache.h)
+        if (!flash_writer_idle()) {
+            printf("FLASH ocupada (flash_writer), reintentar\r\n");
+            return;
+        }
+        flash_cache_set_profile_config(profile, config);
+    }
+    for (uint8_t p = 0; p < CLOCK_PROFILE_COUNT; p++) {
+        printf("%-9s %s%s\r\n", clock_manager_profile_name((clock_profile_t)p),
+               flash_cache_name(flash_cache_profile_config((clock_profile_t)p)),
+               (p == clock_manager_get_profile()) ? " (activo)" : "");
+    }
+}
+
+/**
+ * @brief audio [on|off]: estado de la captura y del detector de ocupación.
+ */
+static void cmd_audio(const char *args)
+{
+    if (strcmp(args, "on") == 0) {
+        if (!audio_capture_start()) printf("error\r\n");
+    } else if (strcmp(args, "off") == 0) {
+        audio_capture_stop();
+    } else if (*args != '\0') {
+        printf("Uso: audio [on|off]\r\n");
+        return;
+    }
+    const audio_capture_stats_t *stats = audio_capture_get_stats();
+    printf("audio: %s sala=%s tramas=%lu bloques=%lu perdidos=%lu\r\n",
+           audio_capture_running() ? "activo" : "detenido", room_occupancy.occupied ? "ocupada" : "libre",
+           (unsigned long)room_occupancy.frames, (unsigned long)stats->blocks, (unsigned long)stats->overruns);
+    printf("energia=%ld piso=%ld (x100) activas=%u/%u\r\n", (long)(room_occupancy.coeffs[0] * 100.0f),
+           (long)(room_occupancy.noise_floor * 100.0f), occupancy_active_frames(&room_occupancy),
+           OCCUPANCY_WINDOW_FRAMES);
+    for (uint32_t s = 0; s < MFCC_STAGE_COUNT; s++) {
+        printf("  %-9s %8lu ciclos\r\n", mfcc_stage_name((mfcc_stage_t)s),
+               (unsigned long)room_occupancy.mfcc.stage_cycles[s]);
+    }
+}
+
+/**
+ * @brief kws: clasifica el último segundo de audio y muestra los puntajes.
+ */
+static void cmd_kws(const char *args)
+{
+    (void)args;
+    int16_t detected = kws_run();
+    const q7_t *scores = kws_scores();
+    uint32_t total = 0;
+
+    for (uint8_t i = 0; i < kws_model()->layer_count; i++) total += kws_runtime()->layer_cycles[i];
+    printf("kws: %s pesos=%s ventana=%s detectada=%s\r\n", voice_unlock ? "activo" : "inactivo",
+           kws_weights_trained() ? "entrenados" : "de prueba", kws_window_full() ? "completa" : "incompleta",
+           (detected >= 0) ? kws_label((uint16_t)detected) : "-");
+    for (uint16_t c = 0; c < KWS_CLASSES; c++) {
+        printf("  %-11s %4d\r\n", kws_label(c), scores[c]);
+    }
+    printf("inferencia: %lu ciclos (%lu us)\r\n", (unsigned long)total,
+           (unsigned long)perf_counter_cycles_to_us(total));
+}
+
+/**
+ * @brief Genera una imagen nueva a partir de la activa agregando o quitando una clave.
+ * @note  La nueva se escribe en el slot del otro banco, así que la activa se sigue
+ *        consultando sin esperas. Si la nueva es el slot A (banco 1, junto al código),
+ *        la CPU espera cada borrado y programación al leer instrucciones.
+ *        Ante cualquier fallo se descarta la actualización y sigue la imagen activa.
+ */
+static bool cred_update(uint32_t key, uint16_t user_id, bool remove)
+{
+    cred_record_t added = { .key = key, .user_id = user_id, .flags = CRED_FLAG_ENABLED, .reserved = 0xFF };
+    bool pending = !remove;
+    bool ok = true;
+
+    if (!cred_db_begin_update(&credential_db)) return false;
+    for (uint32_t i = 0; ok && i < credential_db.count; i++) {
+        const cred_record_t *rec = &credential_db.records[i];
+        if (pending && added.key <= rec->key) {
+            ok = cred_db_stage(&credential_db, &added);
+            pending = false;
+        }
+        if (ok && rec->key != key) ok = cred_db_stage(&credential_db, rec);  // Igual: reemplazada o eliminada
+    }
+    if (ok && pending) ok = cred_db_stage(&credential_db, &added);
+    if (!ok) {
+        cred_db_abort(&credential_db);
+        return false;
+    }
+    return cred_db_commit(&credential_db);
+}
+
+/**
+ * @brief cred [add <pin> <usuario>|del <pin>]: muestra o modifica la base de credenciales.
+ */
+static void cmd_cred(const char *args)
+{
+    char pin[PASSWORD_LEN + 1] = {0};
+    unsigned int user = 0;
+
+    if (strncmp(args, "add ", 4) == 0 && sscanf(args + 4, "%4s %u", pin, &user) == 2) {
+        printf("%s\r\n", cred_update(cred_db_key_from_pin(pin, PASSWORD_LEN), (uint16_t)user, false)
+                              ? "ok" : "error");
+    } else if (strncmp(args, "del ", 4) == 0 && sscanf(args + 4, "%4s", pin) == 1) {
+        printf("%s\r\n", cred_update(cred_db_key_from_pin(pin, PASSWORD_LEN), 0, true) ? "ok" : "error");
+    } else if (*args != '\0') {
+        printf("Uso: cred [add <pin> <usuario>|del <pin>]\r\n");
+        return;
+    }
+    printf("credenciales: slot=%d gen=%lu n=%lu/%lu\r\n", credential_db.active,
+           (unsigned long)credential_db.generation, (unsigned long)credential_db.count,
+           (unsigned long)cred_db_capacity(&credential_db));
+}
+
+static void register_console_commands(void)
+{
+    console_register("stat", "uso de stack, heap y pool", cmd_stat);
+    console_register("mem", "uso de las regiones RAM/RAM2", cmd_mem);
+    console_register("log", "muestra el log de diagnostico", cmd_log);
+    console_register("bench", "ejecuta los benchmarks", cmd_bench);
+    console_register("clk", "perfil de reloj [perf|balanced|lowpower|auto]", cmd_clk);
+    console_register("journal", "eventos de acceso en FLASH [n]", cmd_journal);
+    console_register("cred", "credenciales [add <pin> <u>|del <pin>]", cmd_cred);
+    console_register("cache", "ART por perfil [perfil PID]", cmd_cache);
+    console_register("audio", "ocupacion por audio [on|off]", cmd_audio);
+    console_register("kws", "palabra clave del ultimo segundo", cmd_kws);
+}
+
+/**
+ * @brief Elige el perfil de reloj según el trabajo pendiente (teclas, consola, LEDs).
+ * @note  Debe llamarse en el bucle principal después de procesar las entradas y antes de process_voice().
+ */
+void manage_clock_profile(void)
+{
+    if (!clock_auto) return;
+
+    clock_policy_input_t input = {
+        .pending_keys = ring_buffer_count(&keypad_rb),
+        .pending_console = console_rx_pending(),
+        // process_audio() ya consumió el bloque: mientras la captura corre llega uno cada 20 ms
+        .pending_audio = audio_capture_running() ? 1U : audio_capture_pending(),
+        .ui_active = led_timer_start != 0,
+        .compute_requested = kws_busy(),
+        .now_ms = HAL_GetTick(),
+    };
+    clock_profile_t profile = clock_policy_select(&clock_policy, &input);
+    // No cambiar la latencia de FLASH con una escritura en curso
+    if (profile != clock_manager_get_profile() && flash_writer_idle()) {
+        if (clock_manager_set_profile(profile) != HAL_OK) {
+            Error_Handler();
+        }
+    }
+}
+
+/**
+ * @brief Procesa un bloque de audio capturado y registra los cambios de ocupación.
+ * @note  Un bloque por iteración: a 16 kHz llega uno cada 20 ms.
+ */
+void process_audio(void)
+{
+    const int16_t *block = audio_capture_get_block();
+    if (block == NULL) return;
+
+    uint32_t frames = room_occupancy.frames;
+    bool changed = occupancy_process(&room_occupancy, block);
+    audio_capture_release();
+    if (changed) {
+        journal_append(&access_journal, JOURNAL_EVENT_OCCUPANCY, room_occupancy.occupied ? 1U : 0U,
+                       HAL_GetTick());
+        printf("Sala %s.\r\n", room_occupancy.occupied ? "ocupada" : "libre");
+    }
+    if (room_occupancy.frames == frames) return;  // Todavía sin trama completa
+
+    // Los mismos MFCC alimentan la ventana de palabras clave; solo se infiere con actividad
+    kws_push_frame(room_occupancy.coeffs);
+    if (voice_unlock && kws_window_full() && !kws_busy() && room_occupancy.frames % KWS_INFERENCE_FRAMES == 0
+        && occupancy_active_frames(&room_occupancy) > 0) {
+        kws_start();
+    }
+}
+
+/**
+ * @brief Avanza una capa de la inferencia de palabras clave en curso.
+ * @note  Con el escalado automático espera a que manage_clock_profile() haya subido
+ *        a PERFORMANCE (se demora si flash_writer está ocupado), así ninguna capa
+ *        corre a 4 o 24 MHz. El tiempo por capa frente al bloque de audio (20 ms)
+ *        no está medido en la placa: los bloques perdidos se ven en "audio".
+ */
+void process_voice(void)
+{
+    if (!kws_busy()) return;
+    if (clock_auto && clock_manager_get_profile() != CLOCK_PROFILE_PERFORMANCE) return;
+
+    int16_t detected = kws_poll();
+    if (detected >= 0 && detected == voice_unlock_class) {
+        printf("Palabra clave \"%s\". ACCESO AUTORIZADO.\r\n", kws_label((uint16_t)detected));
+        grant_access(VOICE_UNLOCK_USER);
+    }
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -185,14 +536,18 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  // Verificar SRAM2 antes de tocar datos retenidos (log de diagnóstico)
+  sram2_init();
+  diag_log_init(sram2_get_status()->retained_valid);
   /* USER CODE END Init */
 
   /* Configure the system clock */
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
-
+  perf_counter_init();
+  clock_manager_init(CLOCK_PROFILE_PERFORMANCE); // SystemClock_Config deja 80 MHz
+  flash_cache_init();
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
@@ -204,6 +559,57 @@ int main(void)
   led_init(&led_ext);
   ring_buffer_init(&keypad_rb, keypad_buffer, KEYPAD_BUFFER_LEN);
   keypad_init(&keypad); // Asegura que las filas del keypad estén en BAJO
+  if (!mem_pool_init()) {
+    Error_Handler(); // Las clases del pool no caben en _Mem_Pool_Size
+  }
+  mem_monitor_init();
+  console_init(&huart2);
+  register_console_commands();
+  clock_manager_register(console_on_clock_change);
+  flash_writer_init();
+  if (!journal_init(&access_journal, &journal_flash_ops, (uintptr_t)&_sjournal, FLASH_PAGE_SIZE,
+                    (uint16_t)((&_ejournal - &_sjournal) / FLASH_PAGE_SIZE))) {
+    printf("ADVERTENCIA: no se pudo inicializar el journal en FLASH.\r\n");
+  }
+  journal_append(&access_journal, JOURNAL_EVENT_BOOT, diag_log_boot_count(), HAL_GetTick());
+  cred_db_init(&credential_db, &cred_flash_ops, (uintptr_t)&_scred_a, (uintptr_t)&_scred_b,
+               (uint32_t)(uintptr_t)&_cred_slot_size, FLASH_PAGE_SIZE);
+  if (credential_db.active < 0) {
+    // Primer arranque: sembrar la base con la contraseña de fábrica
+    if (!cred_update(cred_db_key_from_pin(PASSWORD, PASSWORD_LEN), 1, false)) {
+      printf("ADVERTENCIA: no se pudo crear la base de credenciales.\r\n");
+    }
+  }
+  clock_policy_init(&clock_policy, CLOCK_IDLE_TIMEOUT_MS, CLOCK_COMPUTE_HOLD_MS, HAL_GetTick());
+  if (!occupancy_init(&room_occupancy) || !audio_capture_init()) {
+    Error_Handler();
+  }
+  room_occupancy.mfcc.clock = perf_counter_now;
+  if (!kws_init()) {
+    Error_Handler(); // El DS-CNN no entra en KWS_ARENA_SIZE
+  }
+  kws_runtime()->clock = perf_counter_now;
+  voice_unlock_class = kws_find_label(VOICE_UNLOCK_WORD);
+  if (voice_unlock && (!kws_weights_trained() || voice_unlock_class < 0)) {
+    printf("ADVERTENCIA: desbloqueo por voz sin pesos entrenados, desactivado.\r\n");
+    voice_unlock = false;
+  }
+  clock_manager_register(audio_capture_on_clock_change);
+#if AUDIO_OCCUPANCY
+  if (!audio_capture_start()) {
+    printf("ADVERTENCIA: no se pudo iniciar la captura de audio.\r\n");
+  }
+#endif
+
+#if RUN_BENCHMARKS_AT_BOOT
+  benchmark_run_all();
+#endif
+
+  diag_log_printf("arranque #%lu csr=%08lx", (unsigned long)diag_log_boot_count(),
+                  (unsigned long)sram2_get_status()->reset_flags);
+  if (sram2_get_status()->parity_error) {
+    printf("ADVERTENCIA: error de paridad en SRAM2, log reiniciado.\r\n");
+  }
 
   printf("Sistema de Control de Acceso Iniciado.\r\n");
   printf("Ingrese la contraseña de 4 digitos.\r\n");
@@ -241,6 +647,23 @@ int main(void)
       */
     manage_led_timer();
 
+    // Diagnóstico: escaneo incremental del stack y comandos por UART
+    mem_monitor_poll();
+    console_poll();
+
+    // Persistir eventos de acceso sin bloquear el procesamiento de teclas.
+    // Un registro puede requerir dos operaciones (borrado de página y fila).
+    if (flash_writer_free_ops() >= 2) {
+        journal_flush(&access_journal, JOURNAL_FLUSH_PER_LOOP);
+    }
+    flash_writer_poll();
+
+    // Ocupación de la sala por audio y palabra clave. El perfil se elige antes de
+    // avanzar la inferencia para que kws_start() suba el reloj antes de la capa 0.
+    process_audio();
+    manage_clock_profile();
+    process_voice();
+
     /* USER CODE END WHILE */
 // --- Parpadeo rápido del LED externo durante el tiempo de éxito ---
   if (led_timer_start != 0) {
@@ -0,0 +1,98 @@
+#include "mem_monitor.h"
+#include "mem_pool.h"
+#include <stdio.h>
+
+/* Symbols defined in the linker script */
+extern uint8_t _end;
+extern uint8_t _estack;
+extern uint32_t _Min_Stack_Size;
+
+static uint32_t *scan_cursor;     // Próxima palabra a revisar
+static uint32_t *stack_hwm;       // Palabra más baja encontrada sin el patrón
+static uint32_t heap_current;
+static uint32_t heap_peak;
+static uint32_t heap_failures;
+
+/**
+ * @brief Límite inferior del escaneo: el tope actual del heap.
+ */
+static uint32_t *scan_floor(void)
+{
+    return (uint32_t *)(((uintptr_t)&_end + heap_current + 3U) & ~(uintptr_t)3U);
+}
+
+void mem_monitor_init(void)
+{
+    stack_hwm = (uint32_t *)&_estack;
+    scan_cursor = scan_floor();
+}
+
+/**
+ * @brief Recorre desde el heap hacia arriba buscando la primera palabra sin el
+ *        patrón; esa dirección es el punto más profundo que alcanzó el stack.
+ * @note  Como el high-water mark solo puede bajar, cada pasada termina al llegar
+ *        al valor previo y vuelve a empezar desde el heap.
+ */
+void mem_monitor_poll(void)
+{
+    uint32_t *floor = scan_floor();
+    if (scan_cursor < floor) scan_cursor = floor;
+
+    for (uint32_t i = 0; i < MEM_MONITOR_WORDS_PER_POLL; i++) {
+        if (scan_cursor >= stack_hwm) {
+            scan_cursor = floor;
+            return;
+        }
+        if (*scan_cursor != MEM_MONITOR_PAINT) {
+            stack_hwm = scan_cursor;
+            scan_cursor = floor;
+            return;
+        }
+        scan_cursor++;
+    }
+}
+
+/**
+ * @brief Contadores del heap actualizados desde _sbrk.
+ */
+void mem_monitor_on_sbrk(ptrdiff_t incr, bool ok)
+{
+    if (!ok) {
+        heap_failures++;
+        return;
+    }
+    heap_current += (uint32_t)incr;
+    if (heap_current > heap_peak) heap_peak = heap_current;
+}
+
+void mem_monitor_get_stats(mem_monitor_stats_t *stats)
+{
+    uint32_t *floor = scan_floor();
+
+    stats->stack_reserved = (uint32_t)&_Min_Stack_Size;
+    stats->stack_peak = (uint32_t)((uintptr_t)&_estack - (uintptr_t)stack_hwm);
+    stats->heap_current = heap_current;
+    stats->heap_peak = heap_peak;
+    stats->heap_failures = heap_failures;
+    stats->free_gap = (stack_hwm > floor) ? (uint32_t)((uintptr_t)stack_hwm - (uintptr_t)floor) : 0;
+    stats->stack_overflow = stats->stack_peak > stats->stack_reserved || stack_hwm <= floor;
+}
+
+void mem_monitor_report(void)
+{
+    mem_monitor_stats_t st;
+    mem_monitor_get_stats(&st);
+
+    printf("stack: max=%lu/%lu B%s\r\n", (unsigned long)st.stack_peak,
+           (unsigned long)st.stack_reserved, st.stack_overflow ? " DESBORDADO" : "");
+    printf("heap : actual=%lu max=%lu fallos=%lu\r\n", (unsigned long)st.heap_current,
+           (unsigned long)st.heap_peak, (unsigned long)st.heap_failures);
+    printf("libre entre heap y stack: %lu B\r\n", (unsigned long)st.free_gap);
+
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        mem_pool_stats_t ps;
+        mem_pool_get_stats(i, &ps);
+        printf("pool %3u B: uso=%u max=%u/%u fallos=%lu\r\n", ps.block_size, ps.in_use,
+               ps.high_water, ps.block_count, (unsigned long)ps.alloc_failures);
+    }
+}
@@ -0,0 +1,276 @@
+#include "mem_pool.h"
+#include "main.h"
+#include <errno.h>
+#include <string.h>
+
+/**
+ * @brief Configuración de las clases de tamaño (ordenadas de menor a mayor).
+ * @note  block_size debe ser múltiplo de 8 para mantener la alineación.
+ *        La suma de block_size * block_count no debe superar _Mem_Pool_Size.
+ */
+static const struct {
+    uint16_t block_size;
+    uint16_t block_count;
+} pool_config[MEM_POOL_NUM_CLASSES] = {
+    {  16, 64 },
+    {  32, 32 },
+    {  64, 16 },
+    { 128,  8 },
+};
+
+/** @brief Palabras del mapa de bloques entregados; limita block_count a 32 * POOL_MAP_WORDS. */
+#define POOL_MAP_WORDS 2
+
+/**
+ * @brief Nodo de la lista libre; se guarda dentro del propio bloque libre.
+ */
+typedef struct free_block {
+    struct free_block *next;
+} free_block_t;
+
+/**
+ * @brief Estado interno de una clase de tamaño.
+ */
+typedef struct {
+    uint8_t *start;           // Primer bloque de la clase
+    uint8_t *end;             // Fin (exclusivo) de la clase
+    free_block_t *free_list;  // Lista libre LIFO
+    uint32_t used[POOL_MAP_WORDS]; // Bit por bloque entregado, para detectar doble free
+    mem_pool_stats_t stats;
+} pool_class_t;
+
+static pool_class_t pool_classes[MEM_POOL_NUM_CLASSES];
+
+extern uint8_t _spool; /* Symbol defined in the linker script */
+extern uint8_t _epool; /* Symbol defined in the linker script */
+
+/**
+ * @brief Entra a sección crítica guardando el estado previo de PRIMASK.
+ * @note  Permite anidar llamadas desde ISR sin rehabilitar interrupciones antes de tiempo.
+ */
+static inline uint32_t pool_lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void pool_unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Busca la clase a la que pertenece un puntero comparando rangos de dirección.
+ * @return Puntero a la clase o NULL si ptr está fuera del pool o desalineado.
+ */
+static pool_class_t *pool_class_of(const void *ptr)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        pool_class_t *pc = &pool_classes[i];
+        if (p >= pc->start && p < pc->end) {
+            if (((uint32_t)(p - pc->start) % pc->stats.block_size) != 0) return NULL;
+            return pc;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Divide la región del linker en clases y enlaza los bloques libres.
+ */
+bool mem_pool_init(void)
+{
+    uint8_t *cursor = &_spool;
+    uint8_t *limit = &_epool;
+
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        pool_class_t *pc = &pool_classes[i];
+        uint32_t bytes = (uint32_t)pool_config[i].block_size * pool_config[i].block_count;
+
+        if (cursor + bytes > limit) return false;
+        if (pool_config[i].block_count > 32U * POOL_MAP_WORDS) return false;
+
+        pc->start = cursor;
+        pc->end = cursor + bytes;
+        pc->free_list = NULL;
+        memset(pc->used, 0, sizeof(pc->used));
+        memset(&pc->stats, 0, sizeof(pc->stats));
+        pc->stats.block_size = pool_config[i].block_size;
+        pc->stats.block_count = pool_config[i].block_count;
+
+        // Enlazar de atrás hacia adelante para que el primer bloque quede al frente
+        for (int32_t b = pool_config[i].block_count - 1; b >= 0; b--) {
+            free_block_t *blk = (free_block_t *)(cursor + (uint32_t)b * pc->stats.block_size);
+            blk->next = pc->free_list;
+            pc->free_list = blk;
+        }
+        cursor += bytes;
+    }
+    return true;
+}
+
+/**
+ * @brief Índice del bloque blk dentro de su clase.
+ */
+static inline uint32_t pool_block_index(const pool_class_t *pc, const void *blk)
+{
+    return (uint32_t)((const uint8_t *)blk - pc->start) / pc->stats.block_size;
+}
+
+/**
+ * @brief Toma un bloque de la clase adecuada; si está agotada, usa la siguiente más grande.
+ * @note  El fallo se cuenta en la clase adecuada solo si ninguna clase pudo atender la petición.
+ */
+void *mem_pool_alloc(size_t size)
+{
+    if (size == 0) size = 1;
+
+    pool_class_t *fit = NULL;
+    uint32_t primask = pool_lock();
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        pool_class_t *pc = &pool_classes[i];
+        if (size > pc->stats.block_size) continue;
+        if (fit == NULL) fit = pc;
+
+        free_block_t *blk = pc->free_list;
+        if (blk == NULL) continue;
+
+        uint32_t idx = pool_block_index(pc, blk);
+        pc->free_list = blk->next;
+        pc->used[idx / 32U] |= 1UL << (idx % 32U);
+        pc->stats.in_use++;
+        if (pc->stats.in_use > pc->stats.high_water) {
+            pc->stats.high_water = pc->stats.in_use;
+        }
+        pool_unlock(primask);
+        return blk;
+    }
+    if (fit != NULL) fit->stats.alloc_failures++;
+    pool_unlock(primask);
+    return NULL;
+}
+
+/**
+ * @brief Inserta el bloque al frente de la lista libre de su clase.
+ * @note  Un bloque que no está entregado (doble free) se ignora para no corromper
+ *        la lista libre ni el contador in_use.
+ */
+void mem_pool_free(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    pool_class_t *pc = pool_class_of(ptr);
+    if (pc == NULL) return;
+
+    uint32_t idx = pool_block_index(pc, ptr);
+    uint32_t bit = 1UL << (idx % 32U);
+    uint32_t primask = pool_lock();
+    if ((pc->used[idx / 32U] & bit) == 0U) {
+        pool_unlock(primask);
+        return;
+    }
+    pc->used[idx / 32U] &= ~bit;
+    free_block_t *blk = (free_block_t *)ptr;
+    blk->next = pc->free_list;
+    pc->free_list = blk;
+    pc->stats.in_use--;
+    pool_unlock(primask);
+}
+
+/**
+ * @brief Devuelve el tamaño del bloque que contiene ptr.
+ */
+size_t mem_pool_block_size(const void *ptr)
+{
+    pool_class_t *pc = pool_class_of(ptr);
+    return (pc != NULL) ? pc->stats.block_size : 0;
+}
+
+/**
+ * @brief Copia atómicamente las estadísticas de una clase.
+ */
+bool mem_pool_get_stats(uint8_t class_index, mem_pool_stats_t *stats)
+{
+    if (class_index >= MEM_POOL_NUM_CLASSES || stats == NULL) return false;
+
+    uint32_t primask = pool_lock();
+    *stats = pool_classes[class_index].stats;
+    pool_unlock(primask);
+    return true;
+}
+
+/**
+ * @brief Reinicia high_water al uso actual y pone en cero los fallos.
+ */
+void mem_pool_reset_stats(void)
+{
+    uint32_t primask = pool_lock();
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        pool_classes[i].stats.high_water = pool_classes[i].stats.in_use;
+        pool_classes[i].stats.alloc_failures = 0;
+    }
+    pool_unlock(primask);
+}
+
+#if MEM_POOL_OVERRIDE_MALLOC
+/* Reemplazo de la familia malloc de newlib. Se definen también las versiones
+ * reentrantes (_r) porque printf y otras funciones de la libc las llaman directamente. */
+struct _reent;
+
+void *_malloc_r(struct _reent *r, size_t size)
+{
+    (void)r;
+    void *p = mem_pool_alloc(size);
+    if (p == NULL) errno = ENOMEM;
+    return p;
+}
+
+void _free_r(struct _reent *r, void *ptr)
+{
+    (void)r;
+    mem_pool_free(ptr);
+}
+
+void *_calloc_r(struct _reent *r, size_t n, size_t size)
+{
+    if (size != 0 && n > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    void *p = _malloc_r(r, n * size);
+    if (p != NULL) memset(p, 0, n * size);
+    return p;
+}
+
+void *_realloc_r(struct _reent *r, void *ptr, size_t size)
+{
+    if (ptr == NULL) return _malloc_r(r, size);
+    if (size == 0) {
+        _free_r(r, ptr);
+        return NULL;
+    }
+
+    /* Con el reemplazo activo no se enlaza el malloc de newlib, así que un puntero
+     * ajeno al pool no es de ningún asignador: se falla sin tocarlo, como pide realloc */
+    size_t old_size = mem_pool_block_size(ptr);
+    if (old_size == 0) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    if (size <= old_size) return ptr;
+
+    void *p = _malloc_r(r, size);
+    if (p != NULL) {
+        memcpy(p, ptr, old_size);
+        _free_r(r, ptr);
+    }
+    return p;
+}
+
+void *malloc(size_t size) { return _malloc_r(NULL, size); }
+void free(void *ptr) { _free_r(NULL, ptr); }
+void *calloc(size_t n, size_t size) { return _calloc_r(NULL, n, size); }
+void *realloc(void *ptr, size_t size) { return _realloc_r(NULL, ptr, size); }
+#endif
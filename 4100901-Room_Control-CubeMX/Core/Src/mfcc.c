@@ -0,0 +1,128 @@
+#include "mfcc.h"
+
+#define MFCC_LOG_FLOOR 1e-6f  // Evita log(0) en bandas sin energía
+
+static float32_t mfcc_hz_to_mel(float32_t hz)
+{
+    return 1127.0f * logf(1.0f + hz / 700.0f);
+}
+
+static float32_t mfcc_mel_to_hz(float32_t mel)
+{
+    return 700.0f * (expf(mel / 1127.0f) - 1.0f);
+}
+
+/**
+ * @brief Filtros triangulares equiespaciados en mel; guarda solo los pesos no nulos.
+ */
+static bool mfcc_init_mel(mfcc_t *m)
+{
+    const float32_t bin_hz = (float32_t)MFCC_SAMPLE_RATE / MFCC_FRAME_LEN;
+    const float32_t mel_low = mfcc_hz_to_mel(MFCC_LOW_HZ);
+    const float32_t mel_step = (mfcc_hz_to_mel(MFCC_HIGH_HZ) - mel_low) / (MFCC_NUM_MEL + 1U);
+    uint16_t offset = 0;
+
+    for (uint32_t j = 0; j < MFCC_NUM_MEL; j++) {
+        float32_t left = mfcc_mel_to_hz(mel_low + j * mel_step);
+        float32_t center = mfcc_mel_to_hz(mel_low + (j + 1U) * mel_step);
+        float32_t right = mfcc_mel_to_hz(mel_low + (j + 2U) * mel_step);
+
+        m->mel_first[j] = 0;
+        m->mel_len[j] = 0;
+        m->mel_offset[j] = offset;
+        for (uint32_t k = 0; k < MFCC_NUM_BINS; k++) {
+            float32_t f = k * bin_hz;
+            float32_t w = 0.0f;
+            if (f > left && f <= center) {
+                w = (f - left) / (center - left);
+            } else if (f > center && f < right) {
+                w = (right - f) / (right - center);
+            }
+            if (w <= 0.0f) continue;
+            if (offset >= MFCC_MEL_WEIGHTS_MAX) return false;
+            if (m->mel_len[j] == 0) m->mel_first[j] = (uint16_t)k;
+            m->mel_weights[offset++] = w;
+            m->mel_len[j]++;
+        }
+    }
+    return true;
+}
+
+bool mfcc_init(mfcc_t *m)
+{
+#if MFCC_RFFT_RAM_TABLES
+    if (arm_rfft_fast_init_dyn_f32(&m->rfft, MFCC_FRAME_LEN, m->rfft_arena, sizeof(m->rfft_arena)) != ARM_MATH_SUCCESS) {
+        return false;
+    }
+#else
+    if (arm_rfft_fast_init_f32(&m->rfft, MFCC_FRAME_LEN) != ARM_MATH_SUCCESS) return false;
+#endif
+
+    // Hann periódica para reducir la fuga espectral. Con salto de MFCC_FRAME_SHIFT (320)
+    // las tramas no suman constante (COLA pide 256); no hace falta porque no se resintetiza
+    for (uint32_t n = 0; n < MFCC_FRAME_LEN; n++) {
+        m->window[n] = 0.5f - 0.5f * cosf(2.0f * PI * n / MFCC_FRAME_LEN);
+    }
+
+    // DCT-II ortonormal (igual a la de los modelos de KWS entrenados con TensorFlow/librosa)
+    for (uint32_t i = 0; i < MFCC_NUM_COEFFS; i++) {
+        float32_t scale = sqrtf((i == 0 ? 1.0f : 2.0f) / MFCC_NUM_MEL);
+        for (uint32_t j = 0; j < MFCC_NUM_MEL; j++) {
+            m->dct[i * MFCC_NUM_MEL + j] = scale * cosf(PI * i * (j + 0.5f) / MFCC_NUM_MEL);
+        }
+    }
+
+    m->clock = NULL;
+    for (uint32_t s = 0; s < MFCC_STAGE_COUNT; s++) m->stage_cycles[s] = 0;
+    return mfcc_init_mel(m);
+}
+
+static inline uint32_t mfcc_mark(mfcc_t *m, mfcc_stage_t stage, uint32_t t0)
+{
+    if (m->clock == NULL) return 0;
+    uint32_t now = m->clock();
+    m->stage_cycles[stage] = now - t0;
+    return now;
+}
+
+void mfcc_compute(mfcc_t *m, const int16_t *samples, float32_t *coeffs)
+{
+    uint32_t t = (m->clock != NULL) ? m->clock() : 0;
+
+    arm_q15_to_float((q15_t *)samples, m->frame, MFCC_FRAME_LEN);
+    arm_mult_f32(m->frame, m->window, m->frame, MFCC_FRAME_LEN);
+    t = mfcc_mark(m, MFCC_STAGE_WINDOW, t);
+
+    // arm_rfft_fast_f32 no trabaja en el lugar y usa la entrada como temporal
+    arm_rfft_fast_f32(&m->rfft, m->frame, m->spectrum, 0);
+    t = mfcc_mark(m, MFCC_STAGE_FFT, t);
+
+    // spectrum[1] trae la parte real del bin de Nyquist empaquetada junto a la continua
+    float32_t nyquist = fabsf(m->spectrum[1]);
+    m->spectrum[1] = 0.0f;
+    arm_cmplx_mag_f32(m->spectrum, m->spectrum, MFCC_FRAME_LEN / 2U);
+    m->spectrum[MFCC_FRAME_LEN / 2U] = nyquist;
+    t = mfcc_mark(m, MFCC_STAGE_MAG, t);
+
+    for (uint32_t j = 0; j < MFCC_NUM_MEL; j++) {
+        arm_dot_prod_f32(&m->spectrum[m->mel_first[j]], &m->mel_weights[m->mel_offset[j]], m->mel_len[j],
+                         &m->mel[j]);
+    }
+    t = mfcc_mark(m, MFCC_STAGE_MEL, t);
+
+    for (uint32_t j = 0; j < MFCC_NUM_MEL; j++) {
+        m->mel[j] = logf(m->mel[j] + MFCC_LOG_FLOOR);
+    }
+    t = mfcc_mark(m, MFCC_STAGE_LOG, t);
+
+    for (uint32_t i = 0; i < MFCC_NUM_COEFFS; i++) {
+        arm_dot_prod_f32(m->mel, &m->dct[i * MFCC_NUM_MEL], MFCC_NUM_MEL, &coeffs[i]);
+    }
+    mfcc_mark(m, MFCC_STAGE_DCT, t);
+}
+
+const char *mfcc_stage_name(mfcc_stage_t stage)
+{
+    static const char *const names[MFCC_STAGE_COUNT] = { "ventana", "rfft", "magnitud", "mel", "log", "dct" };
+    return (stage < MFCC_STAGE_COUNT) ? names[stage] : "?";
+}
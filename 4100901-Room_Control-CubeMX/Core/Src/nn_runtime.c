@@ -0,0 +1,352 @@
+#include "nn_runtime.h"
+#include <string.h>
+
+static inline uint32_t nn_align(uint32_t size)
+{
+    return (size + NN_ARENA_ALIGN - 1U) & ~(NN_ARENA_ALIGN - 1U);
+}
+
+/**
+ * @brief Tamaño de salida de una ventana deslizante; 0 si la ventana no entra.
+ */
+static uint16_t nn_window_out(uint16_t in, uint8_t kernel, uint8_t pad, uint8_t stride)
+{
+    if (kernel == 0 || stride == 0 || in + 2U * pad < kernel) return 0;
+    return (uint16_t)((in + 2U * pad - kernel) / stride + 1U);
+}
+
+static bool nn_pool_square(const nn_layer_t *layer, const nn_shape_t *in)
+{
+    return in->h == in->w && layer->kernel_x == layer->kernel_y && layer->stride_x == layer->stride_y
+           && layer->pad_x == layer->pad_y;
+}
+
+/**
+ * @brief Capas que escriben el resultado sobre su entrada.
+ */
+static inline bool nn_layer_in_place(const nn_layer_t *layer)
+{
+    return layer->type == NN_LAYER_RELU;
+}
+
+/**
+ * @brief Forma de salida y buffer temporal (bytes) de una capa.
+ */
+static bool nn_layer_plan(const nn_layer_t *layer, const nn_shape_t *in, nn_shape_t *out, uint32_t *scratch)
+{
+    uint32_t in_size = nn_shape_size(in);
+    *scratch = 0;
+
+    switch (layer->type) {
+    case NN_LAYER_CONV:
+    case NN_LAYER_DWCONV:
+        if (layer->weights == NULL || layer->bias == NULL) return false;
+        out->h = nn_window_out(in->h, layer->kernel_y, layer->pad_y, layer->stride_y);
+        out->w = nn_window_out(in->w, layer->kernel_x, layer->pad_x, layer->stride_x);
+        out->c = (layer->type == NN_LAYER_CONV) ? layer->out_ch : in->c;
+        if (layer->type == NN_LAYER_DWCONV && layer->out_ch != 0 && layer->out_ch != in->c) return false;
+        // Columna im2col en q15 (los kernels rápidos procesan dos columnas a la vez)
+        *scratch = 2U * in->c * layer->kernel_x * layer->kernel_y * sizeof(q15_t);
+        break;
+
+    case NN_LAYER_FC:
+    case NN_LAYER_FC_OPT:
+        if (layer->weights == NULL || layer->bias == NULL || in_size > UINT16_MAX) return false;
+        out->h = 1;
+        out->w = 1;
+        out->c = layer->out_ch;
+        *scratch = in_size * sizeof(q15_t);
+        break;
+
+    case NN_LAYER_MAXPOOL:
+        // arm_maxpool_q7_HWC solo admite imágenes y ventanas cuadradas
+        if (!nn_pool_square(layer, in)) return false;
+        out->h = nn_window_out(in->h, layer->kernel_y, layer->pad_y, layer->stride_y);
+        out->w = out->h;
+        out->c = in->c;
+        break;
+
+    case NN_LAYER_AVGPOOL:
+        out->h = nn_window_out(in->h, layer->kernel_y, layer->pad_y, layer->stride_y);
+        out->w = nn_window_out(in->w, layer->kernel_x, layer->pad_x, layer->stride_x);
+        out->c = in->c;
+        if (nn_pool_square(layer, in)) *scratch = 2U * out->w * in->c * sizeof(q15_t);
+        break;
+
+    case NN_LAYER_RELU:
+    case NN_LAYER_SOFTMAX:
+        if (in_size > UINT16_MAX) return false;
+        *out = *in;
+        break;
+
+    default:
+        return false;
+    }
+    return nn_shape_size(out) != 0;
+}
+
+/**
+ * @brief Recorre las capas y obtiene el mayor par entrada + salida y el mayor buffer temporal.
+ */
+static bool nn_plan_sizes(const nn_model_t *model, uint32_t *act_size, uint32_t *max_scratch, nn_shape_t *output)
+{
+    if (model->layer_count == 0 || model->layer_count > NN_MAX_LAYERS) return false;
+
+    nn_shape_t shape = model->input;
+    *act_size = nn_align(nn_shape_size(&shape));
+    *max_scratch = 0;
+
+    for (uint8_t i = 0; i < model->layer_count; i++) {
+        const nn_layer_t *layer = &model->layers[i];
+        nn_shape_t next;
+        uint32_t scratch;
+        if (!nn_layer_plan(layer, &shape, &next, &scratch)) return false;
+        uint32_t pair = nn_align(nn_shape_size(&shape));
+        if (!nn_layer_in_place(layer)) pair += nn_align(nn_shape_size(&next));
+        if (pair > *act_size) *act_size = pair;
+        if (scratch > *max_scratch) *max_scratch = scratch;
+        shape = next;
+    }
+    *output = shape;
+    return *act_size != 0;
+}
+
+bool nn_layer_shape(const nn_layer_t *layer, const nn_shape_t *in, nn_shape_t *out)
+{
+    uint32_t scratch;
+    return nn_layer_plan(layer, in, out, &scratch);
+}
+
+bool nn_model_plan(const nn_model_t *model, uint32_t *arena_size, nn_shape_t *output)
+{
+    uint32_t act_size, max_scratch;
+    nn_shape_t shape;
+
+    if (!nn_plan_sizes(model, &act_size, &max_scratch, &shape)) return false;
+    *arena_size = act_size + nn_align(max_scratch);
+    if (output != NULL) *output = shape;
+    return true;
+}
+
+bool nn_runtime_init(nn_runtime_t *rt, const nn_model_t *model, void *arena, uint32_t arena_size)
+{
+    uint32_t act_size, max_scratch;
+    nn_shape_t output;
+
+    if (((uintptr_t)arena % NN_ARENA_ALIGN) != 0) return false;
+    if (!nn_plan_sizes(model, &act_size, &max_scratch, &output)) return false;
+
+    // [activaciones][temporal]
+    uint32_t needed = act_size + nn_align(max_scratch);
+    if (needed > arena_size) return false;
+
+    uint8_t *base = (uint8_t *)arena;
+    rt->model = model;
+    rt->act = (q7_t *)base;
+    rt->act_size = act_size;
+    rt->scratch = (q15_t *)(base + act_size);
+    rt->output = output;
+    rt->arena_used = needed;
+    rt->clock = NULL;
+    memset(rt->layer_cycles, 0, sizeof(rt->layer_cycles));
+    rt->current = rt->act;
+    rt->shape = model->input;
+    rt->next_layer = model->layer_count;  // Nada en curso
+    return true;
+}
+
+/**
+ * @brief Promedio HWC con ventana rectangular; divide por los píxeles dentro de la imagen
+ *        y trunca igual que arm_avepool_q7_HWC.
+ */
+static void nn_avepool_q7_HWC_nonsquare(const q7_t *src, const nn_shape_t *in, const nn_layer_t *l,
+                                        const nn_shape_t *out, q7_t *dst)
+{
+    for (uint16_t oy = 0; oy < out->h; oy++) {
+        for (uint16_t ox = 0; ox < out->w; ox++) {
+            int32_t y0 = (int32_t)oy * l->stride_y - l->pad_y;
+            int32_t x0 = (int32_t)ox * l->stride_x - l->pad_x;
+            int32_t y1 = y0 + l->kernel_y, x1 = x0 + l->kernel_x;
+            if (y0 < 0) y0 = 0;
+            if (x0 < 0) x0 = 0;
+            if (y1 > in->h) y1 = in->h;
+            if (x1 > in->w) x1 = in->w;
+            int32_t count = (y1 - y0) * (x1 - x0);
+
+            for (uint16_t c = 0; c < in->c; c++) {
+                int32_t sum = 0;
+                for (int32_t y = y0; y < y1; y++) {
+                    for (int32_t x = x0; x < x1; x++) sum += src[((uint32_t)y * in->w + (uint32_t)x) * in->c + c];
+                }
+                dst[((uint32_t)oy * out->w + ox) * in->c + c] = (q7_t)(sum / count);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Ejecuta una capa de src a dst.
+ * @return false si CMSIS-NN rechaza las dimensiones.
+ */
+static bool nn_layer_run(const nn_runtime_t *rt, const nn_layer_t *l, const nn_shape_t *in,
+                         const nn_shape_t *out, q7_t *src, q7_t *dst)
+{
+    arm_status status = ARM_MATH_SUCCESS;
+
+    switch (l->type) {
+    case NN_LAYER_CONV:
+        if ((in->c % 4U) == 0 && (out->c % 2U) == 0) {
+            if (l->kernel_x == 1 && l->kernel_y == 1 && l->pad_x == 0 && l->pad_y == 0
+                && l->stride_x == 1 && l->stride_y == 1) {
+                status = arm_convolve_1x1_HWC_q7_fast_nonsquare(src, in->w, in->h, in->c, l->weights, out->c,
+                                                                 1, 1, 0, 0, 1, 1, l->bias, l->bias_shift,
+                                                                 l->out_shift, dst, out->w, out->h,
+                                                                 rt->scratch, NULL);
+            } else {
+                status = arm_convolve_HWC_q7_fast_nonsquare(src, in->w, in->h, in->c, l->weights, out->c,
+                                                            l->kernel_x, l->kernel_y, l->pad_x, l->pad_y,
+                                                            l->stride_x, l->stride_y, l->bias, l->bias_shift,
+                                                            l->out_shift, dst, out->w, out->h, rt->scratch, NULL);
+            }
+        } else {
+            status = arm_convolve_HWC_q7_basic_nonsquare(src, in->w, in->h, in->c, l->weights, out->c,
+                                                         l->kernel_x, l->kernel_y, l->pad_x, l->pad_y,
+                                                         l->stride_x, l->stride_y, l->bias, l->bias_shift,
+                                                         l->out_shift, dst, out->w, out->h, rt->scratch, NULL);
+        }
+        break;
+
+    case NN_LAYER_DWCONV:
+        status = arm_depthwise_separable_conv_HWC_q7_nonsquare(src, in->w, in->h, in->c, l->weights, out->c,
+                                                               l->kernel_x, l->kernel_y, l->pad_x, l->pad_y,
+                                                               l->stride_x, l->stride_y, l->bias, l->bias_shift,
+                                                               l->out_shift, dst, out->w, out->h,
+                                                               rt->scratch, NULL);
+        break;
+
+    case NN_LAYER_FC:
+        status = arm_fully_connected_q7(src, l->weights, (uint16_t)nn_shape_size(in), out->c, l->bias_shift,
+                                        l->out_shift, l->bias, dst, rt->scratch);
+        break;
+
+    case NN_LAYER_FC_OPT:
+        status = arm_fully_connected_q7_opt(src, l->weights, (uint16_t)nn_shape_size(in), out->c, l->bias_shift,
+                                            l->out_shift, l->bias, dst, rt->scratch);
+        break;
+
+    case NN_LAYER_RELU:
+        arm_relu_q7(src, (uint16_t)nn_shape_size(in));
+        break;
+
+    case NN_LAYER_MAXPOOL:
+        arm_maxpool_q7_HWC(src, in->w, in->c, l->kernel_x, l->pad_x, l->stride_x, out->w, NULL, dst);
+        break;
+
+    case NN_LAYER_AVGPOOL:
+        if (nn_pool_square(l, in)) {
+            arm_avepool_q7_HWC(src, in->w, in->c, l->kernel_x, l->pad_x, l->stride_x, out->w,
+                               (q7_t *)rt->scratch, dst);
+        } else {
+            nn_avepool_q7_HWC_nonsquare(src, in, l, out, dst);
+        }
+        break;
+
+    case NN_LAYER_SOFTMAX:
+        arm_softmax_q7(src, (uint16_t)nn_shape_size(in), dst);
+        break;
+
+    default:
+        return false;
+    }
+    return status == ARM_MATH_SUCCESS;
+}
+
+void nn_runtime_begin(nn_runtime_t *rt, const q7_t *input)
+{
+    // Copia de la entrada: las capas en el lugar y maxpool escriben sobre su origen
+    rt->shape = rt->model->input;
+    rt->current = rt->act;
+    rt->next_layer = 0;
+    memcpy(rt->current, input, nn_shape_size(&rt->shape));
+}
+
+bool nn_runtime_step(nn_runtime_t *rt)
+{
+    if (nn_runtime_done(rt)) return false;
+
+    uint8_t i = rt->next_layer;
+    const nn_layer_t *layer = &rt->model->layers[i];
+    q7_t *src = rt->current;
+    nn_shape_t next;
+    uint32_t scratch;
+    uint32_t t0 = (rt->clock != NULL) ? rt->clock() : 0;
+
+    nn_layer_plan(layer, &rt->shape, &next, &scratch);
+    // La salida va al extremo opuesto de la región; ReLU la deja en su origen
+    q7_t *dst = src;
+    if (!nn_layer_in_place(layer)) {
+        dst = (src == rt->act) ? rt->act + rt->act_size - nn_align(nn_shape_size(&next)) : rt->act;
+    }
+    if (!nn_layer_run(rt, layer, &rt->shape, &next, src, dst)) {
+        rt->next_layer = rt->model->layer_count;
+        return false;
+    }
+    rt->current = dst;
+    rt->shape = next;
+    rt->next_layer++;
+
+    if (rt->clock != NULL) rt->layer_cycles[i] = rt->clock() - t0;
+    return true;
+}
+
+bool nn_runtime_run(nn_runtime_t *rt, const q7_t *input, q7_t *output)
+{
+    nn_runtime_begin(rt, input);
+    while (!nn_runtime_done(rt)) {
+        if (!nn_runtime_step(rt)) return false;
+    }
+    memcpy(output, rt->current, nn_shape_size(&rt->shape));
+    return true;
+}
+
+void nn_fc_opt_reorder(const q7_t *weights, q7_t *reordered, uint16_t rows, uint16_t cols)
+{
+    q7_t *out = reordered;
+    uint16_t row = 0;
+
+    for (; row + 4U <= rows; row += 4U) {
+        const q7_t *r0 = &weights[(uint32_t)row * cols];
+        const q7_t *r1 = r0 + cols, *r2 = r1 + cols, *r3 = r2 + cols;
+        uint16_t col = 0;
+        // Por cada 4 columnas: pares (c, c+2) y luego (c+1, c+3), filas 0-1 y 2-3
+        for (; col + 4U <= cols; col += 4U) {
+            for (uint16_t k = 0; k < 2U; k++) {
+                uint16_t a = col + k, b = col + k + 2U;
+                *out++ = r0[a]; *out++ = r1[a]; *out++ = r0[b]; *out++ = r1[b];
+                *out++ = r2[a]; *out++ = r3[a]; *out++ = r2[b]; *out++ = r3[b];
+            }
+        }
+        for (; col < cols; col++) {
+            *out++ = r0[col]; *out++ = r1[col]; *out++ = r2[col]; *out++ = r3[col];
+        }
+    }
+    // Filas sobrantes en su orden original
+    memcpy(out, &weights[(uint32_t)row * cols], (uint32_t)(rows - row) * cols);
+}
+
+const char *nn_layer_name(uint8_t type)
+{
+    static const char *const names[NN_LAYER_TYPE_COUNT] = {
+        "conv", "dwconv", "fc", "fc_opt", "relu", "maxpool", "avgpool", "softmax"
+    };
+    return (type < NN_LAYER_TYPE_COUNT) ? names[type] : "?";
+}
+
+uint16_t nn_argmax(const q7_t *values, uint16_t count)
+{
+    uint16_t best = 0;
+    for (uint16_t i = 1; i < count; i++) {
+        if (values[i] > values[best]) best = i;
+    }
+    return best;
+}
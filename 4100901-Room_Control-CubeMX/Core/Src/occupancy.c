@@ -0,0 +1,57 @@
+#include "occupancy.h"
+#include <string.h>
+
+#define OCCUPANCY_WINDOW_MASK ((1ULL << OCCUPANCY_WINDOW_FRAMES) - 1ULL)
+
+bool occupancy_init(occupancy_t *occ)
+{
+    memset(occ->history, 0, sizeof(occ->history));
+    occ->fill = 0;
+    occ->noise_floor = 0.0f;
+    occ->activity = 0;
+    occ->frames = 0;
+    occ->last_active_frame = 0;
+    occ->occupied = false;
+    // Una ganancia uniforme de g dB en la magnitud suma g/20*ln(10) a cada log mel;
+    // con la DCT ortonormal coeffs[0] cambia sqrt(NUM_MEL) veces eso
+    occ->margin = OCCUPANCY_MARGIN_DB / 20.0f * logf(10.0f) * sqrtf((float32_t)MFCC_NUM_MEL);
+    return mfcc_init(&occ->mfcc);
+}
+
+bool occupancy_process(occupancy_t *occ, const int16_t *samples)
+{
+    // Desplazar la trama y agregar el bloque nuevo al final
+    memmove(occ->history, &occ->history[MFCC_FRAME_SHIFT],
+            (MFCC_FRAME_LEN - MFCC_FRAME_SHIFT) * sizeof(int16_t));
+    memcpy(&occ->history[MFCC_FRAME_LEN - MFCC_FRAME_SHIFT], samples, MFCC_FRAME_SHIFT * sizeof(int16_t));
+    if (occ->fill < MFCC_FRAME_LEN) {
+        occ->fill += MFCC_FRAME_SHIFT;
+        if (occ->fill < MFCC_FRAME_LEN) return false;
+    }
+
+    mfcc_compute(&occ->mfcc, occ->history, occ->coeffs);
+    float32_t energy = occ->coeffs[0];
+
+    if (occ->frames == 0 || energy < occ->noise_floor) {
+        occ->noise_floor = energy;
+    } else {
+        occ->noise_floor += (energy - occ->noise_floor) * OCCUPANCY_FLOOR_RISE;
+    }
+    bool active = energy > occ->noise_floor + occ->margin;
+    occ->activity = ((occ->activity << 1) | (active ? 1U : 0U)) & OCCUPANCY_WINDOW_MASK;
+    occ->frames++;
+
+    bool was_occupied = occ->occupied;
+    if (occupancy_active_frames(occ) >= OCCUPANCY_MIN_ACTIVE) {
+        occ->occupied = true;
+        occ->last_active_frame = occ->frames;
+    } else if (occ->occupied && occ->frames - occ->last_active_frame > OCCUPANCY_HOLD_FRAMES) {
+        occ->occupied = false;
+    }
+    return occ->occupied != was_occupied;
+}
+
+uint8_t occupancy_active_frames(const occupancy_t *occ)
+{
+    return (uint8_t)__builtin_popcountll(occ->activity);
+}
@@ -0,0 +1,23 @@
+#include "perf_counter.h"
+
+/**
+ * @brief Habilita el trazado (TRCENA) y arranca el contador de ciclos desde cero.
+ */
+void perf_counter_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Convierte ciclos a microsegundos.
+ * @param cycles Ciclos medidos con perf_counter_now().
+ * @return Tiempo equivalente en microsegundos.
+ */
+uint32_t perf_counter_cycles_to_us(uint32_t cycles)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    if (cycles_per_us == 0) return cycles;
+    return cycles / cycles_per_us;
+}
@@ -0,0 +1,84 @@
+#include "sram2.h"
+#include "main.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Symbols defined in the linker script */
+extern uint8_t _sdata, _ebss, _spool, _epool, _end, _estack;
+extern uint8_t _ssram2_text, _esram2_text;
+extern uint8_t _ssram2_bss, _esram2_bss;
+extern uint8_t _ssram2_noinit, _esram2_noinit;
+
+#define RAM_SIZE  (96U * 1024U)   // Debe coincidir con LENGTH(RAM) del linker
+#define RAM2_SIZE (32U * 1024U)   // Debe coincidir con LENGTH(RAM2) del linker
+
+static sram2_status_t sram2_status;
+
+/**
+ * @brief Captura el estado de SRAM2 y limpia la región retenida si no es confiable.
+ */
+void sram2_init(void)
+{
+    sram2_status.reset_flags = RCC->CSR;
+    __HAL_RCC_CLEAR_RESET_FLAGS();
+
+    sram2_status.parity_enabled = (FLASH->OPTR & FLASH_OPTR_SRAM2_PE) == 0;
+    sram2_status.erased_on_reset = (FLASH->OPTR & FLASH_OPTR_SRAM2_RST) == 0;
+
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+    sram2_status.parity_error = (SYSCFG->CFGR2 & SYSCFG_CFGR2_SPF) != 0;
+    if (sram2_status.parity_error) {
+        SYSCFG->CFGR2 |= SYSCFG_CFGR2_SPF; // La bandera se limpia escribiendo 1
+    }
+
+    // Tras un encendido o BOR el contenido de SRAM2 (y su paridad) es aleatorio
+    bool cold_boot = (sram2_status.reset_flags & RCC_CSR_BORRSTF) != 0;
+    sram2_status.retained_valid = !cold_boot && !sram2_status.erased_on_reset
+                                  && !sram2_status.parity_error;
+
+    if (!sram2_status.retained_valid) {
+        memset(&_ssram2_noinit, 0, (size_t)(&_esram2_noinit - &_ssram2_noinit));
+    }
+}
+
+const sram2_status_t *sram2_get_status(void)
+{
+    return &sram2_status;
+}
+
+/**
+ * @brief Imprime una línea del reporte de regiones.
+ */
+static void sram2_report_line(const char *name, const uint8_t *start, const uint8_t *end)
+{
+    printf("  %-14s 0x%08lx %6lu B\r\n", name, (unsigned long)(uintptr_t)start,
+           (unsigned long)(end - start));
+}
+
+/**
+ * @brief Reporte de uso por región.
+ */
+void sram2_report(void)
+{
+    extern void *_sbrk(ptrdiff_t incr);
+    uint8_t *heap_end = (uint8_t *)_sbrk(0);
+    uint32_t ram_used = (uint32_t)(heap_end - &_sdata);
+    uint32_t ram2_used = (uint32_t)(&_esram2_noinit - &_ssram2_text);
+
+    printf("RAM  (SRAM1) %lu/%lu B\r\n", (unsigned long)ram_used, (unsigned long)RAM_SIZE);
+    sram2_report_line(".data+.bss", &_sdata, &_ebss);
+    sram2_report_line(".mem_pool", &_spool, &_epool);
+    sram2_report_line("heap", &_end, heap_end);
+    printf("  %-14s 0x%08lx (tope)\r\n", "stack", (unsigned long)(uintptr_t)&_estack);
+
+    printf("RAM2 (SRAM2) %lu/%lu B\r\n", (unsigned long)ram2_used, (unsigned long)RAM2_SIZE);
+    sram2_report_line(".sram2_text", &_ssram2_text, &_esram2_text);
+    sram2_report_line(".sram2_bss", &_ssram2_bss, &_esram2_bss);
+    sram2_report_line(".sram2_noinit", &_ssram2_noinit, &_esram2_noinit);
+
+    printf("SRAM2: paridad=%s borrado_en_reset=%s error_paridad=%s retenido=%s\r\n",
+           sram2_status.parity_enabled ? "si" : "no",
+           sram2_status.erased_on_reset ? "si" : "no",
+           sram2_status.parity_error ? "si" : "no",
+           sram2_status.retained_valid ? "si" : "no");
+}
@@ -22,6 +22,9 @@
 #include "stm32l4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "flash_writer.h"
+#include "flash_port.h"
+#include "audio_capture.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -69,7 +72,10 @@ extern UART_HandleTypeDef huart2;
 void NMI_Handler(void)
 {
   /* USER CODE BEGIN NonMaskableInt_IRQn 0 */
-
+  // Error ECC doble esperado al recuperar journal/credenciales tras un corte
+  if (flash_port_ecc_nmi()) {
+    return;
+  }
   /* USER CODE END NonMaskableInt_IRQn 0 */
   /* USER CODE BEGIN NonMaskableInt_IRQn 1 */
    while (1)
@@ -246,4 +252,22 @@ void EXTI15_10_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles Flash global interrupt.
+  */
+void FLASH_IRQHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+  /* Con el HAL ya liberado, lanzar la siguiente operación en cola */
+  flash_writer_irq_handler();
+}
+
+/**
+  * @brief This function handles DMA1 channel1 global interrupt (ADC1, audio).
+  */
+void DMA1_Channel1_IRQHandler(void)
+{
+  audio_capture_irq_handler();
+}
+
 /* USER CODE END 1 */
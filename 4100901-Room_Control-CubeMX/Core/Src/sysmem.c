@@ -24,6 +24,7 @@
 #include <errno.h>
 #include <stdint.h>
 #include <stddef.h>
+#include "mem_monitor.h"
 
 /**
  * Pointer to the current high watermark of the heap usage
@@ -69,12 +70,14 @@ void *_sbrk(ptrdiff_t incr)
   /* Protect heap from growing into the reserved MSP stack */
   if (__sbrk_heap_end + incr > max_heap)
   {
+    mem_monitor_on_sbrk(incr, false);
     errno = ENOMEM;
     return (void *)-1;
   }
 
   prev_heap_end = __sbrk_heap_end;
   __sbrk_heap_end += incr;
+  mem_monitor_on_sbrk(incr, true);
 
   return (void *)prev_heap_end;
 }
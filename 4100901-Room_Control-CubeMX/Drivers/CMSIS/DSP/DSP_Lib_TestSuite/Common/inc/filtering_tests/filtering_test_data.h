@@ -20,6 +20,7 @@
 #define FILTERING_MAX_TAP_DELAY	0xFF
 #define FILTERING_MAX_L				3
 #define FILTERING_MAX_M				33
+#define FILTERING_MAX_NUMCHANNELS	8
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
@@ -51,6 +52,7 @@ ARR_DESC_DECLARE(filtering_postshifts);
 ARR_DESC_DECLARE(filtering_numstages);
 ARR_DESC_DECLARE(filtering_Ls);
 ARR_DESC_DECLARE(filtering_Ms);
+ARR_DESC_DECLARE(filtering_numchannels);
 
 /* Coefficient Lists */
 extern const float64_t filtering_coeffs_f64[FILTERING_MAX_NUMSTAGES * 6 + 2];
@@ -9,6 +9,7 @@ JTEST_DECLARE_GROUP(mean_tests);
 JTEST_DECLARE_GROUP(min_tests);
 JTEST_DECLARE_GROUP(power_tests);
 JTEST_DECLARE_GROUP(rms_tests);
+JTEST_DECLARE_GROUP(stats_window_tests);
 JTEST_DECLARE_GROUP(std_tests);
 JTEST_DECLARE_GROUP(var_tests);
 
@@ -113,6 +113,90 @@
    }
 
 
+/*
+ * The FUT filters two consecutive blocks of interleaved frames, so the state
+ * kept between calls is checked too. Each channel must match its own
+ * arm_biquad_cascade_df2T_f32 instance (checked against ref_biquad_cascade_df2T_f32
+ * by arm_biquad_cascade_df2T_f32_test): it runs on each de-interleaved channel,
+ * in place in filtering_scratch, over both blocks. Against the reference, the
+ * different rounding of the two orders of additions drifts below the f32 SNR
+ * threshold over 2 * FILTERING_MAX_BLOCKSIZE samples of the test coefficients.
+ */
+JTEST_DEFINE_TEST(arm_biquad_cascade_multichannel_df2T_f32_test,
+      arm_biquad_cascade_multichannel_df2T_f32)
+{
+   arm_biquad_cascade_multichannel_df2T_instance_f32 biquad_inst_fut = { 0 };
+   arm_biquad_cascade_df2T_instance_f32 biquad_inst_ref = { 0 };
+   float32_t *input = (float32_t *) filtering_f32_inputs;
+   float32_t *output_ref = (float32_t *) filtering_output_ref;
+   float32_t *channel = (float32_t *) filtering_scratch;
+   uint32_t ch, i;
+
+   TEMPLATE_DO_ARR_DESC(
+         blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+         ,
+      TEMPLATE_DO_ARR_DESC(
+            numstages_idx, uint16_t, numStages, filtering_numstages
+            ,
+         TEMPLATE_DO_ARR_DESC(
+               numchannels_idx, uint16_t, numChannels, filtering_numchannels
+               ,
+               /* Display test parameter values */
+               JTEST_DUMP_STRF("Block Size: %d\n"
+                               "Number of Stages: %d\n"
+                               "Number of Channels: %d\n",
+                               (int)blockSize,
+                               (int)numStages,
+                               (int)numChannels);
+
+               /* Initialize the BIQUAD Instance */
+               arm_biquad_cascade_multichannel_df2T_init_f32(
+                     &biquad_inst_fut, numStages, numChannels,
+                     (float32_t*)filtering_coeffs_b_f32,
+                     (void *) filtering_pState);
+
+               JTEST_COUNT_CYCLES(
+                     arm_biquad_cascade_multichannel_df2T_f32(
+                           &biquad_inst_fut,
+                           input,
+                           (float32_t *) filtering_output_fut,
+                           blockSize));
+
+               arm_biquad_cascade_multichannel_df2T_f32(
+                     &biquad_inst_fut,
+                     input + blockSize * numChannels,
+                     (float32_t *) filtering_output_fut + blockSize * numChannels,
+                     blockSize);
+
+               for (ch = 0; ch < numChannels; ch++)
+               {
+                  for (i = 0; i < 2 * blockSize; i++)
+                  {
+                     channel[i] = input[i * numChannels + ch];
+                  }
+
+                  arm_biquad_cascade_df2T_init_f32(
+                        &biquad_inst_ref, numStages,
+                        (float32_t*)filtering_coeffs_b_f32,
+                        (void *) filtering_scratch2);
+
+                  arm_biquad_cascade_df2T_f32(
+                        &biquad_inst_ref, channel, channel,
+                        2 * blockSize);
+
+                  for (i = 0; i < 2 * blockSize; i++)
+                  {
+                     output_ref[i * numChannels + ch] = channel[i];
+                  }
+               }
+
+               FILTERING_SNR_COMPARE_INTERFACE(
+                     2 * blockSize * numChannels,
+                     float32_t))));
+
+   return JTEST_TEST_PASSED;
+}
+
 JTEST_DEFINE_TEST(arm_biquad_cas_df1_32x64_q31_test,
       arm_biquad_cas_df1_32x64_q31)
 {
@@ -223,6 +307,10 @@ BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,,q15_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,_fast,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fast,q15_t);
 
+/* The fused variant has the same output as arm_biquad_cascade_df1_q15, bit for bit */
+#define ref_biquad_cascade_df1_fused_q15 ref_biquad_cascade_df1_q15
+BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fused,q15_t);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -235,10 +323,12 @@ JTEST_DEFINE_GROUP(biquad_tests)
    JTEST_TEST_CALL(arm_biquad_cascade_df1_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_stereo_df2T_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_multichannel_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f64_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q15_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q15_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df1_fused_q15_test);
    JTEST_TEST_CALL(arm_biquad_cas_df1_32x64_q31_test);
 }
@@ -339,6 +339,183 @@
             return JTEST_TEST_PASSED;                                   \
    }
 
+/*
+ * The FUT filters two consecutive blocks of interleaved frames, so the state
+ * kept between calls is checked too. The reference runs ref_fir on each
+ * de-interleaved channel (in place, in filtering_scratch) over both blocks.
+ */
+#define FIR_MULTICHANNEL_DEFINE_TEST(suffix, output_type)                     \
+   JTEST_DEFINE_TEST(arm_fir_multichannel_##suffix##_test,                    \
+         arm_fir_multichannel_##suffix)                                       \
+   {                                                                          \
+      arm_fir_multichannel_instance_##suffix fir_inst_fut = { 0 };            \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                         \
+      output_type *input = (output_type *) filtering_##suffix##_inputs;       \
+      output_type *output_ref = (output_type *) filtering_output_ref;         \
+      output_type *channel = (output_type *) filtering_scratch;               \
+      uint32_t ch, i;                                                         \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps              \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  numchannels_idx, uint16_t, numChannels,                     \
+                  filtering_numchannels                                       \
+                  ,                                                           \
+                  /* Display test parameter values */                         \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                                  "Number of Taps: %d\n"                      \
+                                  "Number of Channels: %d\n",                 \
+                                  (int)blockSize,                             \
+                                  (int)numTaps,                               \
+                                  (int)numChannels);                          \
+                                                                              \
+                  /* Initialize the FIR Instance */                           \
+                  arm_fir_multichannel_init_##suffix(                         \
+                        &fir_inst_fut, numChannels, numTaps,                  \
+                        (output_type*)filtering_coeffs_##suffix,              \
+                        (void *) filtering_pState, blockSize);                \
+                                                                              \
+                  JTEST_COUNT_CYCLES(                                         \
+                        arm_fir_multichannel_##suffix(                        \
+                              &fir_inst_fut,                                  \
+                              input,                                          \
+                              (output_type *) filtering_output_fut,           \
+                              blockSize));                                    \
+                                                                              \
+                  arm_fir_multichannel_##suffix(                              \
+                        &fir_inst_fut,                                        \
+                        input + blockSize * numChannels,                      \
+                        (output_type *) filtering_output_fut +                \
+                        blockSize * numChannels,                              \
+                        blockSize);                                           \
+                                                                              \
+                  for (ch = 0; ch < numChannels; ch++)                        \
+                  {                                                           \
+                     for (i = 0; i < 2 * blockSize; i++)                      \
+                     {                                                        \
+                        channel[i] = input[i * numChannels + ch];             \
+                     }                                                        \
+                                                                              \
+                     arm_fir_init_##suffix(                                   \
+                           &fir_inst_ref, numTaps,                            \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_scratch2, 2 * blockSize);       \
+                                                                              \
+                     ref_fir_##suffix(                                        \
+                           &fir_inst_ref, channel, channel,                   \
+                           2 * blockSize);                                    \
+                                                                              \
+                     for (i = 0; i < 2 * blockSize; i++)                      \
+                     {                                                        \
+                        output_ref[i * numChannels + ch] = channel[i];        \
+                     }                                                        \
+                  }                                                           \
+                                                                              \
+                  FILTERING_SNR_COMPARE_INTERFACE(                            \
+                        2 * blockSize * numChannels,                          \
+                        output_type))));                                      \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+/*
+ * The FUT converts two consecutive blocks, so the output position kept between
+ * calls is checked too. The reference zero-stuffs both blocks by L in place in
+ * filtering_output_ref, filters them with ref_fir and keeps samples M-1, 2M-1, ...
+ * (forward in place: the sample kept for output k is never before k).
+ */
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                         \
+      output_type *input = (output_type *) filtering_##suffix##_inputs;       \
+      output_type *output_ref = (output_type *) filtering_output_ref;         \
+      output_type *output_fut = (output_type *) filtering_output_fut;         \
+      uint32_t i, numOut, numUp;                                              \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                     "Number of Taps: %d\n"                   \
+                                     "Upsample factor: %d\n"                  \
+                                     "Decimation Factor: %d\n",               \
+                                     (int)blockSize,                          \
+                                     (int)numTaps,                            \
+                                     (int)L,                                  \
+                                     (int)M);                                 \
+                                                                              \
+                     /* Initialize the FIR Instance */                        \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_fut, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_scratch2, blockSize);           \
+                                                                              \
+                     JTEST_COUNT_CYCLES(                                      \
+                           numOut = arm_fir_resample_##suffix(                \
+                                 &fir_inst_fut,                               \
+                                 input,                                       \
+                                 output_fut,                                  \
+                                 blockSize));                                 \
+                                                                              \
+                     numOut += arm_fir_resample_##suffix(                     \
+                           &fir_inst_fut,                                     \
+                           input + blockSize,                                 \
+                           output_fut + numOut,                               \
+                           blockSize);                                        \
+                                                                              \
+                     numUp = 2 * blockSize * L;                               \
+                     for (i = 0; i < numUp; i++)                              \
+                     {                                                        \
+                        output_ref[i] = (i % L == 0) ? input[i / L] : 0;      \
+                     }                                                        \
+                                                                              \
+                     arm_fir_init_##suffix(                                   \
+                           &fir_inst_ref, numTaps,                            \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, numUp);                 \
+                                                                              \
+                     ref_fir_##suffix(                                        \
+                           &fir_inst_ref, output_ref, output_ref, numUp);     \
+                                                                              \
+                     for (i = 0; (i + 1) * M <= numUp; i++)                   \
+                     {                                                        \
+                        output_ref[i] = output_ref[(i + 1) * M - 1];          \
+                     }                                                        \
+                                                                              \
+                     if (numOut != i)                                         \
+                     {                                                        \
+                        JTEST_DUMP_STRF("Output count: %d, expected %d\n",    \
+                                        (int)numOut, (int)i);                 \
+                        return JTEST_TEST_FAILED;                             \
+                     }                                                        \
+                                                                              \
+                     if (numOut > 0)                                          \
+                     {                                                        \
+                        FILTERING_SNR_COMPARE_INTERFACE(                      \
+                              numOut,                                         \
+                              output_type);                                   \
+                     }))));                                                   \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
 FIR_DEFINE_TEST(f32,,float32_t);
 FIR_DEFINE_TEST(q31,,q31_t);
 FIR_DEFINE_TEST(q15,,q15_t);
@@ -346,6 +523,9 @@ FIR_DEFINE_TEST(q31,_fast,q31_t);
 FIR_DEFINE_TEST(q15,_fast,q15_t);
 FIR_DEFINE_TEST(q7,,q7_t);
 
+FIR_MULTICHANNEL_DEFINE_TEST(f32,float32_t);
+FIR_MULTICHANNEL_DEFINE_TEST(q15,q15_t);
+
 FIR_LATTICE_DEFINE_TEST(f32,float32_t);
 FIR_LATTICE_DEFINE_TEST(q31,q31_t);
 FIR_LATTICE_DEFINE_TEST(q15,q15_t);
@@ -360,6 +540,9 @@ FIR_DECIMATE_DEFINE_TEST(q15,,q15_t);
 FIR_DECIMATE_DEFINE_TEST(q31,_fast,q31_t);
 FIR_DECIMATE_DEFINE_TEST(q15,_fast,q15_t);
 
+FIR_RESAMPLE_DEFINE_TEST(f32,float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q15,q15_t);
+
 FIR_SPARSE_DEFINE_TEST(f32,float32_t);
 FIR_SPARSE_DEFINE_TEST(q31,q31_t);
 FIR_SPARSE2_DEFINE_TEST(q15,q15_t);
@@ -381,6 +564,9 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_multichannel_f32_test);
+   JTEST_TEST_CALL(arm_fir_multichannel_q15_test);
+
    JTEST_TEST_CALL(arm_fir_lattice_f32_test);
    JTEST_TEST_CALL(arm_fir_lattice_q31_test);
    JTEST_TEST_CALL(arm_fir_lattice_q15_test);
@@ -395,6 +581,9 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_decimate_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_decimate_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_resample_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_q15_test);
+
    JTEST_TEST_CALL(arm_fir_sparse_f32_test);
    JTEST_TEST_CALL(arm_fir_sparse_q31_test);
    JTEST_TEST_CALL(arm_fir_sparse_q15_test);
@@ -0,0 +1,120 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*
+ * Each input is streamed into the window in chunks of STATS_WINDOW_CHUNK
+ * samples (so windows shorter than a chunk are refilled by one call, and the
+ * window wraps in the middle of a chunk). Then each statistic of the window is
+ * compared with the reference function over the last min(windowLen, input
+ * length) samples; the window lengths are statistics_block_sizes.
+ */
+#define STATS_WINDOW_CHUNK 5
+
+static float32_t stats_window_input_f32[STATISTICS_MAX_INPUT_ELEMENTS];
+static q31_t stats_window_input_q31[STATISTICS_MAX_INPUT_ELEMENTS];
+static float32_t stats_window_buffer_f32[STATISTICS_MAX_INPUT_ELEMENTS];
+static q31_t stats_window_buffer_q31[STATISTICS_MAX_INPUT_ELEMENTS];
+static uint32_t stats_window_queue[2 * STATISTICS_MAX_INPUT_ELEMENTS];
+
+/* The inputs are float data: used as is for f32 and converted for q31 */
+#define STATS_WINDOW_CONVERT_f32(src, dst, len) memcpy(dst, src, (len) * sizeof(float32_t))
+#define STATS_WINDOW_CONVERT_q31(src, dst, len) arm_float_to_q31(src, dst, len)
+
+#define STATS_WINDOW_COMPARE_SNR(stat, suffix, type)                    \
+    do                                                                  \
+    {                                                                   \
+        arm_stats_window_##stat##_##suffix(                             \
+            &S, (type *) statistics_output_fut.data_ptr);               \
+        ref_##stat##_##suffix(                                          \
+            pWindow, numSamples, (type *) statistics_output_ref.data_ptr); \
+        STATISTICS_SNR_COMPARE_INTERFACE(1, type);                      \
+    } while (0)
+
+#define STATS_WINDOW_COMPARE_EXACT(stat, suffix, type)                  \
+    do                                                                  \
+    {                                                                   \
+        arm_stats_window_##stat##_##suffix(                             \
+            &S, (type *) statistics_output_fut.data_ptr,                \
+            &statistics_idx_fut);                                       \
+        ref_##stat##_##suffix(                                          \
+            pWindow, numSamples, (type *) statistics_output_ref.data_ptr, \
+            &statistics_idx_ref);                                       \
+        STATISTICS_COMPARE_INTERFACE(1, type);                          \
+    } while (0)
+
+#define JTEST_ARM_STATS_WINDOW_TEST(suffix)                             \
+    JTEST_DEFINE_TEST(arm_stats_window_##suffix##_test,                 \
+                      arm_stats_window_##suffix)                        \
+    {                                                                   \
+        arm_stats_window_instance_##suffix S;                           \
+        TYPE_FROM_ABBREV(suffix) *pInput = stats_window_input_##suffix; \
+        TYPE_FROM_ABBREV(suffix) *pWindow;                              \
+        uint32_t len, numSamples, pos, chunk;                           \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                window_idx, uint32_t, windowLen, statistics_block_sizes \
+                ,                                                       \
+                len = input_ptr->element_count;                         \
+                STATS_WINDOW_CONVERT_##suffix(                          \
+                    (float32_t *) input_ptr->data_ptr, pInput, len);    \
+                                                                        \
+                /* Display test parameter values */                     \
+                JTEST_DUMP_STRF("Input Length: %d\n"                    \
+                                "Window Length: %d\n",                  \
+                                (int)len,                               \
+                                (int)windowLen);                        \
+                                                                        \
+                arm_stats_window_init_##suffix(                         \
+                    &S, windowLen, stats_window_buffer_##suffix,        \
+                    stats_window_queue);                                \
+                                                                        \
+                for (pos = 0; pos < len; pos += chunk)                  \
+                {                                                       \
+                    chunk = (len - pos < STATS_WINDOW_CHUNK) ?          \
+                        len - pos : STATS_WINDOW_CHUNK;                 \
+                    arm_stats_window_##suffix(&S, pInput + pos, chunk); \
+                }                                                       \
+                                                                        \
+                numSamples = (len < windowLen) ? len : windowLen;       \
+                pWindow = pInput + len - numSamples;                    \
+                                                                        \
+                STATS_WINDOW_COMPARE_SNR(mean, suffix,                  \
+                                         TYPE_FROM_ABBREV(suffix));     \
+                STATS_WINDOW_COMPARE_SNR(var, suffix,                   \
+                                         TYPE_FROM_ABBREV(suffix));     \
+                STATS_WINDOW_COMPARE_SNR(std, suffix,                   \
+                                         TYPE_FROM_ABBREV(suffix));     \
+                STATS_WINDOW_COMPARE_SNR(rms, suffix,                   \
+                                         TYPE_FROM_ABBREV(suffix));     \
+                STATS_WINDOW_COMPARE_EXACT(max, suffix,                 \
+                                           TYPE_FROM_ABBREV(suffix));   \
+                STATS_WINDOW_COMPARE_EXACT(min, suffix,                 \
+                                           TYPE_FROM_ABBREV(suffix))));  \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_STATS_WINDOW_TEST(f32);
+JTEST_ARM_STATS_WINDOW_TEST(q31);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_window_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_window_f32_test);
+    JTEST_TEST_CALL(arm_stats_window_q31_test);
+}
@@ -122,6 +122,11 @@
    * It is not enabled by default when Neon is available because performances are 
    * dependent on the compiler and target architecture.
    *
+   * - ARM_MATH_X86_SIMD:
+   *
+   * Define macro ARM_MATH_X86_SIMD on x86-64 hosts to run the main f32 kernels with
+   * SSE4.1 or AVX2, selected at run time (see arm_x86_simd.h).
+   *
    * - ARM_MATH_NEON_EXPERIMENTAL:
    *
    * Define macro ARM_MATH_NEON_EXPERIMENTAL to enable experimental Neon versions of 
@@ -1372,6 +1377,95 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint16_t numChannels;     /**< number of interleaved channels sharing the coefficients. */
+          q15_t *pState;            /**< points to the interleaved state array of length (numTaps+blockSize-1)*numChannels. */
+    const q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multichannel_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint16_t numChannels;     /**< number of interleaved channels sharing the coefficients. */
+          float32_t *pState;        /**< points to the interleaved state array of length (numTaps+blockSize-1)*numChannels. */
+    const float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+          uint32_t blockSize;       /**< frames per call given to the init function. Sets the state layout with fewer than four channels. */
+  } arm_fir_multichannel_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]  pSrc       points to blockSize interleaved frames of numChannels samples.
+   * @param[out] pDst       points to blockSize interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_fir_multichannel_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of frames that are processed at a time.
+   * @return     The function returns either
+   * <code>ARM_MATH_SUCCESS</code> if initialization was successful or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numChannels</code> or <code>numTaps</code> is zero.
+   */
+  arm_status arm_fir_multichannel_init_q15(
+        arm_fir_multichannel_instance_q15 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]  pSrc       points to blockSize interleaved frames of numChannels samples.
+   * @param[out] pDst       points to blockSize interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_fir_multichannel_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of frames that are processed at a time.
+   * @return     The function returns either
+   * <code>ARM_MATH_SUCCESS</code> if initialization was successful or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numChannels</code> or <code>numTaps</code> is zero.
+   */
+  arm_status arm_fir_multichannel_init_f32(
+        arm_fir_multichannel_instance_f32 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1445,6 +1539,51 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
         q15_t * pDst,
         uint32_t blockSize);
 
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter, all stages per tile of samples.
+   *        Bit-exact with arm_biquad_cascade_df1_q15(); the block is read and written once.
+   * @param[in]  S          points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df1_fused_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Design-time ordering and scaling of second order sections against overflow.
+   * @param[in,out] pSos       points to numStages sections {b0, b1, b2, a1, a2}, reordered and scaled in place.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     numFreqs   number of frequencies in [0, pi] where the responses are evaluated.
+   * @param[out]    pGain      gain to apply to the output of the scaled cascade to restore the original response.
+   * @return     The function returns ARM_MATH_SUCCESS, or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numStages</code> is zero, <code>numFreqs</code> is less than 2,
+   * a section is not stable or a partial cascade has no gain.
+   */
+  arm_status arm_biquad_sos_order_scale_f32(
+        float32_t * pSos,
+        uint8_t numStages,
+        uint16_t numFreqs,
+        float32_t * pGain);
+
+  /**
+   * @brief  Conversion of floating-point second order sections to Q15 Biquad cascade coefficients.
+   * @param[in]  pSos        points to numStages sections {b0, b1, b2, a1, a2}.
+   * @param[in]  numStages   number of 2nd order stages in the filter.
+   * @param[out] pCoeffs     points to the numStages*6 coefficients {b0, 0, b1, b2, a1, a2}.
+   * @param[out] pPostShift  smallest shift that fits every coefficient in 1.15 format.
+   * @return     The function returns ARM_MATH_SUCCESS, or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if a coefficient needs a shift larger than 14.
+   */
+  arm_status arm_biquad_sos_to_q15(
+  const float32_t * pSos,
+        uint8_t numStages,
+        q15_t * pCoeffs,
+        int8_t * pPostShift);
+
   /**
    * @brief Processing function for the Q31 Biquad cascade filter
    * @param[in]  S          points to an instance of the Q31 Biquad cascade structure.
@@ -2277,6 +2416,21 @@ void arm_cfft_q31(
         uint8_t ifftFlag,
         uint8_t bitReverseFlag);
 
+  /**
+   * @brief Arena size (bytes) for arm_cfft_init_dyn_f32; 0 for unsupported lengths.
+   */
+  uint32_t arm_cfft_init_dyn_size_f32(
+        uint16_t fftLen);
+
+  /**
+   * @brief CFFT initialization with twiddle and bit reversal tables generated in RAM.
+   */
+  arm_status arm_cfft_init_dyn_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen,
+        void * pArena,
+        uint32_t arenaSize);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2384,12 +2538,127 @@ arm_status arm_rfft_2048_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
 
 arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
 
+  /**
+   * @brief Arena size (bytes) for arm_rfft_fast_init_dyn_f32; 0 for unsupported lengths.
+   */
+  uint32_t arm_rfft_fast_init_dyn_size_f32(
+        uint16_t fftLen);
+
+  /**
+   * @brief Real FFT initialization with all its tables generated in RAM.
+   */
+  arm_status arm_rfft_fast_init_dyn_f32(
+        arm_rfft_fast_instance_f32 * S,
+        uint16_t fftLen,
+        void * pArena,
+        uint32_t arenaSize);
+
 
   void arm_rfft_fast_f32(
         arm_rfft_fast_instance_f32 * S,
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+#define ARM_CFFT_MIXED_MAX_STAGES 16U  /**< radix stages of the longest mixed-radix length (2^16) */
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix (2, 3, 4, 5, 8) CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                                 /**< length of the FFT. */
+          uint8_t numStages;                               /**< number of radix stages. */
+          uint8_t pFactors[ARM_CFFT_MIXED_MAX_STAGES];     /**< radix of each stage, outermost first. */
+    const float32_t *pTwiddle;                             /**< points to the Twiddle factor table (2*fftLen values). */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle);
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          arm_cfft_mixed_instance_f32 Sint;  /**< Internal CFFT structure (fftLenRFFT/2 points). */
+          uint16_t fftLenRFFT;               /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;          /**< Twiddle factors real stage  */
+  } arm_rfft_mixed_instance_f32 ;
+
+  arm_status arm_rfft_mixed_init_f32(
+        arm_rfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle);
+
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Number of frequency-domain partitions of a numTaps filter split in blocks of blockSize taps.
+   */
+#define ARM_FIR_FFT_NUM_PARTITIONS(numTaps, blockSize) (((numTaps) + (blockSize) - 1U) / (blockSize))
+
+  /**
+   * @brief Length, in float32_t values, of the state buffer of arm_fir_fft_init_f32().
+   */
+#define ARM_FIR_FFT_STATE_LEN_F32(numTaps, blockSize) \
+  ((4U * ARM_FIR_FFT_NUM_PARTITIONS(numTaps, blockSize) + 5U) * (blockSize))
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FFT (overlap-save) FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                /**< number of filter coefficients in the filter. */
+          uint16_t blockSize;              /**< partition length: samples per FFT block and taps per partition. */
+          uint16_t numPartitions;          /**< number of filter partitions, ceil(numTaps/blockSize). */
+          uint16_t head;                   /**< slot of the newest input spectrum in the frequency-domain delay line. */
+          float32_t *pState;               /**< points to the state array of ARM_FIR_FFT_STATE_LEN_F32(numTaps, blockSize) values. */
+          arm_rfft_fast_instance_f32 rfft; /**< real FFT of 2*blockSize points. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in the order of arm_fir_init_f32().
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  partition length, a power of 2 from 16 to 2048.
+   * @return     The function returns either
+   * <code>ARM_MATH_SUCCESS</code> if initialization was successful or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numTaps</code> is zero or there is no real FFT of <code>2*blockSize</code> points.
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of the partition length.
+   */
+  void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3705,6 +3974,110 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Largest number of output samples of one call to arm_fir_resample_f32() or arm_fir_resample_q15().
+   */
+#define ARM_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize) ((((uint32_t) (blockSize) * (L)) + (M) - 1U) / (M))
+
+  /**
+   * @brief Instance structure for the Q15 rational (L/M) FIR sample rate converter.
+   */
+  typedef struct
+  {
+          uint16_t L;                  /**< upsample factor. */
+          uint16_t M;                  /**< downsample factor. */
+          uint16_t phaseLength;        /**< length of each polyphase filter component. */
+    const q15_t *pCoeffs;              /**< points to the coefficient array. The array is of length L*phaseLength. */
+          q15_t *pState;               /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+          uint32_t position;           /**< position of the next output, at the upsampled rate, from the first sample of the next block. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point rational (L/M) FIR sample rate converter.
+   */
+  typedef struct
+  {
+          uint16_t L;                  /**< upsample factor. */
+          uint16_t M;                  /**< downsample factor. */
+          uint16_t phaseLength;        /**< length of each polyphase filter component. */
+    const float32_t *pCoeffs;          /**< points to the coefficient array. The array is of length L*phaseLength. */
+          float32_t *pState;           /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+          uint32_t position;           /**< position of the next output, at the upsampled rate, from the first sample of the next block. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 rational FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the Q15 FIR sample rate converter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize) samples.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 rational FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the Q15 FIR sample rate converter structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not a
+   * nonzero multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+        arm_fir_resample_instance_q15 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point rational FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point FIR sample rate converter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize) samples.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point rational FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point FIR sample rate converter structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not a
+   * nonzero multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3765,6 +4138,17 @@ arm_status arm_fir_decimate_init_f32(
     const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels sharing the coefficients. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multichannel_df2T_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -3804,6 +4188,20 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to blockSize frames of numChannels interleaved samples.
+   * @param[out] pDst       points to blockSize frames of numChannels interleaved outputs.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_multichannel_df2T_f32(
+  const arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in]  S          points to an instance of the filter data structure.
@@ -3852,6 +4250,24 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all the channels.
+   * @param[in]     pState       points to the state buffer.
+   * @return     The function returns ARM_MATH_SUCCESS, or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numStages</code> or <code>numChannels</code> is zero.
+   */
+  arm_status arm_biquad_cascade_multichannel_df2T_init_f32(
+        arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -6440,6 +6856,184 @@ arm_status arm_sqrt_q15(
         q15_t * pResult);
 
 
+  /**
+   * @brief Instance structure for the floating-point sliding-window statistics.
+   */
+  typedef struct
+  {
+    uint32_t windowLen;              /**< window length in samples. */
+    uint32_t numSamples;             /**< samples currently in the window (up to windowLen). */
+    uint32_t writeIndex;             /**< slot of pBuffer that receives the next sample. */
+    float32_t *pBuffer;              /**< points to the window, a circular buffer of windowLen samples. */
+    uint32_t *pQueue;                /**< points to the max and min queues of pBuffer slots, 2*windowLen words. */
+    uint32_t maxHead;                /**< first entry of the max queue (pQueue[0..windowLen-1]). */
+    uint32_t maxCount;               /**< entries in the max queue. */
+    uint32_t minHead;                /**< first entry of the min queue (pQueue[windowLen..2*windowLen-1]). */
+    uint32_t minCount;               /**< entries in the min queue. */
+    float32_t mean;                  /**< running mean of the window. */
+    float32_t m2;                    /**< running sum of squared deviations from the mean. */
+    float32_t sumOfSquares;          /**< running sum of squares of the window. */
+    float32_t passMean;              /**< mean of the samples of the current pass over pBuffer. */
+    float32_t passM2;                /**< sum of squared deviations from passMean. */
+    float32_t passSquares;           /**< sum of squares of the samples of the pass. */
+  } arm_stats_window_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding-window statistics.
+   */
+  typedef struct
+  {
+    uint32_t windowLen;              /**< window length in samples. */
+    uint32_t numSamples;             /**< samples currently in the window (up to windowLen). */
+    uint32_t writeIndex;             /**< slot of pBuffer that receives the next sample. */
+    q31_t *pBuffer;                  /**< points to the window, a circular buffer of windowLen samples. */
+    uint32_t *pQueue;                /**< points to the max and min queues of pBuffer slots, 2*windowLen words. */
+    uint32_t maxHead;                /**< first entry of the max queue (pQueue[0..windowLen-1]). */
+    uint32_t maxCount;               /**< entries in the max queue. */
+    uint32_t minHead;                /**< first entry of the min queue (pQueue[windowLen..2*windowLen-1]). */
+    uint32_t minCount;               /**< entries in the min queue. */
+    q63_t sum;                       /**< running sum of the window in 33.31 format. */
+    q63_t sumShifted;                /**< running sum of the samples in 1.23 format (as arm_var_q31). */
+    q63_t sumOfSquares;              /**< running sum of squares of the 1.23 samples in 17.46 format. */
+  } arm_stats_window_instance_q31;
+
+
+  /**
+   * @brief  Initialization function for the floating-point sliding-window statistics.
+   * @param[in,out] S          points to an instance of the floating-point sliding-window statistics structure.
+   * @param[in]     windowLen  window length in samples.
+   * @param[in]     pBuffer    points to the window buffer of windowLen samples.
+   * @param[in]     pQueue     points to the min/max queue buffer of 2*windowLen words.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : windowLen is 0
+   */
+  arm_status arm_stats_window_init_f32(
+        arm_stats_window_instance_f32 * S,
+        uint32_t windowLen,
+        float32_t * pBuffer,
+        uint32_t * pQueue);
+
+
+  /**
+   * @brief  Initialization function for the Q31 sliding-window statistics.
+   * @param[in,out] S          points to an instance of the Q31 sliding-window statistics structure.
+   * @param[in]     windowLen  window length in samples.
+   * @param[in]     pBuffer    points to the window buffer of windowLen samples.
+   * @param[in]     pQueue     points to the min/max queue buffer of 2*windowLen words.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : windowLen is 0 or greater than 65536
+   */
+  arm_status arm_stats_window_init_q31(
+        arm_stats_window_instance_q31 * S,
+        uint32_t windowLen,
+        q31_t * pBuffer,
+        uint32_t * pQueue);
+
+
+  /**
+   * @brief  Adds samples to the floating-point sliding window, dropping the oldest ones.
+   * @param[in,out] S          points to an instance of the floating-point sliding-window statistics structure.
+   * @param[in]     pSrc       points to the new samples.
+   * @param[in]     blockSize  number of samples to add.
+   */
+  void arm_stats_window_f32(
+        arm_stats_window_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Adds samples to the Q31 sliding window, dropping the oldest ones.
+   * @param[in,out] S          points to an instance of the Q31 sliding-window statistics structure.
+   * @param[in]     pSrc       points to the new samples.
+   * @param[in]     blockSize  number of samples to add.
+   */
+  void arm_stats_window_q31(
+        arm_stats_window_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Mean, variance, standard deviation and RMS of the floating-point sliding window.
+   * @param[in]  S  points to an instance of the floating-point sliding-window statistics structure.
+   * @param[out] pResult  value returned here.
+   */
+  void arm_stats_window_mean_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult);
+
+  void arm_stats_window_var_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult);
+
+  void arm_stats_window_std_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult);
+
+  void arm_stats_window_rms_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult);
+
+
+  /**
+   * @brief  Maximum and minimum of the floating-point sliding window.
+   * @param[in]  S        points to an instance of the floating-point sliding-window statistics structure.
+   * @param[out] pResult  value returned here.
+   * @param[out] pIndex   position in the window returned here (0 is the oldest sample).
+   */
+  void arm_stats_window_max_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex);
+
+  void arm_stats_window_min_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex);
+
+
+  /**
+   * @brief  Mean, variance, standard deviation and RMS of the Q31 sliding window.
+   * @param[in]  S  points to an instance of the Q31 sliding-window statistics structure.
+   * @param[out] pResult  value returned here.
+   */
+  void arm_stats_window_mean_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult);
+
+  void arm_stats_window_var_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult);
+
+  void arm_stats_window_std_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult);
+
+  void arm_stats_window_rms_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult);
+
+
+  /**
+   * @brief  Maximum and minimum of the Q31 sliding window.
+   * @param[in]  S        points to an instance of the Q31 sliding-window statistics structure.
+   * @param[out] pResult  value returned here.
+   * @param[out] pIndex   position in the window returned here (0 is the oldest sample).
+   */
+  void arm_stats_window_max_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex);
+
+  void arm_stats_window_min_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex);
+
+
   /**
    * @brief  Floating-point complex magnitude
    * @param[in]  pSrc        points to the complex input vector
@@ -7331,6 +7925,10 @@ arm_status arm_sqrt_q15(
 }
 #endif
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 /* Compiler specific diagnostic adjustment */
 #if   defined ( __CC_ARM )
 
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_simd.h
+ * Description:  x86-64 SSE4.1/AVX2 backend for f32 kernels (host builds)
+ *
+ * Target Processor: x86-64 hosts (GCC / Clang)
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_X86_SIMD_H
+#define _ARM_X86_SIMD_H
+
+/* Included at the end of arm_math.h when ARM_MATH_X86_SIMD is defined */
+
+#if !(defined(__x86_64__) || defined(__i386__)) || !(defined(__GNUC__) || defined(__clang__))
+  #error "ARM_MATH_X86_SIMD requires an x86 host and GCC or Clang"
+#endif
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Instruction set used by the f32 kernels built with ARM_MATH_X86_SIMD.
+   *
+   * The library is compiled for the baseline x86-64 ISA; the SSE4.1 and AVX2+FMA
+   * variants are compiled with function target attributes and selected at run
+   * time, so the same binary runs on any x86-64 server.
+   */
+  typedef enum
+  {
+    ARM_X86_SIMD_NONE  = 0,      /**< Generic C path of the library */
+    ARM_X86_SIMD_SSE41 = 1,      /**< 4-lane SSE4.1 */
+    ARM_X86_SIMD_AVX2  = 2       /**< 8-lane AVX2 with FMA */
+  } arm_x86_simd_level_t;
+
+  /**
+   * @brief  Level in use: the best one supported by the CPU unless forced.
+   */
+  arm_x86_simd_level_t arm_x86_simd_level(void);
+
+  /**
+   * @brief  Forces a level (clamped to what the CPU supports), e.g. to compare paths.
+   * @return level actually selected
+   */
+  arm_x86_simd_level_t arm_x86_simd_set_level(arm_x86_simd_level_t level);
+
+  /**
+   * @brief  Best level supported by the CPU.
+   */
+  arm_x86_simd_level_t arm_x86_simd_supported(void);
+
+  /**
+   * @brief  Printable name of a level.
+   */
+  const char *arm_x86_simd_name(arm_x86_simd_level_t level);
+
+  /*
+   * Vector implementations. The public kernels call them when arm_x86_simd_level()
+   * is not ARM_X86_SIMD_NONE, except arm_add_f32 and arm_cmplx_mag_squared_f32,
+   * which call them only at ARM_X86_SIMD_AVX2: at SSE4.1 the compiler's SSE
+   * vectorization of the C path is faster. Reductions (dot product, power, variance, FIR,
+   * matrix product) add in a different order than the C path and AVX2 uses FMA,
+   * so results match within float rounding rather than bit for bit; the
+   * element-wise kernels and the multi-channel biquad (one channel per lane,
+   * no FMA) are bit-exact.
+   */
+  void arm_add_f32_x86(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+  void arm_mult_f32_x86(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+  void arm_scale_f32_x86(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize);
+  void arm_dot_prod_f32_x86(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result);
+  void arm_mean_f32_x86(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+  void arm_power_f32_x86(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+  void arm_var_f32_x86(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+  void arm_cmplx_mag_f32_x86(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+  void arm_cmplx_mag_squared_f32_x86(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+  void arm_fir_f32_x86(const arm_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+  void arm_biquad_cascade_multichannel_df2T_f32_x86(const arm_biquad_cascade_multichannel_df2T_instance_f32 *S,
+                                                    const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+  arm_status arm_mat_mult_f32_x86(const arm_matrix_instance_f32 *pSrcA,
+                                  const arm_matrix_instance_f32 *pSrcB,
+                                  arm_matrix_instance_f32 *pDst);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_X86_SIMD_H */
@@ -64,6 +64,15 @@ void arm_add_f32(
         float32_t * pDst,
         uint32_t blockSize)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  /* Only AVX2: the generic C path is already auto-vectorized to SSE and beats SSE4.1 */
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2)
+  {
+    arm_add_f32_x86(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
         uint32_t blkCnt;                               /* Loop counter */
 
 #if defined(ARM_MATH_NEON)
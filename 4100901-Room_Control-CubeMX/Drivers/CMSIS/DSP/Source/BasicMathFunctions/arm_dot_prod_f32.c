@@ -65,6 +65,14 @@ void arm_dot_prod_f32(
         uint32_t blockSize,
         float32_t * result)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_dot_prod_f32_x86(pSrcA, pSrcB, blockSize, result);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
         uint32_t blkCnt;                               /* Loop counter */
         float32_t sum = 0.0f;                          /* Temporary return variable */
 
@@ -64,6 +64,14 @@ void arm_mult_f32(
         float32_t * pDst,
         uint32_t blockSize)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_mult_f32_x86(pSrcA, pSrcB, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
     uint32_t blkCnt;                               /* Loop counter */
 
 #if defined(ARM_MATH_NEON)
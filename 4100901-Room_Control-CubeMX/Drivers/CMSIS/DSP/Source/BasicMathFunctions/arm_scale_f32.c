@@ -79,6 +79,14 @@ void arm_scale_f32(
         float32_t *pDst,
         uint32_t blockSize)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_scale_f32_x86(pSrc, scale, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
   uint32_t blkCnt;                               /* Loop counter */
 #if defined(ARM_MATH_NEON_EXPERIMENTAL)
     float32x4_t vec1;
@@ -74,6 +74,14 @@ void arm_cmplx_mag_f32(
         float32_t * pDst,
         uint32_t numSamples)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_cmplx_mag_f32_x86(pSrc, pDst, numSamples);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
   uint32_t blkCnt;                               /* loop counter */
   float32_t real, imag;                      /* Temporary variables to hold input values */
 
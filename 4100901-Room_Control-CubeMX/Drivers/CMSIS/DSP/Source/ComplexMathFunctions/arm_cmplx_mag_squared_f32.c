@@ -74,6 +74,15 @@ void arm_cmplx_mag_squared_f32(
         float32_t * pDst,
         uint32_t numSamples)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  /* Only AVX2: the generic C path is already auto-vectorized to SSE and beats SSE4.1 */
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2)
+  {
+    arm_cmplx_mag_squared_f32_x86(pSrc, pDst, numSamples);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
         uint32_t blkCnt;                               /* Loop counter */
         float32_t real, imag;                          /* Temporary input variables */
 
@@ -31,6 +31,7 @@
 #include "arm_biquad_cascade_df1_f32.c"
 #include "arm_biquad_cascade_df1_fast_q15.c"
 #include "arm_biquad_cascade_df1_fast_q31.c"
+#include "arm_biquad_cascade_df1_fused_q15.c"
 #include "arm_biquad_cascade_df1_init_f32.c"
 #include "arm_biquad_cascade_df1_init_q15.c"
 #include "arm_biquad_cascade_df1_init_q31.c"
@@ -40,8 +41,12 @@
 #include "arm_biquad_cascade_df2T_f64.c"
 #include "arm_biquad_cascade_df2T_init_f32.c"
 #include "arm_biquad_cascade_df2T_init_f64.c"
+#include "arm_biquad_cascade_multichannel_df2T_f32.c"
+#include "arm_biquad_cascade_multichannel_df2T_init_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
+#include "arm_biquad_sos_order_scale_f32.c"
+#include "arm_biquad_sos_to_q15.c"
 #include "arm_conv_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
@@ -80,6 +85,8 @@
 #include "arm_fir_f32.c"
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
+#include "arm_fir_fft_f32.c"
+#include "arm_fir_fft_init_f32.c"
 #include "arm_fir_init_f32.c"
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
@@ -96,9 +103,17 @@
 #include "arm_fir_lattice_init_q31.c"
 #include "arm_fir_lattice_q15.c"
 #include "arm_fir_lattice_q31.c"
+#include "arm_fir_multichannel_f32.c"
+#include "arm_fir_multichannel_init_f32.c"
+#include "arm_fir_multichannel_init_q15.c"
+#include "arm_fir_multichannel_q15.c"
 #include "arm_fir_q15.c"
 #include "arm_fir_q31.c"
 #include "arm_fir_q7.c"
+#include "arm_fir_resample_f32.c"
+#include "arm_fir_resample_init_f32.c"
+#include "arm_fir_resample_init_q15.c"
+#include "arm_fir_resample_q15.c"
 #include "arm_fir_sparse_f32.c"
 #include "arm_fir_sparse_init_f32.c"
 #include "arm_fir_sparse_init_q15.c"
@@ -0,0 +1,297 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df1_fused_q15.c
+ * Description:  Processing function for the Q15 Biquad cascade DirectFormI(DF1) filter, all stages per tile of samples
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Samples carried through all the stages at a time (even, for the packed pairs) */
+#define ARM_BIQUAD_DF1_FUSED_TILE 8U
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 Biquad cascade filter, all stages per tile of samples.
+  @param[in]     S         points to an instance of the Q15 Biquad cascade structure
+  @param[in]     pSrc      points to the block of input data
+  @param[out]    pDst      points to the location where the output result is written
+  @param[in]     blockSize number of samples to process
+  @return        none
+
+  @par           Details
+                   Same instance, arithmetic and output, bit for bit, as \ref arm_biquad_cascade_df1_q15().
+                   Instead of running each stage over the whole block and writing its output to
+                   <code>pDst</code> for the next stage to read back, the samples are taken
+                   ARM_BIQUAD_DF1_FUSED_TILE at a time through all the stages in local variables:
+                   the block is read and written once, whatever <code>numStages</code> is, at the cost
+                   of reloading the coefficients and state of each stage once per tile.
+  @par
+                   <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+  @par           Scaling and Overflow Behavior
+                   Same as \ref arm_biquad_cascade_df1_q15(): each stage output is saturated to 1.15,
+                   so the order and scaling of the sections decide where a cascade clips.
+                   \ref arm_biquad_sos_order_scale_f32() and \ref arm_biquad_sos_to_q15() choose them at design time.
+ */
+void arm_biquad_cascade_df1_fused_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  const q15_t *pIn = pSrc;                             /* Source pointer */
+        q15_t *pOut = pDst;                            /* Destination pointer */
+        q15_t *pState;                                 /* State pointer */
+  const q15_t *pCoeffs;                                /* Coefficient pointer */
+        uint32_t tileLen;                              /* Samples in the current tile */
+        uint32_t i, stage;                             /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+        q31_t tile[ARM_BIQUAD_DF1_FUSED_TILE / 2U];    /* Tile samples, packed in pairs */
+        q31_t in;                                      /* Temporary variable to hold input value */
+        q31_t out;                                     /* Temporary variable to hold output value */
+        q31_t b0;                                      /* Temporary variable to hold bo value */
+        q31_t b1, a1;                                  /* Filter coefficients */
+        q31_t state_in, state_out;                     /* Filter state variables */
+        q31_t acc_l, acc_h;
+        q63_t acc;                                     /* Accumulator */
+        int32_t lShift = (15 - (int32_t) S->postShift);       /* Post shift */
+        int32_t uShift = (32 - lShift);
+        uint32_t numPairs;                             /* Sample pairs in the current tile */
+
+  while (blockSize > 0U)
+  {
+    tileLen = (blockSize < ARM_BIQUAD_DF1_FUSED_TILE) ? blockSize : ARM_BIQUAD_DF1_FUSED_TILE;
+    numPairs = tileLen >> 1U;
+
+    for (i = 0U; i < numPairs; i++)
+    {
+      tile[i] = read_q15x2_ia ((q15_t **) &pIn);
+    }
+
+    /* Odd last sample of the block: alone, as in arm_biquad_cascade_df1_q15() */
+    if ((tileLen & 0x1U) != 0U)
+    {
+      tile[numPairs] = *pIn++;
+    }
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+
+    for (stage = S->numStages; stage > 0U; stage--)
+    {
+      /* Read the b0 and 0 coefficients using SIMD  */
+      b0 = read_q15x2_ia ((q15_t **) &pCoeffs);
+
+      /* Read the b1 and b2 coefficients using SIMD */
+      b1 = read_q15x2_ia ((q15_t **) &pCoeffs);
+
+      /* Read the a1 and a2 coefficients using SIMD */
+      a1 = read_q15x2_ia ((q15_t **) &pCoeffs);
+
+      /* Read the input state values from the state buffer:  x[n-1], x[n-2] */
+      state_in = read_q15x2_ia (&pState);
+
+      /* Read the output state values from the state buffer:  y[n-1], y[n-2] */
+      state_out = read_q15x2_da (&pState);
+
+      for (i = 0U; i < numPairs; i++)
+      {
+        in = tile[i];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        out = __SMUAD(b0, in);
+        acc = __SMLALD(b1, state_in, out);
+        acc = __SMLALD(a1, state_out, acc);
+
+        /* The result is converted from 3.29 to 1.31 if postShift = 1, and then saturation is applied */
+        acc_l = acc & 0xffffffff;
+        acc_h = (acc >> 32) & 0xffffffff;
+        out = (uint32_t) acc_l >> lShift | acc_h << uShift;
+        out = __SSAT(out, 16);
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+        state_in  = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+#else
+        state_in  = __PKHBT(state_in >> 16, (in >> 16), 16);
+        state_out = __PKHBT(state_out >> 16, (out), 16);
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+
+        /* Second sample of the pair */
+        out = __SMUADX(b0, in);
+        acc = __SMLALD(b1, state_in, out);
+        acc = __SMLALD(a1, state_out, acc);
+
+        acc_l = acc & 0xffffffff;
+        acc_h = (acc >> 32) & 0xffffffff;
+        out = (uint32_t) acc_l >> lShift | acc_h << uShift;
+        out = __SSAT(out, 16);
+
+        /* The pair of outputs is the input of the next stage */
+#ifndef  ARM_MATH_BIG_ENDIAN
+        tile[i] = __PKHBT(state_out, out, 16);
+        state_in  = __PKHBT(in >> 16, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+#else
+        tile[i] = __PKHBT(out, state_out >> 16, 16);
+        state_in  = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+      }
+
+      if ((tileLen & 0x1U) != 0U)
+      {
+        in = tile[numPairs];
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+        out = __SMUAD(b0, in);
+#else
+        out = __SMUADX(b0, in);
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+        acc = __SMLALD(b1, state_in, out);
+        acc = __SMLALD(a1, state_out, acc);
+
+        acc_l = acc & 0xffffffff;
+        acc_h = (acc >> 32) & 0xffffffff;
+        out = (uint32_t) acc_l >> lShift | acc_h << uShift;
+        out = __SSAT(out, 16);
+
+        tile[numPairs] = out;
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+#else
+        state_in = __PKHBT(state_in >> 16, in, 16);
+        state_out = __PKHBT(state_out >> 16, out, 16);
+#endif /* #ifndef  ARM_MATH_BIG_ENDIAN */
+      }
+
+      /* Store the updated state variables back into the state array */
+      write_q15x2_ia (&pState, state_in);
+      write_q15x2_ia (&pState, state_out);
+    }
+
+    for (i = 0U; i < numPairs; i++)
+    {
+      write_q15x2_ia (&pOut, tile[i]);
+    }
+
+    if ((tileLen & 0x1U) != 0U)
+    {
+      *pOut++ = (q15_t) tile[numPairs];
+    }
+
+    blockSize -= tileLen;
+  }
+
+#else
+
+        q15_t tile[ARM_BIQUAD_DF1_FUSED_TILE];         /* Tile samples */
+        q15_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+        q15_t Xn1, Xn2, Yn1, Yn2;                      /* Filter state variables */
+        q15_t Xn;                                      /* temporary input */
+        q63_t acc;                                     /* Accumulator */
+        int32_t shift = (15 - (int32_t) S->postShift); /* Post shift */
+
+  while (blockSize > 0U)
+  {
+    tileLen = (blockSize < ARM_BIQUAD_DF1_FUSED_TILE) ? blockSize : ARM_BIQUAD_DF1_FUSED_TILE;
+
+    for (i = 0U; i < tileLen; i++)
+    {
+      tile[i] = *pIn++;
+    }
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+
+    for (stage = S->numStages; stage > 0U; stage--)
+    {
+      /* Reading the coefficients */
+      b0 = *pCoeffs++;
+      pCoeffs++;  // skip the 0 coefficient
+      b1 = *pCoeffs++;
+      b2 = *pCoeffs++;
+      a1 = *pCoeffs++;
+      a2 = *pCoeffs++;
+
+      /* Reading the state values */
+      Xn1 = pState[0];
+      Xn2 = pState[1];
+      Yn1 = pState[2];
+      Yn2 = pState[3];
+
+      for (i = 0U; i < tileLen; i++)
+      {
+        Xn = tile[i];
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc  = (q31_t) b0 * Xn;
+        acc += (q31_t) b1 * Xn1;
+        acc += (q31_t) b2 * Xn2;
+        acc += (q31_t) a1 * Yn1;
+        acc += (q31_t) a2 * Yn2;
+
+        /* The result is converted to 1.15 */
+        acc = __SSAT((acc >> shift), 16);
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) acc;
+
+        /* The output is the input of the next stage */
+        tile[i] = (q15_t) acc;
+      }
+
+      /* Store the updated state variables back into the pState array */
+      *pState++ = Xn1;
+      *pState++ = Xn2;
+      *pState++ = Yn1;
+      *pState++ = Yn2;
+    }
+
+    for (i = 0U; i < tileLen; i++)
+    {
+      *pOut++ = tile[i];
+    }
+
+    blockSize -= tileLen;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
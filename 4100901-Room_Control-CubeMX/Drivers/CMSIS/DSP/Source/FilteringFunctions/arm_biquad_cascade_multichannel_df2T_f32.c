@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multichannel_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter, N channels
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to blockSize frames of numChannels interleaved samples
+  @param[out]    pDst      points to blockSize frames of numChannels interleaved outputs
+  @param[in]     blockSize number of frames to process
+  @return        none
+
+  @par           Details
+                   Generalizes \ref arm_biquad_cascade_stereo_df2T_f32() to any number of channels.
+                   Channel c of frame n is pSrc[n*numChannels + c]; every channel is filtered with the
+                   same coefficients and its own state, with the operations of
+                   \ref arm_biquad_cascade_df2T_f32() in the same order, so each channel gives the
+                   output of its own single channel instance.
+  @par
+                   With ARM_MATH_LOOPUNROLL, groups of four channels are filtered at a time: the four
+                   recursions are independent, so their multiplications and additions interleave instead
+                   of waiting on each other, and each coefficient stays in a register for all of them.
+                   The remaining channels are filtered in pairs, then the last one alone. On x86-64 hosts built with
+                   ARM_MATH_X86_SIMD, each channel is a lane of an SSE4.1 or AVX2 register.
+  @par
+                   <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+void arm_biquad_cascade_multichannel_df2T_f32(
+  const arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_biquad_cascade_multichannel_df2T_f32_x86(S, pSrc, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+  const float32_t *pIn = pSrc;                         /* Input of the current stage */
+  const float32_t *px;                                 /* Input of the current channel */
+        float32_t *pOut;                               /* Output of the current channel */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t numChannels = S->numChannels;         /* Distance between two samples of a channel */
+        float32_t acc1;                                /* Accumulator */
+        float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+        float32_t Xn1;                                 /* Temporary input */
+        float32_t d1, d2;                              /* State variables */
+        uint32_t sample, stage, ch;                    /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc1a, acc1b, acc1c, acc1d;          /* Accumulators of the four channels */
+        float32_t Xn1a, Xn1b, Xn1c, Xn1d;              /* Temporary inputs of the four channels */
+        float32_t d1a, d1b, d1c, d1d;                  /* State variables of the four channels */
+        float32_t d2a, d2b, d2c, d2d;
+#endif
+
+  for (stage = S->numStages; stage > 0U; stage--)
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    pCoeffs += 5U;
+
+    ch = 0U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Four channels at a time */
+    for (; (ch + 4U) <= numChannels; ch += 4U)
+    {
+      /* Reading the state values: d1 of every channel, then d2 of every channel */
+      d1a = pState[ch];
+      d1b = pState[ch + 1U];
+      d1c = pState[ch + 2U];
+      d1d = pState[ch + 3U];
+      d2a = pState[numChannels + ch];
+      d2b = pState[numChannels + ch + 1U];
+      d2c = pState[numChannels + ch + 2U];
+      d2d = pState[numChannels + ch + 3U];
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      for (sample = blockSize; sample > 0U; sample--)
+      {
+        Xn1a = px[0];
+        Xn1b = px[1];
+        Xn1c = px[2];
+        Xn1d = px[3];
+        px += numChannels;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1a = b0 * Xn1a + d1a;
+        acc1b = b0 * Xn1b + d1b;
+        acc1c = b0 * Xn1c + d1c;
+        acc1d = b0 * Xn1d + d1d;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1a = b1 * Xn1a + d2a;
+        d1b = b1 * Xn1b + d2b;
+        d1c = b1 * Xn1c + d2c;
+        d1d = b1 * Xn1d + d2d;
+        d1a += a1 * acc1a;
+        d1b += a1 * acc1b;
+        d1c += a1 * acc1c;
+        d1d += a1 * acc1d;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2a = b2 * Xn1a;
+        d2b = b2 * Xn1b;
+        d2c = b2 * Xn1c;
+        d2d = b2 * Xn1d;
+        d2a += a2 * acc1a;
+        d2b += a2 * acc1b;
+        d2c += a2 * acc1c;
+        d2d += a2 * acc1d;
+
+        pOut[0] = acc1a;
+        pOut[1] = acc1b;
+        pOut[2] = acc1c;
+        pOut[3] = acc1d;
+        pOut += numChannels;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[ch] = d1a;
+      pState[ch + 1U] = d1b;
+      pState[ch + 2U] = d1c;
+      pState[ch + 3U] = d1d;
+      pState[numChannels + ch] = d2a;
+      pState[numChannels + ch + 1U] = d2b;
+      pState[numChannels + ch + 2U] = d2c;
+      pState[numChannels + ch + 3U] = d2d;
+    }
+
+    /* Two of the remaining channels at a time, as arm_biquad_cascade_stereo_df2T_f32() */
+    for (; (ch + 2U) <= numChannels; ch += 2U)
+    {
+      d1a = pState[ch];
+      d1b = pState[ch + 1U];
+      d2a = pState[numChannels + ch];
+      d2b = pState[numChannels + ch + 1U];
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      for (sample = blockSize; sample > 0U; sample--)
+      {
+        Xn1a = px[0];
+        Xn1b = px[1];
+        px += numChannels;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1a = b0 * Xn1a + d1a;
+        acc1b = b0 * Xn1b + d1b;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1a = b1 * Xn1a + d2a;
+        d1b = b1 * Xn1b + d2b;
+        d1a += a1 * acc1a;
+        d1b += a1 * acc1b;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2a = b2 * Xn1a;
+        d2b = b2 * Xn1b;
+        d2a += a2 * acc1a;
+        d2b += a2 * acc1b;
+
+        pOut[0] = acc1a;
+        pOut[1] = acc1b;
+        pOut += numChannels;
+      }
+
+      pState[ch] = d1a;
+      pState[ch + 1U] = d1b;
+      pState[numChannels + ch] = d2a;
+      pState[numChannels + ch + 1U] = d2b;
+    }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    /* Remaining channels, one at a time */
+    for (; ch < numChannels; ch++)
+    {
+      d1 = pState[ch];
+      d2 = pState[numChannels + ch];
+
+      px = pIn + ch;
+      pOut = pDst + ch;
+
+      for (sample = blockSize; sample > 0U; sample--)
+      {
+        Xn1 = *px;
+        px += numChannels;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1 = b0 * Xn1 + d1;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = b1 * Xn1 + d2;
+        d1 += a1 * acc1;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = b2 * Xn1;
+        d2 += a2 * acc1;
+
+        *pOut = acc1;
+        pOut += numChannels;
+      }
+
+      pState[ch] = d1;
+      pState[numChannels + ch] = d2;
+    }
+
+    pState += 2U * numChannels;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multichannel_df2T_init_f32.c
+ * Description:  Initialization function for floating-point transposed direct form II Biquad cascade filter, N channels
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+  @param[in,out] S            points to an instance of the filter data structure.
+  @param[in]     numStages    number of 2nd order stages in the filter.
+  @param[in]     numChannels  number of interleaved channels.
+  @param[in]     pCoeffs      points to the filter coefficients, shared by all the channels.
+  @param[in]     pState       points to the state buffer.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numStages</code> or <code>numChannels</code> is zero
+
+  @par           Coefficient and State Ordering
+                   The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+  </pre>
+  @par
+                   as for \ref arm_biquad_cascade_df2T_init_f32(). The <code>pCoeffs</code> array contains
+                   a total of <code>5*numStages</code> values.
+  @par
+                   The <code>pState</code> is a pointer to state array. For each stage, the <code>d1</code>
+                   state variables of channels 0 to numChannels-1 come first, then their <code>d2</code>
+                   state variables, so the states of neighbouring channels are contiguous.
+                   The state array has a total length of <code>2*numStages*numChannels</code> values.
+                   The state variables are updated after each block of data is processed; the coefficients are untouched.
+ */
+arm_status arm_biquad_cascade_multichannel_df2T_init_f32(
+        arm_biquad_cascade_multichannel_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState)
+{
+  if ((numStages == 0U) || (numChannels == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
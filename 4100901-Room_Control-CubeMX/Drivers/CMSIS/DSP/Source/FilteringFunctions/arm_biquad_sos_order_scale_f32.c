@@ -0,0 +1,195 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_sos_order_scale_f32.c
+ * Description:  Ordering and scaling of second order sections against overflow
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @brief         Largest pole radius of the section y = ... + a1 y[n-1] + a2 y[n-2],
+                 that is of the roots of z^2 - a1 z - a2.
+ */
+static float32_t arm_biquad_sos_pole_radius_f32(
+  float32_t a1,
+  float32_t a2)
+{
+  float32_t disc = a1 * a1 + 4.0f * a2;                /* Discriminant */
+  float32_t root;
+
+  if (disc < 0.0f)
+  {
+    /* Complex conjugate poles: |p|^2 = p * conj(p) = -a2 */
+    arm_sqrt_f32(-a2, &root);
+    return (root);
+  }
+
+  /* Real poles: (a1 +/- root) / 2, the largest magnitude has the sign of a1 */
+  arm_sqrt_f32(disc, &root);
+  return ((fabsf(a1) + root) * 0.5f);
+}
+
+/**
+  @brief         Squared magnitude of the section at the frequency whose cos and sin
+                 of w and 2w are given.
+ */
+static float32_t arm_biquad_sos_mag2_f32(
+  const float32_t * pSec,
+        float32_t c1,
+        float32_t s1,
+        float32_t c2,
+        float32_t s2)
+{
+  float32_t nr, ni, dr, di;                            /* Numerator and denominator, real and imaginary */
+
+  /* H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 - a1 z^-1 - a2 z^-2), z^-k = cos(kw) - j sin(kw) */
+  nr = pSec[0] + pSec[1] * c1 + pSec[2] * c2;
+  ni = pSec[1] * s1 + pSec[2] * s2;
+  dr = 1.0f - pSec[3] * c1 - pSec[4] * c2;
+  di = pSec[3] * s1 + pSec[4] * s2;
+
+  return ((nr * nr + ni * ni) / (dr * dr + di * di));
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Design-time ordering and scaling of second order sections against overflow.
+  @param[in,out] pSos       points to numStages sections {b0, b1, b2, a1, a2}, reordered and scaled in place
+  @param[in]     numStages  number of 2nd order stages in the filter
+  @param[in]     numFreqs   number of frequencies in [0, pi] where the responses are evaluated
+  @param[out]    pGain      gain to apply to the output of the scaled cascade to restore the original response
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numStages</code> is zero, <code>numFreqs</code> is less
+                                                    than 2, a section is not stable or a partial cascade has no gain
+
+  @par           Details
+                   The fixed-point cascades saturate the output of every stage, not only the
+                   last one: a filter whose overall gain fits can still clip inside when a
+                   resonant section comes first. The coefficients use the sign convention of the
+                   Biquad cascade functions, y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2].
+  @par
+                   The sections are sorted by increasing pole radius, so the sharpest resonances
+                   come last and are attenuated by the sections before them. Then, in order, the
+                   numerator of each section is scaled so that the peak magnitude of the cascade up
+                   to its output, evaluated at <code>numFreqs</code> equally spaced frequencies from
+                   0 to pi, is 1 (L-infinity scaling): a full-scale sine does not overflow any stage.
+  @par
+                   The scaled cascade is the original one divided by <code>*pGain</code>.
+                   The result feeds \ref arm_biquad_sos_to_q15().
+ */
+arm_status arm_biquad_sos_order_scale_f32(
+  float32_t * pSos,
+  uint8_t numStages,
+  uint16_t numFreqs,
+  float32_t * pGain)
+{
+  float32_t sec[5];                                    /* Section being inserted */
+  float32_t radius;                                    /* Pole radius of sec */
+  float32_t w, c1, s1, c2, s2;                         /* Frequency and its cos and sin */
+  float32_t mag2, peak2;                               /* Squared magnitudes */
+  float32_t scale;                                     /* Numerator scale of the current stage */
+  float32_t gain = 1.0f;                               /* Product of the inverse scales */
+  uint32_t i, j, k, f;                                 /* Loop counters */
+
+  if ((numStages == 0U) || (numFreqs < 2U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0U; i < numStages; i++)
+  {
+    if (arm_biquad_sos_pole_radius_f32(pSos[5U * i + 3U], pSos[5U * i + 4U]) >= 1.0f)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /* Insertion sort by increasing pole radius, stable for equal radii */
+  for (i = 1U; i < numStages; i++)
+  {
+    memcpy(sec, &pSos[5U * i], sizeof(sec));
+    radius = arm_biquad_sos_pole_radius_f32(sec[3], sec[4]);
+
+    for (j = i; (j > 0U) && (arm_biquad_sos_pole_radius_f32(pSos[5U * j - 2U], pSos[5U * j - 1U]) > radius); j--)
+    {
+      memcpy(&pSos[5U * j], &pSos[5U * (j - 1U)], sizeof(sec));
+    }
+
+    memcpy(&pSos[5U * j], sec, sizeof(sec));
+  }
+
+  /* Scale each stage with the previous ones already scaled */
+  for (k = 0U; k < numStages; k++)
+  {
+    peak2 = 0.0f;
+
+    for (f = 0U; f < numFreqs; f++)
+    {
+      w = PI * (float32_t) f / (float32_t) (numFreqs - 1U);
+      c1 = arm_cos_f32(w);
+      s1 = arm_sin_f32(w);
+      c2 = 2.0f * c1 * c1 - 1.0f;
+      s2 = 2.0f * s1 * c1;
+
+      mag2 = 1.0f;
+      for (i = 0U; i <= k; i++)
+      {
+        mag2 *= arm_biquad_sos_mag2_f32(&pSos[5U * i], c1, s1, c2, s2);
+      }
+
+      if (mag2 > peak2)
+      {
+        peak2 = mag2;
+      }
+    }
+
+    if (peak2 <= 0.0f)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    arm_sqrt_f32(peak2, &scale);
+    gain *= scale;
+    scale = 1.0f / scale;
+
+    pSos[5U * k + 0U] *= scale;
+    pSos[5U * k + 1U] *= scale;
+    pSos[5U * k + 2U] *= scale;
+  }
+
+  *pGain = gain;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
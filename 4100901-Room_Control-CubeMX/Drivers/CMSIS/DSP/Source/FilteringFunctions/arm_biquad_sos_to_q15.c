@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_sos_to_q15.c
+ * Description:  Conversion of second order sections to Q15 Biquad cascade coefficients
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Largest postShift: arm_biquad_cascade_df1_q15() shifts the accumulator right by 15 - postShift */
+#define ARM_BIQUAD_SOS_MAX_POST_SHIFT 14
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF1
+  @{
+ */
+
+/**
+  @brief         Conversion of floating-point second order sections to Q15 Biquad cascade coefficients.
+  @param[in]     pSos        points to numStages sections {b0, b1, b2, a1, a2}
+  @param[in]     numStages   number of 2nd order stages in the filter
+  @param[out]    pCoeffs     points to the numStages*6 coefficients {b0, 0, b1, b2, a1, a2}
+  @param[out]    pPostShift  smallest shift that fits every coefficient in 1.15 format
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a coefficient needs a shift larger than 14
+
+  @par           Details
+                   The output is ready for \ref arm_biquad_cascade_df1_init_q15(): every coefficient
+                   is divided by 2^postShift, rounded to the nearest 1.15 value and saturated, and the
+                   zero that the Q15 Biquad functions expect after b0 is inserted. A smaller postShift
+                   keeps more bits of every coefficient, so it is the smallest one that fits the largest.
+ */
+arm_status arm_biquad_sos_to_q15(
+  const float32_t * pSos,
+        uint8_t numStages,
+        q15_t * pCoeffs,
+        int8_t * pPostShift)
+{
+  float32_t maxAbs = 0.0f;                             /* Largest coefficient magnitude */
+  float32_t scale;                                     /* 32768 / 2^postShift */
+  float32_t value;                                     /* Scaled coefficient */
+  int32_t postShift = 0;                               /* Shift being tried */
+  uint32_t i, k;                                       /* Loop counters */
+
+  for (i = 0U; i < 5U * (uint32_t) numStages; i++)
+  {
+    if (fabsf(pSos[i]) > maxAbs)
+    {
+      maxAbs = fabsf(pSos[i]);
+    }
+  }
+
+  /* 1.15 values lie in [-1, 1 - 2^-15]: anything up to 1 saturates by at most one step */
+  while (maxAbs > 1.0f)
+  {
+    if (postShift == ARM_BIQUAD_SOS_MAX_POST_SHIFT)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    maxAbs *= 0.5f;
+    postShift++;
+  }
+
+  scale = 32768.0f / (float32_t) (1 << postShift);
+
+  for (i = 0U; i < numStages; i++)
+  {
+    for (k = 0U; k < 5U; k++)
+    {
+      value = pSos[5U * i + k] * scale;
+      value += (value > 0.0f) ? 0.5f : -0.5f;
+
+      /* Stage layout {b0, 0, b1, b2, a1, a2} */
+      pCoeffs[6U * i + ((k == 0U) ? 0U : (k + 1U))] = (q15_t) __SSAT((q31_t) value, 16);
+    }
+
+    pCoeffs[6U * i + 1U] = 0;
+  }
+
+  *pPostShift = (int8_t) postShift;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of BiquadCascadeDF1 group
+ */
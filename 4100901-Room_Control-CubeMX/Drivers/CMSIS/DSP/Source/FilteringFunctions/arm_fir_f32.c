@@ -344,6 +344,14 @@ void arm_fir_f32(
         float32_t * pDst,
         uint32_t blockSize)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_fir_f32_x86(S, pSrc, pDst, blockSize);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
         float32_t *pState = S->pState;                 /* State pointer */
   const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
         float32_t *pStateCurnt;                        /* Points to the current sample of the state */
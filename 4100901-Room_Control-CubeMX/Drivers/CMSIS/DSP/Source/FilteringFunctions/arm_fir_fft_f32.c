@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point partitioned FFT (overlap-save) FIR filter processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_FFT Finite Impulse Response (FIR) Filters in the Frequency Domain
+
+  This group of functions computes the same output as \ref arm_fir_f32() with
+  uniformly partitioned overlap-save convolution. Its cost per sample grows with
+  log2(blockSize) + numTaps/blockSize instead of numTaps, which pays off for
+  long filters (see the crossover reported by Tools/fir_fft_bench.c).
+
+  @par           Algorithm
+                   The filter is split in P = ceil(numTaps/blockSize) partitions of blockSize taps and
+                   the spectrum H[p] of each one, zero padded to 2*blockSize points, is computed by the init function.
+                   Each block of blockSize input samples, preceded by the previous block, is transformed
+                   with \ref arm_rfft_fast_f32() into X[k] and stored in a frequency-domain delay line
+                   that keeps the last P input spectra. The output block is the second half of
+  <pre>
+      y = IRFFT( X[k]*H[0] + X[k-1]*H[1] + ... + X[k-P+1]*H[P-1] )
+  </pre>
+                   where the first half is discarded (overlap-save). The products use
+                   \ref arm_cmplx_mult_cmplx_f32() on the packed real FFT format.
+  @par
+                   The latency is one partition: each block of blockSize samples is output as soon as
+                   it is processed, whatever numTaps is. Larger partitions need fewer, longer FFTs
+                   per sample and a shorter delay line, at the cost of latency and of a state buffer
+                   that grows with 4*P*blockSize, about four times numTaps.
+
+  @par           Instance Structure
+                   The filter spectra and the delay line live in the state buffer of
+                   each instance: unlike \ref arm_fir_f32(), instances do not share coefficient arrays.
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, a multiple of S->blockSize
+  @return        none
+
+  @par           Details
+                   The samples are processed in blocks of S->blockSize; <code>pSrc</code> and
+                   <code>pDst</code> may point to the same buffer. The output equals that of
+                   \ref arm_fir_f32() with the same coefficients up to the rounding of the FFTs.
+ */
+void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t partLen = S->blockSize;               /* Partition length */
+        uint32_t fftLen = 2U * partLen;                /* Real FFT length */
+        uint32_t numPartitions = S->numPartitions;     /* Number of filter partitions */
+        uint32_t head = S->head;                       /* Slot of the newest input spectrum */
+  const float32_t *pSpectra = S->pState;               /* Filter spectra */
+        float32_t *pDelay = &S->pState[numPartitions * fftLen];   /* Input spectra, one slot per partition */
+        float32_t *pPrev = &pDelay[numPartitions * fftLen];       /* Previous input block */
+        float32_t *pScratch = &pPrev[partLen];         /* FFT input / product work buffer */
+        float32_t *pAcc = &pScratch[fftLen];           /* Sum of the partition products */
+  const float32_t *pH;                                 /* Spectrum of the current partition */
+        float32_t *pX;                                 /* Input spectrum of the current partition */
+        uint32_t blkCnt, p, slot;                      /* Loop counters */
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0U; blkCnt--)
+  {
+    /* Overlap-save frame: previous block followed by the new one. Both
+       copies are taken before pDst is written, so pSrc may alias it */
+    memcpy(pScratch, pPrev, partLen * sizeof(float32_t));
+    memcpy(&pScratch[partLen], pSrc, partLen * sizeof(float32_t));
+    memcpy(pPrev, pSrc, partLen * sizeof(float32_t));
+
+    /* The newest spectrum replaces the oldest one: slot head + p holds X[k-p] */
+    head = (head == 0U) ? (numPartitions - 1U) : (head - 1U);
+    pX = &pDelay[head * fftLen];
+    arm_rfft_fast_f32(&S->rfft, pScratch, pX, 0U);
+
+    /* Partition 0 writes the accumulator. In the packed format [0] and [1]
+       are the real DC and Nyquist bins, not a complex value */
+    pH = pSpectra;
+    arm_cmplx_mult_cmplx_f32(pX, pH, pAcc, partLen);
+    pAcc[0] = pX[0] * pH[0];
+    pAcc[1] = pX[1] * pH[1];
+
+    slot = head;
+    for (p = 1U; p < numPartitions; p++)
+    {
+      slot = ((slot + 1U) == numPartitions) ? 0U : (slot + 1U);
+      pX = &pDelay[slot * fftLen];
+      pH = &pSpectra[p * fftLen];
+
+      arm_cmplx_mult_cmplx_f32(pX, pH, pScratch, partLen);
+      pScratch[0] = pX[0] * pH[0];
+      pScratch[1] = pX[1] * pH[1];
+      arm_add_f32(pAcc, pScratch, pAcc, fftLen);
+    }
+
+    /* Back to time domain (scaled by 1/fftLen); the first half is circular wrap-around */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pScratch, 1U);
+    memcpy(pDst, &pScratch[partLen], partLen * sizeof(float32_t));
+
+    pSrc += partLen;
+    pDst += partLen;
+  }
+
+  S->head = (uint16_t) head;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
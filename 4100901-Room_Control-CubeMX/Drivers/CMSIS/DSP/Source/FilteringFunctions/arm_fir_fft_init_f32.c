@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point partitioned FFT FIR filter initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficients buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  partition length: a power of 2 from 16 to 2048
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is zero or
+                                                    <code>arm_rfft_fast_init_f32()</code> has no tables for <code>2*blockSize</code> points
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   exactly as for \ref arm_fir_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+                   The coefficients are only read here: their spectra are stored in <code>pState</code>,
+                   so <code>pCoeffs</code> can be released or reused after the call.
+  @par
+                   <code>pState</code> is of length <code>ARM_FIR_FFT_STATE_LEN_F32(numTaps, blockSize)</code>,
+                   that is <code>(4*P + 5)*blockSize</code> values with <code>P = ceil(numTaps/blockSize)</code>:
+                   the P filter spectra, the P input spectra of the delay line, the previous input block and
+                   two FFT work buffers.
+  @par
+                   The real FFT of <code>2*blockSize</code> points uses the constant tables of
+                   \ref arm_rfft_fast_init_f32(); in firmware that only links some of them, pick
+                   a <code>blockSize</code> whose tables are compiled in.
+ */
+
+arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+        uint32_t fftLen = 2U * blockSize;              /* Real FFT length */
+        uint32_t numPartitions;                        /* Number of filter partitions */
+        float32_t *pSpectra = pState;                  /* Filter spectra, one per partition */
+        float32_t *pScratch;                           /* FFT input work buffer */
+        uint32_t p, j, tap;                            /* Loop counters */
+
+  if ((numTaps == 0U) || (blockSize < 16U) || (blockSize > 2048U) ||
+      (arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  numPartitions = ARM_FIR_FFT_NUM_PARTITIONS((uint32_t) numTaps, blockSize);
+
+  S->numTaps = numTaps;
+  S->blockSize = (uint16_t) blockSize;
+  S->numPartitions = (uint16_t) numPartitions;
+  S->head = 0U;
+  S->pState = pState;
+
+  /* The work buffers follow the delay line and the previous input block */
+  pScratch = &pState[(2U * numPartitions * fftLen) + blockSize];
+
+  /* Partition p holds taps b[p*blockSize] ... b[p*blockSize + blockSize - 1],
+     in natural order and zero padded to fftLen */
+  for (p = 0U; p < numPartitions; p++)
+  {
+    memset(pScratch, 0, fftLen * sizeof(float32_t));
+
+    for (j = 0U; j < blockSize; j++)
+    {
+      tap = (p * blockSize) + j;
+      if (tap >= numTaps)
+      {
+        break;
+      }
+
+      pScratch[j] = pCoeffs[numTaps - 1U - tap];
+    }
+
+    arm_rfft_fast_f32(&S->rfft, pScratch, &pSpectra[p * fftLen], 0U);
+  }
+
+  /* Clear the delay line and the previous input block */
+  memset(&pState[numPartitions * fftLen], 0, ((numPartitions * fftLen) + blockSize) * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of FIR_FFT group
+ */
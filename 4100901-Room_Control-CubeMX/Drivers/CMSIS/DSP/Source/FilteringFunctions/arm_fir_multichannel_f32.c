@@ -0,0 +1,512 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multichannel_f32.c
+ * Description:  Floating-point multi-channel FIR filter processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @brief         One output sample: numTaps products of pCoeffs with the
+                 samples of one channel, read every stride values.
+ */
+static inline float32_t arm_fir_multichannel_dot_f32(
+  const float32_t * px,
+  const float32_t * pCoeffs,
+        uint32_t numTaps,
+        uint32_t stride)
+{
+  float32_t acc = 0.0f;
+  uint32_t k;
+
+  for (k = 0U; k < numTaps; k++)
+  {
+    acc += pCoeffs[k] * *px;
+    px += stride;
+  }
+
+  return (acc);
+}
+
+/**
+  @brief         Fewer than four channels: each channel is de-interleaved and
+                 passed to arm_fir_f32(), at most chunk frames at a time.
+ */
+static void arm_fir_multichannel_split_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t chunk)
+{
+        uint32_t numChannels = S->numChannels;         /* Number of interleaved channels */
+        uint32_t stateLen = S->numTaps - 1U + chunk;   /* State of one channel */
+        float32_t *pIn = &S->pState[numChannels * stateLen];  /* Input of the current channel */
+        float32_t *pOut = pIn + chunk;                 /* Output of the current channel */
+        arm_fir_instance_f32 fir = { S->numTaps, NULL, S->pCoeffs };
+        uint32_t ch, n, i, len;                        /* Loop counters */
+
+  for (n = 0U; n < blockSize; n += len)
+  {
+    len = ((blockSize - n) < chunk) ? (blockSize - n) : chunk;
+
+    for (ch = 0U; ch < numChannels; ch++)
+    {
+      fir.pState = &S->pState[ch * stateLen];
+
+      for (i = 0U; i < len; i++)
+      {
+        pIn[i] = pSrc[(n + i) * numChannels + ch];
+      }
+
+      arm_fir_f32(&fir, pIn, pOut, len);
+
+      for (i = 0U; i < len; i++)
+      {
+        pDst[(n + i) * numChannels + ch] = pOut[i];
+      }
+    }
+  }
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point multi-channel FIR filter.
+  @param[in]     S          points to an instance of the floating-point multi-channel FIR structure
+  @param[in]     pSrc       points to blockSize frames of numChannels interleaved samples
+  @param[out]    pDst       points to blockSize frames of numChannels interleaved outputs
+  @param[in]     blockSize  number of frames to process
+  @return        none
+
+  @par           Details
+                   Every channel is filtered with the same coefficients, stored in time
+                   reversed order like in \ref arm_fir_f32(). Channel c of frame n is
+                   pSrc[n*numChannels + c]; the output of channel c only depends on that
+                   channel, exactly as if it had its own arm_fir_f32() instance.
+  @par
+                   With ARM_MATH_LOOPUNROLL, groups of four channels compute two frames at a
+                   time: each coefficient is loaded once for eight outputs and each sample
+                   once for two. The remaining channels use the kernel of arm_fir_f32() on
+                   every numChannels-th sample: eight consecutive outputs per coefficient
+                   load, reusing seven of the eight input samples between taps.
+                   The single pass over pSrc avoids de-interleaving the channels into
+                   separate buffers and calling arm_fir_f32() once per channel.
+  @par
+                   The gain comes from the groups of four channels, so with fewer than four
+                   channels each channel is de-interleaved and filtered by arm_fir_f32()
+                   instead, in chunks that fit in the state buffer (see
+                   \ref arm_fir_multichannel_init_f32()). A single channel is passed to
+                   arm_fir_f32() as is.
+ */
+void arm_fir_multichannel_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t numChannels = S->numChannels;         /* Distance between two samples of a channel */
+  const float32_t *px;                                 /* Oldest sample used by the current output */
+        float32_t *pOut;                               /* Output of the current channel */
+        uint32_t ch, n;                                /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc0, acc1, acc2, acc3;              /* Accumulators */
+        float32_t acc4, acc5, acc6, acc7;              /* Accumulators of the second frame */
+        float32_t x0, x1, x2, x3, x4, x5, x6, x7;      /* Temporary variables to hold state values */
+        float32_t y0, y1, y2, y3;                      /* Samples of the second frame */
+        float32_t c0, c1;                              /* Temporary variables to hold coefficient values */
+        uint32_t k;                                    /* Tap counter */
+#endif
+
+  /* A single channel has the state layout of arm_fir_f32() */
+  if (numChannels == 1U)
+  {
+    arm_fir_instance_f32 fir = { S->numTaps, S->pState, S->pCoeffs };
+
+    arm_fir_f32(&fir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /* Two or three channels: one arm_fir_f32() state per channel, unless the
+     block is too short to leave room for the chunk buffers */
+  if (numChannels < 4U)
+  {
+    n = (numChannels * S->blockSize) / (numChannels + 2U);
+
+    if (n > 0U)
+    {
+      arm_fir_multichannel_split_f32(S, pSrc, pDst, blockSize, n);
+      return;
+    }
+  }
+
+  /* S->pState holds the last (numTaps - 1) frames of the previous call:
+     the new frames are written right after them */
+  memcpy(&pState[(numTaps - 1U) * numChannels], pSrc, blockSize * numChannels * sizeof(float32_t));
+
+  ch = 0U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Four channels and two frames at a time: frame n + k + 1 feeds output n
+     at tap k + 1 and output n + 1 at tap k, so each sample is loaded once per
+     pair of outputs and each coefficient once per eight of them */
+  for (; (ch + 4U) <= numChannels; ch += 4U)
+  {
+    pOut = pDst + ch;
+
+    for (n = 0U; (n + 2U) <= blockSize; n += 2U)
+    {
+      px = &pState[n * numChannels + ch];
+
+      /* x holds frame n + k, y frame n + k + 1 */
+      x0 = px[0];
+      x1 = px[1];
+      x2 = px[2];
+      x3 = px[3];
+      px += numChannels;
+
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+      acc4 = 0.0f;
+      acc5 = 0.0f;
+      acc6 = 0.0f;
+      acc7 = 0.0f;
+
+      /* Two taps per iteration: x and y swap roles instead of being copied */
+      for (k = 0U; (k + 2U) <= numTaps; k += 2U)
+      {
+        c0 = pCoeffs[k];
+        c1 = pCoeffs[k + 1U];
+
+        y0 = px[0];
+        y1 = px[1];
+        y2 = px[2];
+        y3 = px[3];
+        px += numChannels;
+
+        acc0 += c0 * x0;
+        acc1 += c0 * x1;
+        acc2 += c0 * x2;
+        acc3 += c0 * x3;
+        acc4 += c0 * y0;
+        acc5 += c0 * y1;
+        acc6 += c0 * y2;
+        acc7 += c0 * y3;
+
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        x3 = px[3];
+        px += numChannels;
+
+        acc0 += c1 * y0;
+        acc1 += c1 * y1;
+        acc2 += c1 * y2;
+        acc3 += c1 * y3;
+        acc4 += c1 * x0;
+        acc5 += c1 * x1;
+        acc6 += c1 * x2;
+        acc7 += c1 * x3;
+      }
+
+      /* Odd number of taps */
+      if (k < numTaps)
+      {
+        c0 = pCoeffs[k];
+
+        y0 = px[0];
+        y1 = px[1];
+        y2 = px[2];
+        y3 = px[3];
+
+        acc0 += c0 * x0;
+        acc1 += c0 * x1;
+        acc2 += c0 * x2;
+        acc3 += c0 * x3;
+        acc4 += c0 * y0;
+        acc5 += c0 * y1;
+        acc6 += c0 * y2;
+        acc7 += c0 * y3;
+      }
+
+      pOut[0] = acc0;
+      pOut[1] = acc1;
+      pOut[2] = acc2;
+      pOut[3] = acc3;
+      pOut[numChannels + 0U] = acc4;
+      pOut[numChannels + 1U] = acc5;
+      pOut[numChannels + 2U] = acc6;
+      pOut[numChannels + 3U] = acc7;
+
+      pOut += 2U * numChannels;
+    }
+
+    /* Odd block size: last frame alone */
+    if (n < blockSize)
+    {
+      px = &pState[n * numChannels + ch];
+
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      for (k = 0U; k < numTaps; k++)
+      {
+        c0 = pCoeffs[k];
+
+        acc0 += c0 * px[0];
+        acc1 += c0 * px[1];
+        acc2 += c0 * px[2];
+        acc3 += c0 * px[3];
+
+        px += numChannels;
+      }
+
+      pOut[0] = acc0;
+      pOut[1] = acc1;
+      pOut[2] = acc2;
+      pOut[3] = acc3;
+    }
+  }
+
+  /* Remaining channels: eight consecutive outputs of the same channel at a
+     time, the sliding tile of arm_fir_f32() */
+  for (; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+    for (n = 0U; (n + 8U) <= blockSize; n += 8U)
+    {
+      px = &pState[n * numChannels + ch];
+
+      /* Output n + i starts at frame n + i: only one new sample per tap */
+      x0 = px[0U];
+      x1 = px[numChannels];
+      x2 = px[2U * numChannels];
+      x3 = px[3U * numChannels];
+      x4 = px[4U * numChannels];
+      x5 = px[5U * numChannels];
+      x6 = px[6U * numChannels];
+      px += 7U * numChannels;
+
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+      acc4 = 0.0f;
+      acc5 = 0.0f;
+      acc6 = 0.0f;
+      acc7 = 0.0f;
+
+      /* Eight taps per iteration: the register holding the new sample rotates
+         instead of shifting the others */
+      for (k = 0U; (k + 8U) <= numTaps; k += 8U)
+      {
+        c0 = pCoeffs[k];
+        x7 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x0;
+        acc1 += c0 * x1;
+        acc2 += c0 * x2;
+        acc3 += c0 * x3;
+        acc4 += c0 * x4;
+        acc5 += c0 * x5;
+        acc6 += c0 * x6;
+        acc7 += c0 * x7;
+
+        c0 = pCoeffs[k + 1U];
+        x0 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x1;
+        acc1 += c0 * x2;
+        acc2 += c0 * x3;
+        acc3 += c0 * x4;
+        acc4 += c0 * x5;
+        acc5 += c0 * x6;
+        acc6 += c0 * x7;
+        acc7 += c0 * x0;
+
+        c0 = pCoeffs[k + 2U];
+        x1 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x2;
+        acc1 += c0 * x3;
+        acc2 += c0 * x4;
+        acc3 += c0 * x5;
+        acc4 += c0 * x6;
+        acc5 += c0 * x7;
+        acc6 += c0 * x0;
+        acc7 += c0 * x1;
+
+        c0 = pCoeffs[k + 3U];
+        x2 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x3;
+        acc1 += c0 * x4;
+        acc2 += c0 * x5;
+        acc3 += c0 * x6;
+        acc4 += c0 * x7;
+        acc5 += c0 * x0;
+        acc6 += c0 * x1;
+        acc7 += c0 * x2;
+
+        c0 = pCoeffs[k + 4U];
+        x3 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x4;
+        acc1 += c0 * x5;
+        acc2 += c0 * x6;
+        acc3 += c0 * x7;
+        acc4 += c0 * x0;
+        acc5 += c0 * x1;
+        acc6 += c0 * x2;
+        acc7 += c0 * x3;
+
+        c0 = pCoeffs[k + 5U];
+        x4 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x5;
+        acc1 += c0 * x6;
+        acc2 += c0 * x7;
+        acc3 += c0 * x0;
+        acc4 += c0 * x1;
+        acc5 += c0 * x2;
+        acc6 += c0 * x3;
+        acc7 += c0 * x4;
+
+        c0 = pCoeffs[k + 6U];
+        x5 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x6;
+        acc1 += c0 * x7;
+        acc2 += c0 * x0;
+        acc3 += c0 * x1;
+        acc4 += c0 * x2;
+        acc5 += c0 * x3;
+        acc6 += c0 * x4;
+        acc7 += c0 * x5;
+
+        c0 = pCoeffs[k + 7U];
+        x6 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x7;
+        acc1 += c0 * x0;
+        acc2 += c0 * x1;
+        acc3 += c0 * x2;
+        acc4 += c0 * x3;
+        acc5 += c0 * x4;
+        acc6 += c0 * x5;
+        acc7 += c0 * x6;
+      }
+
+      for (; k < numTaps; k++)
+      {
+        c0 = pCoeffs[k];
+        x7 = *px;
+        px += numChannels;
+
+        acc0 += c0 * x0;
+        acc1 += c0 * x1;
+        acc2 += c0 * x2;
+        acc3 += c0 * x3;
+        acc4 += c0 * x4;
+        acc5 += c0 * x5;
+        acc6 += c0 * x6;
+        acc7 += c0 * x7;
+
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+        x3 = x4;
+        x4 = x5;
+        x5 = x6;
+        x6 = x7;
+      }
+
+      pOut[0U]               = acc0;
+      pOut[numChannels]      = acc1;
+      pOut[2U * numChannels] = acc2;
+      pOut[3U * numChannels] = acc3;
+      pOut[4U * numChannels] = acc4;
+      pOut[5U * numChannels] = acc5;
+      pOut[6U * numChannels] = acc6;
+      pOut[7U * numChannels] = acc7;
+
+      pOut += 8U * numChannels;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    for (; n < blockSize; n++)
+    {
+      *pOut = arm_fir_multichannel_dot_f32(&pState[n * numChannels + ch], pCoeffs, numTaps, numChannels);
+      pOut += numChannels;
+    }
+  }
+
+#else
+
+  for (; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      px = &pState[n * numChannels + ch];
+      *pOut = arm_fir_multichannel_dot_f32(px, pCoeffs, numTaps, numChannels);
+      pOut += numChannels;
+    }
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Processing is complete.
+     Now copy the last (numTaps - 1) frames to the start of the state buffer.
+     The regions overlap when blockSize < numTaps - 1. */
+  memmove(pState, &pState[blockSize * numChannels], (numTaps - 1U) * numChannels * sizeof(float32_t));
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multichannel_init_f32.c
+ * Description:  Floating-point multi-channel FIR filter initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point multi-channel FIR filter.
+  @param[in,out] S            points to an instance of the floating-point multi-channel FIR structure.
+  @param[in]     numChannels  number of interleaved channels
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pCoeffs      points to the filter coefficients buffer
+  @param[in]     pState       points to the state buffer
+  @param[in]     blockSize    number of frames processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numChannels</code> or <code>numTaps</code> is zero
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   shared by all the channels:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to the array of interleaved state variables.
+                   <code>pState</code> is of length <code>(numTaps+blockSize-1)*numChannels</code> samples, where <code>blockSize</code> is the number of frames processed by each call to <code>arm_fir_multichannel_f32()</code>.
+  @par
+                   With two or three channels the buffer is split instead into one <code>arm_fir_f32()</code> state of
+                   <code>numTaps-1+L</code> samples per channel, followed by the de-interleaved input and the output of
+                   <code>L</code> samples each, where <code>L = numChannels*blockSize/(numChannels+2)</code>. If <code>L</code>
+                   is zero the interleaved layout is kept. Later calls must not process more than <code>blockSize</code> frames.
+ */
+
+arm_status arm_fir_multichannel_init_f32(
+        arm_fir_multichannel_instance_f32 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  if ((numChannels == 0U) || (numTaps == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign filter taps and channels */
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+
+  /* Sets the state layout with fewer than four channels */
+  S->blockSize = blockSize;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer. The size is always (blockSize + numTaps - 1) frames */
+  memset(pState, 0, (numTaps + (blockSize - 1U)) * numChannels * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,315 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multichannel_q15.c
+ * Description:  Q15 multi-channel FIR filter processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @brief         One output sample: numTaps products of pCoeffs with the
+                 samples of one channel, read every stride values, in 1.15 format.
+ */
+static inline q15_t arm_fir_multichannel_dot_q15(
+  const q15_t * px,
+  const q15_t * pCoeffs,
+        uint32_t numTaps,
+        uint32_t stride)
+{
+  q63_t acc = 0;
+  uint32_t k;
+
+  for (k = 0U; k < numTaps; k++)
+  {
+    acc += (q31_t) pCoeffs[k] * *px;
+    px += stride;
+  }
+
+  return ((q15_t) (__SSAT((acc >> 15), 16)));
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 multi-channel FIR filter.
+  @param[in]     S          points to an instance of the Q15 multi-channel FIR structure
+  @param[in]     pSrc       points to blockSize frames of numChannels interleaved samples
+  @param[out]    pDst       points to blockSize frames of numChannels interleaved outputs
+  @param[in]     blockSize  number of frames to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   Same as \ref arm_fir_q15(): 2.30 products are accumulated in a 64-bit
+                   accumulator, truncated to 34.15 and saturated to 1.15. Each channel
+                   gives bit-exactly the output of its own arm_fir_q15() instance.
+  @par
+                   Unlike arm_fir_q15(), numTaps does not need to be even.
+  @par
+                   With ARM_MATH_LOOPUNROLL, groups of four channels compute two frames at a
+                   time: each coefficient is loaded once for eight outputs and each sample
+                   once for two. The remaining channels compute four consecutive outputs per
+                   coefficient load, reusing three of the four input samples between taps.
+  @par
+                   The gain over one arm_fir_q15() per channel is small: about 1.1x for any
+                   number of channels on the C path. With ARM_MATH_DSP, arm_fir_q15() does
+                   two 16-bit MACs per instruction on contiguous samples, which interleaved
+                   channels cannot use, so it can be the faster choice there.
+ */
+void arm_fir_multichannel_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t numChannels = S->numChannels;         /* Distance between two samples of a channel */
+  const q15_t *px;                                     /* Oldest sample used by the current output */
+        q15_t *pOut;                                   /* Output of the current channel */
+        uint32_t ch, n;                                /* Loop counters */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+        q63_t acc4, acc5, acc6, acc7;                  /* Accumulators of the second frame */
+        q31_t x0, x1, x2, x3, y0, y1, y2, y3;          /* Temporary variables to hold state values */
+        q31_t c0, c1;                                  /* Temporary variables to hold coefficient values */
+        uint32_t k;                                    /* Tap counter */
+#endif
+
+  /* S->pState holds the last (numTaps - 1) frames of the previous call:
+     the new frames are written right after them */
+  memcpy(&pState[(numTaps - 1U) * numChannels], pSrc, blockSize * numChannels * sizeof(q15_t));
+
+  ch = 0U;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Four channels and two frames at a time: frame n + k + 1 feeds output n
+     at tap k + 1 and output n + 1 at tap k, so each sample is loaded once per
+     pair of outputs and each coefficient once per eight of them */
+  for (; (ch + 4U) <= numChannels; ch += 4U)
+  {
+    pOut = pDst + ch;
+
+    for (n = 0U; (n + 2U) <= blockSize; n += 2U)
+    {
+      px = &pState[n * numChannels + ch];
+
+      /* x holds frame n + k, y frame n + k + 1 */
+      x0 = px[0];
+      x1 = px[1];
+      x2 = px[2];
+      x3 = px[3];
+      px += numChannels;
+
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+      acc4 = 0;
+      acc5 = 0;
+      acc6 = 0;
+      acc7 = 0;
+
+      /* Two taps per iteration: x and y swap roles instead of being copied */
+      for (k = 0U; (k + 2U) <= numTaps; k += 2U)
+      {
+        c0 = pCoeffs[k];
+        c1 = pCoeffs[k + 1U];
+
+        y0 = px[0];
+        y1 = px[1];
+        y2 = px[2];
+        y3 = px[3];
+        px += numChannels;
+
+        acc0 += (q31_t) (c0 * x0);
+        acc1 += (q31_t) (c0 * x1);
+        acc2 += (q31_t) (c0 * x2);
+        acc3 += (q31_t) (c0 * x3);
+        acc4 += (q31_t) (c0 * y0);
+        acc5 += (q31_t) (c0 * y1);
+        acc6 += (q31_t) (c0 * y2);
+        acc7 += (q31_t) (c0 * y3);
+
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        x3 = px[3];
+        px += numChannels;
+
+        acc0 += (q31_t) (c1 * y0);
+        acc1 += (q31_t) (c1 * y1);
+        acc2 += (q31_t) (c1 * y2);
+        acc3 += (q31_t) (c1 * y3);
+        acc4 += (q31_t) (c1 * x0);
+        acc5 += (q31_t) (c1 * x1);
+        acc6 += (q31_t) (c1 * x2);
+        acc7 += (q31_t) (c1 * x3);
+      }
+
+      /* Odd number of taps */
+      if (k < numTaps)
+      {
+        c0 = pCoeffs[k];
+
+        y0 = px[0];
+        y1 = px[1];
+        y2 = px[2];
+        y3 = px[3];
+
+        acc0 += (q31_t) (c0 * x0);
+        acc1 += (q31_t) (c0 * x1);
+        acc2 += (q31_t) (c0 * x2);
+        acc3 += (q31_t) (c0 * x3);
+        acc4 += (q31_t) (c0 * y0);
+        acc5 += (q31_t) (c0 * y1);
+        acc6 += (q31_t) (c0 * y2);
+        acc7 += (q31_t) (c0 * y3);
+      }
+
+      pOut[0] = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pOut[1] = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pOut[2] = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pOut[3] = (q15_t) (__SSAT((acc3 >> 15), 16));
+      pOut[numChannels + 0U] = (q15_t) (__SSAT((acc4 >> 15), 16));
+      pOut[numChannels + 1U] = (q15_t) (__SSAT((acc5 >> 15), 16));
+      pOut[numChannels + 2U] = (q15_t) (__SSAT((acc6 >> 15), 16));
+      pOut[numChannels + 3U] = (q15_t) (__SSAT((acc7 >> 15), 16));
+
+      pOut += 2U * numChannels;
+    }
+
+    /* Odd block size: last frame alone */
+    if (n < blockSize)
+    {
+      px = &pState[n * numChannels + ch];
+
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      for (k = 0U; k < numTaps; k++)
+      {
+        c0 = pCoeffs[k];
+
+        acc0 += (q31_t) (c0 * px[0]);
+        acc1 += (q31_t) (c0 * px[1]);
+        acc2 += (q31_t) (c0 * px[2]);
+        acc3 += (q31_t) (c0 * px[3]);
+
+        px += numChannels;
+      }
+
+      pOut[0] = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pOut[1] = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pOut[2] = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pOut[3] = (q15_t) (__SSAT((acc3 >> 15), 16));
+    }
+  }
+
+  /* Remaining channels: four consecutive outputs of the same channel at a time */
+  for (; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+    for (n = 0U; (n + 4U) <= blockSize; n += 4U)
+    {
+      px = &pState[n * numChannels + ch];
+
+      /* Output n + i starts at frame n + i: only one new sample per tap */
+      x0 = px[0U];
+      x1 = px[numChannels];
+      x2 = px[2U * numChannels];
+      px += 3U * numChannels;
+
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      for (k = 0U; k < numTaps; k++)
+      {
+        c0 = pCoeffs[k];
+        x3 = *px;
+
+        acc0 += (q31_t) (c0 * x0);
+        acc1 += (q31_t) (c0 * x1);
+        acc2 += (q31_t) (c0 * x2);
+        acc3 += (q31_t) (c0 * x3);
+
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+        px += numChannels;
+      }
+
+      pOut[0U]               = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pOut[numChannels]      = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pOut[2U * numChannels] = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pOut[3U * numChannels] = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+      pOut += 4U * numChannels;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    for (; n < blockSize; n++)
+    {
+      *pOut = arm_fir_multichannel_dot_q15(&pState[n * numChannels + ch], pCoeffs, numTaps, numChannels);
+      pOut += numChannels;
+    }
+  }
+
+#else
+
+  for (; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      px = &pState[n * numChannels + ch];
+      *pOut = arm_fir_multichannel_dot_q15(px, pCoeffs, numTaps, numChannels);
+      pOut += numChannels;
+    }
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Processing is complete.
+     Now copy the last (numTaps - 1) frames to the start of the state buffer.
+     The regions overlap when blockSize < numTaps - 1. */
+  memmove(pState, &pState[blockSize * numChannels], (numTaps - 1U) * numChannels * sizeof(q15_t));
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point rational (L/M) FIR sample rate converter
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Sample Rate Converter
+
+  These functions change the sample rate by a rational factor <code>L/M</code>: conceptually
+  they upsample by <code>L</code> (zero stuffing), filter with a lowpass FIR designed at the
+  upsampled rate and keep one sample out of <code>M</code>. For example 44.1 kHz to 16 kHz
+  is <code>L = 160</code>, <code>M = 441</code>, where chaining \ref FIR_Interpolate and
+  \ref FIR_Decimate would filter every one of the 7.056 MHz intermediate samples.
+  The lowpass cutoff must be the lower of <code>1/L</code> and <code>1/M</code> (normalized
+  to the upsampled Nyquist frequency), and its gain <code>L</code> to keep the amplitude.
+
+  @par           Algorithm
+                   Only the output samples are computed, each with one polyphase branch of
+                   <code>phaseLength = numTaps/L</code> taps. Output k sits at position
+                   <code>t = k*M + M - 1</code> of the upsampled signal; with <code>n = t/L</code> and
+                   <code>p = t%L</code>:
+  <pre>
+      y[k] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+  </pre>
+                   The cost is <code>phaseLength</code> multiply-accumulates per output, whatever
+                   <code>L</code> and <code>M</code> are. With <code>M = 1</code> the output is that of
+                   \ref arm_fir_interpolate_f32() and with <code>L = 1</code> that of
+                   \ref arm_fir_decimate_f32().
+  @par
+                   <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, a multiple
+                   of <code>L</code>, stored in time reversed order as for \ref FIR_Interpolate:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+
+  @par           Streaming
+                   Each call consumes <code>blockSize</code> input samples (any count up to the
+                   <code>blockSize</code> given to the init function) and returns the number of output
+                   samples written, at most <code>ARM_FIR_RESAMPLE_MAX_OUTPUTS(L, M, blockSize)</code>.
+                   The position of the next output is kept in the instance, so consecutive blocks
+                   give the same samples as one long block: 441 input samples always yield 160 outputs
+                   at 44.1 kHz to 16 kHz, split across calls as the block boundaries fall.
+
+  @par           Instance Structure
+                   Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+                   The instance is updated by every call (<code>position</code>), so it cannot be placed in a const data section.
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point rational FIR sample rate converter.
+  @param[in,out] S          points to an instance of the floating-point FIR sample rate converter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+ */
+uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t stepInt = S->M / L;                   /* Whole input samples between two outputs */
+        uint32_t stepFrac = S->M % L;                  /* Remaining upsampled samples between two outputs */
+        uint32_t n = S->position / L;                  /* Newest input sample of the next output */
+        uint32_t phase = S->position % L;              /* Polyphase branch of the next output */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc;                                 /* Accumulator */
+        uint32_t numOut = 0U;                          /* Number of output samples */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples:
+     the new block is written right after them */
+  memcpy(&pState[phaseLen - 1U], pSrc, blockSize * sizeof(float32_t));
+
+  /* Outputs whose newest input sample is in this block */
+  while (n < blockSize)
+  {
+    /* Oldest sample x[n - phaseLen + 1] meets b[phase + L*(phaseLen - 1)],
+       which is pCoeffs[L - 1 - phase] in time reversed order */
+    px = &pState[n];
+    pb = &pCoeffs[L - 1U - phase];
+    acc = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      acc += px[0] * pb[0];
+      acc += px[1] * pb[L];
+      acc += px[2] * pb[2U * L];
+      acc += px[3] * pb[3U * L];
+
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      acc += *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = acc;
+    numOut++;
+
+    /* The next output is M upsampled samples later */
+    n += stepInt;
+    phase += stepFrac;
+    if (phase >= L)
+    {
+      phase -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output from the first sample of the next block */
+  S->position = ((n - blockSize) * L) + phase;
+
+  /* Processing is complete.
+     Now copy the last (phaseLen - 1) samples to the start of the state buffer.
+     The regions overlap when blockSize < phaseLen - 1. */
+  memmove(pState, &pState[blockSize], (phaseLen - 1U) * sizeof(float32_t));
+
+  return (numOut);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
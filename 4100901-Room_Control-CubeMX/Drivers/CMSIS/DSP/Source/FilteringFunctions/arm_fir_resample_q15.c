@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 rational (L/M) FIR sample rate converter
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 rational FIR sample rate converter.
+  @param[in,out] S          points to an instance of the Q15 FIR sample rate converter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written to <code>pDst</code>
+
+  @par           Scaling and Overflow Behavior
+                   Same as \ref arm_fir_interpolate_q15(): the 2.30 products are accumulated in a
+                   64-bit accumulator in 34.30 format, truncated to 34.15 and saturated to 1.15.
+                   A gain of <code>L</code> in the filter does not fit in 1.15 coefficients: scale
+                   them by <code>1/L</code> or give the gain back to the signal after the converter.
+ */
+uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+        uint32_t L = S->L;                             /* Upsample factor */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        uint32_t stepInt = S->M / L;                   /* Whole input samples between two outputs */
+        uint32_t stepFrac = S->M % L;                  /* Remaining upsampled samples between two outputs */
+        uint32_t n = S->position / L;                  /* Newest input sample of the next output */
+        uint32_t phase = S->position % L;              /* Polyphase branch of the next output */
+  const q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q63_t acc;                                     /* Accumulator */
+        uint32_t numOut = 0U;                          /* Number of output samples */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples:
+     the new block is written right after them */
+  memcpy(&pState[phaseLen - 1U], pSrc, blockSize * sizeof(q15_t));
+
+  /* Outputs whose newest input sample is in this block */
+  while (n < blockSize)
+  {
+    /* Oldest sample x[n - phaseLen + 1] meets b[phase + L*(phaseLen - 1)],
+       which is pCoeffs[L - 1 - phase] in time reversed order */
+    px = &pState[n];
+    pb = &pCoeffs[L - 1U - phase];
+    acc = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 4 taps at a time */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      acc += (q31_t) px[0] * pb[0];
+      acc += (q31_t) px[1] * pb[L];
+      acc += (q31_t) px[2] * pb[2U * L];
+      acc += (q31_t) px[3] * pb[3U * L];
+
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (tapCnt > 0U)
+    {
+      acc += (q31_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement loop counter */
+      tapCnt--;
+    }
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+    numOut++;
+
+    /* The next output is M upsampled samples later */
+    n += stepInt;
+    phase += stepFrac;
+    if (phase >= L)
+    {
+      phase -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output from the first sample of the next block */
+  S->position = ((n - blockSize) * L) + phase;
+
+  /* Processing is complete.
+     Now copy the last (phaseLen - 1) samples to the start of the state buffer.
+     The regions overlap when blockSize < phaseLen - 1. */
+  memmove(pState, &pState[blockSize], (phaseLen - 1U) * sizeof(q15_t));
+
+  return (numOut);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
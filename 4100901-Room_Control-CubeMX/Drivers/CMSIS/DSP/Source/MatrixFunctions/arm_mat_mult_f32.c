@@ -400,6 +400,13 @@ arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcB,
         arm_matrix_instance_f32 * pDst)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    return arm_mat_mult_f32_x86(pSrcA, pSrcB, pDst);
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
   float32_t *pIn1 = pSrcA->pData;                /* Input data matrix pointer A */
   float32_t *pIn2 = pSrcB->pData;                /* Input data matrix pointer B */
   float32_t *pInA = pSrcA->pData;                /* Input data matrix pointer A */
@@ -45,6 +45,12 @@
 #include "arm_rms_f32.c"
 #include "arm_rms_q15.c"
 #include "arm_rms_q31.c"
+#include "arm_stats_window_f32.c"
+#include "arm_stats_window_get_f32.c"
+#include "arm_stats_window_get_q31.c"
+#include "arm_stats_window_init_f32.c"
+#include "arm_stats_window_init_q31.c"
+#include "arm_stats_window_q31.c"
 #include "arm_std_f32.c"
 #include "arm_std_q15.c"
 #include "arm_std_q31.c"
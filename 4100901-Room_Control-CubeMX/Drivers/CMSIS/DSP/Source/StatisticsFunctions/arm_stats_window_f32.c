@@ -0,0 +1,292 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_window_f32.c
+ * Description:  Floating-point sliding-window statistics update
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @brief         Fills the window with windowLen new samples: the sums come from the
+                 block functions and the queues are built from the newest sample back.
+ */
+static void arm_stats_window_refill_f32(
+        arm_stats_window_instance_f32 * S,
+  const float32_t * pSrc)
+{
+        float32_t *pBuffer = S->pBuffer;               /* Window buffer */
+        uint32_t windowLen = S->windowLen;             /* Window length */
+        uint32_t *pMaxQueue = S->pQueue;               /* Queue of the maximum */
+        uint32_t *pMinQueue = S->pQueue + windowLen;   /* Queue of the minimum */
+        uint32_t maxHead = windowLen;                  /* The queues are filled from their end */
+        uint32_t minHead = windowLen;
+        float32_t var, in, maxVal, minVal;             /* Temporary variables */
+        uint32_t i;                                    /* Loop counter */
+
+  arm_copy_f32(pSrc, pBuffer, windowLen);
+  arm_mean_f32(pBuffer, windowLen, &S->mean);
+  arm_power_f32(pBuffer, windowLen, &S->sumOfSquares);
+  arm_var_f32(pBuffer, windowLen, &var);
+  S->m2 = var * (float32_t) (windowLen - 1U);
+
+  /* A sample stays in the queue of the maximum if no later sample is greater
+     (ties keep the oldest), and in that of the minimum if none is smaller */
+  maxVal = pBuffer[windowLen - 1U];
+  minVal = maxVal;
+  for (i = windowLen; i > 0U; i--)
+  {
+    in = pBuffer[i - 1U];
+
+    if (in >= maxVal)
+    {
+      maxVal = in;
+      pMaxQueue[--maxHead] = i - 1U;
+    }
+    if (in <= minVal)
+    {
+      minVal = in;
+      pMinQueue[--minHead] = i - 1U;
+    }
+  }
+
+  /* Full window, the next sample overwrites slot 0 and starts a new pass */
+  S->numSamples = windowLen;
+  S->writeIndex = 0U;
+  S->maxHead = maxHead;
+  S->maxCount = windowLen - maxHead;
+  S->minHead = minHead;
+  S->minCount = windowLen - minHead;
+  S->passMean = 0.0f;
+  S->passM2 = 0.0f;
+  S->passSquares = 0.0f;
+}
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup StatsWindow Sliding-Window Statistics
+
+  Keeps the mean, variance, standard deviation, RMS, maximum and minimum of the
+  last <code>windowLen</code> samples of a stream. Each new sample costs O(1)
+  work (amortized for the maximum and minimum), where the block functions
+  (\ref arm_mean_f32(), \ref arm_var_f32(), ...) read the whole window again
+  every time it slides.
+
+  The window is a circular buffer of <code>windowLen</code> samples. Until it is
+  full the statistics cover the samples received so far.
+  - The maximum and minimum come from two monotonic queues of buffer slots: each
+    sample is queued once and dropped at most once, and the front of each queue is
+    the extreme of the window. Ties resolve to the oldest sample, as the first
+    occurrence in \ref arm_max_f32().
+  - The floating-point version updates the mean and the sum of squared deviations
+    with Welford's method (adding the new sample and removing the one that leaves)
+    and keeps a running sum of squares for the RMS. Alongside, it keeps the same
+    sums for the current pass over the buffer, adding samples only. When the
+    window wraps the pass covers exactly the window and its sums replace the
+    running ones, so the rounding errors of the removals do not build up over
+    long streams and the buffer is never read again.
+  - The Q31 version keeps exact 64-bit sums, like \ref arm_var_q31(), so it never
+    drifts and needs no recomputation.
+
+  A block of <code>windowLen</code> samples or more (a hop longer than the window)
+  leaves nothing to slide: the window is recomputed from the end of the block.
+
+  The results are read at any time with the <code>arm_stats_window_&lt;stat&gt;_&lt;type&gt;()</code>
+  functions, which take O(1) time.
+
+  @par           Instance Structure
+                   The window buffer, the queues and the running sums are stored in an
+                   instance structure. A separate instance must be used for each stream.
+                   Use the init function to set it up.
+ */
+
+/**
+  @addtogroup StatsWindow
+  @{
+ */
+
+/**
+  @brief         Adds samples to the floating-point sliding window.
+  @param[in,out] S          points to an instance of the floating-point sliding-window statistics structure.
+  @param[in]     pSrc       points to the new samples.
+  @param[in]     blockSize  number of samples to add.
+  @return        none
+
+  @par           Cost
+                   Each sample takes a constant number of operations, plus the queue
+                   entries it drops (at most one per sample received). The running sums
+                   are replaced by those of the pass every <code>windowLen</code> samples,
+                   also in constant time.
+  @par
+                   A block of <code>windowLen</code> samples or more replaces the whole
+                   window. Nothing is left to slide, so its last <code>windowLen</code>
+                   samples are copied and the statistics recomputed over them with the
+                   block functions, which is cheaper than adding them one by one.
+ */
+void arm_stats_window_f32(
+        arm_stats_window_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        float32_t *pBuffer = S->pBuffer;               /* Window buffer */
+        uint32_t windowLen = S->windowLen;             /* Window length */
+        uint32_t *pMaxQueue = S->pQueue;               /* Queue of the maximum */
+        uint32_t *pMinQueue = S->pQueue + windowLen;   /* Queue of the minimum */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t writeIndex = S->writeIndex;           /* Slot of the next sample */
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t back;                                 /* Slot of a queue entry */
+        float32_t mean = S->mean;                      /* Running mean */
+        float32_t m2 = S->m2;                          /* Running sum of squared deviations */
+        float32_t sumOfSquares = S->sumOfSquares;      /* Running sum of squares */
+        float32_t passMean = S->passMean;              /* Mean of the pass over the buffer */
+        float32_t passM2 = S->passM2;                  /* Sum of squared deviations of the pass */
+        float32_t passSquares = S->passSquares;        /* Sum of squares of the pass */
+        float32_t invLen = 1.0f / (float32_t) windowLen;
+        float32_t in, out, delta, oldMean;             /* Temporary variables */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  if (blockSize >= windowLen)
+  {
+    /* Only the last windowLen samples stay in the window */
+    arm_stats_window_refill_f32(S, pSrc + (blockSize - windowLen));
+    return;
+  }
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (numSamples == windowLen)
+    {
+      /* The oldest sample, at writeIndex, leaves the window */
+      out = pBuffer[writeIndex];
+
+      /* If it is the front of a queue, it is dropped. A full window keeps at least one entry in each queue. */
+      if (pMaxQueue[maxHead] == writeIndex)
+      {
+        maxHead = (maxHead + 1U == windowLen) ? 0U : maxHead + 1U;
+        maxCount--;
+      }
+      if (pMinQueue[minHead] == writeIndex)
+      {
+        minHead = (minHead + 1U == windowLen) ? 0U : minHead + 1U;
+        minCount--;
+      }
+
+      /* Welford update replacing out by in */
+      delta = in - out;
+      oldMean = mean;
+      mean += delta * invLen;
+      m2 += delta * ((in - mean) + (out - oldMean));
+      sumOfSquares += (in * in) - (out * out);
+    }
+    else
+    {
+      /* Welford update adding in */
+      numSamples++;
+      delta = in - mean;
+      mean += delta / (float32_t) numSamples;
+      m2 += delta * (in - mean);
+      sumOfSquares += in * in;
+    }
+
+    pBuffer[writeIndex] = in;
+
+    /* Welford update adding in to the pass over the buffer, writeIndex + 1 samples */
+    delta = in - passMean;
+    passMean += delta / (float32_t) (writeIndex + 1U);
+    passM2 += delta * (in - passMean);
+    passSquares += in * in;
+
+    /* Queue of the maximum: drop from the back the samples smaller than in, then queue it */
+    while (maxCount > 0U)
+    {
+      back = maxHead + maxCount - 1U;
+      back = (back >= windowLen) ? back - windowLen : back;
+      if (pBuffer[pMaxQueue[back]] >= in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    back = maxHead + maxCount;
+    pMaxQueue[(back >= windowLen) ? back - windowLen : back] = writeIndex;
+    maxCount++;
+
+    /* Queue of the minimum: drop from the back the samples greater than in, then queue it */
+    while (minCount > 0U)
+    {
+      back = minHead + minCount - 1U;
+      back = (back >= windowLen) ? back - windowLen : back;
+      if (pBuffer[pMinQueue[back]] <= in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    back = minHead + minCount;
+    pMinQueue[(back >= windowLen) ? back - windowLen : back] = writeIndex;
+    minCount++;
+
+    writeIndex++;
+    if (writeIndex == windowLen)
+    {
+      writeIndex = 0U;
+
+      if (numSamples == windowLen)
+      {
+        /* The pass covers the whole window: its sums replace the running ones */
+        mean = passMean;
+        m2 = passM2;
+        sumOfSquares = passSquares;
+      }
+      passMean = 0.0f;
+      passM2 = 0.0f;
+      passSquares = 0.0f;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store the updated state */
+  S->numSamples = numSamples;
+  S->writeIndex = writeIndex;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->minHead = minHead;
+  S->minCount = minCount;
+  S->mean = mean;
+  S->m2 = m2;
+  S->sumOfSquares = sumOfSquares;
+  S->passMean = passMean;
+  S->passM2 = passM2;
+  S->passSquares = passSquares;
+}
+
+/**
+  @} end of StatsWindow group
+ */
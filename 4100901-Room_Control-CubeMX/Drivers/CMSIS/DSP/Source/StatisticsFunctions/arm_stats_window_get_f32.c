@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_window_get_f32.c
+ * Description:  Results of the floating-point sliding-window statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsWindow
+  @{
+ */
+
+/**
+  @brief         Mean of the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding-window statistics structure.
+  @param[out]    pResult  mean value returned here (0 if the window is empty)
+  @return        none
+ */
+void arm_stats_window_mean_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult)
+{
+  *pResult = (S->numSamples == 0U) ? 0.0f : S->mean;
+}
+
+/**
+  @brief         Variance of the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding-window statistics structure.
+  @param[out]    pResult  variance returned here, divided by the number of samples minus one as
+                          \ref arm_var_f32() (0 with less than two samples)
+  @return        none
+ */
+void arm_stats_window_var_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult)
+{
+  /* The running sum can round slightly below zero for a constant window */
+  if ((S->numSamples <= 1U) || (S->m2 <= 0.0f))
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  *pResult = S->m2 / (float32_t) (S->numSamples - 1U);
+}
+
+/**
+  @brief         Standard deviation of the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding-window statistics structure.
+  @param[out]    pResult  standard deviation returned here
+  @return        none
+ */
+void arm_stats_window_std_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t var;                                 /* Variance of the window */
+
+  arm_stats_window_var_f32(S, &var);
+  arm_sqrt_f32(var, pResult);
+}
+
+/**
+  @brief         Root Mean Square of the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding-window statistics structure.
+  @param[out]    pResult  RMS value returned here (0 if the window is empty)
+  @return        none
+ */
+void arm_stats_window_rms_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult)
+{
+  if ((S->numSamples == 0U) || (S->sumOfSquares <= 0.0f))
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  arm_sqrt_f32(S->sumOfSquares / (float32_t) S->numSamples, pResult);
+}
+
+/**
+  @brief         Maximum of the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding-window statistics structure.
+  @param[out]    pResult  maximum value returned here (0 if the window is empty)
+  @param[out]    pIndex   position of the maximum in the window returned here, 0 being the oldest sample
+  @return        none
+ */
+void arm_stats_window_max_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  uint32_t slot, oldest;                         /* Slots of the maximum and the oldest sample */
+
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0.0f;
+    *pIndex = 0U;
+    return;
+  }
+
+  slot = S->pQueue[S->maxHead];
+  oldest = (S->numSamples == S->windowLen) ? S->writeIndex : 0U;
+
+  *pResult = S->pBuffer[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+  @brief         Minimum of the floating-point sliding window.
+  @param[in]     S        points to an instance of the floating-point sliding-window statistics structure.
+  @param[out]    pResult  minimum value returned here (0 if the window is empty)
+  @param[out]    pIndex   position of the minimum in the window returned here, 0 being the oldest sample
+  @return        none
+ */
+void arm_stats_window_min_f32(
+  const arm_stats_window_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  uint32_t slot, oldest;                         /* Slots of the minimum and the oldest sample */
+
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0.0f;
+    *pIndex = 0U;
+    return;
+  }
+
+  slot = S->pQueue[S->windowLen + S->minHead];
+  oldest = (S->numSamples == S->windowLen) ? S->writeIndex : 0U;
+
+  *pResult = S->pBuffer[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+  @} end of StatsWindow group
+ */
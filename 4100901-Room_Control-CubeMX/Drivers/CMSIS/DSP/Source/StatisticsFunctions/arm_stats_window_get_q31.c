@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_window_get_q31.c
+ * Description:  Results of the Q31 sliding-window statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsWindow
+  @{
+ */
+
+/**
+  @brief         Mean of the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding-window statistics structure.
+  @param[out]    pResult  mean value returned here (0 if the window is empty)
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   Same result as \ref arm_mean_q31() over the window.
+ */
+void arm_stats_window_mean_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult)
+{
+  *pResult = (S->numSamples == 0U) ? 0 : (q31_t) (S->sum / (q63_t) S->numSamples);
+}
+
+/**
+  @brief         Variance of the sliding window in 17.46 format, before the final shift.
+  @param[in]     S  points to an instance of the Q31 sliding-window statistics structure.
+  @return        variance, not negative
+ */
+static q63_t arm_stats_window_var46_q31(
+  const arm_stats_window_instance_q31 * S)
+{
+        q63_t numSamples = (q63_t) S->numSamples;      /* Samples in the window */
+        q63_t sumShifted = S->sumShifted;              /* Sum of the 1.23 samples */
+        q63_t meanOfSquares, squareOfMean;             /* Square of mean and mean of square */
+        q63_t quotient, remainder;                     /* sumShifted = quotient * numSamples + remainder */
+
+  /* Mean of squares, as in arm_var_q31 */
+  meanOfSquares = S->sumOfSquares / (numSamples - 1);
+
+  /* Square of mean: sumShifted^2 / (numSamples * (numSamples - 1)), split so the products fit in 64 bits */
+  quotient = sumShifted / numSamples;
+  remainder = sumShifted - quotient * numSamples;
+  squareOfMean = (sumShifted * quotient) / (numSamples - 1)
+               + (sumShifted * remainder) / (numSamples * (numSamples - 1));
+
+  return ((meanOfSquares > squareOfMean) ? meanOfSquares - squareOfMean : 0);
+}
+
+/**
+  @brief         Variance of the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding-window statistics structure.
+  @param[out]    pResult  variance returned here (0 with less than two samples)
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   As \ref arm_var_q31(), the samples are used in 1.23 format and the result is
+                   divided by the number of samples minus one. The square of the mean is
+                   computed in two parts so that it does not overflow for long windows; the
+                   result can differ from \ref arm_var_q31() in the least significant bit.
+                   It is saturated to 1.31 format.
+ */
+void arm_stats_window_var_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->numSamples <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  *pResult = clip_q63_to_q31(arm_stats_window_var46_q31(S) >> 15U);
+}
+
+/**
+  @brief         Standard deviation of the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding-window statistics structure.
+  @param[out]    pResult  standard deviation returned here
+  @return        none
+ */
+void arm_stats_window_std_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult)
+{
+  q31_t var;                                     /* Variance of the window */
+
+  arm_stats_window_var_q31(S, &var);
+  arm_sqrt_q31(var, pResult);
+}
+
+/**
+  @brief         Root Mean Square of the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding-window statistics structure.
+  @param[out]    pResult  RMS value returned here (0 if the window is empty)
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The mean square comes from the 1.23 samples of the variance, so it does not
+                   overflow like the 2.62 accumulator of \ref arm_rms_q31(); the result can
+                   differ from it in the 8 least significant bits. It is saturated to 1.31 format.
+ */
+void arm_stats_window_rms_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / (q63_t) S->numSamples) >> 15U), pResult);
+}
+
+/**
+  @brief         Maximum of the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding-window statistics structure.
+  @param[out]    pResult  maximum value returned here (0 if the window is empty)
+  @param[out]    pIndex   position of the maximum in the window returned here, 0 being the oldest sample
+  @return        none
+ */
+void arm_stats_window_max_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex)
+{
+  uint32_t slot, oldest;                         /* Slots of the maximum and the oldest sample */
+
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  slot = S->pQueue[S->maxHead];
+  oldest = (S->numSamples == S->windowLen) ? S->writeIndex : 0U;
+
+  *pResult = S->pBuffer[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+  @brief         Minimum of the Q31 sliding window.
+  @param[in]     S        points to an instance of the Q31 sliding-window statistics structure.
+  @param[out]    pResult  minimum value returned here (0 if the window is empty)
+  @param[out]    pIndex   position of the minimum in the window returned here, 0 being the oldest sample
+  @return        none
+ */
+void arm_stats_window_min_q31(
+  const arm_stats_window_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex)
+{
+  uint32_t slot, oldest;                         /* Slots of the minimum and the oldest sample */
+
+  if (S->numSamples == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  slot = S->pQueue[S->windowLen + S->minHead];
+  oldest = (S->numSamples == S->windowLen) ? S->writeIndex : 0U;
+
+  *pResult = S->pBuffer[slot];
+  *pIndex = (slot >= oldest) ? slot - oldest : slot + S->windowLen - oldest;
+}
+
+/**
+  @} end of StatsWindow group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_window_init_f32.c
+ * Description:  Initialization function for the floating-point sliding-window statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsWindow
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding-window statistics.
+  @param[in,out] S          points to an instance of the floating-point sliding-window statistics structure.
+  @param[in]     windowLen  window length in samples.
+  @param[in]     pBuffer    points to the window buffer of <code>windowLen</code> samples.
+  @param[in]     pQueue     points to the queue buffer of <code>2*windowLen</code> words.
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowLen</code> is zero
+
+  @par           Details
+                   The window starts empty. <code>pBuffer</code> and <code>pQueue</code> are
+                   owned by the instance until it is discarded; their previous contents
+                   are ignored.
+ */
+arm_status arm_stats_window_init_f32(
+        arm_stats_window_instance_f32 * S,
+        uint32_t windowLen,
+        float32_t * pBuffer,
+        uint32_t * pQueue)
+{
+  if (windowLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign window length and buffers */
+  S->windowLen = windowLen;
+  S->pBuffer = pBuffer;
+  S->pQueue = pQueue;
+
+  /* Empty window and queues */
+  S->numSamples = 0U;
+  S->writeIndex = 0U;
+  S->maxHead = 0U;
+  S->maxCount = 0U;
+  S->minHead = 0U;
+  S->minCount = 0U;
+
+  /* Clear the running sums */
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->sumOfSquares = 0.0f;
+  S->passMean = 0.0f;
+  S->passM2 = 0.0f;
+  S->passSquares = 0.0f;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of StatsWindow group
+ */
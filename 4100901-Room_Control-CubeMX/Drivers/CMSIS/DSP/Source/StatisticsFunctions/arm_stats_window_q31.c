@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_window_q31.c
+ * Description:  Q31 sliding-window statistics update
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @brief         Fills the window with windowLen new samples: the sums are computed
+                 over them and the queues are built from the newest sample back.
+ */
+static void arm_stats_window_refill_q31(
+        arm_stats_window_instance_q31 * S,
+  const q31_t * pSrc)
+{
+        q31_t *pBuffer = S->pBuffer;                   /* Window buffer */
+        uint32_t windowLen = S->windowLen;             /* Window length */
+        uint32_t *pMaxQueue = S->pQueue;               /* Queue of the maximum */
+        uint32_t *pMinQueue = S->pQueue + windowLen;   /* Queue of the minimum */
+        uint32_t maxHead = windowLen;                  /* The queues are filled from their end */
+        uint32_t minHead = windowLen;
+        q63_t sum = 0;                                 /* Sum of the window */
+        q63_t sumShifted = 0;                          /* Sum of the 1.23 samples */
+        q63_t sumOfSquares = 0;                        /* Sum of squares of the 1.23 samples */
+        q31_t in, shifted, maxVal, minVal;             /* Temporary variables */
+        uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < windowLen; i++)
+  {
+    in = pSrc[i];
+    pBuffer[i] = in;
+    sum += in;
+    shifted = in >> 8U;
+    sumShifted += shifted;
+    sumOfSquares += ((q63_t) shifted * shifted);
+  }
+
+  /* A sample stays in the queue of the maximum if no later sample is greater
+     (ties keep the oldest), and in that of the minimum if none is smaller */
+  maxVal = pBuffer[windowLen - 1U];
+  minVal = maxVal;
+  for (i = windowLen; i > 0U; i--)
+  {
+    in = pBuffer[i - 1U];
+
+    if (in >= maxVal)
+    {
+      maxVal = in;
+      pMaxQueue[--maxHead] = i - 1U;
+    }
+    if (in <= minVal)
+    {
+      minVal = in;
+      pMinQueue[--minHead] = i - 1U;
+    }
+  }
+
+  /* Full window, the next sample overwrites slot 0 */
+  S->numSamples = windowLen;
+  S->writeIndex = 0U;
+  S->maxHead = maxHead;
+  S->maxCount = windowLen - maxHead;
+  S->minHead = minHead;
+  S->minCount = windowLen - minHead;
+  S->sum = sum;
+  S->sumShifted = sumShifted;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup StatsWindow
+  @{
+ */
+
+/**
+  @brief         Adds samples to the Q31 sliding window.
+  @param[in,out] S          points to an instance of the Q31 sliding-window statistics structure.
+  @param[in]     pSrc       points to the new samples.
+  @param[in]     blockSize  number of samples to add.
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The sum of the samples is kept in 33.31 format, as in \ref arm_mean_q31().
+                   For the variance, the samples are shifted right by 8 bits to 1.23 format
+                   and their sum and sum of squares (17.46 format) are kept, as in \ref arm_var_q31().
+                   All the sums are exact, so removing the sample that leaves the window
+                   undoes its contribution exactly.
+  @par
+                   A block of <code>windowLen</code> samples or more replaces the whole
+                   window. Nothing is left to slide, so its last <code>windowLen</code>
+                   samples are copied and the sums and queues recomputed over them,
+                   which is cheaper than adding them one by one.
+ */
+void arm_stats_window_q31(
+        arm_stats_window_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        q31_t *pBuffer = S->pBuffer;                   /* Window buffer */
+        uint32_t windowLen = S->windowLen;             /* Window length */
+        uint32_t *pMaxQueue = S->pQueue;               /* Queue of the maximum */
+        uint32_t *pMinQueue = S->pQueue + windowLen;   /* Queue of the minimum */
+        uint32_t numSamples = S->numSamples;           /* Samples in the window */
+        uint32_t writeIndex = S->writeIndex;           /* Slot of the next sample */
+        uint32_t maxHead = S->maxHead, maxCount = S->maxCount;
+        uint32_t minHead = S->minHead, minCount = S->minCount;
+        uint32_t back;                                 /* Slot of a queue entry */
+        q63_t sum = S->sum;                            /* Running sum */
+        q63_t sumShifted = S->sumShifted;              /* Running sum of the 1.23 samples */
+        q63_t sumOfSquares = S->sumOfSquares;          /* Running sum of squares of the 1.23 samples */
+        q31_t in, out, shifted;                        /* Temporary variables */
+        uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  if (blockSize >= windowLen)
+  {
+    /* Only the last windowLen samples stay in the window */
+    arm_stats_window_refill_q31(S, pSrc + (blockSize - windowLen));
+    return;
+  }
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (numSamples == windowLen)
+    {
+      /* The oldest sample, at writeIndex, leaves the window */
+      out = pBuffer[writeIndex];
+
+      /* If it is the front of a queue, it is dropped. A full window keeps at least one entry in each queue. */
+      if (pMaxQueue[maxHead] == writeIndex)
+      {
+        maxHead = (maxHead + 1U == windowLen) ? 0U : maxHead + 1U;
+        maxCount--;
+      }
+      if (pMinQueue[minHead] == writeIndex)
+      {
+        minHead = (minHead + 1U == windowLen) ? 0U : minHead + 1U;
+        minCount--;
+      }
+
+      sum -= out;
+      shifted = out >> 8U;
+      sumShifted -= shifted;
+      sumOfSquares -= ((q63_t) shifted * shifted);
+    }
+    else
+    {
+      numSamples++;
+    }
+
+    pBuffer[writeIndex] = in;
+
+    sum += in;
+    shifted = in >> 8U;
+    sumShifted += shifted;
+    sumOfSquares += ((q63_t) shifted * shifted);
+
+    /* Queue of the maximum: drop from the back the samples smaller than in, then queue it */
+    while (maxCount > 0U)
+    {
+      back = maxHead + maxCount - 1U;
+      back = (back >= windowLen) ? back - windowLen : back;
+      if (pBuffer[pMaxQueue[back]] >= in)
+      {
+        break;
+      }
+      maxCount--;
+    }
+    back = maxHead + maxCount;
+    pMaxQueue[(back >= windowLen) ? back - windowLen : back] = writeIndex;
+    maxCount++;
+
+    /* Queue of the minimum: drop from the back the samples greater than in, then queue it */
+    while (minCount > 0U)
+    {
+      back = minHead + minCount - 1U;
+      back = (back >= windowLen) ? back - windowLen : back;
+      if (pBuffer[pMinQueue[back]] <= in)
+      {
+        break;
+      }
+      minCount--;
+    }
+    back = minHead + minCount;
+    pMinQueue[(back >= windowLen) ? back - windowLen : back] = writeIndex;
+    minCount++;
+
+    writeIndex = (writeIndex + 1U == windowLen) ? 0U : writeIndex + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store the updated state */
+  S->numSamples = numSamples;
+  S->writeIndex = writeIndex;
+  S->maxHead = maxHead;
+  S->maxCount = maxCount;
+  S->minHead = minHead;
+  S->minCount = minCount;
+  S->sum = sum;
+  S->sumShifted = sumShifted;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @} end of StatsWindow group
+ */
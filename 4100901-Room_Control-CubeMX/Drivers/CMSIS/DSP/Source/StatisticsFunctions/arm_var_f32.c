@@ -126,6 +126,14 @@ void arm_var_f32(
         uint32_t blockSize,
         float32_t * pResult)
 {
+#if defined(ARM_MATH_X86_SIMD)
+  if (arm_x86_simd_level() != ARM_X86_SIMD_NONE)
+  {
+    arm_var_f32_x86(pSrc, blockSize, pResult);
+    return;
+  }
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
         uint32_t blkCnt;                               /* Loop counter */
         float32_t sum = 0.0f;                          /* Temporary result storage */
         float32_t fSum = 0.0f;
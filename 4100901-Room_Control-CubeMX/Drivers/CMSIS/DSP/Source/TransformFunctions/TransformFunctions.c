@@ -29,6 +29,9 @@
 #include "arm_bitreversal.c"
 #include "arm_bitreversal2.c"
 #include "arm_cfft_f32.c"
+#include "arm_cfft_init_dyn_f32.c"
+#include "arm_cfft_mixed_f32.c"
+#include "arm_cfft_mixed_init_f32.c"
 #include "arm_cfft_q15.c"
 #include "arm_cfft_q31.c"
 #include "arm_cfft_radix2_f32.c"
@@ -56,5 +59,7 @@
 #include "arm_rfft_init_f32.c"
 #include "arm_rfft_init_q15.c"
 #include "arm_rfft_init_q31.c"
+#include "arm_rfft_mixed_f32.c"
+#include "arm_rfft_mixed_init_f32.c"
 #include "arm_rfft_q15.c"
 #include "arm_rfft_q31.c"
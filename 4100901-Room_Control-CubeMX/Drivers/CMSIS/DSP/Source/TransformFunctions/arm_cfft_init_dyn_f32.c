@@ -0,0 +1,341 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_dyn_f32.c
+ * Description:  Floating-point CFFT / RFFT initialization with tables
+ *               generated at run time in a caller-supplied RAM arena
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * Twiddles are evaluated for one octant [0, pi/4] and mirrored to the full
+ * circle. Every ARM_CFFT_DYN_TWIDDLE_PERIOD points the value is recomputed with
+ * a polynomial (periodic correction); in between, a complex rotation by one step
+ * is used. 1 evaluates the polynomial for every point.
+ */
+#ifndef ARM_CFFT_DYN_TWIDDLE_PERIOD
+#define ARM_CFFT_DYN_TWIDDLE_PERIOD 8U
+#endif
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/**
+  @brief         log2 of a supported FFT length (16 to 4096), 0 otherwise.
+ */
+static uint32_t arm_cfft_dyn_log2(uint32_t fftLen)
+{
+  uint32_t log2N = 0U;
+
+  if ((fftLen < 16U) || (fftLen > 4096U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return 0U;
+  }
+  while ((1U << log2N) < fftLen)
+  {
+    log2N++;
+  }
+  return log2N;
+}
+
+/**
+  @brief         Output order of arm_cfft_f32: radix-8 digit reversal, with the
+                 log2N % 3 leftover bits as the least significant digit.
+ */
+static uint32_t arm_cfft_dyn_digitrev(uint32_t i, uint32_t log2N)
+{
+  uint32_t low = log2N % 3U;
+  uint32_t out = i & ((1U << low) - 1U);
+  uint32_t k;
+
+  i >>= low;
+  for (k = 0U; k < log2N / 3U; k++)
+  {
+    out = (out << 3U) | (i & 7U);
+    i >>= 3U;
+  }
+  return out;
+}
+
+/**
+  @brief         Builds the swap list applied by arm_bitreversal_32.
+  @param[out]    pTable  byte offsets (index * 8) of each swap pair, or NULL to only count
+  @return        number of uint16_t entries (bitRevLength)
+
+  Each cycle of the permutation, started at its smallest element, costs one
+  swap less than its length: the result has the same length as the
+  armBitRevIndexTable<N> table of the same size.
+ */
+static uint32_t arm_cfft_dyn_bitrev(uint16_t * pTable, uint32_t log2N)
+{
+  uint32_t N = 1U << log2N;
+  uint32_t count = 0U;
+  uint32_t s, j;
+
+  for (s = 0U; s < N; s++)
+  {
+    /* Skip cycles already visited from a smaller element */
+    j = arm_cfft_dyn_digitrev(s, log2N);
+    while (j > s)
+    {
+      j = arm_cfft_dyn_digitrev(j, log2N);
+    }
+    if (j < s)
+    {
+      continue;
+    }
+
+    j = s;
+    while (arm_cfft_dyn_digitrev(j, log2N) != s)
+    {
+      uint32_t next = arm_cfft_dyn_digitrev(j, log2N);
+      if (pTable != NULL)
+      {
+        pTable[count]      = (uint16_t)(j * 8U);
+        pTable[count + 1U] = (uint16_t)(next * 8U);
+      }
+      count += 2U;
+      j = next;
+    }
+  }
+  return count;
+}
+
+/**
+  @brief         sin and cos for 0 <= x <= pi/4 (Taylor series, error below float rounding).
+ */
+static void arm_cfft_dyn_sincos(float32_t x, float32_t * pSin, float32_t * pCos)
+{
+  float32_t x2 = x * x;
+
+  *pSin = x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f)))));
+  *pCos = 1.0f + x2 * (-0.5f + x2 * (1.0f / 24.0f + x2 * (-1.0f / 720.0f + x2 * (1.0f / 40320.0f + x2 * (-1.0f / 3628800.0f)))));
+}
+
+/**
+  @brief         Stores the twiddle of angle 2*pi*j/M in the tables that use it.
+  @param[out]    pCfft  CFFT table of M >> shift points (cos, sin interleaved)
+  @param[out]    pRfft  RFFT table of M real points (sin, cos interleaved, j < M/2), or NULL
+ */
+static void arm_cfft_dyn_store(
+        float32_t * pCfft,
+        uint32_t shift,
+        float32_t * pRfft,
+        uint32_t M,
+        uint32_t j,
+        float32_t c,
+        float32_t s)
+{
+  j &= (M - 1U);
+  if ((j & ((1U << shift) - 1U)) == 0U)
+  {
+    pCfft[2U * (j >> shift)]      = c;
+    pCfft[2U * (j >> shift) + 1U] = s;
+  }
+  if ((pRfft != NULL) && (j < M / 2U))
+  {
+    pRfft[2U * j]      = s;
+    pRfft[2U * j + 1U] = c;
+  }
+}
+
+/**
+  @brief         Fills the twiddle tables of an M-point circle from its first octant.
+ */
+static void arm_cfft_dyn_twiddles(
+        float32_t * pCfft,
+        uint32_t shift,
+        float32_t * pRfft,
+        uint32_t M)
+{
+  const float32_t step = 2.0f * PI / (float32_t)M;
+  float32_t stepSin, stepCos, s = 0.0f, c = 1.0f, t;
+  uint32_t k;
+
+  arm_cfft_dyn_sincos(step, &stepSin, &stepCos);
+  for (k = 0U; k <= M / 8U; k++)
+  {
+    if (k == M / 8U)
+    {
+      /* pi/4: both values exactly equal so the mirrored points agree */
+      s = 0.70710678118654752440f;
+      c = s;
+    }
+    else if ((k % ARM_CFFT_DYN_TWIDDLE_PERIOD) == 0U)
+    {
+      arm_cfft_dyn_sincos((float32_t)k * step, &s, &c);
+    }
+
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, k, c, s);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, M / 4U - k, s, c);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, M / 4U + k, -s, c);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, M / 2U - k, -c, s);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, M / 2U + k, -c, -s);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, 3U * M / 4U - k, -s, -c);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, 3U * M / 4U + k, s, -c);
+    arm_cfft_dyn_store(pCfft, shift, pRfft, M, M - k, c, -s);
+
+    /* Next point by rotation */
+    t = c * stepCos - s * stepSin;
+    s = s * stepCos + c * stepSin;
+    c = t;
+  }
+}
+
+/**
+  @brief         Arena size needed by arm_cfft_init_dyn_f32.
+  @param[in]     fftLen  length of the FFT (16 to 4096, power of 2)
+  @return        size in bytes (at most 12 * fftLen), 0 if fftLen is not supported
+ */
+uint32_t arm_cfft_init_dyn_size_f32(
+        uint16_t fftLen)
+{
+  uint32_t log2N = arm_cfft_dyn_log2(fftLen);
+
+  if (log2N == 0U)
+  {
+    return 0U;
+  }
+  return 2U * fftLen * sizeof(float32_t) + arm_cfft_dyn_bitrev(NULL, log2N) * sizeof(uint16_t);
+}
+
+/**
+  @brief         Initialization of the floating-point CFFT with tables generated in RAM.
+  @param[out]    S          points to an arm_cfft_instance_f32 structure
+  @param[in]     fftLen     length of the FFT (16 to 4096, power of 2)
+  @param[in]     pArena     word-aligned RAM for the tables; must outlive S
+  @param[in]     arenaSize  size of pArena in bytes (see arm_cfft_init_dyn_size_f32)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported length or arena too small
+
+  @par
+                 Same tables as arm_cfft_sR_f32_len<fftLen> (twiddles within a few
+                 float ulps, identical bit reversal), without keeping them in flash.
+                 Placing the arena in zero-wait-state RAM also avoids the flash
+                 wait states in the FFT butterflies.
+ */
+arm_status arm_cfft_init_dyn_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen,
+        void * pArena,
+        uint32_t arenaSize)
+{
+  uint32_t log2N = arm_cfft_dyn_log2(fftLen);
+  float32_t *pTwiddle = (float32_t *) pArena;
+  uint16_t *pBitRev;
+
+  if ((S == NULL) || (pArena == NULL) || (log2N == 0U) || (arenaSize < arm_cfft_init_dyn_size_f32(fftLen)))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  pBitRev = (uint16_t *) (pTwiddle + 2U * fftLen);
+  arm_cfft_dyn_twiddles(pTwiddle, 0U, NULL, fftLen);
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->bitRevLength = (uint16_t) arm_cfft_dyn_bitrev(pBitRev, log2N);
+  S->pBitRevTable = pBitRev;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFT group
+ */
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Arena size needed by arm_rfft_fast_init_dyn_f32.
+  @param[in]     fftLen  length of the real FFT (32 to 4096, power of 2)
+  @return        size in bytes (at most 10 * fftLen), 0 if fftLen is not supported
+ */
+uint32_t arm_rfft_fast_init_dyn_size_f32(
+        uint16_t fftLen)
+{
+  uint32_t size = arm_cfft_init_dyn_size_f32(fftLen / 2U);
+
+  return (size == 0U) ? 0U : size + fftLen * sizeof(float32_t);
+}
+
+/**
+  @brief         Initialization of the floating-point real FFT with tables generated in RAM.
+  @param[out]    S          points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     fftLen     length of the real FFT (32 to 4096, power of 2)
+  @param[in]     pArena     word-aligned RAM for the tables; must outlive S
+  @param[in]     arenaSize  size of pArena in bytes (see arm_rfft_fast_init_dyn_size_f32)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported length or arena too small
+
+  @par
+                 Replaces arm_rfft_fast_init_f32 when the twiddleCoef_<fftLen/2>,
+                 armBitRevIndexTable<fftLen/2> and twiddleCoef_rfft_<fftLen> tables
+                 are not compiled in (ARM_DSP_CONFIG_TABLES).
+ */
+arm_status arm_rfft_fast_init_dyn_f32(
+        arm_rfft_fast_instance_f32 * S,
+        uint16_t fftLen,
+        void * pArena,
+        uint32_t arenaSize)
+{
+  uint32_t log2N = arm_cfft_dyn_log2(fftLen / 2U);
+  arm_cfft_instance_f32 *Sint;
+  float32_t *pTwiddle = (float32_t *) pArena;
+  float32_t *pTwiddleRFFT;
+  uint16_t *pBitRev;
+
+  if ((S == NULL) || (pArena == NULL) || (log2N == 0U) || (arenaSize < arm_rfft_fast_init_dyn_size_f32(fftLen)))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* The CFFT of fftLen/2 points uses the even points of the fftLen circle */
+  pTwiddleRFFT = pTwiddle + fftLen;
+  pBitRev = (uint16_t *) (pTwiddleRFFT + fftLen);
+  arm_cfft_dyn_twiddles(pTwiddle, 1U, pTwiddleRFFT, fftLen);
+
+  Sint = &(S->Sint);
+  Sint->fftLen = fftLen / 2U;
+  Sint->pTwiddle = pTwiddle;
+  Sint->bitRevLength = (uint16_t) arm_cfft_dyn_bitrev(pBitRev, log2N);
+  Sint->pBitRevTable = pBitRev;
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,465 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5, 8) Decimation in Time CFFT Floating point processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * Iterative decimation in time on interleaved complex data. The stage with the
+ * last factor of pFactors (the innermost one) reads pSrc in digit-reversed order
+ * and writes pDst, so there is no separate reordering pass; the other stages run
+ * in place on pDst, from the inner factors to pFactors[0].
+ *
+ * Butterflies compute the forward transform only, with the radix constants
+ * folded in. The inverse one is conj(FFT(conj(x))) / fftLen: the first stage
+ * conjugates the input and the scaling pass conjugates the output.
+ *
+ * The stage of radix p and span m (it combines p transforms of m points into
+ * one of n = p*m points) uses twiddles W_n^(j*u), 1 <= j < p, for columns
+ * 1 <= u < m, stored in that order by arm_cfft_mixed_init_f32(). Column 0 needs
+ * no product.
+ */
+
+/**
+  @brief         Radix-2 butterfly: x holds the 2 inputs, outputs go to pOut[k*stride].
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly2_f32(
+        float32_t * pOut,
+        uint32_t stride,
+  const float32_t * x)
+{
+  pOut[0]                = x[0] + x[2];
+  pOut[1]                = x[1] + x[3];
+  pOut[2U * stride]      = x[0] - x[2];
+  pOut[2U * stride + 1U] = x[1] - x[3];
+}
+
+/**
+  @brief         Radix-3 butterfly: x holds the 3 inputs, outputs go to pOut[k*stride].
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly3_f32(
+        float32_t * pOut,
+        uint32_t stride,
+  const float32_t * x)
+{
+  const float32_t s60 = 0.86602540378443864676f;          /* sin(2*pi/3) */
+  float32_t sr, si, dr, di, tr, ti;
+
+  sr = x[2] + x[4];
+  si = x[3] + x[5];
+  dr = (x[2] - x[4]) * s60;
+  di = (x[3] - x[5]) * s60;
+  tr = x[0] - 0.5f * sr;
+  ti = x[1] - 0.5f * si;
+
+  /* X1 = t - i*sin(2*pi/3)*(x1 - x2), X2 = t + i*sin(2*pi/3)*(x1 - x2) */
+  pOut[0]                     = x[0] + sr;
+  pOut[1]                     = x[1] + si;
+  pOut[2U * stride]           = tr + di;
+  pOut[2U * stride + 1U]      = ti - dr;
+  pOut[2U * 2U * stride]      = tr - di;
+  pOut[2U * 2U * stride + 1U] = ti + dr;
+}
+
+/**
+  @brief         Radix-4 butterfly: x holds the 4 inputs, outputs go to pOut[k*stride].
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly4_f32(
+        float32_t * pOut,
+        uint32_t stride,
+  const float32_t * x)
+{
+  float32_t ar, ai, br, bi, cr, ci, dr, di;
+
+  ar = x[0] + x[4];
+  ai = x[1] + x[5];
+  br = x[0] - x[4];
+  bi = x[1] - x[5];
+  cr = x[2] + x[6];
+  ci = x[3] + x[7];
+  dr = x[2] - x[6];
+  di = x[3] - x[7];
+
+  /* X1 = b - i*(x1 - x3), X3 = b + i*(x1 - x3) */
+  pOut[0]                     = ar + cr;
+  pOut[1]                     = ai + ci;
+  pOut[2U * stride]           = br + di;
+  pOut[2U * stride + 1U]      = bi - dr;
+  pOut[2U * 2U * stride]      = ar - cr;
+  pOut[2U * 2U * stride + 1U] = ai - ci;
+  pOut[2U * 3U * stride]      = br - di;
+  pOut[2U * 3U * stride + 1U] = bi + dr;
+}
+
+/**
+  @brief         Radix-5 butterfly: x holds the 5 inputs, outputs go to pOut[k*stride].
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly5_f32(
+        float32_t * pOut,
+        uint32_t stride,
+  const float32_t * x)
+{
+  /* cos and sin of 2*pi/5 (a) and 4*pi/5 (b) */
+  const float32_t car =  0.30901699437494742410f;
+  const float32_t sai =  0.95105651629515357212f;
+  const float32_t cbr = -0.80901699437494742410f;
+  const float32_t sbi =  0.58778525229247312917f;
+  float32_t s7r, s7i, s8r, s8i, s9r, s9i, s10r, s10i;
+  float32_t s5r, s5i, s6r, s6i, s11r, s11i, s12r, s12i;
+
+  s7r  = x[2] + x[8];
+  s7i  = x[3] + x[9];
+  s10r = x[2] - x[8];
+  s10i = x[3] - x[9];
+  s8r  = x[4] + x[6];
+  s8i  = x[5] + x[7];
+  s9r  = x[4] - x[6];
+  s9i  = x[5] - x[7];
+
+  s5r  = x[0] + s7r * car + s8r * cbr;
+  s5i  = x[1] + s7i * car + s8i * cbr;
+  s6r  = s10i * sai + s9i * sbi;
+  s6i  = -s10r * sai - s9r * sbi;
+  s11r = x[0] + s7r * cbr + s8r * car;
+  s11i = x[1] + s7i * cbr + s8i * car;
+  s12r = s9i * sai - s10i * sbi;
+  s12i = s10r * sbi - s9r * sai;
+
+  pOut[0]                     = x[0] + s7r + s8r;
+  pOut[1]                     = x[1] + s7i + s8i;
+  pOut[2U * stride]           = s5r + s6r;
+  pOut[2U * stride + 1U]      = s5i + s6i;
+  pOut[2U * 2U * stride]      = s11r - s12r;
+  pOut[2U * 2U * stride + 1U] = s11i - s12i;
+  pOut[2U * 3U * stride]      = s11r + s12r;
+  pOut[2U * 3U * stride + 1U] = s11i + s12i;
+  pOut[2U * 4U * stride]      = s5r - s6r;
+  pOut[2U * 4U * stride + 1U] = s5i - s6i;
+}
+
+/**
+  @brief         Radix-8 butterfly: x holds the 8 inputs, outputs go to pOut[k*stride].
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly8_f32(
+        float32_t * pOut,
+        uint32_t stride,
+  const float32_t * x)
+{
+  const float32_t c45 = 0.70710678118654752440f;          /* cos(pi/4) */
+  float32_t ar, ai, br, bi, cr, ci, dr, di;
+  float32_t e0r, e0i, e1r, e1i, e2r, e2i, e3r, e3i;
+  float32_t o0r, o0i, o1r, o1i, o2r, o2i, o3r, o3i, tr;
+
+  /* Radix-4 on the even inputs */
+  ar = x[0] + x[8];
+  ai = x[1] + x[9];
+  br = x[0] - x[8];
+  bi = x[1] - x[9];
+  cr = x[4] + x[12];
+  ci = x[5] + x[13];
+  dr = x[4] - x[12];
+  di = x[5] - x[13];
+  e0r = ar + cr;
+  e0i = ai + ci;
+  e1r = br + di;
+  e1i = bi - dr;
+  e2r = ar - cr;
+  e2i = ai - ci;
+  e3r = br - di;
+  e3i = bi + dr;
+
+  /* Radix-4 on the odd inputs */
+  ar = x[2] + x[10];
+  ai = x[3] + x[11];
+  br = x[2] - x[10];
+  bi = x[3] - x[11];
+  cr = x[6] + x[14];
+  ci = x[7] + x[15];
+  dr = x[6] - x[14];
+  di = x[7] - x[15];
+  o0r = ar + cr;
+  o0i = ai + ci;
+  o1r = br + di;
+  o1i = bi - dr;
+  o2r = ar - cr;
+  o2i = ai - ci;
+  o3r = br - di;
+  o3i = bi + dr;
+
+  /* Odd half times W8^k: (1 - i)/sqrt(2), -i, -(1 + i)/sqrt(2) */
+  tr  = (o1r + o1i) * c45;
+  o1i = (o1i - o1r) * c45;
+  o1r = tr;
+  tr  = o2i;
+  o2i = -o2r;
+  o2r = tr;
+  tr  = (o3i - o3r) * c45;
+  o3i = -(o3r + o3i) * c45;
+  o3r = tr;
+
+  pOut[0]                     = e0r + o0r;
+  pOut[1]                     = e0i + o0i;
+  pOut[2U * stride]           = e1r + o1r;
+  pOut[2U * stride + 1U]      = e1i + o1i;
+  pOut[2U * 2U * stride]      = e2r + o2r;
+  pOut[2U * 2U * stride + 1U] = e2i + o2i;
+  pOut[2U * 3U * stride]      = e3r + o3r;
+  pOut[2U * 3U * stride + 1U] = e3i + o3i;
+  pOut[2U * 4U * stride]      = e0r - o0r;
+  pOut[2U * 4U * stride + 1U] = e0i - o0i;
+  pOut[2U * 5U * stride]      = e1r - o1r;
+  pOut[2U * 5U * stride + 1U] = e1i - o1i;
+  pOut[2U * 6U * stride]      = e2r - o2r;
+  pOut[2U * 6U * stride + 1U] = e2i - o2i;
+  pOut[2U * 7U * stride]      = e3r - o3r;
+  pOut[2U * 7U * stride + 1U] = e3i - o3i;
+}
+
+/**
+  @brief         Butterfly of the given radix; radix is a constant at every call site.
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly_f32(
+        float32_t * pOut,
+        uint32_t stride,
+  const float32_t * x,
+        uint32_t radix)
+{
+  switch (radix)
+  {
+  case 2U:
+    arm_cfft_mixed_bfly2_f32(pOut, stride, x);
+    break;
+  case 3U:
+    arm_cfft_mixed_bfly3_f32(pOut, stride, x);
+    break;
+  case 4U:
+    arm_cfft_mixed_bfly4_f32(pOut, stride, x);
+    break;
+  case 8U:
+    arm_cfft_mixed_bfly8_f32(pOut, stride, x);
+    break;
+  default:
+    arm_cfft_mixed_bfly5_f32(pOut, stride, x);
+    break;
+  }
+}
+
+/**
+  @brief         First stage (span 1): butterflies on the digit-reversed input.
+  @param[in]     conj  1 for the forward transform, -1 to conjugate the input
+ */
+__STATIC_FORCEINLINE void arm_cfft_mixed_first_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t conj,
+        uint32_t radix)
+{
+  uint32_t numStages = S->numStages;
+  uint32_t stride = S->fftLen / radix;
+  uint32_t weight[16];                           /* Input step of each digit */
+  uint8_t digit[16];                             /* Digits of the group index */
+  uint32_t g, j, base;
+  int32_t s;
+  float32_t x[16];
+
+  weight[0] = 1U;
+  digit[0] = 0U;
+  for (s = 1; s < (int32_t)numStages; s++)
+  {
+    weight[s] = weight[s - 1] * S->pFactors[s - 1];
+    digit[s] = 0U;
+  }
+
+  base = 0U;
+  for (g = 0U; g < stride; g++)
+  {
+    for (j = 0U; j < radix; j++)
+    {
+      x[2U * j]      = pSrc[2U * (base + j * stride)];
+      x[2U * j + 1U] = pSrc[2U * (base + j * stride) + 1U] * conj;
+    }
+    arm_cfft_mixed_bfly_f32(pDst + 2U * radix * g, 1U, x, radix);
+
+    /* Next group: counter over the other digits, pFactors[numStages - 2] first */
+    for (s = (int32_t)numStages - 2; s >= 0; s--)
+    {
+      base += weight[s];
+      if (++digit[s] < S->pFactors[s])
+      {
+        break;
+      }
+      digit[s] = 0U;
+      base -= S->pFactors[s] * weight[s];
+    }
+  }
+}
+
+/**
+  @brief         One in-place stage of the given radix and span m.
+  @return        twiddles of the next stage
+ */
+__STATIC_FORCEINLINE const float32_t * arm_cfft_mixed_pass_f32(
+        float32_t * p,
+        uint32_t fftLen,
+        uint32_t m,
+  const float32_t * pTw,
+        uint32_t radix)
+{
+  uint32_t n = radix * m;
+  uint32_t u, g, j;
+  float32_t x[16], w[14], xr, xi;
+
+  /* Column 0: all the twiddles are 1 */
+  for (g = 0U; g < fftLen; g += n)
+  {
+    for (j = 0U; j < radix; j++)
+    {
+      x[2U * j]      = p[2U * (g + j * m)];
+      x[2U * j + 1U] = p[2U * (g + j * m) + 1U];
+    }
+    arm_cfft_mixed_bfly_f32(p + 2U * g, m, x, radix);
+  }
+
+  for (u = 1U; u < m; u++)
+  {
+    for (j = 0U; j < 2U * (radix - 1U); j++)
+    {
+      w[j] = pTw[j];
+    }
+    pTw += 2U * (radix - 1U);
+
+    for (g = u; g < fftLen; g += n)
+    {
+      x[0] = p[2U * g];
+      x[1] = p[2U * g + 1U];
+      for (j = 1U; j < radix; j++)
+      {
+        /* Multiply by cos - i*sin */
+        xr = p[2U * (g + j * m)];
+        xi = p[2U * (g + j * m) + 1U];
+        x[2U * j]      = xr * w[2U * j - 2U] + xi * w[2U * j - 1U];
+        x[2U * j + 1U] = xi * w[2U * j - 2U] - xr * w[2U * j - 1U];
+      }
+      arm_cfft_mixed_bfly_f32(p + 2U * g, m, x, radix);
+    }
+  }
+
+  return pTw;
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix complex FFT.
+  @param[in]     S         points to an instance of the arm_cfft_mixed_instance_f32 structure
+  @param[in]     pSrc      points to the complex input buffer of size 2*fftLen (not modified)
+  @param[out]    pDst      points to the complex output buffer of size 2*fftLen, in natural order
+  @param[in]     ifftFlag  flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform (scaled by 1/fftLen, like arm_cfft_f32)
+  @return        none
+
+  @par
+                   Unlike arm_cfft_f32 the transform is out of place: pSrc and pDst must
+                   not overlap. The first stage reads pSrc in digit-reversed order, so
+                   there is no bitReverseFlag.
+ */
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint8_t ifftFlag)
+{
+  const float32_t *pTw = S->pTwiddle;
+  uint32_t fftLen = S->fftLen;
+  float32_t conj = (ifftFlag == 1U) ? -1.0f : 1.0f;
+  uint32_t m, k;
+  int32_t s;
+
+  switch (S->pFactors[S->numStages - 1U])
+  {
+  case 2U:
+    arm_cfft_mixed_first_f32(S, pSrc, pDst, conj, 2U);
+    break;
+  case 3U:
+    arm_cfft_mixed_first_f32(S, pSrc, pDst, conj, 3U);
+    break;
+  case 4U:
+    arm_cfft_mixed_first_f32(S, pSrc, pDst, conj, 4U);
+    break;
+  case 8U:
+    arm_cfft_mixed_first_f32(S, pSrc, pDst, conj, 8U);
+    break;
+  default:
+    arm_cfft_mixed_first_f32(S, pSrc, pDst, conj, 5U);
+    break;
+  }
+
+  m = S->pFactors[S->numStages - 1U];
+  for (s = (int32_t)S->numStages - 2; s >= 0; s--)
+  {
+    switch (S->pFactors[s])
+    {
+    case 2U:
+      pTw = arm_cfft_mixed_pass_f32(pDst, fftLen, m, pTw, 2U);
+      break;
+    case 3U:
+      pTw = arm_cfft_mixed_pass_f32(pDst, fftLen, m, pTw, 3U);
+      break;
+    case 4U:
+      pTw = arm_cfft_mixed_pass_f32(pDst, fftLen, m, pTw, 4U);
+      break;
+    case 8U:
+      pTw = arm_cfft_mixed_pass_f32(pDst, fftLen, m, pTw, 8U);
+      break;
+    default:
+      pTw = arm_cfft_mixed_pass_f32(pDst, fftLen, m, pTw, 5U);
+      break;
+    }
+    m *= S->pFactors[s];
+  }
+
+  if (ifftFlag == 1U)
+  {
+    float32_t invL = 1.0f / (float32_t)fftLen;
+
+    for (k = 0U; k < fftLen; k++)
+    {
+      pDst[2U * k]      *= invL;
+      pDst[2U * k + 1U] *= -invL;
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFT group
+ */
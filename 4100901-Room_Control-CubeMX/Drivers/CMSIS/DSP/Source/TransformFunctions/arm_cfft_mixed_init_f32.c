@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix CFFT Floating point function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+  @param[out]    S         points to an arm_cfft_mixed_instance_f32 structure
+  @param[in]     fftLen    length of the FFT: any product of 2, 3 and 5 (2 to 65535)
+  @param[out]    pTwiddle  2*fftLen values filled with the twiddle factors; must outlive S
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen has a prime factor other than 2, 3, 5
+
+  @par
+                   Lengths are factored into radix-4 stages first, then 2, 3 and 5; a
+                   radix-2 stage is merged with a radix-4 one into radix 8. The stages
+                   run in that order: the twiddle-free first stage gets the largest
+                   power-of-two radix and the radix-3/5 stages come last, about 5 %
+                   faster than the reverse. Outermost factor first, 160 = 5*4*8,
+                   240 = 5*3*4*4, 480 = 5*3*4*8.
+  @par
+                   For lengths just below a power of two, such as 120, the transform is
+                   about as fast as arm_cfft_f32 of the zero-padded power of two and can
+                   be slower on some cores. Use it when the bins of fftLen itself are
+                   needed; when any frequency grid will do, padding to 128 is simpler and
+                   no slower. Lengths well below the next power of two (80, 160, 240)
+                   are 1.3-1.8x faster than their padded transform.
+  @par
+                   The twiddles are stored per stage, in the order the stages run (last
+                   factor first): for a stage of radix p that builds n-point transforms
+                   from p of m points, cos and sin of 2*pi*j*u/n interleaved for each
+                   column 1 <= u < m and 1 <= j < p. That is fftLen-1 complex values at
+                   most; pTwiddle keeps the 2*fftLen size of twiddleCoef_N.
+ */
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  static const uint8_t radix[] = { 4U, 2U, 3U, 5U };
+  uint32_t n = fftLen;
+  float32_t *pTw = pTwiddle;
+  uint32_t r, m, p, u, j;
+  int32_t s;
+
+  if ((S == NULL) || (pTwiddle == NULL) || (fftLen < 2U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->numStages = 0U;
+  for (r = 0U; r < sizeof(radix); r++)
+  {
+    while ((n % radix[r]) == 0U)
+    {
+      /* A single radix-2 stage is enough: 4 is tried first */
+      S->pFactors[S->numStages++] = radix[r];
+      n /= radix[r];
+    }
+  }
+  if (n != 1U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* A radix-2 stage left after radix-4 ones is merged with the first of them */
+  if ((S->numStages > 1U) && (S->pFactors[0] == 4U))
+  {
+    for (r = 1U; (r < S->numStages) && (S->pFactors[r] != 2U); r++)
+    {
+    }
+    if (r < S->numStages)
+    {
+      S->pFactors[0] = 8U;
+      for (S->numStages--; r < S->numStages; r++)
+      {
+        S->pFactors[r] = S->pFactors[r + 1U];
+      }
+    }
+  }
+
+  /* Factoring order becomes execution order: the first factor is the innermost stage */
+  for (r = 0U; r < S->numStages / 2U; r++)
+  {
+    uint8_t t = S->pFactors[r];
+
+    S->pFactors[r] = S->pFactors[S->numStages - 1U - r];
+    S->pFactors[S->numStages - 1U - r] = t;
+  }
+
+  /* Stages from the innermost factor; the first one (span 1) has no twiddles */
+  m = S->pFactors[S->numStages - 1U];
+  for (s = (int32_t)S->numStages - 2; s >= 0; s--)
+  {
+    p = S->pFactors[s];
+    for (u = 1U; u < m; u++)
+    {
+      for (j = 1U; j < p; j++)
+      {
+        float32_t angle = 2.0f * PI * (float32_t)(j * u) / (float32_t)(p * m);
+
+        *pTw++ = cosf(angle);
+        *pTw++ = sinf(angle);
+      }
+    }
+    m *= p;
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFT group
+ */
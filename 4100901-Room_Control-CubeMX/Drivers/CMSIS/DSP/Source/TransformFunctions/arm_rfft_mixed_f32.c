@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Mixed-radix RFFT Floating point processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_math.h"
+
+/*
+ * Same real stages as stage_rfft_f32 / merge_rfft_f32 (see arm_rfft_fast_f32.c),
+ * done in place: bins k and fftLen/2-k are computed together from the same two
+ * complex values, so each pair can overwrite its inputs.
+ */
+
+static void arm_rfft_mixed_split_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+  uint32_t half = S->Sint.fftLen;
+  uint32_t k, j;
+  float32_t xAR, xAI, xBR, xBI, t1a, t1b;
+
+  /* Pack first and last sample of the frequency domain together */
+  xAR = p[0];
+  xAI = p[1];
+  p[0] = xAR + xAI;
+  p[1] = xAR - xAI;
+
+  for (k = 1U; k <= half / 2U; k++)
+  {
+    j = half - k;
+    xAR = p[2U * k];
+    xAI = p[2U * k + 1U];
+    xBR = p[2U * j];
+    xBI = p[2U * j + 1U];
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+    p[2U * k]      = 0.5f * (xAR + xBR + pCoeff[2U * k] * t1a + pCoeff[2U * k + 1U] * t1b);
+    p[2U * k + 1U] = 0.5f * (xAI - xBI + pCoeff[2U * k + 1U] * t1a - pCoeff[2U * k] * t1b);
+
+    if (j != k)
+    {
+      /* Roles of A and B swapped: t1a changes sign, t1b does not */
+      p[2U * j]      = 0.5f * (xBR + xAR - pCoeff[2U * j] * t1a + pCoeff[2U * j + 1U] * t1b);
+      p[2U * j + 1U] = 0.5f * (xBI - xAI - pCoeff[2U * j + 1U] * t1a - pCoeff[2U * j] * t1b);
+    }
+  }
+}
+
+static void arm_rfft_mixed_merge_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+  uint32_t half = S->Sint.fftLen;
+  uint32_t k, j;
+  float32_t xAR, xAI, xBR, xBI, t1a, t1b;
+
+  xAR = p[0];
+  xAI = p[1];
+  p[0] = 0.5f * (xAR + xAI);
+  p[1] = 0.5f * (xAR - xAI);
+
+  for (k = 1U; k <= half / 2U; k++)
+  {
+    j = half - k;
+    xAR = p[2U * k];
+    xAI = p[2U * k + 1U];
+    xBR = p[2U * j];
+    xBI = p[2U * j + 1U];
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+    p[2U * k]      = 0.5f * (xAR + xBR - pCoeff[2U * k] * t1a - pCoeff[2U * k + 1U] * t1b);
+    p[2U * k + 1U] = 0.5f * (xAI - xBI + pCoeff[2U * k + 1U] * t1a - pCoeff[2U * k] * t1b);
+
+    if (j != k)
+    {
+      p[2U * j]      = 0.5f * (xBR + xAR + pCoeff[2U * j] * t1a - pCoeff[2U * j + 1U] * t1b);
+      p[2U * j + 1U] = 0.5f * (xBI - xAI - pCoeff[2U * j + 1U] * t1a - pCoeff[2U * j] * t1b);
+    }
+  }
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed-radix real FFT.
+  @param[in]     S         points to an arm_rfft_mixed_instance_f32 structure
+  @param[in]     p         points to input buffer (modified by the inverse transform)
+  @param[out]    pOut      points to output buffer
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par
+                   Input and output use the packed format of arm_rfft_fast_f32: the
+                   forward transform stores X[0] and X[fftLen/2] (both real) in the
+                   first complex value, then X[1] ... X[fftLen/2-1]. p and pOut must not
+                   overlap.
+ */
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+  if (ifftFlag)
+  {
+    /* Real FFT decompression, then inverse complex FFT of half the length */
+    arm_rfft_mixed_merge_f32(S, p);
+    arm_cfft_mixed_f32(&(S->Sint), p, pOut, 1U);
+  }
+  else
+  {
+    /* Complex FFT of half the length, then real FFT compression */
+    arm_cfft_mixed_f32(&(S->Sint), p, pOut, 0U);
+    arm_rfft_mixed_split_f32(S, pOut);
+  }
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the mixed-radix RFFT Floating point function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 4100901-Room_Control-CubeMX contributors.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix real FFT.
+  @param[out]    S         points to an arm_rfft_mixed_instance_f32 structure
+  @param[in]     fftLen    length of the real FFT: even, fftLen/2 a product of 2, 3 and 5
+  @param[out]    pTwiddle  2*fftLen values filled with the twiddle factors; must outlive S
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported length
+
+  @par
+                   The first fftLen values hold the twiddles of the fftLen/2-point CFFT and
+                   the last fftLen the real-stage factors, with the layout of
+                   twiddleCoef_rfft_N (sin and cos of 2*pi*k/fftLen interleaved).
+ */
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  float32_t *pTwiddleRFFT;
+  uint32_t k;
+
+  if ((S == NULL) || (pTwiddle == NULL) || ((fftLen & 1U) != 0U) || (fftLen < 4U) ||
+      (arm_cfft_mixed_init_f32(&(S->Sint), fftLen / 2U, pTwiddle) != ARM_MATH_SUCCESS))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  pTwiddleRFFT = pTwiddle + fftLen;
+  for (k = 0U; k < fftLen / 2U; k++)
+  {
+    float32_t angle = 2.0f * PI * (float32_t)k / (float32_t)fftLen;
+
+    pTwiddleRFFT[2U * k]      = sinf(angle);
+    pTwiddleRFFT[2U * k + 1U] = cosf(angle);
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFT group
+ */
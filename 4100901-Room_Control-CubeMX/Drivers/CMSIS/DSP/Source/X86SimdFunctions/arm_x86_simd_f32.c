@@ -0,0 +1,707 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_simd_f32.c
+ * Description:  SSE4.1/AVX2 versions of the f32 kernels for x86-64 hosts
+ *
+ * Target Processor: x86-64 hosts (GCC / Clang)
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined(ARM_MATH_X86_SIMD)
+
+#include <immintrin.h>
+
+/* The library is built for baseline x86-64; each variant enables its own ISA */
+#define X86_SSE41 __attribute__((target("sse4.1")))
+#define X86_AVX2  __attribute__((target("avx2,fma")))
+
+static int x86_level = -1;
+
+arm_x86_simd_level_t arm_x86_simd_supported(void)
+{
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+  {
+    return ARM_X86_SIMD_AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.1"))
+  {
+    return ARM_X86_SIMD_SSE41;
+  }
+  return ARM_X86_SIMD_NONE;
+}
+
+arm_x86_simd_level_t arm_x86_simd_level(void)
+{
+  if (x86_level < 0)
+  {
+    x86_level = (int)arm_x86_simd_supported();
+  }
+  return (arm_x86_simd_level_t)x86_level;
+}
+
+arm_x86_simd_level_t arm_x86_simd_set_level(arm_x86_simd_level_t level)
+{
+  arm_x86_simd_level_t best = arm_x86_simd_supported();
+
+  x86_level = (int)((level < best) ? level : best);
+  return (arm_x86_simd_level_t)x86_level;
+}
+
+const char *arm_x86_simd_name(arm_x86_simd_level_t level)
+{
+  switch (level)
+  {
+    case ARM_X86_SIMD_SSE41: return "sse4.1";
+    case ARM_X86_SIMD_AVX2:  return "avx2";
+    default:                 return "c";
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Horizontal sums
+ * -------------------------------------------------------------------- */
+
+X86_SSE41 static inline float32_t hsum_sse(__m128 v)
+{
+  v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  v = _mm_add_ss(v, _mm_movehdup_ps(v));
+  return _mm_cvtss_f32(v);
+}
+
+X86_AVX2 static inline float32_t hsum_avx(__m256 v)
+{
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  s = _mm_add_ss(s, _mm_movehdup_ps(s));
+  return _mm_cvtss_f32(s);
+}
+
+/* ----------------------------------------------------------------------
+ * Element-wise kernels (bit-exact with the C path)
+ * -------------------------------------------------------------------- */
+
+X86_AVX2 static void add_avx2(const float32_t *a, const float32_t *b, float32_t *d, uint32_t n)
+{
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    _mm256_storeu_ps(d + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    _mm256_storeu_ps(d + i + 8U, _mm256_add_ps(_mm256_loadu_ps(a + i + 8U), _mm256_loadu_ps(b + i + 8U)));
+  }
+  for (; i < n; i++) d[i] = a[i] + b[i];
+}
+
+/* AVX2 only: arm_add_f32 runs the generic C path at the SSE4.1 level */
+void arm_add_f32_x86(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+  add_avx2(pSrcA, pSrcB, pDst, blockSize);
+}
+
+X86_AVX2 static void mult_avx2(const float32_t *a, const float32_t *b, float32_t *d, uint32_t n)
+{
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    _mm256_storeu_ps(d + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    _mm256_storeu_ps(d + i + 8U, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8U), _mm256_loadu_ps(b + i + 8U)));
+  }
+  for (; i < n; i++) d[i] = a[i] * b[i];
+}
+
+X86_SSE41 static void mult_sse41(const float32_t *a, const float32_t *b, float32_t *d, uint32_t n)
+{
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    _mm_storeu_ps(d + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    _mm_storeu_ps(d + i + 4U, _mm_mul_ps(_mm_loadu_ps(a + i + 4U), _mm_loadu_ps(b + i + 4U)));
+  }
+  for (; i < n; i++) d[i] = a[i] * b[i];
+}
+
+void arm_mult_f32_x86(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) mult_avx2(pSrcA, pSrcB, pDst, blockSize);
+  else mult_sse41(pSrcA, pSrcB, pDst, blockSize);
+}
+
+X86_AVX2 static void scale_avx2(const float32_t *s, float32_t k, float32_t *d, uint32_t n)
+{
+  __m256 vk = _mm256_set1_ps(k);
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    _mm256_storeu_ps(d + i, _mm256_mul_ps(_mm256_loadu_ps(s + i), vk));
+    _mm256_storeu_ps(d + i + 8U, _mm256_mul_ps(_mm256_loadu_ps(s + i + 8U), vk));
+  }
+  for (; i < n; i++) d[i] = s[i] * k;
+}
+
+X86_SSE41 static void scale_sse41(const float32_t *s, float32_t k, float32_t *d, uint32_t n)
+{
+  __m128 vk = _mm_set1_ps(k);
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    _mm_storeu_ps(d + i, _mm_mul_ps(_mm_loadu_ps(s + i), vk));
+    _mm_storeu_ps(d + i + 4U, _mm_mul_ps(_mm_loadu_ps(s + i + 4U), vk));
+  }
+  for (; i < n; i++) d[i] = s[i] * k;
+}
+
+void arm_scale_f32_x86(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize)
+{
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) scale_avx2(pSrc, scale, pDst, blockSize);
+  else scale_sse41(pSrc, scale, pDst, blockSize);
+}
+
+/* Interleaved complex input: even/odd shuffles split re and im, then re*re + im*im
+ * is evaluated exactly as in the C path */
+X86_AVX2 static void cmplx_mag_sq_avx2(const float32_t *s, float32_t *d, uint32_t n, int root)
+{
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    __m256 a = _mm256_loadu_ps(s + 2U * i);
+    __m256 b = _mm256_loadu_ps(s + 2U * i + 8U);
+    /* The shuffle works per 128-bit lane: samples come out as 0 1 4 5 | 2 3 6 7 */
+    __m256 re = _mm256_shuffle_ps(a, b, 0x88);
+    __m256 im = _mm256_shuffle_ps(a, b, 0xDD);
+    __m256 m = _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+    m = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(m), 0xD8));
+    _mm256_storeu_ps(d + i, root ? _mm256_sqrt_ps(m) : m);
+  }
+  for (; i < n; i++)
+  {
+    float32_t re = s[2U * i], im = s[2U * i + 1U];
+    d[i] = root ? sqrtf((re * re) + (im * im)) : (re * re) + (im * im);
+  }
+}
+
+X86_SSE41 static void cmplx_mag_sq_sse41(const float32_t *s, float32_t *d, uint32_t n, int root)
+{
+  uint32_t i = 0;
+  for (; i + 4U <= n; i += 4U)
+  {
+    __m128 a = _mm_loadu_ps(s + 2U * i);
+    __m128 b = _mm_loadu_ps(s + 2U * i + 4U);
+    __m128 re = _mm_shuffle_ps(a, b, 0x88);
+    __m128 im = _mm_shuffle_ps(a, b, 0xDD);
+    __m128 m = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+    _mm_storeu_ps(d + i, root ? _mm_sqrt_ps(m) : m);
+  }
+  for (; i < n; i++)
+  {
+    float32_t re = s[2U * i], im = s[2U * i + 1U];
+    d[i] = root ? sqrtf((re * re) + (im * im)) : (re * re) + (im * im);
+  }
+}
+
+void arm_cmplx_mag_f32_x86(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) cmplx_mag_sq_avx2(pSrc, pDst, numSamples, 1);
+  else cmplx_mag_sq_sse41(pSrc, pDst, numSamples, 1);
+}
+
+/* AVX2 only: arm_cmplx_mag_squared_f32 runs the generic C path at the SSE4.1 level */
+void arm_cmplx_mag_squared_f32_x86(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+  cmplx_mag_sq_avx2(pSrc, pDst, numSamples, 0);
+}
+
+/* ----------------------------------------------------------------------
+ * Reductions (two accumulators to hide the add latency)
+ * -------------------------------------------------------------------- */
+
+X86_AVX2 static float32_t dot_avx2(const float32_t *a, const float32_t *b, uint32_t n)
+{
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8U), _mm256_loadu_ps(b + i + 8U), acc1);
+  }
+  if (i + 8U <= n)
+  {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    i += 8U;
+  }
+  float32_t sum = hsum_avx(_mm256_add_ps(acc0, acc1));
+  for (; i < n; i++) sum += a[i] * b[i];
+  return sum;
+}
+
+X86_SSE41 static float32_t dot_sse41(const float32_t *a, const float32_t *b, uint32_t n)
+{
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4U), _mm_loadu_ps(b + i + 4U)));
+  }
+  if (i + 4U <= n)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    i += 4U;
+  }
+  float32_t sum = hsum_sse(_mm_add_ps(acc0, acc1));
+  for (; i < n; i++) sum += a[i] * b[i];
+  return sum;
+}
+
+void arm_dot_prod_f32_x86(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result)
+{
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) *result = dot_avx2(pSrcA, pSrcB, blockSize);
+  else *result = dot_sse41(pSrcA, pSrcB, blockSize);
+}
+
+X86_AVX2 static float32_t sum_avx2(const float32_t *s, uint32_t n)
+{
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(s + i));
+    acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(s + i + 8U));
+  }
+  if (i + 8U <= n)
+  {
+    acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(s + i));
+    i += 8U;
+  }
+  float32_t sum = hsum_avx(_mm256_add_ps(acc0, acc1));
+  for (; i < n; i++) sum += s[i];
+  return sum;
+}
+
+X86_SSE41 static float32_t sum_sse41(const float32_t *s, uint32_t n)
+{
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_loadu_ps(s + i));
+    acc1 = _mm_add_ps(acc1, _mm_loadu_ps(s + i + 4U));
+  }
+  if (i + 4U <= n)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_loadu_ps(s + i));
+    i += 4U;
+  }
+  float32_t sum = hsum_sse(_mm_add_ps(acc0, acc1));
+  for (; i < n; i++) sum += s[i];
+  return sum;
+}
+
+void arm_mean_f32_x86(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+  float32_t sum = (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) ? sum_avx2(pSrc, blockSize)
+                                                              : sum_sse41(pSrc, blockSize);
+  *pResult = sum / (float32_t)blockSize;
+}
+
+void arm_power_f32_x86(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) *pResult = dot_avx2(pSrc, pSrc, blockSize);
+  else *pResult = dot_sse41(pSrc, pSrc, blockSize);
+}
+
+/* Sum of squared deviations from mean */
+X86_AVX2 static float32_t sq_dev_avx2(const float32_t *s, uint32_t n, float32_t mean)
+{
+  __m256 vm = _mm256_set1_ps(mean);
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(s + i), vm);
+    __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(s + i + 8U), vm);
+    acc0 = _mm256_fmadd_ps(d0, d0, acc0);
+    acc1 = _mm256_fmadd_ps(d1, d1, acc1);
+  }
+  if (i + 8U <= n)
+  {
+    __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(s + i), vm);
+    acc0 = _mm256_fmadd_ps(d0, d0, acc0);
+    i += 8U;
+  }
+  float32_t sum = hsum_avx(_mm256_add_ps(acc0, acc1));
+  for (; i < n; i++) sum += (s[i] - mean) * (s[i] - mean);
+  return sum;
+}
+
+X86_SSE41 static float32_t sq_dev_sse41(const float32_t *s, uint32_t n, float32_t mean)
+{
+  __m128 vm = _mm_set1_ps(mean);
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    __m128 d0 = _mm_sub_ps(_mm_loadu_ps(s + i), vm);
+    __m128 d1 = _mm_sub_ps(_mm_loadu_ps(s + i + 4U), vm);
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(d0, d0));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(d1, d1));
+  }
+  if (i + 4U <= n)
+  {
+    __m128 d0 = _mm_sub_ps(_mm_loadu_ps(s + i), vm);
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(d0, d0));
+    i += 4U;
+  }
+  float32_t sum = hsum_sse(_mm_add_ps(acc0, acc1));
+  for (; i < n; i++) sum += (s[i] - mean) * (s[i] - mean);
+  return sum;
+}
+
+void arm_var_f32_x86(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+  float32_t mean;
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+  arm_mean_f32_x86(pSrc, blockSize, &mean);
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) *pResult = sq_dev_avx2(pSrc, blockSize, mean);
+  else *pResult = sq_dev_sse41(pSrc, blockSize, mean);
+  *pResult /= (float32_t)(blockSize - 1.0f);
+}
+
+/* ----------------------------------------------------------------------
+ * FIR: vectorized across outputs, taps in the same order as the C path,
+ * so the SSE4.1 version is bit-exact and AVX2 only differs by FMA rounding.
+ * -------------------------------------------------------------------- */
+
+X86_AVX2 static void fir_avx2(const float32_t *x, const float32_t *c, float32_t *d, uint32_t taps, uint32_t n)
+{
+  uint32_t i = 0;
+  for (; i + 16U <= n; i += 16U)
+  {
+    __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+    for (uint32_t k = 0; k < taps; k++)
+    {
+      __m256 ck = _mm256_broadcast_ss(&c[k]);
+      acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + k), ck, acc0);
+      acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + k + 8U), ck, acc1);
+    }
+    _mm256_storeu_ps(d + i, acc0);
+    _mm256_storeu_ps(d + i + 8U, acc1);
+  }
+  for (; i + 8U <= n; i += 8U)
+  {
+    __m256 acc = _mm256_setzero_ps();
+    for (uint32_t k = 0; k < taps; k++)
+    {
+      acc = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + k), _mm256_broadcast_ss(&c[k]), acc);
+    }
+    _mm256_storeu_ps(d + i, acc);
+  }
+  for (; i < n; i++)
+  {
+    float32_t acc = 0.0f;
+    for (uint32_t k = 0; k < taps; k++) acc += x[i + k] * c[k];
+    d[i] = acc;
+  }
+}
+
+X86_SSE41 static void fir_sse41(const float32_t *x, const float32_t *c, float32_t *d, uint32_t taps, uint32_t n)
+{
+  uint32_t i = 0;
+  for (; i + 8U <= n; i += 8U)
+  {
+    __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+    for (uint32_t k = 0; k < taps; k++)
+    {
+      __m128 ck = _mm_set1_ps(c[k]);
+      acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + i + k), ck));
+      acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + i + k + 4U), ck));
+    }
+    _mm_storeu_ps(d + i, acc0);
+    _mm_storeu_ps(d + i + 4U, acc1);
+  }
+  for (; i < n; i++)
+  {
+    float32_t acc = 0.0f;
+    for (uint32_t k = 0; k < taps; k++) acc += x[i + k] * c[k];
+    d[i] = acc;
+  }
+}
+
+void arm_fir_f32_x86(const arm_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+  uint32_t numTaps = S->numTaps;
+
+  /* New samples go after the numTaps - 1 kept from the previous call */
+  memcpy(&S->pState[numTaps - 1U], pSrc, blockSize * sizeof(float32_t));
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) fir_avx2(S->pState, S->pCoeffs, pDst, numTaps, blockSize);
+  else fir_sse41(S->pState, S->pCoeffs, pDst, numTaps, blockSize);
+  memmove(S->pState, &S->pState[blockSize], (numTaps - 1U) * sizeof(float32_t));
+}
+
+/* ----------------------------------------------------------------------
+ * Multi-channel biquad: one channel per lane. Products and sums stay separate
+ * (no FMA) and in the order of arm_biquad_cascade_df2T_f32, so each channel is
+ * bit-exact with a single channel instance. Two registers of channels per
+ * frame hide part of the latency of the recursion.
+ * -------------------------------------------------------------------- */
+
+#define BQ_STEP_SSE(xv, yv, d1, d2)                                              \
+  do                                                                            \
+  {                                                                             \
+    yv = _mm_add_ps(_mm_mul_ps(b0, xv), d1);                                    \
+    d1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b1, xv), d2), _mm_mul_ps(a1, yv));    \
+    d2 = _mm_add_ps(_mm_mul_ps(b2, xv), _mm_mul_ps(a2, yv));                    \
+  } while (0)
+
+#define BQ_STEP_AVX(xv, yv, d1, d2)                                                          \
+  do                                                                                        \
+  {                                                                                         \
+    yv = _mm256_add_ps(_mm256_mul_ps(b0v, xv), d1);                                         \
+    d1 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b1v, xv), d2), _mm256_mul_ps(a1v, yv));  \
+    d2 = _mm256_add_ps(_mm256_mul_ps(b2v, xv), _mm256_mul_ps(a2v, yv));                     \
+  } while (0)
+
+/* One stage over channels [ch, nch): two at a time in the low lanes, then the last one */
+X86_SSE41 static void biquad_mc_tail(const float32_t *c, const float32_t *x, float32_t *y, float32_t *st,
+                                     uint32_t ch, uint32_t nch, uint32_t n)
+{
+  __m128 b0 = _mm_set1_ps(c[0]), b1 = _mm_set1_ps(c[1]), b2 = _mm_set1_ps(c[2]);
+  __m128 a1 = _mm_set1_ps(c[3]), a2 = _mm_set1_ps(c[4]);
+
+  for (; ch + 2U <= nch; ch += 2U)
+  {
+    __m128 d1 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(st + ch));
+    __m128 d2 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(st + nch + ch));
+    for (uint32_t i = 0; i < n; i++)
+    {
+      __m128 xv = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(x + i * nch + ch)), yv;
+      BQ_STEP_SSE(xv, yv, d1, d2);
+      _mm_storel_pi((__m64 *)(y + i * nch + ch), yv);
+    }
+    _mm_storel_pi((__m64 *)(st + ch), d1);
+    _mm_storel_pi((__m64 *)(st + nch + ch), d2);
+  }
+  if (ch < nch)
+  {
+    float32_t d1 = st[ch], d2 = st[nch + ch];
+    for (uint32_t i = 0; i < n; i++)
+    {
+      float32_t xn = x[i * nch + ch];
+      float32_t yn = c[0] * xn + d1;
+      d1 = c[1] * xn + d2;
+      d1 += c[3] * yn;
+      d2 = c[2] * xn;
+      d2 += c[4] * yn;
+      y[i * nch + ch] = yn;
+    }
+    st[ch] = d1;
+    st[nch + ch] = d2;
+  }
+}
+
+/* Groups of 8 and 4 channels with 4-lane registers; returns the first channel left */
+X86_SSE41 static uint32_t biquad_mc_sse41(const float32_t *c, const float32_t *x, float32_t *y, float32_t *st,
+                                          uint32_t ch, uint32_t nch, uint32_t n)
+{
+  __m128 b0 = _mm_set1_ps(c[0]), b1 = _mm_set1_ps(c[1]), b2 = _mm_set1_ps(c[2]);
+  __m128 a1 = _mm_set1_ps(c[3]), a2 = _mm_set1_ps(c[4]);
+
+  for (; ch + 8U <= nch; ch += 8U)
+  {
+    __m128 d1a = _mm_loadu_ps(st + ch), d1b = _mm_loadu_ps(st + ch + 4U);
+    __m128 d2a = _mm_loadu_ps(st + nch + ch), d2b = _mm_loadu_ps(st + nch + ch + 4U);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      __m128 xa = _mm_loadu_ps(x + i * nch + ch), xb = _mm_loadu_ps(x + i * nch + ch + 4U), ya, yb;
+      BQ_STEP_SSE(xa, ya, d1a, d2a);
+      BQ_STEP_SSE(xb, yb, d1b, d2b);
+      _mm_storeu_ps(y + i * nch + ch, ya);
+      _mm_storeu_ps(y + i * nch + ch + 4U, yb);
+    }
+    _mm_storeu_ps(st + ch, d1a);
+    _mm_storeu_ps(st + ch + 4U, d1b);
+    _mm_storeu_ps(st + nch + ch, d2a);
+    _mm_storeu_ps(st + nch + ch + 4U, d2b);
+  }
+  if (ch + 4U <= nch)
+  {
+    __m128 d1 = _mm_loadu_ps(st + ch), d2 = _mm_loadu_ps(st + nch + ch);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      __m128 xv = _mm_loadu_ps(x + i * nch + ch), yv;
+      BQ_STEP_SSE(xv, yv, d1, d2);
+      _mm_storeu_ps(y + i * nch + ch, yv);
+    }
+    _mm_storeu_ps(st + ch, d1);
+    _mm_storeu_ps(st + nch + ch, d2);
+    ch += 4U;
+  }
+  return ch;
+}
+
+/* Groups of 16 and 8 channels with 8-lane registers; returns the first channel left.
+   AVX2 without FMA: with it GCC would contract the products and sums */
+__attribute__((target("avx2")))
+static uint32_t biquad_mc_avx2(const float32_t *c, const float32_t *x, float32_t *y, float32_t *st,
+                               uint32_t nch, uint32_t n)
+{
+  __m256 b0v = _mm256_set1_ps(c[0]), b1v = _mm256_set1_ps(c[1]), b2v = _mm256_set1_ps(c[2]);
+  __m256 a1v = _mm256_set1_ps(c[3]), a2v = _mm256_set1_ps(c[4]);
+  uint32_t ch = 0;
+
+  for (; ch + 16U <= nch; ch += 16U)
+  {
+    __m256 d1a = _mm256_loadu_ps(st + ch), d1b = _mm256_loadu_ps(st + ch + 8U);
+    __m256 d2a = _mm256_loadu_ps(st + nch + ch), d2b = _mm256_loadu_ps(st + nch + ch + 8U);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      __m256 xa = _mm256_loadu_ps(x + i * nch + ch), xb = _mm256_loadu_ps(x + i * nch + ch + 8U), ya, yb;
+      BQ_STEP_AVX(xa, ya, d1a, d2a);
+      BQ_STEP_AVX(xb, yb, d1b, d2b);
+      _mm256_storeu_ps(y + i * nch + ch, ya);
+      _mm256_storeu_ps(y + i * nch + ch + 8U, yb);
+    }
+    _mm256_storeu_ps(st + ch, d1a);
+    _mm256_storeu_ps(st + ch + 8U, d1b);
+    _mm256_storeu_ps(st + nch + ch, d2a);
+    _mm256_storeu_ps(st + nch + ch + 8U, d2b);
+  }
+  if (ch + 8U <= nch)
+  {
+    __m256 d1 = _mm256_loadu_ps(st + ch), d2 = _mm256_loadu_ps(st + nch + ch);
+    for (uint32_t i = 0; i < n; i++)
+    {
+      __m256 xv = _mm256_loadu_ps(x + i * nch + ch), yv;
+      BQ_STEP_AVX(xv, yv, d1, d2);
+      _mm256_storeu_ps(y + i * nch + ch, yv);
+    }
+    _mm256_storeu_ps(st + ch, d1);
+    _mm256_storeu_ps(st + nch + ch, d2);
+    ch += 8U;
+  }
+  return ch;
+}
+
+void arm_biquad_cascade_multichannel_df2T_f32_x86(const arm_biquad_cascade_multichannel_df2T_instance_f32 *S,
+                                                  const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;
+  const float32_t *pCoeffs = S->pCoeffs;
+  float32_t *pState = S->pState;
+  uint32_t nch = S->numChannels;
+
+  for (uint32_t stage = 0; stage < S->numStages; stage++)
+  {
+    uint32_t ch = 0;
+    if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2) ch = biquad_mc_avx2(pCoeffs, pIn, pDst, pState, nch, blockSize);
+    ch = biquad_mc_sse41(pCoeffs, pIn, pDst, pState, ch, nch, blockSize);
+    biquad_mc_tail(pCoeffs, pIn, pDst, pState, ch, nch, blockSize);
+
+    /* The output of this stage is the input of the next one */
+    pIn = pDst;
+    pCoeffs += 5U;
+    pState += 2U * nch;
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Matrix product: a block of output columns stays in registers across k
+ * -------------------------------------------------------------------- */
+
+X86_AVX2 static void mat_mult_avx2(const float32_t *a, const float32_t *b, float32_t *d,
+                                   uint32_t rows, uint32_t inner, uint32_t cols)
+{
+  for (uint32_t r = 0; r < rows; r++)
+  {
+    const float32_t *ar = a + r * inner;
+    float32_t *dr = d + r * cols;
+    uint32_t j = 0;
+    for (; j + 16U <= cols; j += 16U)
+    {
+      __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+      for (uint32_t k = 0; k < inner; k++)
+      {
+        __m256 ak = _mm256_broadcast_ss(&ar[k]);
+        acc0 = _mm256_fmadd_ps(ak, _mm256_loadu_ps(b + k * cols + j), acc0);
+        acc1 = _mm256_fmadd_ps(ak, _mm256_loadu_ps(b + k * cols + j + 8U), acc1);
+      }
+      _mm256_storeu_ps(dr + j, acc0);
+      _mm256_storeu_ps(dr + j + 8U, acc1);
+    }
+    for (; j + 8U <= cols; j += 8U)
+    {
+      __m256 acc = _mm256_setzero_ps();
+      for (uint32_t k = 0; k < inner; k++)
+      {
+        acc = _mm256_fmadd_ps(_mm256_broadcast_ss(&ar[k]), _mm256_loadu_ps(b + k * cols + j), acc);
+      }
+      _mm256_storeu_ps(dr + j, acc);
+    }
+    for (; j < cols; j++)
+    {
+      float32_t sum = 0.0f;
+      for (uint32_t k = 0; k < inner; k++) sum += ar[k] * b[k * cols + j];
+      dr[j] = sum;
+    }
+  }
+}
+
+X86_SSE41 static void mat_mult_sse41(const float32_t *a, const float32_t *b, float32_t *d,
+                                     uint32_t rows, uint32_t inner, uint32_t cols)
+{
+  for (uint32_t r = 0; r < rows; r++)
+  {
+    const float32_t *ar = a + r * inner;
+    float32_t *dr = d + r * cols;
+    uint32_t j = 0;
+    for (; j + 8U <= cols; j += 8U)
+    {
+      __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+      for (uint32_t k = 0; k < inner; k++)
+      {
+        __m128 ak = _mm_set1_ps(ar[k]);
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(ak, _mm_loadu_ps(b + k * cols + j)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(ak, _mm_loadu_ps(b + k * cols + j + 4U)));
+      }
+      _mm_storeu_ps(dr + j, acc0);
+      _mm_storeu_ps(dr + j + 4U, acc1);
+    }
+    for (; j < cols; j++)
+    {
+      float32_t sum = 0.0f;
+      for (uint32_t k = 0; k < inner; k++) sum += ar[k] * b[k * cols + j];
+      dr[j] = sum;
+    }
+  }
+}
+
+arm_status arm_mat_mult_f32_x86(const arm_matrix_instance_f32 *pSrcA,
+                                const arm_matrix_instance_f32 *pSrcB,
+                                arm_matrix_instance_f32 *pDst)
+{
+#ifdef ARM_MATH_MATRIX_CHECK
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if (arm_x86_simd_level() == ARM_X86_SIMD_AVX2)
+  {
+    mat_mult_avx2(pSrcA->pData, pSrcB->pData, pDst->pData, pSrcA->numRows, pSrcA->numCols, pSrcB->numCols);
+  }
+  else
+  {
+    mat_mult_sse41(pSrcA->pData, pSrcB->pData, pDst->pData, pSrcA->numRows, pSrcA->numCols, pSrcB->numCols);
+  }
+  return ARM_MATH_SUCCESS;
+}
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
@@ -0,0 +1,237 @@
+/**
+ * @brief Herramienta de host: cascada de biquads q15 fusionada por tramos
+ *        (arm_biquad_cascade_df1_fused_q15) y orden/escala de secciones
+ *        (arm_biquad_sos_order_scale_f32) contra las cascadas existentes.
+ * @note  Diseña un Butterworth pasa bajos de 2 a 8 secciones por transformada
+ *        bilineal en double, con las secciones en el orden natural (la de mayor
+ *        Q primero) y ganancia unitaria en DC. Para cada tamaño:
+ *        - la variante fusionada debe coincidir bit a bit con df1_q15 (dos
+ *          llamadas de largo impar y una en sitio); devuelve 1 si no.
+ *        - ns por muestra de df1_q15, df1_fast_q15, fusionada, df1_q31 y df2T_f32.
+ *        - con un barrido de 0 a 0.1 fs de amplitud 0.9, salidas de etapa fuera de
+ *          escala y SNR contra double, con las secciones tal cual y ordenadas y
+ *          escaladas. Las secciones ordenadas no deben saturar nunca.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/biquad_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define HOST_MAX_STAGES 8
+#define HOST_BLOCK 160          // Muestras por llamada (ventana de 10 ms a 16 kHz)
+#define HOST_SWEEP (16 * HOST_BLOCK)
+#define HOST_CUTOFF 0.03        // Corte del Butterworth en fracción de fs
+#define HOST_SWEEP_TOP 0.1      // Frecuencia final del barrido en fracción de fs
+#define HOST_AMPLITUDE 0.9
+#define HOST_FREQS 512          // Frecuencias donde se evalúa la respuesta al escalar
+#define HOST_MIN_NS 20e6        // Tiempo mínimo de medición por variante
+
+static float32_t sos_f32[HOST_MAX_STAGES * 5];
+static double sos_f64[HOST_MAX_STAGES * 5];
+static q15_t coeffs_q15[HOST_MAX_STAGES * 6];
+static q31_t coeffs_q31[HOST_MAX_STAGES * 5];
+static q15_t state_q15[2][HOST_MAX_STAGES * 4];
+static q31_t state_q31[HOST_MAX_STAGES * 4];
+static float32_t state_f32[HOST_MAX_STAGES * 2];
+
+static double sweep[HOST_SWEEP], ref[HOST_SWEEP];
+static q15_t in_q15[HOST_SWEEP], out_q15[2][HOST_SWEEP];
+static q31_t in_q31[HOST_BLOCK], out_q31[HOST_BLOCK];
+static float32_t in_f32[HOST_BLOCK], out_f32[HOST_BLOCK];
+
+static arm_biquad_casd_df1_inst_q15 df1_q15[2];
+static arm_biquad_casd_df1_inst_q31 df1_q31;
+static arm_biquad_cascade_df2T_instance_f32 df2T_f32;
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Butterworth pasa bajos de 2*stages polos en secciones {b0, b1, b2, a1, a2}
+ *        con el signo de CMSIS; la sección k tiene el polo de ángulo (2k+1)pi/(4 stages).
+ */
+static void design_butterworth(uint32_t stages, double *sos)
+{
+    double wc = tan(M_PI * HOST_CUTOFF);  // Corte predistorsionado de s = (1 - z^-1)/(1 + z^-1)
+
+    for (uint32_t k = 0; k < stages; k++) {
+        double theta = M_PI * (2.0 * k + 1.0) / (4.0 * stages);
+        double alpha = 2.0 * wc * sin(theta), w2 = wc * wc, a0 = 1.0 + alpha + w2;
+
+        sos[5 * k + 0] = w2 / a0;
+        sos[5 * k + 1] = 2.0 * w2 / a0;
+        sos[5 * k + 2] = w2 / a0;
+        sos[5 * k + 3] = -(2.0 * w2 - 2.0) / a0;
+        sos[5 * k + 4] = -(1.0 - alpha + w2) / a0;
+    }
+}
+
+/**
+ * @brief Filtra en double con las secciones dadas. Con limit > 0 cuenta las
+ *        salidas de etapa con módulo mayor que limit.
+ */
+static uint32_t run_f64(const double *sos, uint32_t stages, const double *in, double *out, double limit)
+{
+    uint32_t over = 0;
+
+    memcpy(out, in, HOST_SWEEP * sizeof(double));
+    for (uint32_t k = 0; k < stages; k++) {
+        const double *c = &sos[5 * k];
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+        for (uint32_t n = 0; n < HOST_SWEEP; n++) {
+            double x = out[n], y = c[0] * x + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2;
+            if (limit > 0.0 && fabs(y) > limit) over++;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            out[n] = y;
+        }
+    }
+    return over;
+}
+
+/**
+ * @brief Convierte secciones f32 a q15 y q31 e inicializa todas las instancias.
+ */
+static int init_filters(uint32_t stages)
+{
+    int8_t shift;
+
+    if (arm_biquad_sos_to_q15(sos_f32, (uint8_t)stages, coeffs_q15, &shift) != ARM_MATH_SUCCESS) return 0;
+    for (uint32_t i = 0; i < 5 * stages; i++) {
+        coeffs_q31[i] = (q31_t)lrint(fmax(fmin(ldexp(sos_f32[i], 31 - shift), 2147483647.0), -2147483648.0));
+    }
+    for (int v = 0; v < 2; v++) {
+        arm_biquad_cascade_df1_init_q15(&df1_q15[v], (uint8_t)stages, coeffs_q15, state_q15[v], shift);
+    }
+    arm_biquad_cascade_df1_init_q31(&df1_q31, (uint8_t)stages, coeffs_q31, state_q31, shift);
+    arm_biquad_cascade_df2T_init_f32(&df2T_f32, (uint8_t)stages, sos_f32, state_f32);
+    return 1;
+}
+
+/**
+ * @brief Salidas de etapa fuera de escala y SNR (dB) de la cascada q15 de sos_f32,
+ *        cuya salida por gain es la del filtro original.
+ */
+static double measure_snr(uint32_t stages, float32_t gain, uint32_t *over)
+{
+    static double sos_q[HOST_MAX_STAGES * 5], sim[HOST_SWEEP];
+    double signal = 0.0, noise = 0.0;
+    int32_t shift = df1_q15[0].postShift;
+
+    // Coeficientes cuantizados, en double, para ver dónde satura cada etapa
+    for (uint32_t k = 0; k < stages; k++) {
+        static const uint32_t q15_index[5] = {0, 2, 3, 4, 5};
+        for (uint32_t i = 0; i < 5; i++) sos_q[5 * k + i] = ldexp(coeffs_q15[6 * k + q15_index[i]], shift - 15);
+    }
+    *over = run_f64(sos_q, stages, sweep, sim, 32767.0 / 32768.0);
+
+    arm_biquad_cascade_df1_q15(&df1_q15[0], in_q15, out_q15[0], HOST_SWEEP);
+    for (uint32_t n = 0; n < HOST_SWEEP; n++) {
+        double err = out_q15[0][n] / 32768.0 * gain - ref[n];
+        signal += ref[n] * ref[n];
+        noise += err * err;
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+static void run_df1_q15(void) { arm_biquad_cascade_df1_q15(&df1_q15[0], in_q15, out_q15[0], HOST_BLOCK); }
+static void run_df1_fast_q15(void) { arm_biquad_cascade_df1_fast_q15(&df1_q15[0], in_q15, out_q15[0], HOST_BLOCK); }
+static void run_fused_q15(void) { arm_biquad_cascade_df1_fused_q15(&df1_q15[1], in_q15, out_q15[1], HOST_BLOCK); }
+static void run_df1_q31(void) { arm_biquad_cascade_df1_q31(&df1_q31, in_q31, out_q31, HOST_BLOCK); }
+static void run_df2T_f32(void) { arm_biquad_cascade_df2T_f32(&df2T_f32, in_f32, out_f32, HOST_BLOCK); }
+
+/**
+ * @brief Nanosegundos por muestra de run: mejor tanda de 64 bloques durante HOST_MIN_NS.
+ */
+static double measure(void (*run)(void))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+
+    run();  // Calentar caché
+    do {
+        t0 = host_now_ns();
+        for (int i = 0; i < 64; i++) run();
+        batch = (host_now_ns() - t0) / 64;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best / HOST_BLOCK;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    for (uint32_t n = 0; n < HOST_SWEEP; n++) {
+        sweep[n] = HOST_AMPLITUDE * sin(M_PI * HOST_SWEEP_TOP * (double)n * n / HOST_SWEEP);
+        in_q15[n] = (q15_t)lrint(sweep[n] * 32768.0);
+    }
+    arm_q15_to_q31(in_q15, in_q31, HOST_BLOCK);
+    arm_q15_to_float(in_q15, in_f32, HOST_BLOCK);
+
+#if defined(ARM_MATH_X86_SIMD)
+    // Todas las variantes por el camino en C, el que corre en el Cortex-M4
+    arm_x86_simd_set_level(ARM_X86_SIMD_NONE);
+#endif
+
+    printf("%-3s %8s %8s %8s %8s %8s %8s | %6s %8s %6s %8s %8s\n", "sec", "dif", "df1 q15", "fast q15",
+           "fus q15", "df1 q31", "df2T f32", "sat", "SNR dB", "sat o+e", "SNR dB", "ganancia");
+    for (uint32_t stages = 2; stages <= HOST_MAX_STAGES; stages *= 2) {
+        uint32_t diff = 0, over_naive, over_scaled;
+        float32_t gain;
+        double snr_naive, snr_scaled;
+
+        design_butterworth(stages, sos_f64);
+        for (uint32_t i = 0; i < 5 * stages; i++) sos_f32[i] = (float32_t)sos_f64[i];
+        run_f64(sos_f64, stages, sweep, ref, 0.0);
+
+        // Fusionada contra df1_q15: dos llamadas impares con estado entre ellas y una en sitio
+        if (!init_filters(stages)) {
+            fprintf(stderr, "%u secciones: conversion a q15 fallo\n", stages);
+            return 1;
+        }
+        arm_biquad_cascade_df1_q15(&df1_q15[0], in_q15, out_q15[0], 2 * HOST_BLOCK + 1);
+        arm_biquad_cascade_df1_q15(&df1_q15[0], &in_q15[2 * HOST_BLOCK + 1], &out_q15[0][2 * HOST_BLOCK + 1],
+                                   HOST_BLOCK + 7);
+        arm_biquad_cascade_df1_fused_q15(&df1_q15[1], in_q15, out_q15[1], 2 * HOST_BLOCK + 1);
+        memcpy(&out_q15[1][2 * HOST_BLOCK + 1], &in_q15[2 * HOST_BLOCK + 1], (HOST_BLOCK + 7) * sizeof(q15_t));
+        arm_biquad_cascade_df1_fused_q15(&df1_q15[1], &out_q15[1][2 * HOST_BLOCK + 1],
+                                         &out_q15[1][2 * HOST_BLOCK + 1], HOST_BLOCK + 7);
+        for (uint32_t n = 0; n < 3 * HOST_BLOCK + 8; n++) {
+            if (out_q15[0][n] != out_q15[1][n]) diff++;
+        }
+
+        double t_df1 = measure(run_df1_q15), t_fast = measure(run_df1_fast_q15);
+        double t_fused = measure(run_fused_q15), t_q31 = measure(run_df1_q31), t_f32 = measure(run_df2T_f32);
+
+        // Saturación: secciones tal cual contra ordenadas y escaladas
+        init_filters(stages);
+        snr_naive = measure_snr(stages, 1.0f, &over_naive);
+        if (arm_biquad_sos_order_scale_f32(sos_f32, (uint8_t)stages, HOST_FREQS, &gain) != ARM_MATH_SUCCESS ||
+            !init_filters(stages)) {
+            fprintf(stderr, "%u secciones: orden y escala fallo\n", stages);
+            return 1;
+        }
+        snr_scaled = measure_snr(stages, gain, &over_scaled);
+
+        printf("%-3u %8u %8.2f %8.2f %8.2f %8.2f %8.2f | %6u %8.1f %6u %8.1f %8.3f\n", stages, diff, t_df1, t_fast,
+               t_fused, t_q31, t_f32, over_naive, snr_naive, over_scaled, snr_scaled, gain);
+        if (diff != 0 || over_scaled != 0) {
+            fprintf(stderr, "%u secciones: %u muestras distintas, %u saturadas tras ordenar\n", stages, diff,
+                    over_scaled);
+            failed = 1;
+        }
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
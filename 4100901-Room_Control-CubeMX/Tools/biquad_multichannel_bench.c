@@ -0,0 +1,192 @@
+/**
+ * @brief Herramienta de host: cascada de biquads df2T de N canales entrelazados
+ *        (arm_biquad_cascade_multichannel_df2T_f32) contra un
+ *        arm_biquad_cascade_df2T_f32 por canal.
+ * @note  Para 1 a 16 canales filtra dos bloques seguidos (así se verifica también
+ *        el estado entre llamadas) con N instancias mono y con la variante
+ *        multicanal por el camino en C (el del Cortex-M4) y por SSE4.1/AVX2 si
+ *        la CPU los tiene. Todas deben coincidir bit a bit con las instancias
+ *        mono; devuelve 1 si no. Reporta los ns por muestra de cada una; el
+ *        camino mono incluye separar y volver a entrelazar los canales. Con 2
+ *        canales agrega arm_biquad_cascade_stereo_df2T_f32 como referencia.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/biquad_multichannel_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define HOST_STAGES 4
+#define HOST_BLOCK 160          // Tramas por llamada (ventana de 10 ms a 16 kHz)
+#define HOST_MAX_CHANNELS 16
+#define HOST_MIN_NS 20e6        // Tiempo mínimo de medición por variante
+
+static const uint32_t host_channels[] = {1, 2, 3, 4, 5, 8, 12, 16};
+
+static float32_t coeffs[5 * HOST_STAGES];
+static float32_t in[2 * HOST_BLOCK * HOST_MAX_CHANNELS];
+static float32_t out_mono[2 * HOST_BLOCK * HOST_MAX_CHANNELS], out_mc[2 * HOST_BLOCK * HOST_MAX_CHANNELS];
+static float32_t state_mono[HOST_MAX_CHANNELS][2 * HOST_STAGES];
+static float32_t state_mc[2 * HOST_STAGES * HOST_MAX_CHANNELS];
+static float32_t state_stereo[4 * HOST_STAGES];
+static float32_t chan_in[HOST_BLOCK], chan_out[HOST_BLOCK];
+
+static arm_biquad_cascade_df2T_instance_f32 mono[HOST_MAX_CHANNELS];
+static arm_biquad_cascade_multichannel_df2T_instance_f32 mc;
+static arm_biquad_cascade_stereo_df2T_instance_f32 stereo;
+static uint32_t run_channels;
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Un bloque de cada variante; block elige la mitad de entrada y salida */
+static void run_mono(uint32_t block)
+{
+    const float32_t *src = &in[block * HOST_BLOCK * run_channels];
+    float32_t *dst = &out_mono[block * HOST_BLOCK * run_channels];
+
+    for (uint32_t ch = 0; ch < run_channels; ch++) {
+        for (uint32_t n = 0; n < HOST_BLOCK; n++) chan_in[n] = src[n * run_channels + ch];
+        arm_biquad_cascade_df2T_f32(&mono[ch], chan_in, chan_out, HOST_BLOCK);
+        for (uint32_t n = 0; n < HOST_BLOCK; n++) dst[n * run_channels + ch] = chan_out[n];
+    }
+}
+
+static void run_multichannel(uint32_t block)
+{
+    arm_biquad_cascade_multichannel_df2T_f32(&mc, &in[block * HOST_BLOCK * run_channels],
+                                             &out_mc[block * HOST_BLOCK * run_channels], HOST_BLOCK);
+}
+
+static void run_stereo(uint32_t block)
+{
+    arm_biquad_cascade_stereo_df2T_f32(&stereo, &in[block * HOST_BLOCK * 2], &out_mc[block * HOST_BLOCK * 2],
+                                       HOST_BLOCK);
+}
+
+/**
+ * @brief Nanosegundos por muestra de run: mejor tanda de 64 bloques durante HOST_MIN_NS.
+ */
+static double measure(void (*run)(uint32_t))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+
+    run(0);  // Calentar caché
+    do {
+        t0 = host_now_ns();
+        for (int i = 0; i < 64; i++) run(0);
+        batch = (host_now_ns() - t0) / 64;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best / (HOST_BLOCK * run_channels);
+}
+
+/**
+ * @brief Reinicia el estado de todas las instancias de run_channels canales.
+ */
+static int init_filters(void)
+{
+    for (uint32_t ch = 0; ch < run_channels; ch++) {
+        arm_biquad_cascade_df2T_init_f32(&mono[ch], HOST_STAGES, coeffs, state_mono[ch]);
+    }
+    arm_biquad_cascade_stereo_df2T_init_f32(&stereo, HOST_STAGES, coeffs, state_stereo);
+    return arm_biquad_cascade_multichannel_df2T_init_f32(&mc, HOST_STAGES, (uint16_t)run_channels, coeffs,
+                                                         state_mc) == ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Filtra los dos bloques con la variante multicanal desde estado cero y
+ *        cuenta las muestras distintas de la salida mono.
+ */
+static uint32_t check_multichannel(void)
+{
+    uint32_t diff = 0;
+
+    init_filters();
+    run_multichannel(0);
+    run_multichannel(1);
+    for (uint32_t i = 0; i < 2 * HOST_BLOCK * run_channels; i++) {
+        if (memcmp(&out_mc[i], &out_mono[i], sizeof(float32_t)) != 0) diff++;
+    }
+    return diff;
+}
+
+int main(void)
+{
+    int failed = 0;
+    uint32_t seed = 4242;
+
+    // Secciones estables al azar: polos de radio 0.5 a 0.95
+    for (uint32_t k = 0; k < HOST_STAGES; k++) {
+        seed = seed * 1664525U + 1013904223U;
+        double r = 0.5 + 0.45 * ((seed >> 8) & 0xFFFF) / 65536.0;
+        seed = seed * 1664525U + 1013904223U;
+        double theta = M_PI * ((seed >> 8) & 0xFFFF) / 65536.0;
+        for (uint32_t i = 0; i < 3; i++) {
+            seed = seed * 1664525U + 1013904223U;
+            coeffs[5 * k + i] = ((float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f) / 4.0f;
+        }
+        coeffs[5 * k + 3] = (float32_t)(2.0 * r * cos(theta));
+        coeffs[5 * k + 4] = (float32_t)(-r * r);
+    }
+    for (uint32_t i = 0; i < 2 * HOST_BLOCK * HOST_MAX_CHANNELS; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        in[i] = (float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+    }
+
+#if defined(ARM_MATH_X86_SIMD)
+    arm_x86_simd_level_t best_level = arm_x86_simd_supported();
+#endif
+
+    printf("%-3s %10s %10s %6s %10s %6s %10s %6s %10s\n", "ch", "ns/m mono", "ns/m C", "x", "ns/m sse", "x",
+           "ns/m avx2", "x", "ns/m est");
+    for (uint32_t c = 0; c < sizeof(host_channels) / sizeof(host_channels[0]); c++) {
+        double t_level[3] = {0.0, 0.0, 0.0}, t_mono, t_stereo = 0.0;
+        uint32_t diff = 0;
+
+        run_channels = host_channels[c];
+        if (!init_filters()) {
+            fprintf(stderr, "%u canales: init fallo\n", run_channels);
+            return 1;
+        }
+        // measure sigue filtrando sobre out_mono: la referencia se calcula después, desde estado cero
+        t_mono = measure(run_mono);
+        init_filters();
+        run_mono(0);
+        run_mono(1);
+
+#if defined(ARM_MATH_X86_SIMD)
+        for (int level = ARM_X86_SIMD_NONE; level <= (int)best_level; level++) {
+            arm_x86_simd_set_level((arm_x86_simd_level_t)level);
+            diff += check_multichannel();
+            t_level[level] = measure(run_multichannel);
+        }
+        arm_x86_simd_set_level(ARM_X86_SIMD_NONE);
+#else
+        diff = check_multichannel();
+        t_level[0] = measure(run_multichannel);
+#endif
+        if (run_channels == 2) t_stereo = measure(run_stereo);
+
+        printf("%-3u %10.2f %10.2f %6.2f", run_channels, t_mono, t_level[0], t_mono / t_level[0]);
+        for (int level = 1; level <= 2; level++) {
+            if (t_level[level] > 0.0) printf(" %10.2f %6.2f", t_level[level], t_mono / t_level[level]);
+            else printf(" %10s %6s", "-", "-");
+        }
+        if (t_stereo > 0.0) printf(" %10.2f\n", t_stereo);
+        else printf(" %10s\n", "-");
+        if (diff != 0) {
+            fprintf(stderr, "%u canales: %u muestras distintas de las instancias mono\n", run_channels, diff);
+            failed = 1;
+        }
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
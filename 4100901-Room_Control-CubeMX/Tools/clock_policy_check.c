@@ -0,0 +1,129 @@
+/**
+ * @brief Tabla de transiciones de clock_policy en el host.
+ * @note  Cada caso parte de una política recién inicializada y aplica una secuencia
+ *        de entradas, comprobando el perfil elegido en cada paso. Cubre la subida a
+ *        PERFORMANCE por cálculo y su histéresis, BALANCED por E/S, audio o interfaz,
+ *        la bajada a LOW_POWER por inactividad y el desborde de HAL_GetTick().
+ *
+ *        Compilar y ejecutar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/host -B build/host && cmake --build build/host
+ *          ctest --test-dir build/host -R clock_policy_check
+ */
+#include "clock_policy.h"
+#include <stdio.h>
+
+#define IDLE_MS 2000U
+#define HOLD_MS 100U
+#define MAX_STEPS 8
+
+#define P CLOCK_PROFILE_PERFORMANCE
+#define B CLOCK_PROFILE_BALANCED
+#define L CLOCK_PROFILE_LOW_POWER
+
+// Entradas de un paso; now_ms se suma al instante inicial del caso
+typedef struct {
+    uint32_t now_ms;
+    uint16_t keys;
+    uint16_t console;
+    uint16_t audio;
+    bool ui;
+    bool compute;
+    clock_profile_t expected;
+} step_t;
+
+typedef struct {
+    const char *name;
+    uint32_t start_ms;
+    step_t steps[MAX_STEPS];
+    int count;
+} case_t;
+
+static const case_t cases[] = {
+    { "arranque sin actividad", 0, {
+        {    0, 0, 0, 0, false, false, B },
+        { 1999, 0, 0, 0, false, false, B },
+        { 2000, 0, 0, 0, false, false, L },
+    }, 3 },
+    { "tecla despierta desde LOW_POWER", 0, {
+        { 5000, 0, 0, 0, false, false, L },
+        { 5001, 1, 0, 0, false, false, B },
+        { 7000, 0, 0, 0, false, false, B },
+        { 7001, 0, 0, 0, false, false, L },
+    }, 4 },
+    { "consola, audio e interfaz mantienen BALANCED", 0, {
+        { 1500, 0, 3, 0, false, false, B },
+        { 3000, 0, 0, 1, false, false, B },
+        { 4500, 0, 0, 0, true,  false, B },
+        { 6499, 0, 0, 0, false, false, B },
+        { 6500, 0, 0, 0, false, false, L },
+    }, 5 },
+    { "cálculo sube a PERFORMANCE con histéresis", 0, {
+        {   10, 0, 0, 0, false, true,  P },
+        {   50, 0, 0, 0, false, true,  P },
+        {  149, 0, 0, 0, false, false, P },
+        {  150, 0, 0, 0, false, false, B },
+        { 2049, 0, 0, 0, false, false, B },
+        { 2050, 0, 0, 0, false, false, L },
+    }, 6 },
+    { "cálculo desde LOW_POWER sube directo", 0, {
+        { 3000, 0, 0, 0, false, false, L },
+        { 3001, 0, 0, 0, false, true,  P },
+        { 3100, 0, 0, 0, false, false, P },
+        { 3101, 0, 0, 0, false, false, B },
+    }, 4 },
+    { "cálculo con audio pendiente prevalece", 0, {
+        {   10, 0, 0, 2, false, true,  P },
+        {  110, 0, 0, 2, false, false, B },
+    }, 2 },
+    { "sin cálculo previo no hay PERFORMANCE al inicio", 0, {
+        {    0, 0, 0, 0, false, false, B },
+        {   50, 0, 0, 0, false, false, B },
+    }, 2 },
+    { "desborde de HAL_GetTick", 0xFFFFFF00U, {
+        {    0, 0, 0, 0, false, true,  P },
+        {   99, 0, 0, 0, false, false, P },
+        {  100, 0, 0, 0, false, false, B },
+        { 1999, 0, 0, 0, false, false, B },
+        { 2000, 0, 0, 0, false, false, L },
+        { 2300, 1, 0, 0, false, false, B },
+    }, 6 },
+};
+
+static const char *profile_name(clock_profile_t p)
+{
+    static const char *names[] = { "PERFORMANCE", "BALANCED", "LOW_POWER" };
+    return (p < CLOCK_PROFILE_COUNT) ? names[p] : "?";
+}
+
+int main(void)
+{
+    unsigned failures = 0, steps = 0;
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        const case_t *tc = &cases[c];
+        clock_policy_t policy;
+        clock_policy_init(&policy, IDLE_MS, HOLD_MS, tc->start_ms);
+
+        for (int s = 0; s < tc->count; s++) {
+            const step_t *st = &tc->steps[s];
+            clock_policy_input_t input = {
+                .pending_keys = st->keys,
+                .pending_console = st->console,
+                .pending_audio = st->audio,
+                .ui_active = st->ui,
+                .compute_requested = st->compute,
+                .now_ms = tc->start_ms + st->now_ms,
+            };
+            clock_profile_t got = clock_policy_select(&policy, &input);
+            steps++;
+            if (got != st->expected) {
+                failures++;
+                printf("FALLO: %s, paso %d (t=%lu): %s, se esperaba %s\n", tc->name, s,
+                       (unsigned long)st->now_ms, profile_name(got), profile_name(st->expected));
+            }
+        }
+    }
+
+    printf("casos: %zu  pasos: %u  fallos: %u\n", sizeof(cases) / sizeof(cases[0]), steps, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+/**
+ * @brief Herramienta de host: genera la imagen de un slot de cred_db y mide búsquedas.
+ * @note  Usa el mismo cred_db.c del firmware sobre una FLASH simulada en RAM, así la
+ *        imagen es idéntica a la que escribiría el equipo.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          gcc -std=gnu11 -O2 -ICore/Inc Core/Src/cred_db.c Tools/cred_db_build.c -o cred_db_build
+ *
+ *        Uso:
+ *          cred_db_build <credenciales.txt> <slot.bin>   líneas "PIN usuario"
+ *          cred_db_build --bench                         ciclos por búsqueda (10, 1k, 50k)
+ *
+ *        slot.bin se graba en el inicio de CRED_A (0x08070000), por ejemplo:
+ *          STM32_Programmer_CLI -c port=SWD -w slot.bin 0x08070000
+ *        El otro slot debe estar borrado o tener una generación menor.
+ */
+#include "cred_db.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES() __rdtsc()
+#else
+#define HOST_CYCLES() 0ULL
+#endif
+
+#define HOST_PAGE_SIZE 2048U
+#define HOST_SLOT_SIZE (64U * 1024U)           // Igual que CRED_A/CRED_B
+#define HOST_BENCH_SLOT_SIZE (512U * 1024U)    // 50k credenciales no caben en 64K
+#define HOST_BENCH_LOOKUPS 2000000UL
+
+static uint8_t *host_flash;
+static uint32_t host_flash_size;
+
+static bool host_erase_page(uintptr_t addr)
+{
+    if (addr < (uintptr_t)host_flash || addr + HOST_PAGE_SIZE > (uintptr_t)host_flash + host_flash_size) {
+        return false;
+    }
+    memset((void *)addr, 0xFF, HOST_PAGE_SIZE);
+    return true;
+}
+
+static bool host_program_dword(uintptr_t addr, uint64_t data)
+{
+    uint64_t old;
+    memcpy(&old, (const void *)addr, 8);
+    if (old != UINT64_MAX) return false;  // Regla de la FLASH: solo sobre borrado
+    memcpy((void *)addr, &data, 8);
+    return true;
+}
+
+static const cred_db_flash_ops_t host_ops = {
+    .erase_page = host_erase_page,
+    .program_dword = host_program_dword,
+    .sync = NULL,
+};
+
+/**
+ * @brief Reserva dos slots contiguos alineados a página, borrados.
+ */
+static void host_flash_alloc(uint32_t slot_size)
+{
+    free(host_flash);
+    host_flash_size = 2U * slot_size;
+    host_flash = aligned_alloc(HOST_PAGE_SIZE, host_flash_size);
+    if (host_flash == NULL) {
+        fprintf(stderr, "sin memoria\n");
+        exit(1);
+    }
+    memset(host_flash, 0xFF, host_flash_size);
+}
+
+static int host_cmp_record(const void *a, const void *b)
+{
+    uint32_t ka = ((const cred_record_t *)a)->key;
+    uint32_t kb = ((const cred_record_t *)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static bool host_build(cred_db_t *db, cred_record_t *set, uint32_t count, uint32_t slot_size)
+{
+    host_flash_alloc(slot_size);
+    cred_db_init(db, &host_ops, (uintptr_t)host_flash, (uintptr_t)host_flash + slot_size,
+                 slot_size, HOST_PAGE_SIZE);
+    qsort(set, count, sizeof(*set), host_cmp_record);
+    if (!cred_db_begin_update(db)) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!cred_db_stage(db, &set[i])) {
+            fprintf(stderr, "registro %u rechazado (clave repetida o sin espacio, capacidad %u)\n",
+                    i, cred_db_capacity(db));
+            return false;
+        }
+    }
+    return cred_db_commit(db);
+}
+
+static int host_build_file(const char *in_path, const char *out_path)
+{
+    FILE *in = fopen(in_path, "r");
+    if (in == NULL) {
+        perror(in_path);
+        return 1;
+    }
+    uint32_t cap = (HOST_SLOT_SIZE - CRED_DB_RECORDS_OFFSET) / sizeof(cred_record_t);
+    cred_record_t *set = calloc(cap, sizeof(*set));
+    uint32_t count = 0;
+    char pin[8];
+    unsigned user;
+    while (count < cap && fscanf(in, "%7s %u", pin, &user) == 2) {
+        set[count].key = cred_db_key_from_pin(pin, (uint8_t)strlen(pin));
+        set[count].user_id = (uint16_t)user;
+        set[count].flags = CRED_FLAG_ENABLED;
+        set[count].reserved = 0xFF;
+        count++;
+    }
+    fclose(in);
+
+    cred_db_t db;
+    if (!host_build(&db, set, count, HOST_SLOT_SIZE)) return 1;
+
+    FILE *out = fopen(out_path, "wb");
+    if (out == NULL || fwrite(host_flash, 1, HOST_SLOT_SIZE, out) != HOST_SLOT_SIZE) {
+        perror(out_path);
+        return 1;
+    }
+    fclose(out);
+    printf("%u credenciales, %u niveles de indice (%u bytes), capacidad %u\n", count, db.levels,
+           cred_db_index_size(count), cred_db_capacity(&db));
+    free(set);
+    return 0;
+}
+
+/**
+ * @brief Búsqueda binaria sobre el arreglo ordenado (la imagen sin índice), como referencia.
+ */
+static const cred_record_t *host_bsearch(const cred_record_t *r, uint32_t count, uint32_t key)
+{
+    uint32_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2U;
+        if (r[mid].key == key) return &r[mid];
+        if (r[mid].key < key) lo = mid + 1U; else hi = mid;
+    }
+    return NULL;
+}
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int host_bench(void)
+{
+    static const uint32_t sizes[] = { 10, 1000, 50000 };
+    uint32_t max = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    cred_record_t *set = calloc(max, sizeof(*set));
+    uint32_t *probe = malloc(max * 2U * sizeof(*probe));
+    uint32_t seed = 12345;
+
+    printf("%8s %6s %14s %14s %14s %14s\n", "n", "niveles", "indice ns", "indice ciclos",
+           "binaria ns", "binaria ciclos");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        for (uint32_t i = 0; i < n; i++) {
+            set[i].key = 0x01000000U + i * 37U;  // Claves separadas: los impares de la sonda fallan
+            set[i].user_id = (uint16_t)i;
+            set[i].flags = CRED_FLAG_ENABLED;
+            set[i].reserved = 0xFF;
+        }
+        cred_db_t db;
+        if (!host_build(&db, set, n, HOST_BENCH_SLOT_SIZE)) return 1;
+
+        // Mitad aciertos, mitad fallos, en orden aleatorio
+        for (uint32_t i = 0; i < 2U * n; i++) {
+            seed = seed * 1664525U + 1013904223U;
+            uint32_t k = set[(seed >> 8) % n].key;
+            probe[i] = (i & 1U) ? k + 1U : k;
+        }
+
+        volatile uintptr_t sink = 0;
+        double t0 = host_now_ns();
+        unsigned long long c0 = HOST_CYCLES();
+        for (unsigned long i = 0; i < HOST_BENCH_LOOKUPS; i++) {
+            sink += (uintptr_t)cred_db_find(&db, probe[i % (2U * n)]);
+        }
+        unsigned long long c_idx = HOST_CYCLES() - c0;
+        double t_idx = host_now_ns() - t0;
+
+        t0 = host_now_ns();
+        c0 = HOST_CYCLES();
+        for (unsigned long i = 0; i < HOST_BENCH_LOOKUPS; i++) {
+            sink += (uintptr_t)host_bsearch(db.records, db.count, probe[i % (2U * n)]);
+        }
+        unsigned long long c_bin = HOST_CYCLES() - c0;
+        double t_bin = host_now_ns() - t0;
+
+        // Verificación cruzada
+        for (uint32_t i = 0; i < 2U * n; i++) {
+            if (cred_db_find(&db, probe[i]) != host_bsearch(db.records, db.count, probe[i])) {
+                fprintf(stderr, "resultado distinto para la clave %08x\n", probe[i]);
+                return 1;
+            }
+        }
+        printf("%8u %6u %14.1f %14.1f %14.1f %14.1f\n", n, db.levels,
+               t_idx / HOST_BENCH_LOOKUPS, (double)c_idx / HOST_BENCH_LOOKUPS,
+               t_bin / HOST_BENCH_LOOKUPS, (double)c_bin / HOST_BENCH_LOOKUPS);
+    }
+    free(set);
+    free(probe);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 2 && strcmp(argv[1], "--bench") == 0) return host_bench();
+    if (argc == 3) return host_build_file(argv[1], argv[2]);
+    fprintf(stderr, "uso: %s <credenciales.txt> <slot.bin> | --bench\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,136 @@
+/**
+ * @brief Modelo en el host de cortes de energía durante una actualización de cred_db.
+ * @note  Usa la FLASH simulada de Tools/host/sim_flash.c, que corta la energía tras
+ *        N operaciones. Tras cada corte se "reinicia" y se verifica que cred_db
+ *        publique exactamente la imagen vieja o la nueva, y que pueda actualizarse
+ *        otra vez. El corte durante el journal está en Tools/journal_powerfail.c.
+ *
+ *        Compilar y ejecutar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/host -B build/host && cmake --build build/host
+ *          ctest --test-dir build/host -R cred_db_powerfail
+ */
+#include "cred_db.h"
+#include "sim_flash.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SIM_OLD_COUNT 300U
+#define SIM_NEW_COUNT 500U
+#define SIM_SEEDS 8U
+
+static const cred_db_flash_ops_t sim_ops_table = {
+    .erase_page = sim_erase_page,
+    .program_dword = sim_program_dword,
+    .sync = sim_sync,
+    .read = sim_read,
+};
+
+static void sim_make_set(cred_record_t *set, uint32_t count, uint32_t first_key, uint32_t step)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        set[i].key = first_key + i * step;
+        set[i].user_id = (uint16_t)(i + 1);
+        set[i].flags = CRED_FLAG_ENABLED;
+        set[i].reserved = 0xFF;
+    }
+}
+
+static bool sim_write_set(cred_db_t *db, const cred_record_t *set, uint32_t count)
+{
+    if (!cred_db_begin_update(db)) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!cred_db_stage(db, &set[i])) return false;
+    }
+    return cred_db_commit(db);
+}
+
+static bool sim_matches(const cred_db_t *db, const cred_record_t *set, uint32_t count)
+{
+    if (db->active < 0 || db->count != count) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        const cred_record_t *r = cred_db_find(db, set[i].key);
+        if (r == NULL || r->user_id != set[i].user_id) return false;
+    }
+    return true;
+}
+
+static void sim_boot(cred_db_t *db)
+{
+    cred_db_init(db, &sim_ops_table, (uintptr_t)sim_flash[0], (uintptr_t)sim_flash[1],
+                 SIM_SLOT_SIZE, SIM_PAGE_SIZE);
+}
+
+/**
+ * @brief Cortes durante una actualización de la base de credenciales.
+ * @return Cantidad de fallos.
+ */
+static unsigned long cred_db_powerfail(void)
+{
+    static cred_record_t old_set[SIM_OLD_COUNT];
+    static cred_record_t new_set[SIM_NEW_COUNT];
+    cred_db_t db;
+
+    sim_make_set(old_set, SIM_OLD_COUNT, 0x31313131U, 7);
+    sim_make_set(new_set, SIM_NEW_COUNT, 0x31313135U, 5);
+
+    // Estado inicial: dos generaciones ya escritas, la vieja activa en uno de los slots
+    sim_reset();
+    sim_boot(&db);
+    if (!sim_write_set(&db, new_set, SIM_NEW_COUNT) || !sim_write_set(&db, old_set, SIM_OLD_COUNT)) {
+        fprintf(stderr, "cred_db: no se pudo preparar el estado inicial\n");
+        return 1;
+    }
+    sim_save();
+
+    // Cantidad de operaciones de una actualización completa
+    sim_ops = 0;
+    sim_boot(&db);
+    sim_write_set(&db, new_set, SIM_NEW_COUNT);
+    unsigned long total_ops = sim_ops;
+
+    unsigned long kept_old = 0, got_new = 0, failures = 0, ecc_cuts = 0;
+    for (unsigned seed = 1; seed <= SIM_SEEDS; seed++) {
+        srand(seed);
+        for (long cut = 0; cut <= (long)total_ops; cut++) {
+            sim_restore();
+            sim_power_on();
+            sim_boot(&db);
+
+            sim_budget = cut;
+            sim_write_set(&db, new_set, SIM_NEW_COUNT);
+
+            // Reinicio
+            sim_power_on();
+            unsigned long hits = sim_ecc_hits;
+            sim_boot(&db);
+            if (sim_ecc_hits != hits) ecc_cuts++;
+            if (sim_matches(&db, old_set, SIM_OLD_COUNT)) {
+                kept_old++;
+            } else if (sim_matches(&db, new_set, SIM_NEW_COUNT)) {
+                got_new++;
+            } else {
+                failures++;
+                printf("FALLO cred_db: semilla %u corte %ld -> slot %d n=%lu\n", seed, cut, db.active,
+                       (unsigned long)db.count);
+                continue;
+            }
+
+            // La base debe poder actualizarse otra vez después del corte
+            if (!sim_write_set(&db, new_set, SIM_NEW_COUNT) || !sim_matches(&db, new_set, SIM_NEW_COUNT)) {
+                failures++;
+                printf("FALLO cred_db: semilla %u corte %ld -> no se recupera\n", seed, cut);
+            }
+        }
+    }
+
+    printf("cred_db: operaciones por actualizacion: %lu\n", total_ops);
+    printf("cred_db: cortes simulados: %lu  imagen vieja: %lu  imagen nueva: %lu\n",
+           (total_ops + 1) * SIM_SEEDS, kept_old, got_new);
+    printf("cred_db: con error ECC al recuperar: %lu  fallos: %lu\n", ecc_cuts, failures);
+    return failures;
+}
+
+int main(void)
+{
+    return cred_db_powerfail() == 0 ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+/**
+ * @brief Herramienta de host: mide en Linux los kernels de CMSIS-DSP que usa el firmware.
+ * @note  Mismos tamaños que benchmark_flash_cache (FIR de 32 taps y bloque de 64,
+ *        RFFT de 256) más algunas funciones de BasicMath y Statistics. En el host
+ *        arm_math.h usa el camino en C genérico, así que sirve para comparar
+ *        algoritmos y detectar regresiones, no para predecir ciclos del Cortex-M4.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/dsp_host_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_FIR_TAPS 32
+#define HOST_FIR_BLOCK 64
+#define HOST_FFT_LEN 256
+#define HOST_VEC_LEN 256
+#define HOST_RUNS 20000UL
+
+static float32_t fir_coeffs[HOST_FIR_TAPS];
+static float32_t fir_state[HOST_FIR_TAPS + HOST_FIR_BLOCK - 1];
+static float32_t signal_in[HOST_VEC_LEN];
+static float32_t signal_b[HOST_VEC_LEN];
+static float32_t signal_out[HOST_VEC_LEN];
+static arm_fir_instance_f32 fir;
+static arm_rfft_fast_instance_f32 rfft;
+static volatile float32_t sink;
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void run_fir(void)
+{
+    arm_fir_f32(&fir, signal_in, signal_out, HOST_FIR_BLOCK);
+}
+
+static void run_rfft(void)
+{
+    float32_t in[HOST_FFT_LEN];
+    memcpy(in, signal_in, sizeof(in));  // arm_rfft_fast_f32 modifica la entrada
+    arm_rfft_fast_f32(&rfft, in, signal_out, 0);
+}
+
+static void run_mult(void)
+{
+    arm_mult_f32(signal_in, signal_b, signal_out, HOST_VEC_LEN);
+}
+
+static void run_dot(void)
+{
+    float32_t r;
+    arm_dot_prod_f32(signal_in, signal_b, HOST_VEC_LEN, &r);
+    sink = r;
+}
+
+static void run_var(void)
+{
+    float32_t r;
+    arm_var_f32(signal_in, HOST_VEC_LEN, &r);
+    sink = r;
+}
+
+static const struct {
+    const char *name;
+    void (*run)(void);
+} kernels[] = {
+    { "arm_fir_f32 32x64", run_fir },
+    { "arm_rfft_fast_f32 256", run_rfft },
+    { "arm_mult_f32 256", run_mult },
+    { "arm_dot_prod_f32 256", run_dot },
+    { "arm_var_f32 256", run_var },
+};
+
+int main(void)
+{
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < HOST_VEC_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        signal_in[i] = (float32_t)((seed >> 8) & 0xFF) / 256.0f;
+        signal_b[i] = (float32_t)((seed >> 16) & 0xFF) / 256.0f;
+    }
+    for (uint32_t i = 0; i < HOST_FIR_TAPS; i++) fir_coeffs[i] = 1.0f / HOST_FIR_TAPS;
+    arm_fir_init_f32(&fir, HOST_FIR_TAPS, fir_coeffs, fir_state, HOST_FIR_BLOCK);
+    if (arm_rfft_fast_init_f32(&rfft, HOST_FFT_LEN) != ARM_MATH_SUCCESS) {
+        fprintf(stderr, "arm_rfft_fast_init_f32 fallo\n");
+        return 1;
+    }
+
+    printf("%-24s %12s\n", "kernel", "ns/llamada");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        kernels[k].run();  // Calentar caché
+        double t0 = host_now_ns();
+        for (unsigned long i = 0; i < HOST_RUNS; i++) kernels[k].run();
+        printf("%-24s %12.1f\n", kernels[k].name, (host_now_ns() - t0) / HOST_RUNS);
+    }
+    sink = signal_out[1];
+    return 0;
+}
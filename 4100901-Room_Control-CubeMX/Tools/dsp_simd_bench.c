@@ -0,0 +1,230 @@
+/**
+ * @brief Herramienta de host: throughput de los kernels f32 de CMSIS-DSP con el
+ *        camino en C y con cada nivel SIMD de x86 (SSE4.1, AVX2) soportado por la CPU.
+ * @note  Los tamaños son los del análisis fuera de línea de datos grabados (bloques
+ *        largos), no los del firmware. Cada variante SIMD se compara contra el
+ *        camino en C: devuelve 1 si el error relativo supera HOST_TOLERANCE.
+ *
+ *        dsp_simd_bench enlaza CMSIS_DSP (C desenrollado con CMSIS_DSP_LOOPUNROLL)
+ *        y dsp_simd_bench_scalar una copia sin desenrollar; la columna "c" de cada
+ *        uno da las cifras escalar y desenrollada. arm_mat_mult_f32 solo se mide
+ *        con Matrix en CMSIS_DSP_GROUPS.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/dsp_simd_bench && build/host-dsp/dsp_simd_bench_scalar
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+#ifndef HOST_C_PATH
+#define HOST_C_PATH "c"
+#endif
+
+#define HOST_VEC_LEN 4096
+#define HOST_FIR_TAPS 64
+#define HOST_FIR_BLOCK 1024
+#define HOST_MAT_DIM 64
+#define HOST_MIN_NS 20e6     // Tiempo mínimo de medición por kernel y nivel
+#define HOST_TOLERANCE 1e-4  // Error relativo admitido (orden de suma distinto, FMA)
+
+static float32_t vec_a[HOST_VEC_LEN];
+static float32_t vec_b[HOST_VEC_LEN];
+static float32_t cmplx_in[2 * HOST_VEC_LEN];
+static float32_t out[HOST_VEC_LEN];
+static float32_t ref[HOST_VEC_LEN];
+static float32_t fir_coeffs[HOST_FIR_TAPS];
+static float32_t fir_state[HOST_FIR_TAPS + HOST_FIR_BLOCK - 1];
+static arm_fir_instance_f32 fir;
+#if defined(HOST_MATRIX)
+static float32_t mat_a[HOST_MAT_DIM * HOST_MAT_DIM];
+static float32_t mat_b[HOST_MAT_DIM * HOST_MAT_DIM];
+static arm_matrix_instance_f32 mat_in_a, mat_in_b, mat_out;
+#endif
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Cada kernel deja su resultado en out[] y devuelve cuántos valores escribió */
+static uint32_t run_add(void)
+{
+    arm_add_f32(vec_a, vec_b, out, HOST_VEC_LEN);
+    return HOST_VEC_LEN;
+}
+
+static uint32_t run_mult(void)
+{
+    arm_mult_f32(vec_a, vec_b, out, HOST_VEC_LEN);
+    return HOST_VEC_LEN;
+}
+
+static uint32_t run_scale(void)
+{
+    arm_scale_f32(vec_a, 0.75f, out, HOST_VEC_LEN);
+    return HOST_VEC_LEN;
+}
+
+static uint32_t run_dot(void)
+{
+    arm_dot_prod_f32(vec_a, vec_b, HOST_VEC_LEN, out);
+    return 1;
+}
+
+static uint32_t run_mean(void)
+{
+    arm_mean_f32(vec_a, HOST_VEC_LEN, out);
+    return 1;
+}
+
+static uint32_t run_power(void)
+{
+    arm_power_f32(vec_a, HOST_VEC_LEN, out);
+    return 1;
+}
+
+static uint32_t run_var(void)
+{
+    arm_var_f32(vec_a, HOST_VEC_LEN, out);
+    return 1;
+}
+
+static uint32_t run_cmplx_mag(void)
+{
+    arm_cmplx_mag_f32(cmplx_in, out, HOST_VEC_LEN);
+    return HOST_VEC_LEN;
+}
+
+static uint32_t run_cmplx_mag_sq(void)
+{
+    arm_cmplx_mag_squared_f32(cmplx_in, out, HOST_VEC_LEN);
+    return HOST_VEC_LEN;
+}
+
+static uint32_t run_fir(void)
+{
+    // Estado en cero en cada llamada para que todas las variantes vean la misma entrada
+    memset(fir_state, 0, sizeof(fir_state));
+    arm_fir_f32(&fir, vec_a, out, HOST_FIR_BLOCK);
+    return HOST_FIR_BLOCK;
+}
+
+#if defined(HOST_MATRIX)
+static uint32_t run_mat_mult(void)
+{
+    static float32_t mat_c[HOST_MAT_DIM * HOST_MAT_DIM];
+    mat_out.pData = mat_c;
+    arm_mat_mult_f32(&mat_in_a, &mat_in_b, &mat_out);
+    memcpy(out, mat_c, sizeof(out) < sizeof(mat_c) ? sizeof(out) : sizeof(mat_c));
+    return HOST_VEC_LEN < HOST_MAT_DIM * HOST_MAT_DIM ? HOST_VEC_LEN : HOST_MAT_DIM * HOST_MAT_DIM;
+}
+#endif
+
+static const struct {
+    const char *name;
+    uint32_t (*run)(void);
+    double samples;  // Muestras (o MACs en FIR y matriz) por llamada, para el throughput
+} kernels[] = {
+    { "arm_add_f32 4096", run_add, HOST_VEC_LEN },
+    { "arm_mult_f32 4096", run_mult, HOST_VEC_LEN },
+    { "arm_scale_f32 4096", run_scale, HOST_VEC_LEN },
+    { "arm_dot_prod_f32 4096", run_dot, HOST_VEC_LEN },
+    { "arm_mean_f32 4096", run_mean, HOST_VEC_LEN },
+    { "arm_power_f32 4096", run_power, HOST_VEC_LEN },
+    { "arm_var_f32 4096", run_var, HOST_VEC_LEN },
+    { "arm_cmplx_mag_f32 4096", run_cmplx_mag, HOST_VEC_LEN },
+    { "arm_cmplx_mag_sq_f32 4096", run_cmplx_mag_sq, HOST_VEC_LEN },
+    { "arm_fir_f32 64x1024", run_fir, (double)HOST_FIR_TAPS * HOST_FIR_BLOCK },
+#if defined(HOST_MATRIX)
+    { "arm_mat_mult_f32 64x64", run_mat_mult, (double)HOST_MAT_DIM * HOST_MAT_DIM * HOST_MAT_DIM },
+#endif
+};
+
+/**
+ * @brief Mide un kernel con el nivel activo; devuelve millones de muestras por segundo.
+ */
+static double measure(size_t k)
+{
+    unsigned long runs = 0;
+    double t0 = host_now_ns(), elapsed;
+
+    kernels[k].run();  // Calentar caché
+    do {
+        for (unsigned long i = 0; i < 64; i++) kernels[k].run();
+        runs += 64;
+        elapsed = host_now_ns() - t0;
+    } while (elapsed < HOST_MIN_NS);
+    return kernels[k].samples * runs / elapsed * 1e3;
+}
+
+/**
+ * @brief Máximo error relativo de out[] contra ref[] (normalizado al máximo de ref).
+ */
+static double max_rel_error(uint32_t count)
+{
+    double peak = 0.0, err = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (fabs(ref[i]) > peak) peak = fabs(ref[i]);
+        if (fabs((double)out[i] - ref[i]) > err) err = fabs((double)out[i] - ref[i]);
+    }
+    return peak > 0.0 ? err / peak : err;
+}
+
+int main(void)
+{
+    arm_x86_simd_level_t best = arm_x86_simd_supported();
+    int failed = 0;
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < HOST_VEC_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        vec_a[i] = (float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+        vec_b[i] = (float32_t)((seed >> 16) & 0xFFFF) / 32768.0f - 1.0f;
+        cmplx_in[2 * i] = vec_a[i];
+        cmplx_in[2 * i + 1] = vec_b[i];
+    }
+    for (uint32_t i = 0; i < HOST_FIR_TAPS; i++) fir_coeffs[i] = vec_b[i] / HOST_FIR_TAPS;
+    arm_fir_init_f32(&fir, HOST_FIR_TAPS, fir_coeffs, fir_state, HOST_FIR_BLOCK);
+#if defined(HOST_MATRIX)
+    memcpy(mat_a, vec_a, sizeof(mat_a));
+    memcpy(mat_b, vec_b, sizeof(mat_b));
+    arm_mat_init_f32(&mat_in_a, HOST_MAT_DIM, HOST_MAT_DIM, mat_a);
+    arm_mat_init_f32(&mat_in_b, HOST_MAT_DIM, HOST_MAT_DIM, mat_b);
+    arm_mat_init_f32(&mat_out, HOST_MAT_DIM, HOST_MAT_DIM, NULL);
+#endif
+
+    printf("CPU: %s; camino en C %s; Mmuestras/s (x sobre C), error relativo maximo\n",
+           arm_x86_simd_name(best), HOST_C_PATH);
+    printf("%-26s %10s", "kernel", "c");
+    for (int l = ARM_X86_SIMD_SSE41; l <= (int)best; l++) printf(" %18s", arm_x86_simd_name((arm_x86_simd_level_t)l));
+    printf("\n");
+
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        arm_x86_simd_set_level(ARM_X86_SIMD_NONE);
+        uint32_t count = kernels[k].run();
+        memcpy(ref, out, count * sizeof(float32_t));
+        double base = measure(k);
+        printf("%-26s %10.0f", kernels[k].name, base);
+
+        for (int l = ARM_X86_SIMD_SSE41; l <= (int)best; l++) {
+            arm_x86_simd_set_level((arm_x86_simd_level_t)l);
+            kernels[k].run();
+            double err = max_rel_error(count);
+            double rate = measure(k);
+            printf(" %7.0f (x%4.1f) %s", rate, rate / base, err <= HOST_TOLERANCE ? "  " : "!!");
+            if (err > HOST_TOLERANCE) {
+                fprintf(stderr, "%s %s: error relativo %.2e\n", kernels[k].name,
+                        arm_x86_simd_name((arm_x86_simd_level_t)l), err);
+                failed = 1;
+            }
+        }
+        printf("\n");
+    }
+    arm_x86_simd_set_level(best);
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
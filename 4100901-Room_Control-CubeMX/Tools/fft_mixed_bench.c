@@ -0,0 +1,209 @@
+/**
+ * @brief Herramienta de host: FFT de radix mixto (arm_cfft_mixed_f32 /
+ *        arm_rfft_mixed_f32) contra la FFT de potencia de 2 con relleno de ceros.
+ * @note  Para las ventanas de los sensores (160, 240 y 480 muestras reales, y las
+ *        CFFT de la mitad) reporta el error contra una DFT en double, la ida y
+ *        vuelta con la transformada inversa y el tiempo por transformada de cada
+ *        variante. Devuelve 1 si algún error supera HOST_TOLERANCE.
+ *
+ *        Necesita las tablas de las potencias de 2 usadas (CMSIS_DSP_FFT_TABLES=ALL).
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/fft_mixed_bench
+ */
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_MAX_LEN 512
+#define HOST_MIN_NS 20e6     // Tiempo mínimo de medición por transformada
+#define HOST_TOLERANCE 1e-5  // Error relativo al pico del espectro
+
+static float32_t signal[2 * HOST_MAX_LEN];
+static float32_t work[2 * HOST_MAX_LEN];
+static float32_t out[2 * HOST_MAX_LEN];
+static float32_t back[2 * HOST_MAX_LEN];
+static float32_t twiddle[2 * HOST_MAX_LEN];
+static double ref[2 * HOST_MAX_LEN];
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief DFT compleja en double de los n primeros valores de signal (real si real != 0).
+ */
+static void dft_reference(uint32_t n, int real)
+{
+    for (uint32_t k = 0; k < n; k++) {
+        double re = 0.0, im = 0.0;
+        for (uint32_t t = 0; t < n; t++) {
+            double angle = -2.0 * M_PI * (double)((uint64_t)k * t % n) / n;
+            double xr = real ? signal[t] : signal[2 * t];
+            double xi = real ? 0.0 : signal[2 * t + 1];
+            re += xr * cos(angle) - xi * sin(angle);
+            im += xr * sin(angle) + xi * cos(angle);
+        }
+        ref[2 * k] = re;
+        ref[2 * k + 1] = im;
+    }
+}
+
+/**
+ * @brief Error máximo de out[] contra ref[] relativo al pico; con real != 0 out[]
+ *        está empaquetado como arm_rfft_fast_f32 (X[0], X[n/2], X[1] ... X[n/2-1]).
+ */
+static double spectrum_error(uint32_t n, int real)
+{
+    double peak = 0.0, err = 0.0;
+    uint32_t values = real ? n : 2 * n;
+    for (uint32_t i = 0; i < values; i++) {
+        double expected = (real && i == 1) ? ref[n] : ref[i];
+        if (fabs(expected) > peak) peak = fabs(expected);
+        if (fabs(out[i] - expected) > err) err = fabs(out[i] - expected);
+    }
+    return err / peak;
+}
+
+static double max_error(const float32_t *a, const float32_t *b, uint32_t count)
+{
+    double err = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (fabs((double)a[i] - b[i]) > err) err = fabs((double)a[i] - b[i]);
+    }
+    return err;
+}
+
+static const arm_cfft_instance_f32 *pow2_cfft(uint32_t n)
+{
+    switch (n) {
+    case 128: return &arm_cfft_sR_f32_len128;
+    case 256: return &arm_cfft_sR_f32_len256;
+    default: return &arm_cfft_sR_f32_len512;
+    }
+}
+
+static uint32_t next_pow2(uint32_t n)
+{
+    uint32_t p = 16;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+/* Transformadas medidas: cada una copia su entrada (las de CMSIS la modifican) */
+static arm_cfft_mixed_instance_f32 cfft_mixed;
+static arm_rfft_mixed_instance_f32 rfft_mixed;
+static arm_rfft_fast_instance_f32 rfft_pow2;
+static const arm_cfft_instance_f32 *cfft_pow2;
+static uint32_t run_len;
+
+static void run_cfft_mixed(void)
+{
+    memcpy(work, signal, 2 * run_len * sizeof(float32_t));
+    arm_cfft_mixed_f32(&cfft_mixed, work, out, 0);
+}
+
+static void run_cfft_pow2(void)
+{
+    memset(work, 0, 2 * cfft_pow2->fftLen * sizeof(float32_t));
+    memcpy(work, signal, 2 * run_len * sizeof(float32_t));
+    arm_cfft_f32(cfft_pow2, work, 0, 1);
+}
+
+static void run_rfft_mixed(void)
+{
+    memcpy(work, signal, run_len * sizeof(float32_t));
+    arm_rfft_mixed_f32(&rfft_mixed, work, out, 0);
+}
+
+static void run_rfft_pow2(void)
+{
+    memset(work, 0, rfft_pow2.fftLenRFFT * sizeof(float32_t));
+    memcpy(work, signal, run_len * sizeof(float32_t));
+    arm_rfft_fast_f32(&rfft_pow2, work, out, 0);
+}
+
+/**
+ * @brief Nanosegundos por llamada de run: mejor tanda de 64 durante HOST_MIN_NS
+ *        (el mínimo es más estable que el promedio en un host compartido).
+ */
+static double measure(void (*run)(void))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+
+    run();  // Calentar caché
+    do {
+        t0 = host_now_ns();
+        for (int i = 0; i < 64; i++) run();
+        batch = (host_now_ns() - t0) / 64;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best;
+}
+
+int main(void)
+{
+    static const uint16_t real_lens[] = { 160, 240, 480 };
+    int failed = 0;
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < 2 * HOST_MAX_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        signal[i] = (float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+    }
+
+    printf("%-10s %10s %10s %10s %10s %12s %8s\n", "FFT", "err", "ida/vuelta", "ns", "pot. 2", "ns pot. 2",
+           "x");
+    for (size_t l = 0; l < sizeof(real_lens) / sizeof(real_lens[0]); l++) {
+        for (int real = 0; real <= 1; real++) {
+            uint32_t n = real ? real_lens[l] : real_lens[l] / 2U;
+            uint32_t pow2 = next_pow2(n);
+            double err, roundtrip, t_mixed, t_pow2;
+
+            run_len = n;
+            dft_reference(n, real);
+            if (real) {
+                if (arm_rfft_mixed_init_f32(&rfft_mixed, n, twiddle) != ARM_MATH_SUCCESS ||
+                    arm_rfft_fast_init_f32(&rfft_pow2, pow2) != ARM_MATH_SUCCESS) {
+                    fprintf(stderr, "rfft %u: init fallo\n", n);
+                    return 1;
+                }
+                run_rfft_mixed();
+                err = spectrum_error(n, 1);
+                memcpy(work, out, n * sizeof(float32_t));
+                arm_rfft_mixed_f32(&rfft_mixed, work, back, 1);
+                roundtrip = max_error(back, signal, n);
+                t_mixed = measure(run_rfft_mixed);
+                t_pow2 = measure(run_rfft_pow2);
+            } else {
+                if (arm_cfft_mixed_init_f32(&cfft_mixed, n, twiddle) != ARM_MATH_SUCCESS) {
+                    fprintf(stderr, "cfft %u: init fallo\n", n);
+                    return 1;
+                }
+                cfft_pow2 = pow2_cfft(pow2);
+                run_cfft_mixed();
+                err = spectrum_error(n, 0);
+                memcpy(work, out, 2 * n * sizeof(float32_t));
+                arm_cfft_mixed_f32(&cfft_mixed, work, back, 1);
+                roundtrip = max_error(back, signal, 2 * n);
+                t_mixed = measure(run_cfft_mixed);
+                t_pow2 = measure(run_cfft_pow2);
+            }
+
+            char name[16];
+            snprintf(name, sizeof(name), "%s %u", real ? "rfft" : "cfft", n);
+            printf("%-10s %10.1e %10.1e %10.0f %10u %12.0f %8.2f\n", name, err, roundtrip, t_mixed, pow2, t_pow2,
+                   t_pow2 / t_mixed);
+            if (err > HOST_TOLERANCE || roundtrip > HOST_TOLERANCE) {
+                fprintf(stderr, "%s: error %.2e, ida y vuelta %.2e\n", name, err, roundtrip);
+                failed = 1;
+            }
+        }
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
@@ -0,0 +1,150 @@
+/**
+ * @brief Herramienta de host: compara las tablas de FFT f32 generadas en RAM
+ *        (arm_cfft_init_dyn_f32 / arm_rfft_fast_init_dyn_f32) con las de FLASH.
+ * @note  Por tamaño reporta el error máximo de los twiddles, si la tabla de bit
+ *        reversal produce la misma permutación, el error de una RFFT completa
+ *        contra la que usa las tablas de FLASH, los bytes de arena y el tiempo de
+ *        inicialización. Devuelve 1 si algo supera las tolerancias.
+ *
+ *        Necesita todas las tablas (CMSIS_DSP_FFT_TABLES=ALL, el valor del host).
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/fft_tables_check
+ */
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include <stdio.h>
+#include <time.h>
+
+#if defined(ARM_DSP_CONFIG_TABLES)
+#error "fft_tables_check compara contra todas las tablas: usar CMSIS_DSP_FFT_TABLES=ALL"
+#endif
+
+#define HOST_MAX_LEN 4096
+#define HOST_MIN_NS 20e6           // Tiempo mínimo de medición de cada init
+#define HOST_TWIDDLE_TOLERANCE 5e-7  // Unas 4 ulp de float cerca de 1.0
+#define HOST_FFT_TOLERANCE 1e-5      // Relativo al pico del espectro
+
+// Cota de arm_cfft_init_dyn_size_f32: 12 bytes por punto
+static uint32_t arena[(12 * HOST_MAX_LEN) / sizeof(uint32_t)];
+static uint32_t perm_rom[HOST_MAX_LEN * 2];
+static uint32_t perm_dyn[HOST_MAX_LEN * 2];
+static float32_t fft_in[HOST_MAX_LEN];
+static float32_t fft_work[HOST_MAX_LEN];
+static float32_t fft_rom[HOST_MAX_LEN];
+static float32_t fft_dyn[HOST_MAX_LEN];
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double max_abs_error(const float32_t *a, const float32_t *b, uint32_t count)
+{
+    double err = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (fabs((double)a[i] - b[i]) > err) err = fabs((double)a[i] - b[i]);
+    }
+    return err;
+}
+
+// Definida en arm_bitreversal2.c, sin prototipo en arm_math.h (igual que en arm_cfft_f32.c)
+extern void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTable);
+
+/**
+ * @brief Aplica la tabla de bit reversal a la identidad (cada complejo = 2 palabras).
+ */
+static void apply_bitrev(uint32_t *perm, uint32_t n, const arm_cfft_instance_f32 *s)
+{
+    for (uint32_t i = 0; i < 2 * n; i++) perm[i] = i;
+    arm_bitreversal_32(perm, s->bitRevLength, s->pBitRevTable);
+}
+
+/**
+ * @brief Ejecuta la RFFT de fft_in con la instancia dada y deja el espectro en out.
+ */
+static void run_rfft(arm_rfft_fast_instance_f32 *s, float32_t *out)
+{
+    memcpy(fft_work, fft_in, s->fftLenRFFT * sizeof(float32_t));  // arm_rfft_fast_f32 modifica la entrada
+    arm_rfft_fast_f32(s, fft_work, out, 0);
+}
+
+int main(void)
+{
+    static const arm_cfft_instance_f32 *const rom[] = {
+        &arm_cfft_sR_f32_len16, &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64,
+        &arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512,
+        &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096,
+    };
+    int failed = 0;
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < HOST_MAX_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        fft_in[i] = (float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+    }
+
+    printf("%-6s %8s %10s %8s %10s %8s %10s %10s\n", "N", "arena B", "FLASH B", "tw err", "bitrev",
+           "rfft 2N", "rfft err", "init us");
+    for (size_t k = 0; k < sizeof(rom) / sizeof(rom[0]); k++) {
+        const arm_cfft_instance_f32 *cfft_rom = rom[k];
+        uint16_t n = cfft_rom->fftLen;
+        arm_cfft_instance_f32 cfft_dyn;
+
+        // CFFT de N puntos: twiddles y permutación
+        if (arm_cfft_init_dyn_f32(&cfft_dyn, n, arena, sizeof(arena)) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "CFFT %u: arm_cfft_init_dyn_f32 fallo\n", n);
+            failed = 1;
+            continue;
+        }
+        double tw_err = max_abs_error(cfft_dyn.pTwiddle, cfft_rom->pTwiddle, 2U * n);
+        apply_bitrev(perm_rom, n, cfft_rom);
+        apply_bitrev(perm_dyn, n, &cfft_dyn);
+        int same_perm = memcmp(perm_rom, perm_dyn, 2U * n * sizeof(uint32_t)) == 0;
+        int same_len = cfft_dyn.bitRevLength == cfft_rom->bitRevLength;
+        uint32_t flash = 2U * n * sizeof(float32_t) + cfft_rom->bitRevLength * sizeof(uint16_t);
+        printf("%-6u %8lu %10lu %8.1e %10s", n, (unsigned long)arm_cfft_init_dyn_size_f32(n),
+               (unsigned long)flash, tw_err, !same_perm ? "DISTINTA" : same_len ? "igual" : "otra long");
+
+        // RFFT de 2N puntos (su CFFT interna es la de N), salvo 8192 que no existe
+        double rfft_err = 0.0, init_ns;
+        uint16_t len = (uint16_t)(2U * n);
+        if (n < HOST_MAX_LEN) {
+            arm_rfft_fast_instance_f32 rfft_rom, rfft_dyn;
+            arm_rfft_fast_init_f32(&rfft_rom, len);
+            arm_rfft_fast_init_dyn_f32(&rfft_dyn, len, arena, sizeof(arena));
+            double rfft_tw_err = max_abs_error(rfft_dyn.pTwiddleRFFT, rfft_rom.pTwiddleRFFT, len);
+            if (rfft_tw_err > tw_err) tw_err = rfft_tw_err;
+            run_rfft(&rfft_rom, fft_rom);
+            run_rfft(&rfft_dyn, fft_dyn);
+            double peak = 0.0;
+            for (uint32_t i = 0; i < len; i++) {
+                if (fabs(fft_rom[i]) > peak) peak = fabs(fft_rom[i]);
+            }
+            rfft_err = max_abs_error(fft_dyn, fft_rom, len) / peak;
+
+            // Tiempo de arm_rfft_fast_init_dyn_f32 (el caso de arranque del firmware)
+            unsigned long runs = 0;
+            double t0 = host_now_ns();
+            do {
+                arm_rfft_fast_init_dyn_f32(&rfft_dyn, len, arena, sizeof(arena));
+                runs++;
+                init_ns = host_now_ns() - t0;
+            } while (init_ns < HOST_MIN_NS);
+            init_ns /= runs;
+            printf(" %8u %10.1e %10.2f\n", len, rfft_err, init_ns / 1e3);
+        } else {
+            printf(" %8s %10s %10s\n", "-", "-", "-");
+        }
+
+        if (tw_err > HOST_TWIDDLE_TOLERANCE || !same_perm || !same_len || rfft_err > HOST_FFT_TOLERANCE) {
+            fprintf(stderr, "N=%u: twiddles %.2e, permutacion %s, longitud %u/%u, rfft %.2e\n", n, tw_err,
+                    same_perm ? "igual" : "distinta", cfft_dyn.bitRevLength, cfft_rom->bitRevLength, rfft_err);
+            failed = 1;
+        }
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
@@ -0,0 +1,145 @@
+/**
+ * @brief Herramienta de host: FIR por convolución FFT particionada (overlap-save,
+ *        arm_fir_fft_f32) contra el FIR directo (arm_fir_f32).
+ * @note  Para 16 a 4096 taps y particiones de 64, 256 y 1024 muestras filtra la
+ *        misma señal con ambos, reporta el error relativo al pico de la salida y
+ *        los ns por muestra, y marca desde cuántos taps gana la FFT (cruce). Las
+ *        dos variantes por el camino en C, el del Cortex-M4. Devuelve 1 si algún
+ *        error supera HOST_TOLERANCE.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX (requiere las tablas ALL):
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/fir_fft_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_MIN_TAPS 16
+#define HOST_MAX_TAPS 4096
+#define HOST_CHUNK 1024         // Muestras por llamada: múltiplo de todas las particiones
+#define HOST_CHUNKS 8           // La señal cubre varias veces el filtro más largo
+#define HOST_LEN (HOST_CHUNK * HOST_CHUNKS)
+#define HOST_NUM_PARTS 3
+#define HOST_MIN_NS 20e6        // Tiempo mínimo de medición por variante
+#define HOST_TOLERANCE 1e-4     // Error relativo al pico de la salida
+#define HOST_FFT_STATE_LEN ARM_FIR_FFT_STATE_LEN_F32(HOST_MAX_TAPS, 1024U)  // El mayor de la tabla
+
+static const uint32_t part_sizes[HOST_NUM_PARTS] = {64, 256, 1024};
+
+static float32_t coeffs[HOST_MAX_TAPS];
+static float32_t in[HOST_LEN];
+static float32_t out_ref[HOST_LEN], out[HOST_LEN];  // out: la variante en prueba
+static float32_t fir_state[HOST_MAX_TAPS + HOST_CHUNK - 1];
+static float32_t fft_state[HOST_FFT_STATE_LEN];
+
+static arm_fir_instance_f32 fir;
+static arm_fir_fft_instance_f32 fir_fft;
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void run_direct(uint32_t chunk)
+{
+    arm_fir_f32(&fir, &in[chunk * HOST_CHUNK], &out[chunk * HOST_CHUNK], HOST_CHUNK);
+}
+
+static void run_fft(uint32_t chunk)
+{
+    arm_fir_fft_f32(&fir_fft, &in[chunk * HOST_CHUNK], &out[chunk * HOST_CHUNK], HOST_CHUNK);
+}
+
+/**
+ * @brief Nanosegundos por muestra de run: mejor tanda de 8 bloques durante HOST_MIN_NS.
+ */
+static double measure(void (*run)(uint32_t))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+
+    run(0);  // Calentar caché
+    do {
+        t0 = host_now_ns();
+        for (uint32_t i = 0; i < 8; i++) run(i % HOST_CHUNKS);
+        batch = (host_now_ns() - t0) / 8;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best / HOST_CHUNK;
+}
+
+int main(void)
+{
+    int failed = 0;
+    uint32_t crossover = 0;
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < HOST_MAX_TAPS; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        coeffs[i] = ((float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f) / 16.0f;
+    }
+    for (uint32_t i = 0; i < HOST_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        in[i] = (float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+    }
+
+#if defined(ARM_MATH_X86_SIMD)
+    // arm_fir_f32 y arm_add_f32 tienen variantes AVX: se comparan los caminos en C
+    arm_x86_simd_set_level(ARM_X86_SIMD_NONE);
+#endif
+
+    printf("%-5s %10s", "taps", "ns/m dir");
+    for (uint32_t b = 0; b < HOST_NUM_PARTS; b++) printf("   B=%-4u %9s %6s", part_sizes[b], "ns/m fft", "x");
+    printf("\n");
+
+    for (uint32_t taps = HOST_MIN_TAPS; taps <= HOST_MAX_TAPS; taps *= 2) {
+        double best_x = 0.0;
+
+        // Los coeficientes del final del arreglo: h[] crece por el lado de b[0]
+        const float32_t *pCoeffs = &coeffs[HOST_MAX_TAPS - taps];
+        arm_fir_init_f32(&fir, (uint16_t)taps, pCoeffs, fir_state, HOST_CHUNK);
+        for (uint32_t c = 0; c < HOST_CHUNKS; c++) run_direct(c);
+        memcpy(out_ref, out, sizeof(out_ref));  // measure() sigue filtrando con el estado acumulado
+        double peak = 0.0;
+        for (uint32_t i = 0; i < HOST_LEN; i++) {
+            if (fabs(out_ref[i]) > peak) peak = fabs(out_ref[i]);
+        }
+        double t_direct = measure(run_direct);
+        printf("%-5u %10.2f", taps, t_direct);
+
+        for (uint32_t b = 0; b < HOST_NUM_PARTS; b++) {
+            if (arm_fir_fft_init_f32(&fir_fft, (uint16_t)taps, pCoeffs, fft_state, part_sizes[b]) !=
+                ARM_MATH_SUCCESS) {
+                fprintf(stderr, "\n%u taps, B=%u: init fallo\n", taps, part_sizes[b]);
+                return 1;
+            }
+            for (uint32_t c = 0; c < HOST_CHUNKS; c++) run_fft(c);
+
+            double err = 0.0;
+            for (uint32_t i = 0; i < HOST_LEN; i++) {
+                if (fabs((double)out[i] - out_ref[i]) > err) err = fabs((double)out[i] - out_ref[i]);
+            }
+            err /= peak;
+
+            double t_fft = measure(run_fft);
+            printf("   %-6.0e %9.2f %6.2f", err, t_fft, t_direct / t_fft);
+            if (t_direct / t_fft > best_x) best_x = t_direct / t_fft;
+            if (err > HOST_TOLERANCE) {
+                fprintf(stderr, "\n%u taps, B=%u: error %.2e\n", taps, part_sizes[b], err);
+                failed = 1;
+            }
+        }
+        printf("\n");
+        if (crossover == 0 && best_x > 1.0) crossover = taps;
+    }
+
+    if (crossover != 0) {
+        printf("Cruce: la FFT gana desde %u taps\n", crossover);
+    } else {
+        printf("Cruce: el FIR directo gana hasta %u taps\n", HOST_MAX_TAPS);
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
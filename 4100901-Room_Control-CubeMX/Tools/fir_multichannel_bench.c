@@ -0,0 +1,179 @@
+/**
+ * @brief Herramienta de host: FIR de N canales entrelazados en una pasada
+ *        (arm_fir_multichannel_f32/q15) contra un arm_fir_f32/q15 por canal.
+ * @note  Para 1 a 8 canales filtra dos bloques seguidos con ambas variantes (así
+ *        se verifica también el estado entre llamadas) y reporta la diferencia y
+ *        los ns por muestra. El camino por canal incluye separar y volver a
+ *        entrelazar los canales, que es lo que evita la API multicanal. q15 debe
+ *        coincidir bit a bit; f32 dentro de HOST_TOLERANCE. Devuelve 1 si no.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/fir_multichannel_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_TAPS 32            // Par: arm_fir_q15 lo exige en el camino con DSP
+#define HOST_BLOCK 160          // Tramas por llamada (ventana de 10 ms a 16 kHz)
+#define HOST_MAX_CHANNELS 8
+#define HOST_MIN_NS 20e6        // Tiempo mínimo de medición por variante
+#define HOST_TOLERANCE 1e-5     // Error f32 relativo al pico de la salida
+#define HOST_STATE_LEN (HOST_TAPS + HOST_BLOCK)  // arm_fir_init_q15 usa numTaps+blockSize
+
+static float32_t coeffs_f32[HOST_TAPS];
+static q15_t coeffs_q15[HOST_TAPS];
+static float32_t in_f32[2 * HOST_BLOCK * HOST_MAX_CHANNELS];
+static q15_t in_q15[2 * HOST_BLOCK * HOST_MAX_CHANNELS];
+static float32_t out_f32[2][2 * HOST_BLOCK * HOST_MAX_CHANNELS];  // [0] por canal, [1] multicanal
+static q15_t out_q15[2][2 * HOST_BLOCK * HOST_MAX_CHANNELS];
+static float32_t state_f32[HOST_MAX_CHANNELS][HOST_STATE_LEN];
+static q15_t state_q15[HOST_MAX_CHANNELS][HOST_STATE_LEN];
+static float32_t mc_state_f32[HOST_STATE_LEN * HOST_MAX_CHANNELS];
+static q15_t mc_state_q15[HOST_STATE_LEN * HOST_MAX_CHANNELS];
+static float32_t chan_in_f32[HOST_BLOCK], chan_out_f32[HOST_BLOCK];
+static q15_t chan_in_q15[HOST_BLOCK], chan_out_q15[HOST_BLOCK];
+
+static arm_fir_instance_f32 fir_f32[HOST_MAX_CHANNELS];
+static arm_fir_instance_q15 fir_q15[HOST_MAX_CHANNELS];
+static arm_fir_multichannel_instance_f32 mc_f32;
+static arm_fir_multichannel_instance_q15 mc_q15;
+static uint32_t run_channels;
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Un bloque de cada variante; block elige la mitad de entrada y salida */
+static void run_per_channel_f32(uint32_t block)
+{
+    const float32_t *in = &in_f32[block * HOST_BLOCK * run_channels];
+    float32_t *out = &out_f32[0][block * HOST_BLOCK * run_channels];
+
+    for (uint32_t ch = 0; ch < run_channels; ch++) {
+        for (uint32_t n = 0; n < HOST_BLOCK; n++) chan_in_f32[n] = in[n * run_channels + ch];
+        arm_fir_f32(&fir_f32[ch], chan_in_f32, chan_out_f32, HOST_BLOCK);
+        for (uint32_t n = 0; n < HOST_BLOCK; n++) out[n * run_channels + ch] = chan_out_f32[n];
+    }
+}
+
+static void run_multichannel_f32(uint32_t block)
+{
+    arm_fir_multichannel_f32(&mc_f32, &in_f32[block * HOST_BLOCK * run_channels],
+                             &out_f32[1][block * HOST_BLOCK * run_channels], HOST_BLOCK);
+}
+
+static void run_per_channel_q15(uint32_t block)
+{
+    const q15_t *in = &in_q15[block * HOST_BLOCK * run_channels];
+    q15_t *out = &out_q15[0][block * HOST_BLOCK * run_channels];
+
+    for (uint32_t ch = 0; ch < run_channels; ch++) {
+        for (uint32_t n = 0; n < HOST_BLOCK; n++) chan_in_q15[n] = in[n * run_channels + ch];
+        arm_fir_q15(&fir_q15[ch], chan_in_q15, chan_out_q15, HOST_BLOCK);
+        for (uint32_t n = 0; n < HOST_BLOCK; n++) out[n * run_channels + ch] = chan_out_q15[n];
+    }
+}
+
+static void run_multichannel_q15(uint32_t block)
+{
+    arm_fir_multichannel_q15(&mc_q15, &in_q15[block * HOST_BLOCK * run_channels],
+                             &out_q15[1][block * HOST_BLOCK * run_channels], HOST_BLOCK);
+}
+
+/**
+ * @brief Inicializa las instancias de run_channels canales con estado en cero.
+ */
+static int init_filters(void)
+{
+    for (uint32_t ch = 0; ch < run_channels; ch++) {
+        arm_fir_init_f32(&fir_f32[ch], HOST_TAPS, coeffs_f32, state_f32[ch], HOST_BLOCK);
+        if (arm_fir_init_q15(&fir_q15[ch], HOST_TAPS, coeffs_q15, state_q15[ch], HOST_BLOCK) != ARM_MATH_SUCCESS) {
+            return 0;
+        }
+    }
+    return arm_fir_multichannel_init_f32(&mc_f32, (uint16_t)run_channels, HOST_TAPS, coeffs_f32, mc_state_f32,
+                                         HOST_BLOCK) == ARM_MATH_SUCCESS &&
+           arm_fir_multichannel_init_q15(&mc_q15, (uint16_t)run_channels, HOST_TAPS, coeffs_q15, mc_state_q15,
+                                         HOST_BLOCK) == ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Nanosegundos por muestra de run: mejor tanda de 64 bloques durante HOST_MIN_NS.
+ */
+static double measure(void (*run)(uint32_t))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+
+    run(0);  // Calentar caché
+    do {
+        t0 = host_now_ns();
+        for (int i = 0; i < 64; i++) run(0);
+        batch = (host_now_ns() - t0) / 64;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best / (HOST_BLOCK * run_channels);
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < HOST_TAPS; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        coeffs_f32[i] = ((float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f) / 8.0f;
+    }
+    arm_float_to_q15(coeffs_f32, coeffs_q15, HOST_TAPS);
+    for (uint32_t i = 0; i < 2 * HOST_BLOCK * HOST_MAX_CHANNELS; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        in_f32[i] = (float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+    }
+    arm_float_to_q15(in_f32, in_q15, 2 * HOST_BLOCK * HOST_MAX_CHANNELS);
+
+#if defined(ARM_MATH_X86_SIMD)
+    // Ambas variantes por el camino en C, el que corre en el Cortex-M4
+    arm_x86_simd_set_level(ARM_X86_SIMD_NONE);
+#endif
+
+    printf("%-3s %10s %10s %10s %6s %10s %10s %10s %6s\n", "ch", "f32 err", "ns/m canal", "ns/m multi", "x",
+           "q15 dif", "ns/m canal", "ns/m multi", "x");
+    for (run_channels = 1; run_channels <= HOST_MAX_CHANNELS; run_channels++) {
+        uint32_t values = 2 * HOST_BLOCK * run_channels;
+
+        if (!init_filters()) {
+            fprintf(stderr, "%u canales: init fallo\n", run_channels);
+            return 1;
+        }
+        for (uint32_t block = 0; block < 2; block++) {
+            run_per_channel_f32(block);
+            run_multichannel_f32(block);
+            run_per_channel_q15(block);
+            run_multichannel_q15(block);
+        }
+
+        double peak = 0.0, err = 0.0;
+        uint32_t q15_diff = 0;
+        for (uint32_t i = 0; i < values; i++) {
+            if (fabs(out_f32[0][i]) > peak) peak = fabs(out_f32[0][i]);
+            if (fabs((double)out_f32[1][i] - out_f32[0][i]) > err) err = fabs((double)out_f32[1][i] - out_f32[0][i]);
+            if (out_q15[1][i] != out_q15[0][i]) q15_diff++;
+        }
+        err /= peak;
+
+        double t_ref_f32 = measure(run_per_channel_f32), t_mc_f32 = measure(run_multichannel_f32);
+        double t_ref_q15 = measure(run_per_channel_q15), t_mc_q15 = measure(run_multichannel_q15);
+        printf("%-3u %10.1e %10.2f %10.2f %6.2f %10u %10.2f %10.2f %6.2f\n", run_channels, err, t_ref_f32, t_mc_f32,
+               t_ref_f32 / t_mc_f32, q15_diff, t_ref_q15, t_mc_q15, t_ref_q15 / t_mc_q15);
+        if (err > HOST_TOLERANCE || q15_diff != 0) {
+            fprintf(stderr, "%u canales: error f32 %.2e, %u muestras q15 distintas\n", run_channels, err, q15_diff);
+            failed = 1;
+        }
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
@@ -0,0 +1,15 @@
+/**
+ * @brief Sustituto de main.h para compilar módulos del firmware en el host.
+ * @note  Solo cubre lo que usan esos módulos: no hay interrupciones que enmascarar,
+ *        así que las secciones críticas de CMSIS quedan vacías.
+ */
+#ifndef HOST_MAIN_H
+#define HOST_MAIN_H
+
+#include <stdint.h>
+
+static inline uint32_t __get_PRIMASK(void) { return 0U; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+static inline void __disable_irq(void) {}
+
+#endif // HOST_MAIN_H
@@ -0,0 +1,142 @@
+#include "sim_flash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_DWORDS (SIM_SLOT_SIZE / 8U)
+
+uint8_t sim_flash[2][SIM_SLOT_SIZE] __attribute__((aligned(SIM_PAGE_SIZE)));
+unsigned long sim_ecc_hits;
+unsigned long sim_ops;
+long sim_budget;
+bool sim_powered;
+
+static uint8_t sim_snapshot[2][SIM_SLOT_SIZE];
+static bool sim_ecc_bad[2][SIM_DWORDS];      // Doble palabra a medias: error ECC al leer
+static bool sim_ecc_snapshot[2][SIM_DWORDS];
+
+static bool sim_in_flash(uintptr_t addr, uint32_t len)
+{
+    for (int s = 0; s < 2; s++) {
+        uintptr_t base = (uintptr_t)sim_flash[s];
+        if (addr >= base && addr + len <= base + SIM_SLOT_SIZE) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Marca (o limpia) el error ECC de las dobles palabras de [addr, addr + len).
+ */
+static void sim_mark_ecc(uintptr_t addr, uint32_t len, bool bad)
+{
+    for (int s = 0; s < 2; s++) {
+        uintptr_t base = (uintptr_t)sim_flash[s];
+        if (addr < base || addr >= base + SIM_SLOT_SIZE) continue;
+        for (uint32_t i = (uint32_t)(addr - base) / 8U; i < (uint32_t)(addr - base + len + 7U) / 8U; i++) {
+            sim_ecc_bad[s][i] = bad;
+        }
+    }
+}
+
+/**
+ * @brief Consume una operación; devuelve false si esta es la que se corta.
+ */
+static bool sim_tick(void)
+{
+    sim_ops++;
+    if (sim_budget < 0) return true;
+    if (sim_budget == 0) {
+        sim_powered = false;
+        return false;
+    }
+    sim_budget--;
+    return true;
+}
+
+bool sim_erase_page(uintptr_t addr)
+{
+    if (!sim_powered || !sim_in_flash(addr, SIM_PAGE_SIZE) || (addr % SIM_PAGE_SIZE) != 0) return false;
+    uint8_t *page = (uint8_t *)addr;
+    if (!sim_tick()) {
+        // Borrado interrumpido: un prefijo aleatorio queda borrado, el resto con basura
+        uint32_t done = ((uint32_t)rand() % SIM_PAGE_SIZE) & ~7U;
+        memset(page, 0xFF, done);
+        for (uint32_t i = done; i < SIM_PAGE_SIZE; i++) page[i] &= (uint8_t)rand() | 0x0F;
+        sim_mark_ecc(addr, done, false);
+        sim_mark_ecc(addr + done, SIM_PAGE_SIZE - done, true);
+        return false;
+    }
+    memset(page, 0xFF, SIM_PAGE_SIZE);
+    sim_mark_ecc(addr, SIM_PAGE_SIZE, false);
+    return true;
+}
+
+bool sim_program_dword(uintptr_t addr, uint64_t data)
+{
+    if (!sim_powered || !sim_in_flash(addr, 8) || (addr % 8) != 0) return false;
+    uint64_t old;
+    memcpy(&old, (const void *)addr, 8);
+    if (old != UINT64_MAX) {
+        fprintf(stderr, "programacion sobre doble palabra no borrada en %p\n", (void *)addr);
+        exit(1);
+    }
+    if (!sim_tick()) {
+        // Programación interrumpida: solo algunos bits llegan a cero
+        uint64_t partial = data | ((uint64_t)rand() << 32 | (uint64_t)rand());
+        memcpy((void *)addr, &partial, 8);
+        sim_mark_ecc(addr, 8, true);
+        return false;
+    }
+    memcpy((void *)addr, &data, 8);
+    sim_mark_ecc(addr, 8, false);
+    return true;
+}
+
+/**
+ * @brief Lectura con ECC: falla si toca una doble palabra a medias (la NMI en el L4).
+ */
+bool sim_read(uintptr_t addr, void *dst, uint32_t len)
+{
+    memcpy(dst, (const void *)addr, len);
+    for (int s = 0; s < 2; s++) {
+        uintptr_t base = (uintptr_t)sim_flash[s];
+        if (addr < base || addr >= base + SIM_SLOT_SIZE) continue;
+        for (uint32_t i = (uint32_t)(addr - base) / 8U; i < (uint32_t)(addr - base + len + 7U) / 8U; i++) {
+            if (sim_ecc_bad[s][i]) {
+                sim_ecc_hits++;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool sim_sync(void)
+{
+    return sim_powered;
+}
+
+void sim_reset(void)
+{
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+    memset(sim_ecc_bad, 0, sizeof(sim_ecc_bad));
+    sim_power_on();
+}
+
+void sim_power_on(void)
+{
+    sim_powered = true;
+    sim_budget = -1;
+}
+
+void sim_save(void)
+{
+    memcpy(sim_snapshot, sim_flash, sizeof(sim_flash));
+    memcpy(sim_ecc_snapshot, sim_ecc_bad, sizeof(sim_ecc_bad));
+}
+
+void sim_restore(void)
+{
+    memcpy(sim_flash, sim_snapshot, sizeof(sim_flash));
+    memcpy(sim_ecc_bad, sim_ecc_snapshot, sizeof(sim_ecc_bad));
+}
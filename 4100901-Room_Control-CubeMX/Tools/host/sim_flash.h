@@ -0,0 +1,45 @@
+/**
+ * @brief FLASH simulada en RAM para las pruebas de corte de energía del host.
+ * @note  Dos regiones de SIM_SLOT_PAGES páginas con la regla "borrar antes de
+ *        programar". Tras sim_budget operaciones se corta la energía y la última
+ *        queda borrada/programada a medias; esas dobles palabras dan error ECC al
+ *        leerlas con sim_read, como la NMI de ECCD en el L4.
+ */
+#ifndef SIM_FLASH_H
+#define SIM_FLASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIM_PAGE_SIZE 2048U
+#define SIM_SLOT_PAGES 4U
+#define SIM_SLOT_SIZE (SIM_PAGE_SIZE * SIM_SLOT_PAGES)
+
+extern uint8_t sim_flash[2][SIM_SLOT_SIZE];
+extern unsigned long sim_ecc_hits;  // Lecturas que tocaron una doble palabra a medias
+extern unsigned long sim_ops;       // Borrados y programaciones realizados
+extern long sim_budget;             // Operaciones antes del corte; -1 = sin corte
+extern bool sim_powered;
+
+bool sim_erase_page(uintptr_t addr);
+bool sim_program_dword(uintptr_t addr, uint64_t data);
+bool sim_read(uintptr_t addr, void *dst, uint32_t len);
+bool sim_sync(void);
+
+/**
+ * @brief Ambas regiones borradas, con energía y sin corte programado.
+ */
+void sim_reset(void);
+
+/**
+ * @brief Reinicio tras un corte: vuelve la energía y se quita el corte programado.
+ */
+void sim_power_on(void);
+
+/**
+ * @brief Guarda / restaura el contenido y el estado ECC de ambas regiones.
+ */
+void sim_save(void);
+void sim_restore(void);
+
+#endif // SIM_FLASH_H
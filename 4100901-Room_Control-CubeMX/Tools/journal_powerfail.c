@@ -0,0 +1,149 @@
+/**
+ * @brief Modelo en el host de cortes de energía durante la escritura del journal.
+ * @note  Usa el mismo journal.c del firmware sobre la FLASH simulada de
+ *        Tools/host/sim_flash.c, que corta la energía tras N operaciones.
+ *        Tras cada corte se "reinicia" y se verifica que el journal recupere una
+ *        secuencia de registros sin huecos que termina en el último registro
+ *        escrito por completo, y que siga escribiendo. Cubre también la rotación
+ *        de páginas y un journal_init cuyo borrado falla.
+ *
+ *        Compilar y ejecutar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/host -B build/host && cmake --build build/host
+ *          ctest --test-dir build/host -R journal_powerfail
+ */
+#include "journal.h"
+#include "sim_flash.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SIM_SEEDS 8U
+#define SIM_JOURNAL_OLD 300U   // Registros ya escritos antes del corte
+#define SIM_JOURNAL_NEW 300U   // Registros de la escritura cortada (rota a la página 0)
+#define SIM_JOURNAL_AFTER 20U  // Registros escritos tras recuperar
+#define SIM_JOURNAL_DEPTH 200U // Registros recientes que deben leerse sin huecos
+
+static const journal_flash_ops_t sim_journal_ops = {
+    .erase_page = sim_erase_page,
+    .program_dword = sim_program_dword,
+    .read = sim_read,
+};
+
+static bool sim_erase_fail(uintptr_t addr)
+{
+    (void)addr;
+    return false;
+}
+
+// Borrado que falla sin cortar la energía: journal_init no puede abrir la página 0
+static const journal_flash_ops_t sim_journal_fail_ops = {
+    .erase_page = sim_erase_fail,
+    .program_dword = sim_program_dword,
+    .read = sim_read,
+};
+
+static bool sim_journal_boot(journal_t *j)
+{
+    return journal_init(j, &sim_journal_ops, (uintptr_t)sim_flash[0], SIM_PAGE_SIZE, SIM_SLOT_PAGES);
+}
+
+/**
+ * @brief Escribe count registros de a uno; el dato de cada uno es su secuencia.
+ */
+static bool sim_journal_write(journal_t *j, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        journal_append(j, JOURNAL_EVENT_ACCESS_GRANTED, j->next_sequence, i);
+        if (journal_flush(j, 1) != 1) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Los depth registros más recientes deben tener secuencias consecutivas
+ *        terminando en *latest, y cada uno su propia secuencia como dato.
+ */
+static bool sim_journal_check(const journal_t *j, uint32_t depth, uint32_t *latest)
+{
+    journal_record_t rec;
+    if (!journal_read_latest(j, 0, &rec)) return false;
+    *latest = rec.sequence;
+    if (depth > rec.sequence + 1U) depth = rec.sequence + 1U;
+
+    for (uint32_t n = 0; n < depth; n++) {
+        if (!journal_read_latest(j, n, &rec)) return false;
+        if (rec.sequence != *latest - n || rec.data != rec.sequence) return false;
+    }
+    return j->next_sequence == *latest + 1U;
+}
+
+int main(void)
+{
+    journal_t j;
+    uint32_t old_latest, latest, again;
+    unsigned long failures = 0;
+
+    // Si journal_init no puede abrir la página, journal_flush no debe escribir nada
+    sim_reset();
+    if (journal_init(&j, &sim_journal_fail_ops, (uintptr_t)sim_flash[0], SIM_PAGE_SIZE, SIM_SLOT_PAGES)) {
+        failures++;
+        printf("FALLO journal: init con borrado fallido devolvio true\n");
+    }
+    journal_append(&j, JOURNAL_EVENT_BOOT, 0, 0);
+    bool untouched = journal_flush(&j, 1) == 0;
+    for (uint32_t i = 0; i < SIM_SLOT_SIZE; i++) untouched = untouched && sim_flash[0][i] == 0xFF;
+    if (!untouched) {
+        failures++;
+        printf("FALLO journal: escribio en FLASH tras un init fallido\n");
+    }
+
+    // Estado inicial: SIM_JOURNAL_OLD registros en las primeras páginas
+    sim_reset();
+    if (!sim_journal_boot(&j) || !sim_journal_write(&j, SIM_JOURNAL_OLD) ||
+        !sim_journal_check(&j, SIM_JOURNAL_DEPTH, &old_latest)) {
+        fprintf(stderr, "journal: no se pudo preparar el estado inicial\n");
+        return 1;
+    }
+    sim_save();
+
+    // Cantidad de operaciones de la escritura completa
+    sim_ops = 0;
+    sim_journal_boot(&j);
+    sim_journal_write(&j, SIM_JOURNAL_NEW);
+    unsigned long total_ops = sim_ops;
+    unsigned long ecc_cuts = 0;
+
+    for (unsigned seed = 1; seed <= SIM_SEEDS; seed++) {
+        srand(seed);
+        for (long cut = 0; cut <= (long)total_ops; cut++) {
+            sim_restore();
+            sim_power_on();
+            sim_journal_boot(&j);
+
+            sim_budget = cut;
+            sim_journal_write(&j, SIM_JOURNAL_NEW);
+
+            // Reinicio
+            sim_power_on();
+            unsigned long hits = sim_ecc_hits;
+            if (!sim_journal_boot(&j) || !sim_journal_check(&j, SIM_JOURNAL_DEPTH, &latest) ||
+                latest < old_latest || latest > old_latest + SIM_JOURNAL_NEW) {
+                failures++;
+                printf("FALLO journal: semilla %u corte %ld -> pagina %u slot %u\n", seed, cut, j.page, j.slot);
+                continue;
+            }
+            if (sim_ecc_hits != hits) ecc_cuts++;
+
+            // Debe seguir escribiendo sin programar sobre FLASH no borrada
+            if (!sim_journal_write(&j, SIM_JOURNAL_AFTER) || !sim_journal_check(&j, SIM_JOURNAL_DEPTH, &again) ||
+                again != latest + SIM_JOURNAL_AFTER) {
+                failures++;
+                printf("FALLO journal: semilla %u corte %ld -> no se recupera\n", seed, cut);
+            }
+        }
+    }
+
+    printf("journal: operaciones por escritura: %lu\n", total_ops);
+    printf("journal: cortes simulados: %lu  con error ECC al recuperar: %lu  fallos: %lu\n",
+           (total_ops + 1) * SIM_SEEDS, ecc_cuts, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+/**
+ * @brief Herramienta de host: ejecuta el DS-CNN de kws.c y reporta por capa las
+ *        multiplicaciones-acumulaciones, el tiempo y los ciclos, más la RAM total.
+ * @note  Los ciclos son del contador de tiempo del host (rdtsc): sirven para
+ *        comparar capas entre sí. Las cifras del Cortex-M4 salen de benchmark_kws()
+ *        en el firmware (comando "bench").
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_nn -B build/host-nn && cmake --build build/host-nn
+ *          build/host-nn/kws_host_bench
+ */
+#include "kws.h"
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES() ((uint32_t)__rdtsc())
+#else
+#define HOST_CYCLES() 0U
+#endif
+
+#define HOST_RUNS 200U
+
+static uint32_t host_cycles(void)
+{
+    return HOST_CYCLES();
+}
+
+/**
+ * @brief Multiplicaciones-acumulaciones de una capa.
+ */
+static uint32_t layer_macs(const nn_layer_t *l, const nn_shape_t *in, const nn_shape_t *out)
+{
+    switch (l->type) {
+    case NN_LAYER_CONV:
+        return nn_shape_size(out) * l->kernel_x * l->kernel_y * in->c;
+    case NN_LAYER_DWCONV:
+        return nn_shape_size(out) * l->kernel_x * l->kernel_y;
+    case NN_LAYER_FC:
+    case NN_LAYER_FC_OPT:
+        return nn_shape_size(in) * out->c;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Bytes de pesos y bias (FLASH) de una capa.
+ */
+static uint32_t layer_weight_bytes(const nn_layer_t *l, const nn_shape_t *in, const nn_shape_t *out)
+{
+    switch (l->type) {
+    case NN_LAYER_CONV:
+        return (uint32_t)out->c * l->kernel_x * l->kernel_y * in->c + out->c;
+    case NN_LAYER_DWCONV:
+        return (uint32_t)out->c * l->kernel_x * l->kernel_y + out->c;
+    case NN_LAYER_FC:
+    case NN_LAYER_FC_OPT:
+        return nn_shape_size(in) * out->c + out->c;
+    default:
+        return 0;
+    }
+}
+
+int main(void)
+{
+    const nn_model_t *model = kws_model();
+    nn_runtime_t *rt = kws_runtime();
+    uint64_t cycles[NN_MAX_LAYERS] = {0};
+    uint32_t arena_size;
+    nn_shape_t output;
+
+    if (!kws_init() || !nn_model_plan(model, &arena_size, &output)) {
+        fprintf(stderr, "modelo invalido\n");
+        return 1;
+    }
+
+    // Una ventana completa de MFCC con un patrón fijo
+    for (uint32_t f = 0; f < KWS_FRAMES; f++) {
+        float32_t coeffs[KWS_COEFFS];
+        for (uint32_t i = 0; i < KWS_COEFFS; i++) coeffs[i] = (float32_t)((int32_t)((f * 7U + i * 13U) % 41U) - 20);
+        kws_push_frame(coeffs);
+    }
+
+    rt->clock = host_cycles;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t run = 0; run < HOST_RUNS; run++) {
+        kws_run();
+        for (uint8_t i = 0; i < model->layer_count; i++) cycles[i] += rt->layer_cycles[i];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double total_us = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / 1e3 / HOST_RUNS;
+
+    printf("modelo %s: entrada %ux%ux%u, %u capas\n", model->name, model->input.h, model->input.w,
+           model->input.c, model->layer_count);
+    printf("  #  capa         salida         MACs     ciclos host\n");
+    nn_shape_t shape = model->input;
+    uint64_t total_cycles = 0;
+    uint32_t total_macs = 0, flash = 0;
+    for (uint8_t i = 0; i < model->layer_count; i++) {
+        const nn_layer_t *l = &model->layers[i];
+        nn_shape_t next;
+        nn_layer_shape(l, &shape, &next);
+        uint32_t macs = layer_macs(l, &shape, &next);
+        total_macs += macs;
+        total_cycles += cycles[i];
+        flash += layer_weight_bytes(l, &shape, &next);
+        printf("  %2u %-8s %4ux%-3ux%-4u %9u %12.0f\n", i, nn_layer_name(l->type), next.h, next.w, next.c, macs,
+               (double)cycles[i] / HOST_RUNS);
+        shape = next;
+    }
+    printf("total: %u MACs, %.0f ciclos host, %.1f us por inferencia\n", total_macs,
+           (double)total_cycles / HOST_RUNS, total_us);
+
+    uint32_t features = (KWS_FRAMES + 1U) * KWS_COEFFS;
+    uint32_t fc_copy = KWS_CLASSES * KWS_CHANNELS;
+    uint32_t history = (KWS_AVERAGE + 1U) * KWS_CLASSES;
+    printf("RAM: arena %u (activaciones %u + temporal %u, reservada %u), ventana MFCC %u, FC intercalada %u, "
+           "historial %u -> %u bytes\n", arena_size, rt->act_size, arena_size - rt->act_size, KWS_ARENA_SIZE,
+           features, fc_copy, history, KWS_ARENA_SIZE + features + fc_copy + history);
+    printf("FLASH: pesos y bias %u bytes\n", flash);
+    printf("clase %s (%d)\n", kws_label(nn_argmax(kws_scores(), KWS_CLASSES)), kws_scores()[nn_argmax(kws_scores(), KWS_CLASSES)]);
+    return arena_size == KWS_ARENA_SIZE ? 0 : 1;
+}
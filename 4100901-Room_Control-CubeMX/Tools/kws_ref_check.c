@@ -0,0 +1,333 @@
+/**
+ * @brief Prueba de host: compara el DS-CNN q7 (nn_runtime + CMSIS-NN) con
+ *        implementaciones de referencia en punto flotante.
+ * @note  Por capa: la referencia recibe la misma entrada q7 que el kernel y su
+ *        resultado redondeado debe coincidir con él (tolerancia de 1 LSB).
+ *        De punta a punta: la red en float sin cuantizar intermedios debe elegir
+ *        la misma clase salvo empates dentro del error de cuantización, sus
+ *        logits deben quedar a CHECK_E2E_LOGIT_LSB de los del runtime y, sin
+ *        empate, las probabilidades de arm_softmax_q7 a CHECK_E2E_PROB.
+ *        Devuelve 0 si todo pasa.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_nn -B build/host-nn && cmake --build build/host-nn
+ *          build/host-nn/kws_ref_check
+ */
+#include "kws.h"
+#include "kws_weights.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK_INPUTS 16U
+#define CHECK_TOLERANCE_LSB 1
+#define CHECK_E2E_LOGIT_LSB 12  // Error de punta a punta de los logits (q7); medido: 10.6 en 1000 entradas
+#define CHECK_E2E_PROB 0.05     // Error de probabilidad de punta a punta sin empates (6 LSB de q7)
+#define CHECK_MAX_TENSOR ((KWS_FRAMES + 1U) * KWS_COEFFS * KWS_CHANNELS)
+
+static uint32_t check_arena[KWS_ARENA_SIZE / sizeof(uint32_t)];
+static q7_t check_q[CHECK_MAX_TENSOR];
+static q7_t check_q_prev[CHECK_MAX_TENSOR];
+static double check_f[2][CHECK_MAX_TENSOR];
+
+static uint32_t check_seed = 2024;
+
+static double check_gauss(void)
+{
+    double u1, u2;
+    do {
+        check_seed = check_seed * 1103515245U + 12345U;
+        u1 = (check_seed >> 8) / 16777216.0;
+    } while (u1 <= 0.0);
+    check_seed = check_seed * 1103515245U + 12345U;
+    u2 = (check_seed >> 8) / 16777216.0;
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/**
+ * @brief Salida de las primeras count capas usando el runtime real.
+ */
+static bool check_run_prefix(const q7_t *input, uint8_t count, q7_t *out, nn_shape_t *shape)
+{
+    nn_model_t prefix = *kws_model();
+    nn_runtime_t rt;
+    prefix.layer_count = count;
+    if (!nn_runtime_init(&rt, &prefix, check_arena, sizeof(check_arena))) return false;
+    *shape = rt.output;
+    return nn_runtime_run(&rt, input, out);
+}
+
+/**
+ * @brief Pesos de una capa en orden natural (la FC del modelo está intercalada).
+ */
+static const q7_t *check_weights(const nn_layer_t *l)
+{
+    static const q7_t fc_natural[] = FINAL_FC_WT;
+    return (l->type == NN_LAYER_FC_OPT) ? fc_natural : l->weights;
+}
+
+/**
+ * @brief Referencia float de una capa. Los tensores valen q * 2^-frac; los pesos
+ *        se toman como enteros, así que la salida de conv/FC queda con frac - out_shift.
+ */
+static void ref_layer(const nn_layer_t *l, const nn_shape_t *in, const nn_shape_t *out, int in_frac,
+                      const double *x, double *y)
+{
+    const q7_t *w = check_weights(l);
+    double bias_scale = ldexp(1.0, l->bias_shift - in_frac);
+
+    switch (l->type) {
+    case NN_LAYER_CONV:
+    case NN_LAYER_DWCONV: {
+        bool dw = l->type == NN_LAYER_DWCONV;
+        for (int oy = 0; oy < out->h; oy++) {
+            for (int ox = 0; ox < out->w; ox++) {
+                for (int co = 0; co < out->c; co++) {
+                    double acc = l->bias[co] * bias_scale;
+                    for (int ky = 0; ky < l->kernel_y; ky++) {
+                        int iy = oy * l->stride_y - l->pad_y + ky;
+                        if (iy < 0 || iy >= in->h) continue;
+                        for (int kx = 0; kx < l->kernel_x; kx++) {
+                            int ix = ox * l->stride_x - l->pad_x + kx;
+                            if (ix < 0 || ix >= in->w) continue;
+                            const double *px = &x[(iy * in->w + ix) * in->c];
+                            if (dw) {
+                                acc += px[co] * w[(ky * l->kernel_x + kx) * out->c + co];
+                            } else {
+                                const q7_t *pw = &w[((co * l->kernel_y + ky) * l->kernel_x + kx) * in->c];
+                                for (int ci = 0; ci < in->c; ci++) acc += px[ci] * pw[ci];
+                            }
+                        }
+                    }
+                    y[(oy * out->w + ox) * out->c + co] = acc;
+                }
+            }
+        }
+        break;
+    }
+    case NN_LAYER_FC:
+    case NN_LAYER_FC_OPT: {
+        uint32_t n = nn_shape_size(in);
+        for (int o = 0; o < out->c; o++) {
+            double acc = l->bias[o] * bias_scale;
+            for (uint32_t i = 0; i < n; i++) acc += x[i] * w[o * n + i];
+            y[o] = acc;
+        }
+        break;
+    }
+    case NN_LAYER_RELU:
+        for (uint32_t i = 0; i < nn_shape_size(in); i++) y[i] = x[i] > 0.0 ? x[i] : 0.0;
+        break;
+    case NN_LAYER_AVGPOOL:
+        for (int oy = 0; oy < out->h; oy++) {
+            for (int ox = 0; ox < out->w; ox++) {
+                for (int c = 0; c < in->c; c++) {
+                    double sum = 0.0;
+                    int count = 0;
+                    for (int iy = oy * l->stride_y - l->pad_y; iy < oy * l->stride_y - l->pad_y + l->kernel_y; iy++) {
+                        for (int ix = ox * l->stride_x - l->pad_x; ix < ox * l->stride_x - l->pad_x + l->kernel_x;
+                             ix++) {
+                            if (iy < 0 || iy >= in->h || ix < 0 || ix >= in->w) continue;
+                            sum += x[(iy * in->w + ix) * in->c + c];
+                            count++;
+                        }
+                    }
+                    y[(oy * out->w + ox) * in->c + c] = sum / count;
+                }
+            }
+        }
+        break;
+    case NN_LAYER_SOFTMAX: {
+        uint32_t n = nn_shape_size(in);
+        double max = x[0], sum = 0.0;
+        for (uint32_t i = 1; i < n; i++) max = fmax(max, x[i]);
+        for (uint32_t i = 0; i < n; i++) sum += exp(x[i] - max);
+        for (uint32_t i = 0; i < n; i++) y[i] = exp(x[i] - max) / sum;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Bits fraccionarios del tensor de salida de una capa.
+ */
+static int out_frac(const nn_layer_t *l, int in_frac)
+{
+    switch (l->type) {
+    case NN_LAYER_CONV:
+    case NN_LAYER_DWCONV:
+    case NN_LAYER_FC:
+    case NN_LAYER_FC_OPT:
+        return in_frac - l->out_shift;
+    case NN_LAYER_SOFTMAX:
+        return 7;
+    default:
+        return in_frac;
+    }
+}
+
+/**
+ * @brief Lleva un valor de la referencia al q7 que produciría el kernel.
+ */
+static int ref_quantize(const nn_layer_t *l, double v, int frac)
+{
+    double scaled = ldexp(v, frac);
+    // arm_avepool_q7_HWC divide enteros (trunca); el resto redondea con NN_ROUND
+    long q = (l->type == NN_LAYER_AVGPOOL) ? (long)trunc(scaled) : (long)floor(scaled + 0.5);
+    return q > 127 ? 127 : q < -128 ? -128 : (int)q;
+}
+
+int main(void)
+{
+    const nn_model_t *model = kws_model();
+    static q7_t input[(KWS_FRAMES + 1U) * KWS_COEFFS];
+    int worst[NN_MAX_LAYERS] = {0};
+    uint32_t failures = 0, class_mismatch = 0, prob_checked = 0;
+    double worst_prob = 0.0, worst_logit = 0.0;
+
+    if (!kws_init()) {
+        fprintf(stderr, "kws_init fallo\n");
+        return 1;
+    }
+
+    for (uint32_t n = 0; n < CHECK_INPUTS; n++) {
+        // MFCC sintéticos cuantizados como kws_push_frame, con la fila de relleno en cero
+        memset(input, 0, sizeof(input));
+        for (uint32_t f = 0; f < KWS_FRAMES; f++) {
+            for (uint32_t i = 0; i < KWS_COEFFS; i++) {
+                double c = (i == 0) ? -10.0 + 8.0 * check_gauss() : 4.0 / (i + 1) * check_gauss();
+                long q = lround(ldexp(c, KWS_INPUT_FRAC));
+                input[f * KWS_COEFFS + i] = (q7_t)(q > 127 ? 127 : q < -128 ? -128 : q);
+            }
+        }
+
+        // Capa por capa: misma entrada q7 para el kernel y la referencia
+        nn_shape_t in_shape = model->input, out_shape;
+        int frac = KWS_INPUT_FRAC;
+        memcpy(check_q_prev, input, sizeof(input));
+        for (uint8_t i = 0; i < model->layer_count; i++) {
+            const nn_layer_t *l = &model->layers[i];
+            if (!check_run_prefix(input, (uint8_t)(i + 1U), check_q, &out_shape)) {
+                printf("FALLO: capa %u no se pudo ejecutar\n", i);
+                return 1;
+            }
+            for (uint32_t k = 0; k < nn_shape_size(&in_shape); k++) check_f[0][k] = ldexp(check_q_prev[k], -frac);
+            ref_layer(l, &in_shape, &out_shape, frac, check_f[0], check_f[1]);
+            int next_frac = out_frac(l, frac);
+
+            if (l->type == NN_LAYER_SOFTMAX) {
+                // arm_softmax_q7 usa base 2: solo se exige la misma clase
+                uint16_t q_best = nn_argmax(check_q, (uint16_t)out_shape.c);
+                uint16_t f_best = 0;
+                for (uint16_t k = 1; k < out_shape.c; k++) {
+                    if (check_f[1][k] > check_f[1][f_best]) f_best = k;
+                }
+                if (check_q[q_best] != check_q[f_best]) {
+                    printf("FALLO: entrada %u softmax clase %u vs %u\n", n, q_best, f_best);
+                    failures++;
+                }
+            } else {
+                for (uint32_t k = 0; k < nn_shape_size(&out_shape); k++) {
+                    int diff = abs(check_q[k] - ref_quantize(l, check_f[1][k], next_frac));
+                    if (diff > worst[i]) worst[i] = diff;
+                }
+            }
+            memcpy(check_q_prev, check_q, nn_shape_size(&out_shape));
+            in_shape = out_shape;
+            frac = next_frac;
+        }
+
+        // Punta a punta: red float desde la entrada dequantizada, sin redondeos intermedios
+        nn_shape_t shape = model->input;
+        frac = KWS_INPUT_FRAC;
+        uint8_t cur = 0;
+        for (uint32_t k = 0; k < nn_shape_size(&shape); k++) check_f[0][k] = ldexp(input[k], -frac);
+        for (uint8_t i = 0; i + 1U < model->layer_count; i++) {
+            const nn_layer_t *l = &model->layers[i];
+            nn_shape_t next;
+            nn_layer_shape(l, &shape, &next);
+            ref_layer(l, &shape, &next, frac, check_f[cur], check_f[cur ^ 1U]);
+            cur ^= 1U;
+            shape = next;
+            frac = out_frac(l, frac);
+        }
+        // Logits en la escala del modelo entrenado y softmax en base e
+        double prob[KWS_CLASSES], max = -1e30, sum = 0.0;
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) {
+            prob[k] = ldexp(check_f[cur][k], frac - FINAL_FC_OUT_FRAC);
+            max = fmax(max, prob[k]);
+        }
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) sum += (prob[k] = exp(prob[k] - max));
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) prob[k] /= sum;
+        q7_t scores[KWS_CLASSES];
+        nn_runtime_t rt;
+        nn_runtime_init(&rt, model, check_arena, sizeof(check_arena));
+        nn_runtime_run(&rt, input, scores);
+
+        uint16_t q_best = nn_argmax(scores, KWS_CLASSES), f_best = 0, f_second = 0;
+        for (uint16_t k = 1; k < KWS_CLASSES; k++) {
+            if (prob[k] > prob[f_best]) f_best = k;
+        }
+        f_second = (f_best == 0) ? 1 : 0;
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) {
+            if (k != f_best && prob[k] > prob[f_second]) f_second = k;
+        }
+        if (q_best != f_best && scores[q_best] != scores[f_best]) {
+            // Empate real en float: la cuantización puede invertir el orden
+            if (prob[f_best] - prob[f_second] > 0.05) {
+                printf("FALLO: entrada %u clase q7 %u (%d) vs float %u (%.3f)\n", n, q_best, scores[q_best], f_best,
+                       prob[f_best]);
+                failures++;
+            }
+            class_mismatch++;
+        }
+        // Logits: los del runtime deben seguir a los float en la escala q7
+        nn_shape_t logit_shape;
+        double logit[KWS_CLASSES], top = -1e30, second = -1e30;
+        check_run_prefix(input, (uint8_t)(model->layer_count - 1U), check_q, &logit_shape);
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) {
+            logit[k] = fmin(fmax(ldexp(check_f[cur][k], frac), -128.0), 127.0);
+            worst_logit = fmax(worst_logit, fabs(logit[k] - check_q[k]));
+            if (logit[k] > top) {
+                second = top;
+                top = logit[k];
+            } else if (logit[k] > second) {
+                second = logit[k];
+            }
+        }
+
+        // Probabilidades: arm_softmax_q7 usa 2^x sobre el logit q7, no e^x sobre el
+        // logit entrenado; se compara con la misma softmax en base 2 de los logits
+        // float. Si las dos primeras clases están a menos de CHECK_E2E_LOGIT_LSB, la
+        // cuantización puede invertirlas (empate) y no se exige la tolerancia.
+        double sum2 = 0.0, prob_err = 0.0;
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) sum2 += exp2(logit[k] - top);
+        for (uint16_t k = 0; k < KWS_CLASSES; k++) {
+            prob_err = fmax(prob_err, fabs(exp2(logit[k] - top) / sum2 - scores[k] / 128.0));
+        }
+        if (top - second > CHECK_E2E_LOGIT_LSB) {
+            prob_checked++;
+            if (prob_err > worst_prob) worst_prob = prob_err;
+        }
+    }
+
+    printf("diferencia maxima por capa (LSB), %u entradas:\n", CHECK_INPUTS);
+    for (uint8_t i = 0; i < model->layer_count; i++) {
+        const nn_layer_t *l = &model->layers[i];
+        if (l->type == NN_LAYER_SOFTMAX) continue;
+        printf("  %2u %-8s %d%s\n", i, nn_layer_name(l->type), worst[i], worst[i] > CHECK_TOLERANCE_LSB ? "  FALLO" : "");
+        if (worst[i] > CHECK_TOLERANCE_LSB) failures++;
+    }
+    printf("punta a punta: %u entradas con otra clase (empates)\n", class_mismatch);
+    printf("  error maximo de logits %.2f LSB (tolerancia %d)%s\n", worst_logit, CHECK_E2E_LOGIT_LSB,
+           worst_logit > CHECK_E2E_LOGIT_LSB ? "  FALLO" : "");
+    printf("  error maximo de probabilidad %.3f en %u entradas sin empate (tolerancia %.3f, softmax base 2)%s\n",
+           worst_prob, prob_checked, CHECK_E2E_PROB, worst_prob > CHECK_E2E_PROB ? "  FALLO" : "");
+    if (worst_logit > CHECK_E2E_LOGIT_LSB) failures++;
+    if (worst_prob > CHECK_E2E_PROB) failures++;
+    printf("%s\n", failures == 0 ? "OK" : "FALLO");
+    return failures == 0 ? 0 : 1;
+}
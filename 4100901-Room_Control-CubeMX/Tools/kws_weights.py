@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""
+Genera Core/Inc/kws_weights.h: pesos q7 del DS-CNN de palabras clave (kws.c).
+
+Cuantiza cada tensor a potencias de dos (formato Qm.n por tensor, como el flujo
+de ML-KWS-for-MCU) y deriva los desplazamientos *_BIAS_LSHIFT / *_OUT_RSHIFT que
+esperan los kernels de CMSIS-NN. El formato de cada activación sale del máximo
+observado al propagar en float las entradas de calibración.
+
+Sin --model genera pesos pseudoaleatorios (He) para medir tiempos y memoria:
+el modelo no reconoce palabras y KWS_WEIGHTS_TRAINED queda en 0.
+
+Con --model toma un JSON con los pesos float ya entrenados (batch norm plegado
+en conv/bias):
+  {"conv1": {"w": [...], "b": [...]}, "conv2_ds": {...}, "conv2_pw": {...}, ...,
+   "fc": {...}, "calibration": [[490 valores MFCC], ...]}
+Orden de los pesos: conv [salida][ky][kx][entrada], depthwise [ky][kx][canal],
+fc [salida][entrada]. Las entradas de calibración son 49 tramas x 10 MFCC.
+
+Uso (desde 4100901-Room_Control-CubeMX):
+  Tools/kws_weights.py [--model modelo.json] [--seed 1] [-o Core/Inc/kws_weights.h]
+"""
+import argparse
+import json
+import math
+import random
+import sys
+
+FRAMES, COEFFS = 49, 10        # Entrada: 1 s de MFCC (kws.h)
+ROWS = FRAMES + 1              # Fila extra en cero: relleno SAME de TensorFlow
+CH = 64
+CLASSES = 12
+DS_BLOCKS = 4
+INPUT_FRAC = 1                 # MFCC en Q6.1, como ML-KWS
+
+# (nombre, tipo, ky, kx, sy, sx, py, px, canales de salida)
+LAYERS = [("CONV1", "conv", 10, 4, 2, 2, 4, 1, CH)]
+for i in range(DS_BLOCKS):
+    LAYERS.append(("CONV%d_DS" % (i + 2), "dw", 3, 3, 1, 1, 1, 1, CH))
+    LAYERS.append(("CONV%d_PW" % (i + 2), "conv", 1, 1, 1, 1, 0, 0, CH))
+LAYERS.append(("FINAL_FC", "fc", 0, 0, 0, 0, 0, 0, CLASSES))
+
+
+def out_dim(n, k, s, p):
+    return (n + 2 * p - k) // s + 1
+
+
+def conv(x, shape, w, b, ky, kx, sy, sx, py, px, cout, depthwise):
+    """Convolución HWC en float con ReLU, igual a los kernels de CMSIS-NN."""
+    h, wd, cin = shape
+    oh, ow = out_dim(h, ky, sy, py), out_dim(wd, kx, sx, px)
+    out = [0.0] * (oh * ow * cout)
+    for oy in range(oh):
+        for ox in range(ow):
+            taps = []
+            for ky_ in range(ky):
+                iy = oy * sy - py + ky_
+                if iy < 0 or iy >= h:
+                    continue
+                for kx_ in range(kx):
+                    ix = ox * sx - px + kx_
+                    if 0 <= ix < wd:
+                        taps.append(((iy * wd + ix) * cin, ky_ * kx + kx_))
+            base = (oy * ow + ox) * cout
+            for co in range(cout):
+                acc = b[co]
+                if depthwise:
+                    for src, k in taps:
+                        acc += x[src + co] * w[k * cout + co]
+                else:
+                    wo = co * ky * kx * cin
+                    for src, k in taps:
+                        wk = wo + k * cin
+                        acc += sum(x[src + c] * w[wk + c] for c in range(cin))
+                out[base + co] = acc if acc > 0.0 else 0.0
+    return out, (oh, ow, cout)
+
+
+def forward(params, x):
+    """Devuelve el máximo absoluto de cada salida (capas de LAYERS) en float."""
+    shape = (ROWS, COEFFS, 1)
+    peaks = []
+    for name, kind, ky, kx, sy, sx, py, px, cout in LAYERS:
+        w, b = params[name]
+        if kind == "fc":
+            # Promedio global antes de la FC
+            n = shape[0] * shape[1]
+            pooled = [sum(x[i * shape[2] + c] for i in range(n)) / n for c in range(shape[2])]
+            x = [b[o] + sum(pooled[i] * w[o * len(pooled) + i] for i in range(len(pooled))) for o in range(cout)]
+        else:
+            x, shape = conv(x, shape, w, b, ky, kx, sy, sx, py, px, cout, kind == "dw")
+        peaks.append(max(abs(v) for v in x))
+    return peaks
+
+
+def frac_bits(peak):
+    """Bits fraccionarios de un q7 que cubre +-peak."""
+    if peak <= 0.0:
+        return 7
+    return 7 - max(0, math.ceil(math.log2(peak * (1.0 + 1e-6))))
+
+
+def quantize(values, frac):
+    scale = 2.0 ** frac
+    return [max(-128, min(127, int(round(v * scale)))) for v in values]
+
+
+def random_params(seed):
+    rng = random.Random(seed)
+    params = {}
+    cin = 1
+    for name, kind, ky, kx, _, _, _, _, cout in LAYERS:
+        if kind == "conv":
+            fan_in, count = ky * kx * cin, cout * ky * kx * cin
+        elif kind == "dw":
+            fan_in, count = ky * kx, ky * kx * cout
+        else:
+            fan_in, count = cin, cout * cin
+        std = math.sqrt(2.0 / fan_in)
+        params[name] = ([rng.gauss(0.0, std) for _ in range(count)], [rng.gauss(0.0, 0.05) for _ in range(cout)])
+        cin = cout
+    return params
+
+
+def random_inputs(seed, count):
+    """MFCC sintéticos: coeficiente 0 en el rango de la energía, el resto más chicos."""
+    rng = random.Random(seed + 1000)
+    inputs = []
+    for _ in range(count):
+        x = []
+        for _ in range(FRAMES):
+            x.append(rng.gauss(-10.0, 8.0))
+            x.extend(rng.gauss(0.0, 4.0 / (k + 1)) for k in range(1, COEFFS))
+        inputs.append(x)
+    return inputs
+
+
+def format_array(values, per_line=24):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(",".join(str(v) for v in values[i:i + per_line]))
+    return "{ \\\n" + ", \\\n".join(lines) + " }"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--model", help="JSON con pesos float entrenados")
+    parser.add_argument("--seed", type=int, default=1, help="semilla de los pesos de prueba")
+    parser.add_argument("-o", "--output", default="Core/Inc/kws_weights.h")
+    args = parser.parse_args()
+
+    if args.model:
+        with open(args.model) as f:
+            data = json.load(f)
+        params = {}
+        for name, *_ in LAYERS:
+            layer = data[name.lower()]
+            params[name] = ([float(v) for v in layer["w"]], [float(v) for v in layer["b"]])
+        inputs = data.get("calibration") or random_inputs(args.seed, 4)
+        trained = 1
+    else:
+        params = random_params(args.seed)
+        inputs = random_inputs(args.seed, 4)
+        trained = 0
+
+    # Entrada cuantizada como la verá el firmware, con la fila de relleno en cero
+    padded = []
+    for x in inputs:
+        q = quantize(x, INPUT_FRAC)
+        padded.append([v / 2.0 ** INPUT_FRAC for v in q] + [0.0] * COEFFS)
+    peaks = [0.0] * len(LAYERS)
+    for x in padded:
+        peaks = [max(a, b) for a, b in zip(peaks, forward(params, x))]
+
+    out = []
+    out.append("/* Generado por Tools/kws_weights.py; no editar a mano. */")
+    out.append("#ifndef KWS_WEIGHTS_H")
+    out.append("#define KWS_WEIGHTS_H")
+    out.append("")
+    if trained:
+        out.append("#define KWS_WEIGHTS_TRAINED 1")
+    else:
+        out.append("// Pesos pseudoaleatorios (semilla %d): solo para medir tiempos y memoria" % args.seed)
+        out.append("#define KWS_WEIGHTS_TRAINED 0")
+    out.append("#define KWS_INPUT_FRAC %d" % INPUT_FRAC)
+
+    in_frac = INPUT_FRAC
+    for (name, kind, *_), peak in zip(LAYERS, peaks):
+        w, b = params[name]
+        w_frac = frac_bits(max(abs(v) for v in w))
+        # El bias se suma en la escala del acumulador: no puede tener más bits que él
+        b_frac = min(frac_bits(max(abs(v) for v in b)), in_frac + w_frac)
+        o_frac = min(frac_bits(peak), in_frac + w_frac)
+        out.append("")
+        out.append("// %s: bits fraccionarios de pesos %d, bias %d, salida %d" % (name, w_frac, b_frac, o_frac))
+        out.append("#define %s_BIAS_LSHIFT %d" % (name, in_frac + w_frac - b_frac))
+        out.append("#define %s_OUT_RSHIFT %d" % (name, in_frac + w_frac - o_frac))
+        out.append("#define %s_OUT_FRAC %d" % (name, o_frac))
+        out.append("#define %s_WT %s" % (name, format_array(quantize(w, w_frac))))
+        out.append("#define %s_BIAS %s" % (name, format_array(quantize(b, b_frac))))
+        in_frac = o_frac
+    out.append("")
+    out.append("#endif // KWS_WEIGHTS_H")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out) + "\n")
+    sys.stderr.write("%s: %d capas, picos %s\n" % (args.output, len(LAYERS),
+                                                   " ".join("%.1f" % p for p in peaks)))
+
+
+if __name__ == "__main__":
+    main()
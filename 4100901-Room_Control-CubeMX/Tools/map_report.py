@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+"""
+Reporte de tamaño (y velocidad) por función a partir del .map de GNU ld.
+
+Lo corre CMake después de cada build y deja <proyecto>_size.txt junto al .elf.
+Manualmente, desde el directorio de build:
+
+  map_report.py 4100901-Room_Control-CubeMX.map
+  map_report.py perf.map --baseline release.map       diferencias contra otro build
+  map_report.py perf.map --cycles ciclos.txt          agrega velocidad medida
+
+Incluye la FLASH de las tablas de FFT de CMSIS-DSP por tipo y longitud
+(ver CMSIS_DSP_FFT_TABLES en cmake/cmsis_dsp).
+
+ciclos.txt tiene una línea "<función> <ciclos>" por medición (por ejemplo el mejor
+de bench_kernel_best o una medición con perf_counter_now alrededor de la llamada);
+'#' inicia un comentario.
+"""
+import argparse
+import os
+import re
+import sys
+
+HEX = r"0x[0-9a-fA-F]+"
+RE_REGION = re.compile(r"^(\S+)\s+(" + HEX + r")\s+(" + HEX + r")")
+RE_OUTPUT = re.compile(r"^(\.\S+|\S+)\s+(" + HEX + r")\s+(" + HEX + r")(?:\s+load address\s+(" + HEX + r"))?")
+RE_OUTPUT_NAME = re.compile(r"^(\.\S+)\s*$")
+RE_INPUT = re.compile(r"^ (\.\S+|COMMON)\s+(" + HEX + r")\s+(" + HEX + r")\s+(\S.*)$")
+RE_INPUT_NAME = re.compile(r"^ (\.\S+|COMMON)\s*$")
+RE_INPUT_CONT = re.compile(r"^\s+(" + HEX + r")\s+(" + HEX + r")\s+(\S.*)$")
+RE_SYMBOL = re.compile(r"^\s+(" + HEX + r")\s+([A-Za-z_$][\w$.]*)\s*$")
+
+CODE_PREFIXES = (".text", ".sram2_text", ".ramfunc")
+
+# Tablas de FFT de CMSIS-DSP (arm_common_tables.c / arm_const_structs.c): tipo, longitud
+FFT_TABLES = [
+    (re.compile(r"^twiddleCoef_(\d+)$"), "cfft f32"),
+    (re.compile(r"^armBitRevIndexTable(\d+)$"), "cfft f32"),
+    (re.compile(r"^arm_cfft_sR_f32_len(\d+)$"), "cfft f32"),
+    (re.compile(r"^twiddleCoef_(\d+)_q31$"), "cfft q31"),
+    (re.compile(r"^arm_cfft_sR_q31_len(\d+)$"), "cfft q31"),
+    (re.compile(r"^twiddleCoef_(\d+)_q15$"), "cfft q15"),
+    (re.compile(r"^arm_cfft_sR_q15_len(\d+)$"), "cfft q15"),
+    (re.compile(r"^armBitRevIndexTable_fixed_(\d+)$"), "cfft q31/q15"),
+    (re.compile(r"^twiddleCoef_rfft_(\d+)$"), "rfft_fast f32"),
+    (re.compile(r"^armBitRevTable()$"), "radix2/4"),
+    (re.compile(r"^realCoef[AB](Q31|Q15)?$"), "rfft"),
+    (re.compile(r"^(?:Weights|cos_factors)_(\d+)"), "dct4"),
+]
+
+
+class Item:
+    def __init__(self, name, module, output, addr, size):
+        self.name = name
+        self.module = module
+        self.output = output
+        self.addr = addr
+        self.size = size
+
+
+def module_name(path):
+    """libc_nano.a(lib_a-memcpy.o) -> libc_nano.a(memcpy); ruta/ring_buffer.c.obj -> ring_buffer.c"""
+    m = re.match(r"(.*\.a)\((.*)\)$", path)
+    if m:
+        member = re.sub(r"^lib_a-|\.o(bj)?$", "", m.group(2))
+        return "%s(%s)" % (os.path.basename(m.group(1)), member)
+    base = os.path.basename(path)
+    if ".ltrans" in base:
+        return "<lto>"
+    return re.sub(r"\.o(bj)?$", "", base)
+
+
+def parse_map(path):
+    with open(path, errors="replace") as f:
+        lines = f.read().splitlines()
+
+    regions = []
+    items = []
+    outputs = {}
+
+    i = 0
+    while i < len(lines) and not lines[i].startswith("Memory Configuration"):
+        i += 1
+    i += 1
+    while i < len(lines) and not lines[i].startswith("Linker script and memory map"):
+        m = RE_REGION.match(lines[i])
+        if m and m.group(1) not in ("Name", "*default*"):
+            regions.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+        i += 1
+
+    output = None
+    section = None  # (nombre, dirección, tamaño, módulo, símbolos)
+
+    def close_section():
+        if section is None:
+            return
+        name, addr, size, module, symbols = section
+        if size == 0:
+            return
+        # Símbolos globales del input section; los estáticos no aparecen en el map
+        syms = sorted(s for s in symbols if addr <= s[0] < addr + size)
+        if not syms:
+            short = name
+            for prefix in CODE_PREFIXES + (".rodata", ".data", ".bss"):
+                if name.startswith(prefix + "."):
+                    short = name[len(prefix) + 1:]
+                    break
+            items.append(Item(short, module, output, addr, size))
+            return
+        if syms[0][0] > addr:
+            items.append(Item(name, module, output, addr, syms[0][0] - addr))
+        for k, (saddr, sname) in enumerate(syms):
+            end = syms[k + 1][0] if k + 1 < len(syms) else addr + size
+            items.append(Item(sname, module, output, saddr, end - saddr))
+
+    while i < len(lines):
+        line = lines[i]
+        if line.startswith("/DISCARD/") or line.startswith("OUTPUT("):
+            break
+
+        if line and not line[0].isspace():
+            # Sección de salida, el nombre puede venir solo en su línea
+            m = RE_OUTPUT_NAME.match(line)
+            if m and i + 1 < len(lines):
+                line = m.group(1) + " " + lines[i + 1].strip()
+                i += 1
+            m = RE_OUTPUT.match(line)
+            if m and m.group(1).startswith("."):
+                close_section()
+                section = None
+                output = m.group(1)
+                load = int(m.group(4), 16) if m.group(4) else int(m.group(2), 16)
+                outputs[output] = (int(m.group(2), 16), int(m.group(3), 16), load)
+            i += 1
+            continue
+
+        m = RE_INPUT_NAME.match(line)
+        if m and i + 1 < len(lines):
+            cont = RE_INPUT_CONT.match(lines[i + 1])
+            if cont:
+                line = " %s %s %s %s" % (m.group(1), cont.group(1), cont.group(2), cont.group(3))
+                i += 1
+        m = RE_INPUT.match(line)
+        if m and output is not None:
+            close_section()
+            section = (m.group(1), int(m.group(2), 16), int(m.group(3), 16), module_name(m.group(4)), [])
+            i += 1
+            continue
+
+        m = RE_SYMBOL.match(line)
+        if m and section is not None:
+            section[4].append((int(m.group(1), 16), m.group(2)))
+        i += 1
+    close_section()
+
+    return regions, outputs, items
+
+
+def region_of(regions, addr):
+    for name, origin, length in regions:
+        if origin <= addr < origin + length:
+            return name
+    return "?"
+
+
+def region_usage(regions, outputs):
+    used = {name: 0 for name, _, _ in regions}
+    for _, (vma, size, lma) in outputs.items():
+        if size == 0:
+            continue
+        r = region_of(regions, vma)
+        if r in used:
+            used[r] += size
+        if lma != vma:  # .data ocupa también su imagen de carga en FLASH
+            r = region_of(regions, lma)
+            if r in used:
+                used[r] += size
+    return used
+
+
+def base_name(name):
+    """foo.lto_priv.0 / foo.constprop.1 / foo.isra.0 -> foo, para cruzar con las mediciones."""
+    return re.sub(r"(\.(lto_priv|constprop|isra|part|cold)(\.\d+)?)+$", "", name)
+
+
+def is_code(item):
+    return item.output is not None and item.output.startswith(CODE_PREFIXES)
+
+
+def load_cycles(path):
+    cycles = {}
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if len(line) >= 2:
+                cycles[line[0]] = int(line[1], 0)
+    return cycles
+
+
+def fft_report(items, out):
+    """FLASH de tablas de FFT por tipo y longitud, y por configuración RFFT_FAST_F32_<N>."""
+    tables = {}
+    for it in items:
+        for pattern, kind in FFT_TABLES:
+            m = pattern.match(it.name)
+            if m:
+                key = (kind, int(m.group(1)) if m.group(1) and m.group(1).isdigit() else 0)
+                size, names = tables.get(key, (0, []))
+                tables[key] = (size + it.size, names + [it.name])
+                break
+    if not tables:
+        return
+
+    out.write("\nTablas de FFT (CMSIS-DSP)\n")
+    for (kind, length), (size, names) in sorted(tables.items()):
+        out.write("  %-14s %5s %8d  %s\n" % (kind, length or "-", size, " ".join(sorted(names))))
+    out.write("  %-20s %8d\n" % ("total", sum(size for size, _ in tables.values())))
+
+    # Una RFFT rápida de N usa además la CFFT f32 de N/2 (compartida si esa CFFT también se usa)
+    rfft = sorted(length for kind, length in tables if kind == "rfft_fast f32")
+    for length in rfft:
+        size = tables[("rfft_fast f32", length)][0]
+        size += tables.get(("cfft f32", length // 2), (0, []))[0]
+        out.write("  RFFT_FAST_F32_%-6d %8d\n" % (length, size))
+
+
+def report(args, out):
+    regions, outputs, items = parse_map(args.map)
+    code = [it for it in items if is_code(it)]
+
+    out.write("Reporte de %s\n\n" % os.path.basename(args.map))
+
+    out.write("Regiones\n")
+    used = region_usage(regions, outputs)
+    for name, origin, length in regions:
+        if length == 0 or used[name] == 0:
+            continue
+        out.write("  %-10s %8d / %8d bytes  %5.1f%%\n" % (name, used[name], length, 100.0 * used[name] / length))
+
+    out.write("\nSecciones de salida\n")
+    for name, (vma, size, lma) in sorted(outputs.items(), key=lambda kv: kv[1][0]):
+        if size:
+            out.write("  %-20s 0x%08x %8d  %s\n" % (name, vma, size, region_of(regions, vma)))
+
+    modules = {}
+    for it in code:
+        modules[it.module] = modules.get(it.module, 0) + it.size
+    out.write("\nCódigo por módulo\n")
+    for name, size in sorted(modules.items(), key=lambda kv: -kv[1])[: args.top]:
+        out.write("  %-40s %8d\n" % (name, size))
+
+    fft_report(items, out)
+
+    baseline = {}
+    if args.baseline:
+        for it in parse_map(args.baseline)[2]:
+            if is_code(it):
+                baseline[base_name(it.name)] = baseline.get(base_name(it.name), 0) + it.size
+        total = sum(it.size for it in code)
+        base_total = sum(baseline.values())
+        out.write("\nCódigo total: %d bytes, base %d bytes (%+d)\n" % (total, base_total, total - base_total))
+
+    cycles = load_cycles(args.cycles) if args.cycles else {}
+
+    out.write("\nFunciones por tamaño\n")
+    header = "  %-40s %-24s %8s" % ("función", "módulo", "bytes")
+    if baseline:
+        header += " %8s" % "delta"
+    if cycles:
+        header += " %10s" % "ciclos"
+    out.write(header + "\n")
+    ranked = sorted(code, key=lambda it: -it.size)
+    shown = ranked[: args.top] + [it for it in ranked[args.top:] if base_name(it.name) in cycles]
+    for it in shown:
+        row = "  %-40s %-24s %8d" % (it.name[:40], it.module[:24], it.size)
+        key = base_name(it.name)
+        if baseline:
+            row += " %8s" % ("%+d" % (it.size - baseline[key]) if key in baseline else "nueva")
+        if cycles:
+            row += " %10s" % (cycles[key] if key in cycles else "")
+        out.write(row + "\n")
+
+    # Mediciones de funciones que LTO inlineó o eliminó: no tienen tamaño propio
+    missing = sorted(set(cycles) - set(base_name(it.name) for it in code))
+    if missing:
+        out.write("\nSin símbolo en el map (inlineadas o eliminadas): %s\n" % ", ".join(missing))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Tamaño y velocidad por función desde un .map de GNU ld")
+    parser.add_argument("map")
+    parser.add_argument("-o", "--output", help="archivo de salida (por defecto stdout)")
+    parser.add_argument("--baseline", help="otro .map para comparar tamaños (p. ej. el de Release)")
+    parser.add_argument("--cycles", help="archivo '<función> <ciclos>' con mediciones de perf_counter")
+    parser.add_argument("--top", type=int, default=40, help="funciones y módulos a listar")
+    args = parser.parse_args()
+
+    if args.output:
+        with open(args.output, "w") as out:
+            report(args, out)
+    else:
+        report(args, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,145 @@
+/**
+ * @brief Herramienta de host: latencia de alloc/free de mem_pool contra malloc/free de glibc.
+ * @note  Misma carga aleatoria que benchmark_mem_pool() en el firmware (slots, tamaños y
+ *        semilla), con más operaciones para que los percentiles sean estables. Los ciclos
+ *        son del contador de tiempo del host (rdtsc). La comparación con newlib sale del
+ *        firmware (comando "bench"): en el host no hay newlib.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/host -B build/host && cmake --build build/host
+ *          build/host/mem_pool_bench
+ */
+#include "mem_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES() ((uint32_t)__rdtsc())
+#else
+#define HOST_CYCLES() 0U
+#endif
+
+#define BENCH_ALLOC_SLOTS 32      // Igual que benchmark.c
+#define BENCH_ALLOC_MAX_SIZE 128
+#define BENCH_ALLOC_OPS 200000U
+#define BENCH_HIST_BUCKETS 8      // <32, <64, ... <2048, >=2048 ciclos
+
+// Región del pool: en el firmware la reserva el linker (_Mem_Pool_Size = 0x1000)
+__asm__(".globl _spool\n.globl _epool\n.bss\n.balign 8\n_spool:\n.space 0x1000\n_epool:\n.text\n");
+
+typedef void *(*bench_alloc_fn)(size_t size);
+typedef void (*bench_free_fn)(void *ptr);
+
+typedef struct {
+    uint32_t *samples;
+    uint32_t count;
+    uint32_t failures;
+} bench_stats_t;
+
+static uint32_t bench_rand_state;
+
+static uint32_t bench_rand(void)
+{
+    bench_rand_state = bench_rand_state * 1664525U + 1013904223U;
+    return bench_rand_state >> 8;
+}
+
+static int bench_cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Carga aleatoria de benchmark.c: cada paso elige un slot; si está vacío pide
+ *        un bloque de tamaño aleatorio, si está ocupado lo libera.
+ */
+static void bench_alloc_workload(bench_alloc_fn alloc_fn, bench_free_fn free_fn,
+                                 bench_stats_t *alloc_stats, bench_stats_t *free_stats)
+{
+    void *slots[BENCH_ALLOC_SLOTS] = {0};
+
+    bench_rand_state = 0x1234U;
+    alloc_stats->count = free_stats->count = 0;
+    alloc_stats->failures = 0;
+
+    for (uint32_t op = 0; op < BENCH_ALLOC_OPS; op++) {
+        uint32_t idx = bench_rand() % BENCH_ALLOC_SLOTS;
+        if (slots[idx] == NULL) {
+            size_t size = 1 + bench_rand() % BENCH_ALLOC_MAX_SIZE;
+            uint32_t t0 = HOST_CYCLES();
+            slots[idx] = alloc_fn(size);
+            alloc_stats->samples[alloc_stats->count++] = HOST_CYCLES() - t0;
+            if (slots[idx] == NULL) {
+                alloc_stats->failures++;
+            } else {
+                memset(slots[idx], (int)op, size);  // Como un uso real: toca el bloque
+            }
+        } else {
+            uint32_t t0 = HOST_CYCLES();
+            free_fn(slots[idx]);
+            free_stats->samples[free_stats->count++] = HOST_CYCLES() - t0;
+            slots[idx] = NULL;
+        }
+    }
+
+    for (uint32_t i = 0; i < BENCH_ALLOC_SLOTS; i++) {
+        free_fn(slots[i]);
+    }
+}
+
+static void bench_stats_print(const char *name, bench_stats_t *s)
+{
+    uint32_t hist[BENCH_HIST_BUCKETS] = {0};
+    uint64_t total = 0;
+
+    if (s->count == 0) return;
+    for (uint32_t i = 0; i < s->count; i++) {
+        uint8_t bucket = 0;
+        uint32_t limit = 32;
+        while (bucket < BENCH_HIST_BUCKETS - 1 && s->samples[i] >= limit) {
+            bucket++;
+            limit <<= 1;
+        }
+        hist[bucket]++;
+        total += s->samples[i];
+    }
+    qsort(s->samples, s->count, sizeof(s->samples[0]), bench_cmp);
+    printf("%-12s n=%u min=%u p50=%u avg=%lu p99=%u p99.9=%u max=%u ciclos\n", name, s->count,
+           s->samples[0], s->samples[s->count / 2], (unsigned long)(total / s->count),
+           s->samples[(uint64_t)s->count * 99U / 100U], s->samples[(uint64_t)s->count * 999U / 1000U],
+           s->samples[s->count - 1]);
+    printf("  hist(<32,<64,<128,<256,<512,<1k,<2k,>=2k):");
+    for (uint8_t i = 0; i < BENCH_HIST_BUCKETS; i++) printf(" %u", hist[i]);
+    printf("\n");
+}
+
+int main(void)
+{
+    static uint32_t alloc_samples[BENCH_ALLOC_OPS], free_samples[BENCH_ALLOC_OPS];
+    bench_stats_t alloc_stats = { alloc_samples, 0, 0 }, free_stats = { free_samples, 0, 0 };
+
+    if (!mem_pool_init()) {
+        fprintf(stderr, "las clases no caben en la region del pool\n");
+        return 1;
+    }
+
+    printf("%u operaciones, %u slots, 1..%u bytes\n", BENCH_ALLOC_OPS, BENCH_ALLOC_SLOTS, BENCH_ALLOC_MAX_SIZE);
+    bench_alloc_workload(mem_pool_alloc, mem_pool_free, &alloc_stats, &free_stats);
+    bench_stats_print("pool alloc", &alloc_stats);
+    bench_stats_print("pool free", &free_stats);
+    printf("pool: %u peticiones sin bloque libre\n", alloc_stats.failures);
+
+    bench_alloc_workload(malloc, free, &alloc_stats, &free_stats);
+    bench_stats_print("glibc malloc", &alloc_stats);
+    bench_stats_print("glibc free", &free_stats);
+
+    for (uint8_t i = 0; i < MEM_POOL_NUM_CLASSES; i++) {
+        mem_pool_stats_t st;
+        mem_pool_get_stats(i, &st);
+        printf("clase %3u B: uso=%u max=%u/%u fallos=%lu\n", st.block_size, st.in_use, st.high_water,
+               st.block_count, (unsigned long)st.alloc_failures);
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @brief Herramienta de host: pasa archivos WAV por el pipeline de ocupación
+ *        (MFCC + detector) y reporta tramas por segundo y ciclos por etapa.
+ * @note  Acepta WAV PCM de 16 bits a MFCC_SAMPLE_RATE; con varios canales usa el
+ *        primero. Los ciclos son del contador de tiempo del host (rdtsc).
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *
+ *        Uso:
+ *          build/host-dsp/mfcc_wav_bench [--csv mfcc.csv] audio1.wav [audio2.wav ...]
+ */
+#include "occupancy.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES() ((uint32_t)__rdtsc())
+#else
+#define HOST_CYCLES() 0U
+#endif
+
+static uint32_t host_cycles(void)
+{
+    return HOST_CYCLES();
+}
+
+static double host_now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t read_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * @brief Carga las muestras del primer canal; devuelve NULL si el formato no sirve.
+ */
+static int16_t *load_wav(const char *path, uint32_t *count)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc((size_t)size);
+    if (buf == NULL || fread(buf, 1, (size_t)size, f) != (size_t)size) {
+        fclose(f);
+        free(buf);
+        return NULL;
+    }
+    fclose(f);
+
+    int16_t *samples = NULL;
+    uint16_t channels = 0, bits = 0, format = 0;
+    uint32_t rate = 0;
+    if (size < 12 || memcmp(buf, "RIFF", 4) != 0 || memcmp(buf + 8, "WAVE", 4) != 0) {
+        fprintf(stderr, "%s: no es un WAV\n", path);
+        goto done;
+    }
+    for (long pos = 12; pos + 8 <= size;) {
+        uint32_t len = read_le32(buf + pos + 4);
+        const uint8_t *chunk = buf + pos + 8;
+        if (pos + 8 + (long)len > size) break;
+        if (memcmp(buf + pos, "fmt ", 4) == 0 && len >= 16) {
+            format = read_le16(chunk);
+            channels = read_le16(chunk + 2);
+            rate = read_le32(chunk + 4);
+            bits = read_le16(chunk + 14);
+        } else if (memcmp(buf + pos, "data", 4) == 0 && channels != 0) {
+            if (format != 1 || bits != 16 || rate != MFCC_SAMPLE_RATE) {
+                fprintf(stderr, "%s: se espera PCM 16 bits a %u Hz (formato %u, %u bits, %u Hz)\n", path,
+                        MFCC_SAMPLE_RATE, format, bits, rate);
+                goto done;
+            }
+            *count = len / (2U * channels);
+            samples = malloc(*count * sizeof(int16_t));
+            for (uint32_t i = 0; i < *count; i++) samples[i] = (int16_t)read_le16(chunk + 2U * channels * i);
+            goto done;
+        }
+        pos += 8 + len + (len & 1U);
+    }
+    fprintf(stderr, "%s: sin bloque data\n", path);
+done:
+    free(buf);
+    return samples;
+}
+
+int main(int argc, char **argv)
+{
+    static occupancy_t occ;
+    FILE *csv = NULL;
+    int first = 1;
+
+    if (argc > 2 && strcmp(argv[1], "--csv") == 0) {
+        csv = fopen(argv[2], "w");
+        if (csv == NULL) {
+            perror(argv[2]);
+            return 1;
+        }
+        first = 3;
+    }
+    if (first >= argc) {
+        fprintf(stderr, "uso: %s [--csv mfcc.csv] audio.wav ...\n", argv[0]);
+        return 2;
+    }
+
+    for (int a = first; a < argc; a++) {
+        uint32_t count = 0;
+        int16_t *samples = load_wav(argv[a], &count);
+        if (samples == NULL) return 1;
+        if (!occupancy_init(&occ)) {
+            fprintf(stderr, "mfcc_init fallo\n");
+            return 1;
+        }
+        occ.mfcc.clock = host_cycles;
+
+        uint64_t stage_sum[MFCC_STAGE_COUNT] = {0};
+        uint32_t frames = 0;
+        double t0 = host_now_s();
+        for (uint32_t pos = 0; pos + MFCC_FRAME_SHIFT <= count; pos += MFCC_FRAME_SHIFT) {
+            uint32_t before = occ.frames;
+            bool changed = occupancy_process(&occ, &samples[pos]);
+            if (occ.frames == before) continue;  // Todavía llenando la primera trama
+
+            frames++;
+            for (uint32_t s = 0; s < MFCC_STAGE_COUNT; s++) stage_sum[s] += occ.mfcc.stage_cycles[s];
+            if (changed) {
+                printf("  %7.2f s  %s\n", (double)(pos + MFCC_FRAME_SHIFT) / MFCC_SAMPLE_RATE,
+                       occ.occupied ? "ocupado" : "libre");
+            }
+            if (csv != NULL) {
+                fprintf(csv, "%s,%u", argv[a], frames - 1U);
+                for (uint32_t i = 0; i < MFCC_NUM_COEFFS; i++) fprintf(csv, ",%.4f", occ.coeffs[i]);
+                fprintf(csv, "\n");
+            }
+        }
+        double elapsed = host_now_s() - t0;
+
+        printf("%s: %.2f s de audio, %u tramas, %.0f tramas/s (tiempo real x%.0f)\n", argv[a],
+               (double)count / MFCC_SAMPLE_RATE, frames, frames / elapsed,
+               ((double)count / MFCC_SAMPLE_RATE) / elapsed);
+        uint64_t total = 0;
+        for (uint32_t s = 0; s < MFCC_STAGE_COUNT; s++) total += stage_sum[s];
+        for (uint32_t s = 0; s < MFCC_STAGE_COUNT && frames > 0; s++) {
+            printf("  %-9s %8.0f ciclos/trama %5.1f%%\n", mfcc_stage_name((mfcc_stage_t)s),
+                   (double)stage_sum[s] / frames, total ? 100.0 * stage_sum[s] / total : 0.0);
+        }
+        free(samples);
+    }
+    if (csv != NULL) fclose(csv);
+    return 0;
+}
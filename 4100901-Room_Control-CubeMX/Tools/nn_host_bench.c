@@ -0,0 +1,106 @@
+/**
+ * @brief Herramienta de host: ejecuta nn_runtime con CMSIS-NN en Linux y mide cada capa.
+ * @note  Usa el mismo modelo sintético que benchmark_nn del firmware (pesos
+ *        pseudoaleatorios, sin entrenar): sirve para validar el runtime y comparar
+ *        costos relativos de las capas, no para predecir ciclos del Cortex-M4.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_nn -B build/host-nn && cmake --build build/host-nn
+ *          build/host-nn/nn_host_bench
+ */
+#include "nn_runtime.h"
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_RUNS 2000UL
+
+static q7_t conv1_w[8 * 3 * 3 * 4], conv1_b[8];
+static q7_t dw_w[3 * 3 * 8], dw_b[8];
+static q7_t pw_w[16 * 8], pw_b[16];
+static q7_t fc_w[4 * 16], fc_b[4];
+
+static const nn_layer_t layers[] = {
+    { .type = NN_LAYER_CONV, .kernel_x = 3, .kernel_y = 3, .stride_x = 1, .stride_y = 1, .pad_x = 1, .pad_y = 1,
+      .bias_shift = 0, .out_shift = 7, .out_ch = 8, .weights = conv1_w, .bias = conv1_b },
+    { .type = NN_LAYER_RELU },
+    { .type = NN_LAYER_MAXPOOL, .kernel_x = 2, .kernel_y = 2, .stride_x = 2, .stride_y = 2 },
+    { .type = NN_LAYER_DWCONV, .kernel_x = 3, .kernel_y = 3, .stride_x = 1, .stride_y = 1, .pad_x = 1, .pad_y = 1,
+      .bias_shift = 0, .out_shift = 6, .out_ch = 8, .weights = dw_w, .bias = dw_b },
+    { .type = NN_LAYER_RELU },
+    { .type = NN_LAYER_CONV, .kernel_x = 1, .kernel_y = 1, .stride_x = 1, .stride_y = 1,
+      .bias_shift = 0, .out_shift = 6, .out_ch = 16, .weights = pw_w, .bias = pw_b },
+    { .type = NN_LAYER_RELU },
+    { .type = NN_LAYER_AVGPOOL, .kernel_x = 8, .kernel_y = 8, .stride_x = 8, .stride_y = 8 },
+    { .type = NN_LAYER_FC, .bias_shift = 0, .out_shift = 6, .out_ch = 4, .weights = fc_w, .bias = fc_b },
+    { .type = NN_LAYER_SOFTMAX },
+};
+
+static const nn_model_t model = {
+    .name = "sintetico",
+    .input = { .h = 16, .w = 16, .c = 4 },
+    .layers = layers,
+    .layer_count = sizeof(layers) / sizeof(layers[0]),
+};
+
+
+static uint32_t seed = 12345;
+
+static void fill(q7_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        data[i] = (q7_t)((seed >> 24) & 0x3F) - 32;  // Pesos pequeños: evitan saturar
+    }
+}
+
+static uint32_t host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+int main(void)
+{
+    static uint32_t arena[4096];
+    static q7_t input[16 * 16 * 4];
+    q7_t output[4];
+    nn_runtime_t rt;
+    uint32_t needed;
+
+    fill(conv1_w, sizeof(conv1_w));
+    fill(conv1_b, sizeof(conv1_b));
+    fill(dw_w, sizeof(dw_w));
+    fill(dw_b, sizeof(dw_b));
+    fill(pw_w, sizeof(pw_w));
+    fill(pw_b, sizeof(pw_b));
+    fill(fc_w, sizeof(fc_w));
+    fill(fc_b, sizeof(fc_b));
+    fill(input, sizeof(input));
+
+    if (!nn_model_plan(&model, &needed, NULL) || !nn_runtime_init(&rt, &model, arena, sizeof(arena))) {
+        fprintf(stderr, "modelo invalido o arena chica (necesita %u bytes)\n", needed);
+        return 1;
+    }
+    printf("modelo %s: %u capas, arena %u bytes, salida %ux%ux%u\n", model.name, model.layer_count,
+           rt.arena_used, rt.output.h, rt.output.w, rt.output.c);
+
+    uint64_t totals[NN_MAX_LAYERS] = {0};
+    rt.clock = host_now_ns;
+    for (unsigned long run = 0; run < HOST_RUNS; run++) {
+        if (!nn_runtime_run(&rt, input, output)) {
+            fprintf(stderr, "CMSIS-NN rechazo una capa\n");
+            return 1;
+        }
+        for (uint8_t i = 0; i < model.layer_count; i++) totals[i] += rt.layer_cycles[i];
+    }
+
+    uint64_t sum = 0;
+    for (uint8_t i = 0; i < model.layer_count; i++) {
+        printf("  %2u %-8s %10.1f ns\n", i, nn_layer_name(layers[i].type), (double)totals[i] / HOST_RUNS);
+        sum += totals[i];
+    }
+    printf("total %.1f ns por inferencia, clase %u (%d %d %d %d)\n", (double)sum / HOST_RUNS,
+           nn_argmax(output, 4), output[0], output[1], output[2], output[3]);
+    return 0;
+}
@@ -0,0 +1,232 @@
+/**
+ * @brief Herramienta de host: conversor de tasa racional L/M (arm_fir_resample_f32/q15)
+ *        contra interpolar por L con arm_fir_interpolate_f32/q15 y descartar M-1 de cada M.
+ * @note  Para cada razón filtra HOST_BLOCKS bloques seguidos (así se verifica también
+ *        la posición guardada entre llamadas) con un pasabajos de ventana de Hann
+ *        diseñado a la tasa intermedia, y reporta la diferencia y los ns por muestra de
+ *        salida. q15 debe coincidir bit a bit; f32 dentro de HOST_TOLERANCE. Devuelve 1
+ *        si no. Ambos por el camino en C, el del Cortex-M4.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/resample_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+#define HOST_PHASE_LEN 24       // Taps por fase: numTaps = L * HOST_PHASE_LEN
+#define HOST_MAX_L 160
+#define HOST_BLOCK 480          // Muestras de entrada por llamada (10 ms a 48 kHz)
+#define HOST_BLOCKS 4
+#define HOST_LEN (HOST_BLOCK * HOST_BLOCKS)
+#define HOST_MAX_TAPS (HOST_MAX_L * HOST_PHASE_LEN)
+#define HOST_MIN_NS 20e6        // Tiempo mínimo de medición por variante
+#define HOST_TOLERANCE 1e-5     // Error f32 relativo al pico de la salida
+
+static const struct {
+    const char *name;
+    uint16_t L, M;
+} ratios[] = {
+    { "48k->16k", 1, 3 },
+    { "44.1k->16k", 160, 441 },
+    { "48k->44.1k", 147, 160 },
+    { "16k->24k", 3, 2 },
+};
+
+static float32_t coeffs_f32[HOST_MAX_TAPS];
+static q15_t coeffs_q15[HOST_MAX_TAPS];
+static float32_t in_f32[HOST_LEN];
+static q15_t in_q15[HOST_LEN];
+static float32_t up_f32[HOST_LEN * HOST_MAX_L];  // Salida completa del interpolador
+static q15_t up_q15[HOST_LEN * HOST_MAX_L];
+static float32_t out_f32[2][HOST_LEN * 2];       // [0] interpolar y descartar, [1] conversor
+static q15_t out_q15[2][HOST_LEN * 2];
+static float32_t state_f32[HOST_PHASE_LEN + HOST_BLOCK - 1];
+static q15_t state_q15[HOST_PHASE_LEN + HOST_BLOCK - 1];
+
+static arm_fir_interpolate_instance_f32 interp_f32;
+static arm_fir_interpolate_instance_q15 interp_q15;
+static arm_fir_resample_instance_f32 rs_f32;
+static arm_fir_resample_instance_q15 rs_q15;
+static uint32_t run_L, run_M;
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Pasabajos de ventana de Hann a la tasa intermedia: corte en la menor de las
+ *        dos frecuencias de Nyquist y ganancia L, en orden invertido como pide CMSIS.
+ */
+static void design_lowpass(uint32_t L, uint32_t M)
+{
+    uint32_t taps = L * HOST_PHASE_LEN;
+    double fc = 0.5 / (L > M ? L : M) * 0.9;  // Ciclos por muestra intermedia, con margen de transición
+    double peak = 0.0;
+
+    for (uint32_t i = 0; i < taps; i++) {
+        double t = i - (taps - 1) / 2.0;
+        double sinc = (t == 0.0) ? 2.0 * fc : sin(2.0 * PI * fc * t) / (PI * t);
+        double hann = 0.5 - 0.5 * cos(2.0 * PI * (i + 1) / (taps + 1));
+        coeffs_f32[taps - 1 - i] = (float32_t)(L * sinc * hann);
+        if (fabs(coeffs_f32[taps - 1 - i]) > peak) peak = fabs(coeffs_f32[taps - 1 - i]);
+    }
+    // q15 no representa la ganancia L: se escala para que el mayor coeficiente quepa
+    for (uint32_t i = 0; i < taps; i++) {
+        coeffs_q15[i] = (q15_t)lrint(coeffs_f32[i] / (peak > 1.0 ? peak : 1.0) * 32767.0);
+    }
+}
+
+/* Un bloque de cada variante; devuelven las muestras de salida producidas */
+static uint32_t run_chain_f32(uint32_t block, float32_t *out)
+{
+    float32_t *up = &up_f32[block * HOST_BLOCK * run_L];
+    arm_fir_interpolate_f32(&interp_f32, &in_f32[block * HOST_BLOCK], up, HOST_BLOCK);
+    // Posición de la primera salida del conversor en este bloque: t = k*M + M - 1
+    uint32_t first = block * HOST_BLOCK * run_L, n = 0;
+    uint32_t t = first / run_M * run_M + run_M - 1;
+    for (; t < first + HOST_BLOCK * run_L; t += run_M) out[n++] = up[t - first];
+    return n;
+}
+
+static uint32_t run_chain_q15(uint32_t block, q15_t *out)
+{
+    q15_t *up = &up_q15[block * HOST_BLOCK * run_L];
+    arm_fir_interpolate_q15(&interp_q15, &in_q15[block * HOST_BLOCK], up, HOST_BLOCK);
+    uint32_t first = block * HOST_BLOCK * run_L, n = 0;
+    uint32_t t = first / run_M * run_M + run_M - 1;
+    for (; t < first + HOST_BLOCK * run_L; t += run_M) out[n++] = up[t - first];
+    return n;
+}
+
+static uint32_t run_resample_f32(uint32_t block, float32_t *out)
+{
+    return arm_fir_resample_f32(&rs_f32, &in_f32[block * HOST_BLOCK], out, HOST_BLOCK);
+}
+
+static uint32_t run_resample_q15(uint32_t block, q15_t *out)
+{
+    return arm_fir_resample_q15(&rs_q15, &in_q15[block * HOST_BLOCK], out, HOST_BLOCK);
+}
+
+/**
+ * @brief Inicializa las cuatro instancias para run_L/run_M con estado en cero.
+ */
+static int init_filters(void)
+{
+    uint16_t taps = (uint16_t)(run_L * HOST_PHASE_LEN);
+
+    return arm_fir_interpolate_init_f32(&interp_f32, (uint8_t)run_L, taps, coeffs_f32, state_f32, HOST_BLOCK) ==
+               ARM_MATH_SUCCESS &&
+           arm_fir_interpolate_init_q15(&interp_q15, (uint8_t)run_L, taps, coeffs_q15, state_q15, HOST_BLOCK) ==
+               ARM_MATH_SUCCESS;
+}
+
+static int init_resamplers(void)
+{
+    uint16_t taps = (uint16_t)(run_L * HOST_PHASE_LEN);
+
+    return arm_fir_resample_init_f32(&rs_f32, (uint16_t)run_L, (uint16_t)run_M, taps, coeffs_f32, state_f32,
+                                     HOST_BLOCK) == ARM_MATH_SUCCESS &&
+           arm_fir_resample_init_q15(&rs_q15, (uint16_t)run_L, (uint16_t)run_M, taps, coeffs_q15, state_q15,
+                                     HOST_BLOCK) == ARM_MATH_SUCCESS;
+}
+
+/**
+ * @brief Nanosegundos por muestra de salida de run (f32 o q15 según sea): mejor
+ *        tanda de HOST_BLOCKS bloques durante HOST_MIN_NS.
+ */
+static double measure_f32(uint32_t (*run)(uint32_t, float32_t *))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+    uint32_t outputs = 0;
+
+    do {
+        t0 = host_now_ns();
+        outputs = 0;
+        for (uint32_t b = 0; b < HOST_BLOCKS; b++) outputs += run(b, out_f32[0]);
+        batch = host_now_ns() - t0;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best / outputs;
+}
+
+static double measure_q15(uint32_t (*run)(uint32_t, q15_t *))
+{
+    double start = host_now_ns(), best = 1e30, t0, batch;
+    uint32_t outputs = 0;
+
+    do {
+        t0 = host_now_ns();
+        outputs = 0;
+        for (uint32_t b = 0; b < HOST_BLOCKS; b++) outputs += run(b, out_q15[0]);
+        batch = host_now_ns() - t0;
+        if (batch < best) best = batch;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    return best / outputs;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < HOST_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        in_f32[i] = ((float32_t)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f) / 2.0f;
+    }
+    arm_float_to_q15(in_f32, in_q15, HOST_LEN);
+
+#if defined(ARM_MATH_X86_SIMD)
+    // Ambas variantes por el camino en C, el que corre en el Cortex-M4
+    arm_x86_simd_set_level(ARM_X86_SIMD_NONE);
+#endif
+
+    printf("%-11s %4s %4s %10s %10s %10s %7s %9s %10s %10s %7s\n", "razón", "L", "M", "f32 err", "ns/s cad.",
+           "ns/s conv", "x", "q15 dif", "ns/s cad.", "ns/s conv", "x");
+    for (uint32_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+        run_L = ratios[r].L;
+        run_M = ratios[r].M;
+        design_lowpass(run_L, run_M);
+
+        // Salida de referencia de toda la señal y del conversor, bloque a bloque
+        uint32_t n_ref = 0, n_f32 = 0, n_q15 = 0, n_ref_q15 = 0;
+        if (!init_filters() || !init_resamplers()) {
+            fprintf(stderr, "%s: init falló\n", ratios[r].name);
+            return 1;
+        }
+        for (uint32_t b = 0; b < HOST_BLOCKS; b++) n_ref += run_chain_f32(b, &out_f32[0][n_ref]);
+        for (uint32_t b = 0; b < HOST_BLOCKS; b++) n_ref_q15 += run_chain_q15(b, &out_q15[0][n_ref_q15]);
+        init_resamplers();
+        for (uint32_t b = 0; b < HOST_BLOCKS; b++) n_f32 += run_resample_f32(b, &out_f32[1][n_f32]);
+        for (uint32_t b = 0; b < HOST_BLOCKS; b++) n_q15 += run_resample_q15(b, &out_q15[1][n_q15]);
+
+        double peak = 0.0, err = 0.0;
+        uint32_t q15_diff = 0;
+        for (uint32_t i = 0; i < n_ref; i++) {
+            if (fabs(out_f32[0][i]) > peak) peak = fabs(out_f32[0][i]);
+            if (fabs((double)out_f32[1][i] - out_f32[0][i]) > err) err = fabs((double)out_f32[1][i] - out_f32[0][i]);
+            if (out_q15[1][i] != out_q15[0][i]) q15_diff++;
+        }
+        err /= peak;
+
+        init_filters();
+        double t_chain_f32 = measure_f32(run_chain_f32), t_chain_q15 = measure_q15(run_chain_q15);
+        init_resamplers();
+        double t_rs_f32 = measure_f32(run_resample_f32), t_rs_q15 = measure_q15(run_resample_q15);
+        printf("%-11s %4u %4u %10.1e %10.2f %10.2f %7.1f %9u %10.2f %10.2f %7.1f\n", ratios[r].name, run_L, run_M,
+               err, t_chain_f32, t_rs_f32, t_chain_f32 / t_rs_f32, q15_diff, t_chain_q15, t_rs_q15,
+               t_chain_q15 / t_rs_q15);
+        if (n_f32 != n_ref || n_q15 != n_ref_q15 || n_ref != n_ref_q15 || err > HOST_TOLERANCE || q15_diff != 0) {
+            fprintf(stderr, "%s: %u/%u/%u salidas (esperadas %u), error f32 %.2e, %u muestras q15 distintas\n",
+                    ratios[r].name, n_f32, n_q15, n_ref_q15, n_ref, err, q15_diff);
+            failed = 1;
+        }
+    }
+    printf("%s\n", failed ? "FALLA" : "OK");
+    return failed;
+}
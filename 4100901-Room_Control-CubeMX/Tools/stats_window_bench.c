@@ -0,0 +1,243 @@
+/**
+ * @brief Herramienta de host: estadísticas de ventana deslizante
+ *        (arm_stats_window_f32/q31) contra las funciones de bloque de CMSIS-DSP
+ *        recalculadas sobre la ventana completa en cada salto.
+ * @note  Para cada ventana y salto recorre una señal con ruido, una componente
+ *        lenta y ráfagas de amplitud 100 veces mayor. Tras cada salto compara
+ *        media, varianza, desviación, RMS, máximo y mínimo (con su posición) con
+ *        arm_mean/var/std/rms/max/min sobre la ventana; el máximo y el mínimo deben
+ *        coincidir exactamente, igual que la media q31. En f32 el error admitido es
+ *        relativo al pico de las dos últimas ventanas (lo filtrado desde la última
+ *        vuelta del buffer). La varianza q31 se compara con la calculada en double
+ *        sobre las muestras en 1.23 y la desviación y el RMS con arm_sqrt_q31 de la
+ *        referencia: arm_var_q31 (el cuadrado de la suma) y arm_rms_q31 (el
+ *        acumulador 2.62) desbordan con ventanas largas.
+ *        Devuelve 1 si algo no coincide. Reporta los ns por salto de cada forma;
+ *        con el salto mayor que la ventana no hay nada que reutilizar y la ventana
+ *        también recalcula sobre el final del bloque.
+ *
+ *        Compilar desde 4100901-Room_Control-CubeMX:
+ *          cmake -S cmake/cmsis_dsp -B build/host-dsp && cmake --build build/host-dsp
+ *          build/host-dsp/stats_window_bench
+ */
+#include "arm_math.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define HOST_SIGNAL_LEN 120000U
+#define HOST_MIN_NS 20e6        // Tiempo mínimo de medición por forma
+#define HOST_TOL_F32 1e-5       // Error relativo admitido en f32 (al pico reciente)
+
+typedef struct {
+    uint32_t window;
+    uint32_t hop;
+} host_case_t;
+
+// 1 s a 16 kHz cada 10 ms, 100 ms a 16 kHz cada 1 ms, 1 s a 100 Hz muestra a muestra y bordes
+static const host_case_t host_cases[] = {
+    {16000, 160}, {1600, 16}, {100, 1}, {1, 1}, {2, 3}, {7, 5}, {333, 1000},
+};
+
+static float32_t sig_f32[HOST_SIGNAL_LEN];
+static q31_t sig_q31[HOST_SIGNAL_LEN];
+
+static double host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Compara a con b relativo a scale; cuenta y reporta la primera falla.
+ */
+static uint32_t check_close(const char *what, uint32_t window, double a, double b, double scale, double tol)
+{
+    if (fabs(a - b) <= tol * scale) return 0;
+    fprintf(stderr, "ventana %u: %s %.9g, esperado %.9g\n", window, what, a, b);
+    return 1;
+}
+
+/**
+ * @brief Recorre la señal f32 con la ventana deslizante y compara tras cada salto.
+ */
+static uint32_t check_f32(const host_case_t *c)
+{
+    arm_stats_window_instance_f32 S;
+    float32_t *buffer = malloc(c->window * sizeof(float32_t));
+    uint32_t *queue = malloc(2 * c->window * sizeof(uint32_t));
+    uint32_t fails = 0;
+
+    arm_stats_window_init_f32(&S, c->window, buffer, queue);
+    for (uint32_t end = c->hop; end <= HOST_SIGNAL_LEN && fails < 8; end += c->hop) {
+        arm_stats_window_f32(&S, &sig_f32[end - c->hop], c->hop);
+
+        uint32_t n = (end < c->window) ? end : c->window;
+        const float32_t *win = &sig_f32[end - n];
+        float32_t got, ref, ref_rms;
+        uint32_t got_idx, ref_idx;
+        double scale = 1e-30;
+
+        for (uint32_t i = (end > 2 * n) ? end - 2 * n : 0; i < end; i++) {
+            if (fabs(sig_f32[i]) > scale) scale = fabs(sig_f32[i]);
+        }
+        arm_rms_f32(win, n, &ref_rms);
+
+        arm_stats_window_mean_f32(&S, &got);
+        arm_mean_f32(win, n, &ref);
+        fails += check_close("media f32", c->window, got, ref, scale, HOST_TOL_F32);
+        arm_stats_window_var_f32(&S, &got);
+        arm_var_f32(win, n, &ref);
+        fails += check_close("varianza f32", c->window, got, ref, scale * scale, HOST_TOL_F32);
+        arm_stats_window_std_f32(&S, &got);
+        arm_std_f32(win, n, &ref);
+        fails += check_close("desviacion f32", c->window, got, ref, scale, sqrt(HOST_TOL_F32));
+        arm_stats_window_rms_f32(&S, &got);
+        fails += check_close("RMS f32", c->window, got, ref_rms, scale, HOST_TOL_F32);
+
+        arm_stats_window_max_f32(&S, &got, &got_idx);
+        arm_max_f32(win, n, &ref, &ref_idx);
+        fails += (got != ref || got_idx != ref_idx) ? check_close("max f32", c->window, got_idx, ref_idx, 1, 0) : 0;
+        arm_stats_window_min_f32(&S, &got, &got_idx);
+        arm_min_f32(win, n, &ref, &ref_idx);
+        fails += (got != ref || got_idx != ref_idx) ? check_close("min f32", c->window, got_idx, ref_idx, 1, 0) : 0;
+    }
+    free(buffer);
+    free(queue);
+    return fails;
+}
+
+/**
+ * @brief Recorre la señal q31 con la ventana deslizante y compara tras cada salto.
+ */
+static uint32_t check_q31(const host_case_t *c)
+{
+    arm_stats_window_instance_q31 S;
+    q31_t *buffer = malloc(c->window * sizeof(q31_t));
+    uint32_t *queue = malloc(2 * c->window * sizeof(uint32_t));
+    uint32_t fails = 0;
+
+    arm_stats_window_init_q31(&S, c->window, buffer, queue);
+    for (uint32_t end = c->hop; end <= HOST_SIGNAL_LEN && fails < 8; end += c->hop) {
+        arm_stats_window_q31(&S, &sig_q31[end - c->hop], c->hop);
+
+        uint32_t n = (end < c->window) ? end : c->window;
+        const q31_t *win = &sig_q31[end - n];
+        q31_t got, ref;
+        uint32_t got_idx, ref_idx;
+        double sum = 0.0, sq = 0.0, var;
+        q31_t ref_sqrt;
+
+        arm_stats_window_mean_q31(&S, &got);
+        arm_mean_q31(win, n, &ref);
+        fails += check_close("media q31", c->window, got, ref, 1, 0);
+
+        // Referencias en double con las muestras en 1.23, como los acumuladores de la ventana (1.0 = 2^23)
+        for (uint32_t i = 0; i < n; i++) {
+            sum += (double)(win[i] >> 8) / 8388608.0;
+            sq += (double)(win[i] >> 8) / 8388608.0 * ((win[i] >> 8) / 8388608.0);
+        }
+        // Saturada a 1.31 como la de la ventana
+        var = fmin((n > 1) ? (sq - sum * sum / n) / (n - 1) * 2147483648.0 : 0.0, 2147483647.0);
+        arm_stats_window_var_q31(&S, &got);
+        fails += check_close("varianza q31", c->window, got, var, 1, 4);
+        // Los 4 LSB de la varianza se amplifican en la raíz por 2^31 / (2 * desviación)
+        arm_stats_window_std_q31(&S, &got);
+        arm_sqrt_q31((q31_t)var, &ref_sqrt);
+        fails += check_close("desviacion q31", c->window, got, ref_sqrt, 1, 4 + 4 * 1073741824.0 / (ref_sqrt + 1));
+        arm_stats_window_rms_q31(&S, &got);
+        arm_sqrt_q31((q31_t)fmin(sq / n * 2147483648.0, 2147483647.0), &ref_sqrt);
+        fails += check_close("RMS q31", c->window, got, ref_sqrt, 1, 4);
+
+        arm_stats_window_max_q31(&S, &got, &got_idx);
+        arm_max_q31(win, n, &ref, &ref_idx);
+        fails += (got != ref || got_idx != ref_idx) ? check_close("max q31", c->window, got_idx, ref_idx, 1, 0) : 0;
+        arm_stats_window_min_q31(&S, &got, &got_idx);
+        arm_min_q31(win, n, &ref, &ref_idx);
+        fails += (got != ref || got_idx != ref_idx) ? check_close("min q31", c->window, got_idx, ref_idx, 1, 0) : 0;
+    }
+    free(buffer);
+    free(queue);
+    return fails;
+}
+
+/**
+ * @brief Nanosegundos por salto: la mejor pasada completa por la señal durante HOST_MIN_NS.
+ *        stream = 1 usa la ventana deslizante, 0 las funciones de bloque sobre la ventana.
+ */
+static double measure_f32(const host_case_t *c, int stream)
+{
+    arm_stats_window_instance_f32 S;
+    float32_t *buffer = malloc(c->window * sizeof(float32_t));
+    uint32_t *queue = malloc(2 * c->window * sizeof(uint32_t));
+    float32_t r[6];
+    uint32_t idx[2], hops = 0;
+    volatile float32_t sink = 0.0f;
+    uint32_t first = (c->window > c->hop) ? c->window : c->hop;
+    double start = host_now_ns(), best = 1e30;
+
+    do {
+        // Ventana llena desde el primer salto medido
+        arm_stats_window_init_f32(&S, c->window, buffer, queue);
+        arm_stats_window_f32(&S, sig_f32, first - c->hop);
+        double t0 = host_now_ns();
+        hops = 0;
+        for (uint32_t end = first; end <= HOST_SIGNAL_LEN; end += c->hop, hops++) {
+            if (stream) {
+                arm_stats_window_f32(&S, &sig_f32[end - c->hop], c->hop);
+                arm_stats_window_mean_f32(&S, &r[0]);
+                arm_stats_window_var_f32(&S, &r[1]);
+                arm_stats_window_std_f32(&S, &r[2]);
+                arm_stats_window_rms_f32(&S, &r[3]);
+                arm_stats_window_max_f32(&S, &r[4], &idx[0]);
+                arm_stats_window_min_f32(&S, &r[5], &idx[1]);
+            } else {
+                const float32_t *win = &sig_f32[end - c->window];
+                arm_mean_f32(win, c->window, &r[0]);
+                arm_var_f32(win, c->window, &r[1]);
+                arm_std_f32(win, c->window, &r[2]);
+                arm_rms_f32(win, c->window, &r[3]);
+                arm_max_f32(win, c->window, &r[4], &idx[0]);
+                arm_min_f32(win, c->window, &r[5], &idx[1]);
+            }
+            sink += r[0] + r[1] + r[2] + r[3] + r[4] + r[5];
+        }
+        double t = host_now_ns() - t0;
+        if (t < best) best = t;
+    } while (host_now_ns() - start < HOST_MIN_NS);
+    free(buffer);
+    free(queue);
+    return best / hops;
+}
+
+int main(void)
+{
+    uint32_t fails = 0, seed = 5050;
+
+    // Ruido uniforme de amplitud 0.01, seno lento de amplitud 0.2 y ráfagas de amplitud 1
+    for (uint32_t i = 0; i < HOST_SIGNAL_LEN; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        double noise = ((double)((seed >> 8) & 0xFFFF) / 32768.0 - 1.0) * 0.01;
+        double x = noise + 0.2 * sin(2.0 * M_PI * i / 40000.0);
+        if ((i / 5000U) % 7U == 3U) x += noise * 99.0;
+        sig_f32[i] = (float32_t)x;
+    }
+    arm_float_to_q31(sig_f32, sig_q31, HOST_SIGNAL_LEN);
+
+    printf("%-7s %5s %14s %14s %8s\n", "ventana", "salto", "ns/salto bloq", "ns/salto desl", "x");
+    for (uint32_t c = 0; c < sizeof(host_cases) / sizeof(host_cases[0]); c++) {
+        const host_case_t *hc = &host_cases[c];
+        uint32_t f = check_f32(hc) + check_q31(hc);
+
+        fails += f;
+        if (hc->window >= 100) {
+            double t_block = measure_f32(hc, 0), t_stream = measure_f32(hc, 1);
+            printf("%-7u %5u %14.1f %14.1f %8.1f\n", hc->window, hc->hop, t_block, t_stream, t_block / t_stream);
+        } else {
+            printf("%-7u %5u %14s %14s %8s\n", hc->window, hc->hop, "-", "-", "-");
+        }
+    }
+    printf("%s\n", fails ? "FALLA" : "OK");
+    return fails != 0;
+}
@@ -13,6 +13,9 @@ set(CMAKE_ASM_COMPILER              ${CMAKE_C_COMPILER})
 set(CMAKE_CXX_COMPILER              ${TOOLCHAIN_PREFIX}g++)
 set(CMAKE_LINKER                    ${TOOLCHAIN_PREFIX}g++)
 set(CMAKE_OBJCOPY                   ${TOOLCHAIN_PREFIX}objcopy)
+# gcc-ar/gcc-ranlib cargan el plugin de LTO para bibliotecas estáticas
+set(CMAKE_AR                        ${TOOLCHAIN_PREFIX}gcc-ar)
+set(CMAKE_RANLIB                    ${TOOLCHAIN_PREFIX}gcc-ranlib)
 set(CMAKE_SIZE                      ${TOOLCHAIN_PREFIX}size)
 
 set(CMAKE_EXECUTABLE_SUFFIX_ASM     ".elf")
@@ -32,6 +35,12 @@ set(CMAKE_C_FLAGS_DEBUG "-O0 -g3")
 set(CMAKE_C_FLAGS_RELEASE "-Os -g0")
 set(CMAKE_CXX_FLAGS_DEBUG "-O0 -g3")
 set(CMAKE_CXX_FLAGS_RELEASE "-Os -g0")
+# Perf: Release con LTO. Los módulos calientes suben a PERF_HOT_OPT en CMakeLists.txt;
+# GCC guarda el nivel de optimización de cada función, así que LTO lo respeta.
+set(CMAKE_C_FLAGS_PERF "-Os -g0 -flto")
+set(CMAKE_CXX_FLAGS_PERF "-Os -g0 -flto")
+set(CMAKE_ASM_FLAGS_PERF "")
+set(CMAKE_EXE_LINKER_FLAGS_PERF "-flto")
 
 set(CMAKE_CXX_FLAGS "${CMAKE_C_FLAGS} -fno-rtti -fno-exceptions -fno-threadsafe-statics")
 
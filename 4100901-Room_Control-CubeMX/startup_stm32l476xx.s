@@ -44,6 +44,17 @@ defined in linker script */
 .word	_sbss
 /* end address for the .bss section. defined in linker script */
 .word	_ebss
+/* start address for the initialization values of the .sram2_text section.
+defined in linker script */
+.word	_sisram2_text
+/* start address for the .sram2_text section. defined in linker script */
+.word	_ssram2_text
+/* end address for the .sram2_text section. defined in linker script */
+.word	_esram2_text
+/* start address for the .sram2_bss section. defined in linker script */
+.word	_ssram2_bss
+/* end address for the .sram2_bss section. defined in linker script */
+.word	_esram2_bss
 
 .equ  BootRAM,        0xF1E0F85F
 /**
@@ -80,6 +91,23 @@ LoopCopyDataInit:
   adds r4, r0, r3
   cmp r4, r1
   bcc CopyDataInit
+
+/* Copy the SRAM2 code segment from flash to SRAM2 */
+  ldr r0, =_ssram2_text
+  ldr r1, =_esram2_text
+  ldr r2, =_sisram2_text
+  movs r3, #0
+  b LoopCopySram2Text
+
+CopySram2Text:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopySram2Text:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopySram2Text
   
 /* Zero fill the bss segment. */
   ldr r2, =_sbss
@@ -95,6 +123,36 @@ LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
 
+/* Zero fill the SRAM2 bss segment (also initializes SRAM2 parity bits). */
+  ldr r2, =_ssram2_bss
+  ldr r4, =_esram2_bss
+  movs r3, #0
+  b LoopFillZeroSram2bss
+
+FillZeroSram2bss:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopFillZeroSram2bss:
+  cmp r2, r4
+  bcc FillZeroSram2bss
+
+/* Paint the free RAM between the heap start and the current stack pointer
+   so mem_monitor can find the stack high-water mark. The pattern must match
+   MEM_MONITOR_PAINT in mem_monitor.h */
+  ldr r2, =_end
+  mov r4, sp
+  ldr r3, =0xC5C5C5C5
+  b LoopPaintStack
+
+PaintStack:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopPaintStack:
+  cmp r2, r4
+  bcc PaintStack
+
 /* Call static constructors */
     bl __libc_init_array
 /* Call the application's entry point.*/